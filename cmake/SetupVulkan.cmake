@@ -73,3 +73,8 @@ find_package(glslang CONFIG REQUIRED PATHS ${EMERAUDE_EXT_LIBS_PATH} NO_DEFAULT_
 
 # Headers are already included via ${EMERAUDE_EXT_LIBS_PATH}/include in the main CMakeLists.txt.
 target_link_libraries(${TARGET_BINARY_FOR_SETUP} PRIVATE glslang::SPIRV glslang::glslang)
+
+# SPIRV-Tools (optimizer and validator), already found by the glslang config above.
+message("Enabling SPIRV-Tools optimizer for the SPIR-V optimization stage ...")
+
+target_link_libraries(${TARGET_BINARY_FOR_SETUP} PRIVATE SPIRV-Tools-opt)
@@ -65,6 +65,7 @@
 #include "PlatformSpecific/Desktop/Dialog/Message.hpp"
 #include "SettingKeys.hpp"
 #include "Tool/GeometryDataPrinter.hpp"
+#include "Tool/ShaderBaker.hpp"
 #include "Tool/ShowVulkanInformation.hpp"
 
 namespace EmEn
@@ -322,10 +323,17 @@ namespace EmEn
 
 		Tracer::success(ClassId, "[THREAD] Rendering process terminated successfully !");
 
-		TraceInfo{ClassId} <<
+		TraceInfo trace{ClassId};
+
+		trace <<
 			"The rendering produced " << frames << " frames." "\n"
 			"Pipelines statistics : " << m_graphicsRenderer.pipelineBuiltCount() << " built during, " << m_graphicsRenderer.pipelineReusedCount() << " were re-used." "\n"
 			"Programs statistics : " << m_graphicsRenderer.programBuiltCount() << " built during, " << m_graphicsRenderer.programsReusedCount() << " were re-used.";
+
+		for ( const auto & [generatorLabel, count] : m_graphicsRenderer.programSpecializedCounts() )
+		{
+			trace << "\n" "\t" << generatorLabel << " : " << count << " specialized uber-shader variants.";
+		}
 	}
 
 	void
@@ -2293,6 +2301,13 @@ namespace EmEn
 			return EXIT_SUCCESS;
 		}
 
+		if ( tools == BakeShadersToolName )
+		{
+			Tool::ShaderBaker tool{m_primaryServices.arguments(), m_primaryServices};
+
+			return tool.execute() ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+
 		TraceWarning{ClassId} << "Unrecognized tools '" << tools << "' !";
 
 		return EXIT_FAILURE;
@@ -203,6 +203,7 @@ namespace EmEn
 			static constexpr auto VulkanInformationToolName{"vulkanInfo"}; ///< Displays Vulkan instance/device info.
 			static constexpr auto PrintGeometryToolName{"printGeometry"}; ///< Prints geometry file contents.
 			static constexpr auto ConvertGeometryToolName{"convertGeometry"};///< Converts between geometry formats.
+			static constexpr auto BakeShadersToolName{"bakeShaders"}; ///< Packs generated shader sources into a SPIR-V archive.
 			/** @} */
 
 			/**
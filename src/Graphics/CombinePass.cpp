@@ -27,6 +27,7 @@
 #include "CombinePass.hpp"
 
 /* STL inclusions. */
+#include <cstring>
 #include <sstream>
 #include <string>
 
@@ -40,7 +41,6 @@
 #include "Vulkan/DescriptorSetLayout.hpp"
 #include "Vulkan/LayoutManager.hpp"
 #include "Vulkan/PipelineLayout.hpp"
-#include "Vulkan/UniformBufferObject.hpp"
 
 static constexpr auto TracerTag{"CombinePass"};
 
@@ -266,8 +266,8 @@ namespace EmEn::Graphics
 			return nullptr;
 		}
 
-		/* Descriptor set layout: samplers + the dynamics UBO. */
-		auto descriptorSetLayout = this->getInputLayout(samplerCount, 1);
+		/* Descriptor set layout: samplers + the dynamics UBO, a dynamic binding on the frame ring allocator. */
+		auto descriptorSetLayout = this->getInputLayout(samplerCount, 1, true);
 
 		if ( descriptorSetLayout == nullptr )
 		{
@@ -300,7 +300,7 @@ namespace EmEn::Graphics
 			return nullptr;
 		}
 
-		/* Per-frame descriptor sets + dynamics uniform buffers. */
+		/* Per-frame descriptor sets. The dynamics live in the frame ring allocator. */
 		variant.descriptorSetsPerFrame = this->createPerFrameDescriptorSets(descriptorSetLayout, ClassId, shaderName.str() + "DescSet");
 
 		if ( variant.descriptorSetsPerFrame.empty() )
@@ -308,25 +308,7 @@ namespace EmEn::Graphics
 			return nullptr;
 		}
 
-		const VkDeviceSize uboSize = static_cast< VkDeviceSize >(contributions.size()) * DynamicsSlots * 4 * sizeof(float);
-
-		variant.uniformBuffersPerFrame = this->createPerFrameUniformBuffers(uboSize, ClassId, shaderName.str() + "Dynamics");
-
-		if ( variant.uniformBuffersPerFrame.empty() )
-		{
-			return nullptr;
-		}
-
-		/* Bind each per-frame UBO to its descriptor set once (binding = samplerCount). */
-		for ( size_t frameIndex = 0; frameIndex < variant.descriptorSetsPerFrame.size(); ++frameIndex )
-		{
-			if ( !variant.descriptorSetsPerFrame[frameIndex]->writeUniformBufferObject(samplerCount, *variant.uniformBuffersPerFrame[frameIndex]) )
-			{
-				TraceError{TracerTag} << "Failed to bind the combine dynamics UBO !";
-
-				return nullptr;
-			}
-		}
+		variant.dynamicsSize = static_cast< uint32_t >(contributions.size() * DynamicsSlots * 4 * sizeof(float));
 
 		return &variant;
 	}
@@ -341,6 +323,15 @@ namespace EmEn::Graphics
 			return inputColor;
 		}
 
+		auto * frameRingAllocator = this->renderer().frameRingAllocator();
+
+		if ( frameRingAllocator == nullptr )
+		{
+			TraceError{TracerTag} << "No frame ring allocator to hold the combine dynamics !";
+
+			return inputColor;
+		}
+
 		auto * variant = this->getOrCreateVariant(computeSignature(contributions), contributions);
 
 		if ( variant == nullptr )
@@ -407,7 +398,18 @@ namespace EmEn::Graphics
 			}
 		}
 
-		/* Upload this frame's dynamics. */
+		/* Write this group's dynamics in the frame ring allocator. Each group gets its own
+		 * allocation, so two groups of the same frame never overwrite each other. */
+		const auto allocation = frameRingAllocator->allocate(variant->dynamicsSize);
+
+		if ( !allocation.isValid() )
+		{
+			/* NOTE: The partition was full, the next frame grows it. */
+			TraceError{TracerTag} << "No room left in the frame ring allocator for the combine dynamics !";
+
+			return inputColor;
+		}
+
 		{
 			std::vector< float > dynamicsData(contributions.size() * DynamicsSlots * 4, 0.0F);
 
@@ -431,12 +433,15 @@ namespace EmEn::Graphics
 				}
 			}
 
-			if ( !updateUniformBufferData(*variant->uniformBuffersPerFrame[frameIndex], dynamicsData.data(), dynamicsData.size() * sizeof(float)) )
-			{
-				TraceError{TracerTag} << "Failed to upload the combine dynamics !";
+			std::memcpy(allocation.data, dynamicsData.data(), dynamicsData.size() * sizeof(float));
+		}
 
-				return inputColor;
-			}
+		/* NOTE: Rewritten every record, the ring buffer is replaced when it grows. */
+		if ( !descriptorSet.writeUniformBufferDynamic(binding, frameRingAllocator->descriptorInfo(variant->dynamicsSize)) )
+		{
+			TraceError{TracerTag} << "Failed to bind the combine dynamics !";
+
+			return inputColor;
 		}
 
 		auto & target = m_targets[groupIndex % m_targets.size()];
@@ -447,6 +452,7 @@ namespace EmEn::Graphics
 			*variant->pipeline,
 			*variant->pipelineLayout,
 			descriptorSet,
+			allocation.offset,
 			&context.constants,
 			sizeof(PostProcessor::PushConstants)
 		);
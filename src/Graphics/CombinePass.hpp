@@ -117,7 +117,7 @@ namespace EmEn::Graphics
 				std::shared_ptr< Vulkan::GraphicsPipeline > pipeline;
 				std::shared_ptr< Vulkan::PipelineLayout > pipelineLayout;
 				std::vector< std::unique_ptr< Vulkan::DescriptorSet > > descriptorSetsPerFrame;
-				std::vector< std::unique_ptr< Vulkan::UniformBufferObject > > uniformBuffersPerFrame;
+				uint32_t dynamicsSize{0};
 				uint32_t samplerCount{0};
 			};
 
@@ -1073,9 +1073,13 @@ namespace EmEn::Graphics::Effects::Framebuffer
 			{
 				const auto prevAdaptIdx = 1 - m_currentAdaptIndex;
 
-				/* Update the adaptation descriptor set with current ping-pong targets. */
-				static_cast< void >(m_adaptPerFrame[frameIndex]->writeCombinedImageSampler(0, *m_lumTargets.back()));
-				static_cast< void >(m_adaptPerFrame[frameIndex]->writeCombinedImageSampler(1, m_adaptTargets[prevAdaptIdx]));
+				/* Adaptation descriptor set with the current ping-pong targets. */
+				FrameDescriptorAllocator::Writes adaptWrites;
+				adaptWrites
+					.combinedImageSampler(0, *m_lumTargets.back())
+					.combinedImageSampler(1, m_adaptTargets[prevAdaptIdx]);
+
+				const auto adaptSet = this->frameDescriptorSet(*m_adaptPerFrame[frameIndex], adaptWrites);
 
 				const AdaptationPushConstants pc{
 					.deltaTime = deltaTime,
@@ -1089,7 +1093,7 @@ namespace EmEn::Graphics::Effects::Framebuffer
 					m_adaptTargets[m_currentAdaptIndex],
 					*m_adaptPipeline,
 					*m_adaptPipelineLayout,
-					*m_adaptPerFrame[frameIndex],
+					adaptSet,
 					&pc,
 					sizeof(pc)
 				);
@@ -1239,13 +1243,16 @@ namespace EmEn::Graphics::Effects::Framebuffer
 			m_meteredLuminance = 0.0F;
 
 			/* Tonemap-pass descriptor: binding 0 = HDR input, (bloom variant: binding 1 = glare). */
-			static_cast< void >(m_tonemapDescPerFrame[frameIndex]->writeCombinedImageSampler(0, inputColor));
+			FrameDescriptorAllocator::Writes tonemapWrites;
+			tonemapWrites.combinedImageSampler(0, inputColor);
 
 			if ( m_bloomSource != nullptr )
 			{
-				static_cast< void >(m_tonemapDescPerFrame[frameIndex]->writeCombinedImageSampler(1, m_bloomSource->bloomTexture()));
+				tonemapWrites.combinedImageSampler(1, m_bloomSource->bloomTexture());
 			}
 
+			const auto tonemapSet = this->frameDescriptorSet(*m_tonemapDescPerFrame[frameIndex], tonemapWrites);
+
 			const ToneMappingPushConstants pc{
 				.exposure = exposure,
 				.gamma = m_parameters.gamma,
@@ -1258,7 +1265,7 @@ namespace EmEn::Graphics::Effects::Framebuffer
 				m_outputTarget,
 				*m_pipeline,
 				*m_tonemapPipelineLayout,
-				*m_tonemapDescPerFrame[frameIndex],
+				tonemapSet,
 				&pc,
 				sizeof(pc)
 			);
@@ -0,0 +1,417 @@
+/*
+ * src/Graphics/FrameDescriptorAllocator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "FrameDescriptorAllocator.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <functional>
+#include <string>
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+#include "Vulkan/DescriptorPool.hpp"
+#include "Vulkan/DescriptorSetLayout.hpp"
+#include "Vulkan/Device.hpp"
+#include "Vulkan/Image.hpp"
+#include "Vulkan/ImageView.hpp"
+#include "Vulkan/Sampler.hpp"
+#include "Vulkan/TextureInterface.hpp"
+#include "Vulkan/Utility.hpp"
+
+namespace EmEn::Graphics
+{
+	using namespace Vulkan;
+
+	namespace
+	{
+		/**
+		 * @brief Mixes a value into a hash.
+		 * @param seed A reference to the hash.
+		 * @param value The value.
+		 * @return void
+		 */
+		void
+		hashCombine (size_t & seed, size_t value) noexcept
+		{
+			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+		}
+
+		/**
+		 * @brief Returns the descriptor counts of one pool, covering the layouts of the transient passes.
+		 * @param setsPerPool The number of sets in the pool.
+		 * @return std::vector< VkDescriptorPoolSize >
+		 */
+		[[nodiscard]]
+		std::vector< VkDescriptorPoolSize >
+		poolSizes (uint32_t setsPerPool) noexcept
+		{
+			return {
+				{VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, setsPerPool * 4},
+				{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, setsPerPool * 2},
+				{VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, setsPerPool},
+				{VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, setsPerPool * 2},
+				{VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, setsPerPool}
+			};
+		}
+	}
+
+	FrameDescriptorAllocator::Writes &
+	FrameDescriptorAllocator::Writes::combinedImageSampler (uint32_t binding, const TextureInterface & texture) noexcept
+	{
+		if ( !texture.isCreated() )
+		{
+			Tracer::error(ClassId, "The texture resource is not created !");
+
+			m_valid = false;
+
+			return *this;
+		}
+
+		auto * entry = this->next();
+
+		if ( entry != nullptr )
+		{
+			entry->binding = binding;
+			entry->type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+			entry->imageInfo.sampler = texture.sampler()->handle();
+			entry->imageInfo.imageView = texture.imageView()->handle();
+			entry->imageInfo.imageLayout = texture.image()->currentImageLayout();
+		}
+
+		return *this;
+	}
+
+	FrameDescriptorAllocator::Writes &
+	FrameDescriptorAllocator::Writes::addBuffer (uint32_t binding, VkDescriptorType type, const VkDescriptorBufferInfo & bufferInfo) noexcept
+	{
+		if ( bufferInfo.buffer == VK_NULL_HANDLE )
+		{
+			Tracer::error(ClassId, "The buffer is not created !");
+
+			m_valid = false;
+
+			return *this;
+		}
+
+		auto * entry = this->next();
+
+		if ( entry != nullptr )
+		{
+			entry->binding = binding;
+			entry->type = type;
+			entry->bufferInfo = bufferInfo;
+		}
+
+		return *this;
+	}
+
+	FrameDescriptorAllocator::Writes::Entry *
+	FrameDescriptorAllocator::Writes::next () noexcept
+	{
+		if ( m_count >= MaxWrites )
+		{
+			TraceError{ClassId} << "A transient descriptor set is limited to " << MaxWrites << " writes !";
+
+			m_valid = false;
+
+			return nullptr;
+		}
+
+		return &m_entries[m_count++];
+	}
+
+	void
+	FrameDescriptorAllocator::Writes::apply (VkDevice deviceHandle, VkDescriptorSet descriptorSetHandle) const noexcept
+	{
+		std::array< VkWriteDescriptorSet, MaxWrites > descriptorWrites{};
+
+		for ( size_t index = 0; index < m_count; ++index )
+		{
+			const auto & entry = m_entries[index];
+			auto & descriptorWrite = descriptorWrites[index];
+
+			descriptorWrite.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+			descriptorWrite.pNext = nullptr;
+			descriptorWrite.dstSet = descriptorSetHandle;
+			descriptorWrite.dstBinding = entry.binding;
+			descriptorWrite.dstArrayElement = 0;
+			descriptorWrite.descriptorCount = 1;
+			descriptorWrite.descriptorType = entry.type;
+
+			if ( entry.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER )
+			{
+				descriptorWrite.pImageInfo = &entry.imageInfo;
+			}
+			else
+			{
+				descriptorWrite.pBufferInfo = &entry.bufferInfo;
+			}
+		}
+
+		vkUpdateDescriptorSets(deviceHandle, static_cast< uint32_t >(m_count), descriptorWrites.data(), 0, nullptr);
+	}
+
+	size_t
+	FrameDescriptorAllocator::Writes::hash () const noexcept
+	{
+		size_t seed = m_count;
+
+		for ( size_t index = 0; index < m_count; ++index )
+		{
+			const auto & entry = m_entries[index];
+
+			hashCombine(seed, (static_cast< size_t >(entry.binding) << 32U) | static_cast< size_t >(entry.type));
+
+			if ( entry.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER )
+			{
+				hashCombine(seed, std::hash< const void * >{}(entry.imageInfo.imageView));
+				hashCombine(seed, std::hash< const void * >{}(entry.imageInfo.sampler));
+				hashCombine(seed, static_cast< size_t >(entry.imageInfo.imageLayout));
+			}
+			else
+			{
+				hashCombine(seed, std::hash< const void * >{}(entry.bufferInfo.buffer));
+				hashCombine(seed, static_cast< size_t >(entry.bufferInfo.offset));
+				hashCombine(seed, static_cast< size_t >(entry.bufferInfo.range));
+			}
+		}
+
+		return seed;
+	}
+
+	bool
+	FrameDescriptorAllocator::Writes::operator== (const Writes & operand) const noexcept
+	{
+		if ( m_count != operand.m_count )
+		{
+			return false;
+		}
+
+		/* NOTE: Field by field, the structures have padding bytes. */
+		return std::equal(m_entries.cbegin(), m_entries.cbegin() + static_cast< std::ptrdiff_t >(m_count), operand.m_entries.cbegin(), [] (const Entry & left, const Entry & right) {
+			if ( left.binding != right.binding || left.type != right.type )
+			{
+				return false;
+			}
+
+			if ( left.type == VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER )
+			{
+				return left.imageInfo.imageView == right.imageInfo.imageView &&
+					left.imageInfo.sampler == right.imageInfo.sampler &&
+					left.imageInfo.imageLayout == right.imageInfo.imageLayout;
+			}
+
+			return left.bufferInfo.buffer == right.bufferInfo.buffer &&
+				left.bufferInfo.offset == right.bufferInfo.offset &&
+				left.bufferInfo.range == right.bufferInfo.range;
+		});
+	}
+
+	FrameDescriptorAllocator::FrameDescriptorAllocator (const std::shared_ptr< Device > & device, uint32_t frameCount, uint32_t setsPerPool) noexcept
+		: m_device{device},
+		m_framePools(std::max(frameCount, 1U)),
+		m_setsPerPool{std::max(setsPerPool, 1U)}
+	{
+
+	}
+
+	FrameDescriptorAllocator::~FrameDescriptorAllocator () = default;
+
+	void
+	FrameDescriptorAllocator::beginFrame (uint32_t frameIndex) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		m_currentFrameIndex = frameIndex % static_cast< uint32_t >(m_framePools.size());
+
+		/* NOTE: The fence of this frame signaled, no command buffer reads its sets anymore. */
+		auto & pools = m_framePools[m_currentFrameIndex];
+
+		for ( auto & pool : pools )
+		{
+			if ( pool->reset() )
+			{
+				m_freePools.emplace_back(std::move(pool));
+			}
+		}
+
+		pools.clear();
+
+		/* NOTE: The cached sets belong to the previous frame, still in flight. */
+		m_cache.clear();
+
+		m_lastFrameRequests = m_frameRequests;
+		m_lastFrameAllocations = m_frameAllocations;
+		m_lastFrameCacheHits = m_frameCacheHits;
+		m_frameRequests = 0;
+		m_frameAllocations = 0;
+		m_frameCacheHits = 0;
+	}
+
+	VkDescriptorSet
+	FrameDescriptorAllocator::get (const DescriptorSetLayout & descriptorSetLayout, const Writes & writes) noexcept
+	{
+		if ( !writes.isValid() )
+		{
+			Tracer::error(ClassId, "Invalid descriptor writes, no set returned !");
+
+			return VK_NULL_HANDLE;
+		}
+
+		auto * layoutHandle = descriptorSetLayout.handle();
+
+		auto key = writes.hash();
+		hashCombine(key, std::hash< const void * >{}(layoutHandle));
+
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		m_frameRequests++;
+
+		auto & bucket = m_cache[key];
+
+		for ( const auto & cachedSet : bucket )
+		{
+			if ( cachedSet.layout == layoutHandle && cachedSet.writes == writes )
+			{
+				m_frameCacheHits++;
+				m_totalCacheHits++;
+
+				return cachedSet.handle;
+			}
+		}
+
+		auto * descriptorSetHandle = this->allocate(layoutHandle);
+
+		if ( descriptorSetHandle == VK_NULL_HANDLE )
+		{
+			return VK_NULL_HANDLE;
+		}
+
+		writes.apply(m_device->handle(), descriptorSetHandle);
+
+		bucket.emplace_back(CachedSet{layoutHandle, writes, descriptorSetHandle});
+
+		m_frameAllocations++;
+		m_totalAllocations++;
+
+		return descriptorSetHandle;
+	}
+
+	VkDescriptorSet
+	FrameDescriptorAllocator::allocate (VkDescriptorSetLayout layoutHandle) noexcept
+	{
+		auto & pools = m_framePools[m_currentFrameIndex];
+
+		VkDescriptorSetAllocateInfo allocateInfo{};
+		allocateInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+		allocateInfo.pNext = nullptr;
+		allocateInfo.descriptorSetCount = 1;
+		allocateInfo.pSetLayouts = &layoutHandle;
+
+		/* NOTE: Only the last pool of the frame can have room left, the previous ones ran out.
+		 * A full pool is not an error here, the allocation moves on to a fresh pool. */
+		for ( auto attempt = 0; attempt < 2; ++attempt )
+		{
+			if ( pools.empty() || attempt > 0 )
+			{
+				auto pool = this->acquirePool();
+
+				if ( pool == nullptr )
+				{
+					return VK_NULL_HANDLE;
+				}
+
+				pools.emplace_back(std::move(pool));
+			}
+
+			allocateInfo.descriptorPool = pools.back()->handle();
+
+			VkDescriptorSet descriptorSetHandle = VK_NULL_HANDLE;
+
+			const auto result = vkAllocateDescriptorSets(m_device->handle(), &allocateInfo, &descriptorSetHandle);
+
+			if ( result == VK_SUCCESS )
+			{
+				return descriptorSetHandle;
+			}
+
+			if ( result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL )
+			{
+				TraceError{ClassId} << "Unable to allocate a transient descriptor set : " << vkResultToCString(result) << " !";
+
+				return VK_NULL_HANDLE;
+			}
+		}
+
+		Tracer::error(ClassId, "A fresh pool is unable to hold the descriptor set, the layout exceeds the pool sizes !");
+
+		return VK_NULL_HANDLE;
+	}
+
+	std::unique_ptr< DescriptorPool >
+	FrameDescriptorAllocator::acquirePool () noexcept
+	{
+		if ( !m_freePools.empty() )
+		{
+			auto pool = std::move(m_freePools.back());
+
+			m_freePools.pop_back();
+
+			return pool;
+		}
+
+		auto pool = std::make_unique< DescriptorPool >(m_device, poolSizes(m_setsPerPool), m_setsPerPool);
+		pool->setIdentifier(ClassId, "Frame" + std::to_string(m_poolCount), "DescriptorPool");
+
+		if ( !pool->createOnHardware() )
+		{
+			Tracer::error(ClassId, "Unable to create a transient descriptor pool !");
+
+			return nullptr;
+		}
+
+		m_poolCount++;
+
+		return pool;
+	}
+
+	FrameDescriptorAllocator::Statistics
+	FrameDescriptorAllocator::statistics () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		return {
+			.lastFrameRequests = m_lastFrameRequests,
+			.lastFrameAllocations = m_lastFrameAllocations,
+			.lastFrameCacheHits = m_lastFrameCacheHits,
+			.totalAllocations = m_totalAllocations,
+			.totalCacheHits = m_totalCacheHits,
+			.poolCount = m_poolCount
+		};
+	}
+}
@@ -0,0 +1,337 @@
+/*
+ * src/Graphics/FrameDescriptorAllocator.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/* Third-party inclusions. */
+#include <vulkan/vulkan.h>
+
+/* Forward declarations. */
+namespace EmEn::Vulkan
+{
+	class DescriptorPool;
+	class DescriptorSetLayout;
+	class Device;
+	class TextureInterface;
+}
+
+namespace EmEn::Graphics
+{
+	/**
+	 * @brief Allocates the transient descriptor sets of a frame from pools reset in bulk.
+	 *
+	 * Each frame in flight owns the pools it allocated from during the frame. beginFrame(), called
+	 * right after the fence of that frame signaled, resets all of them with a single
+	 * vkResetDescriptorPool() each and puts them back in a shared free list. Sets are never freed
+	 * one at a time, so the pools do not fragment.
+	 *
+	 * Within a frame, a request with the same layout and the same writes as a previous one returns
+	 * the already written set: a pass recorded twice, or several passes reading the same inputs,
+	 * cost a hash lookup instead of an allocation and a vkUpdateDescriptorSets().
+	 *
+	 * @note The sets live one frame. Long-lived sets (materials, instances) still belong to the
+	 * renderer descriptor pool.
+	 * @since 0.9.53
+	 */
+	class EMEN_API FrameDescriptorAllocator final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"FrameDescriptorAllocator"};
+
+			/** @brief Default number of sets in one pool. */
+			static constexpr uint32_t DefaultSetsPerPool{256};
+
+			/**
+			 * @brief The descriptor writes of a set, compared and hashed field by field.
+			 */
+			class Writes final
+			{
+				public:
+
+					/** @brief The maximum number of bindings written in one set. */
+					static constexpr size_t MaxWrites{16};
+
+					/**
+					 * @brief Adds a combined image sampler write from a texture.
+					 * @note The image layout is the current one of the texture image.
+					 * @param binding The binding index.
+					 * @param texture A reference to the texture.
+					 * @return Writes &
+					 */
+					Writes & combinedImageSampler (uint32_t binding, const Vulkan::TextureInterface & texture) noexcept;
+
+					/**
+					 * @brief Adds a uniform buffer write.
+					 * @param binding The binding index.
+					 * @param bufferInfo A reference to the buffer range.
+					 * @return Writes &
+					 */
+					Writes &
+					uniformBuffer (uint32_t binding, const VkDescriptorBufferInfo & bufferInfo) noexcept
+					{
+						return this->addBuffer(binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, bufferInfo);
+					}
+
+					/**
+					 * @brief Adds a storage buffer write.
+					 * @param binding The binding index.
+					 * @param bufferInfo A reference to the buffer range.
+					 * @return Writes &
+					 */
+					Writes &
+					storageBuffer (uint32_t binding, const VkDescriptorBufferInfo & bufferInfo) noexcept
+					{
+						return this->addBuffer(binding, VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, bufferInfo);
+					}
+
+					/**
+					 * @brief Returns whether every write is valid and fits in the list.
+					 * @return bool
+					 */
+					[[nodiscard]]
+					bool
+					isValid () const noexcept
+					{
+						return m_valid;
+					}
+
+					/**
+					 * @brief Returns the number of writes.
+					 * @return size_t
+					 */
+					[[nodiscard]]
+					size_t
+					count () const noexcept
+					{
+						return m_count;
+					}
+
+					/**
+					 * @brief Writes the descriptors into a set.
+					 * @param deviceHandle The device handle.
+					 * @param descriptorSetHandle The descriptor set handle.
+					 * @return void
+					 */
+					void apply (VkDevice deviceHandle, VkDescriptorSet descriptorSetHandle) const noexcept;
+
+					/**
+					 * @brief Returns the hash of the writes.
+					 * @return size_t
+					 */
+					[[nodiscard]]
+					size_t hash () const noexcept;
+
+					/**
+					 * @brief Returns whether two lists hold the same writes in the same order.
+					 * @param operand A reference to the other list.
+					 * @return bool
+					 */
+					[[nodiscard]]
+					bool operator== (const Writes & operand) const noexcept;
+
+				private:
+
+					friend class FrameDescriptorAllocator;
+
+					/** @brief One binding write. */
+					struct Entry
+					{
+						VkDescriptorImageInfo imageInfo{};
+						VkDescriptorBufferInfo bufferInfo{};
+						uint32_t binding{0};
+						VkDescriptorType type{VK_DESCRIPTOR_TYPE_MAX_ENUM};
+					};
+
+					/**
+					 * @brief Adds a buffer write.
+					 * @param binding The binding index.
+					 * @param type The descriptor type.
+					 * @param bufferInfo A reference to the buffer range.
+					 * @return Writes &
+					 */
+					Writes & addBuffer (uint32_t binding, VkDescriptorType type, const VkDescriptorBufferInfo & bufferInfo) noexcept;
+
+					/**
+					 * @brief Reserves the next entry, or invalidates the list when it is full.
+					 * @return Entry *
+					 */
+					[[nodiscard]]
+					Entry * next () noexcept;
+
+					std::array< Entry, MaxWrites > m_entries{};
+					size_t m_count{0};
+					bool m_valid{true};
+			};
+
+			/** @brief The usage statistics. */
+			struct Statistics
+			{
+				/** @brief The number of sets requested by the last completed frame. */
+				uint64_t lastFrameRequests{0};
+				/** @brief The number of sets allocated by the last completed frame. */
+				uint64_t lastFrameAllocations{0};
+				/** @brief The number of requests served by the cache during the last completed frame. */
+				uint64_t lastFrameCacheHits{0};
+				/** @brief The number of sets allocated since the creation. */
+				uint64_t totalAllocations{0};
+				/** @brief The number of requests served by the cache since the creation. */
+				uint64_t totalCacheHits{0};
+				/** @brief The number of pools created. */
+				uint32_t poolCount{0};
+
+				/**
+				 * @brief Returns the ratio of requests served by the cache since the creation.
+				 * @return float
+				 */
+				[[nodiscard]]
+				float
+				cacheHitRate () const noexcept
+				{
+					const auto requests = totalAllocations + totalCacheHits;
+
+					return requests > 0 ? static_cast< float >(totalCacheHits) / static_cast< float >(requests) : 0.0F;
+				}
+			};
+
+			/**
+			 * @brief Constructs a frame descriptor allocator.
+			 * @param device A reference to the device smart pointer.
+			 * @param frameCount The number of frames in flight.
+			 * @param setsPerPool The number of sets in one pool. Default 256.
+			 */
+			FrameDescriptorAllocator (const std::shared_ptr< Vulkan::Device > & device, uint32_t frameCount, uint32_t setsPerPool = DefaultSetsPerPool) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			FrameDescriptorAllocator (const FrameDescriptorAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			FrameDescriptorAllocator (FrameDescriptorAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return FrameDescriptorAllocator &
+			 */
+			FrameDescriptorAllocator & operator= (const FrameDescriptorAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return FrameDescriptorAllocator &
+			 */
+			FrameDescriptorAllocator & operator= (FrameDescriptorAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the frame descriptor allocator.
+			 */
+			~FrameDescriptorAllocator ();
+
+			/**
+			 * @brief Releases the sets of a frame in flight and makes it the current one.
+			 * @note Call from the render thread, right after the frame fence wait.
+			 * @param frameIndex The frame-in-flight index.
+			 * @return void
+			 */
+			void beginFrame (uint32_t frameIndex) noexcept;
+
+			/**
+			 * @brief Returns a descriptor set of the current frame holding the writes.
+			 * @note Thread-safe. The set is valid until the next beginFrame() of the same frame index.
+			 * @param descriptorSetLayout A reference to the descriptor set layout.
+			 * @param writes A reference to the writes.
+			 * @return VkDescriptorSet A null handle on failure.
+			 */
+			[[nodiscard]]
+			VkDescriptorSet get (const Vulkan::DescriptorSetLayout & descriptorSetLayout, const Writes & writes) noexcept;
+
+			/**
+			 * @brief Returns the usage statistics.
+			 * @return Statistics
+			 */
+			[[nodiscard]]
+			Statistics statistics () const noexcept;
+
+		private:
+
+			/** @brief A set written during the current frame. */
+			struct CachedSet
+			{
+				VkDescriptorSetLayout layout{VK_NULL_HANDLE};
+				Writes writes;
+				VkDescriptorSet handle{VK_NULL_HANDLE};
+			};
+
+			/**
+			 * @brief Allocates a set from the pools of the current frame, taking a new pool when they are full.
+			 * @param layoutHandle The descriptor set layout handle.
+			 * @return VkDescriptorSet
+			 */
+			[[nodiscard]]
+			VkDescriptorSet allocate (VkDescriptorSetLayout layoutHandle) noexcept;
+
+			/**
+			 * @brief Takes a pool from the free list, or creates one.
+			 * @return std::unique_ptr< Vulkan::DescriptorPool >
+			 */
+			[[nodiscard]]
+			std::unique_ptr< Vulkan::DescriptorPool > acquirePool () noexcept;
+
+			std::shared_ptr< Vulkan::Device > m_device;
+			std::vector< std::vector< std::unique_ptr< Vulkan::DescriptorPool > > > m_framePools;
+			std::vector< std::unique_ptr< Vulkan::DescriptorPool > > m_freePools;
+			std::unordered_map< size_t, std::vector< CachedSet > > m_cache;
+			mutable std::mutex m_access;
+			uint64_t m_frameRequests{0};
+			uint64_t m_frameAllocations{0};
+			uint64_t m_frameCacheHits{0};
+			uint64_t m_lastFrameRequests{0};
+			uint64_t m_lastFrameAllocations{0};
+			uint64_t m_lastFrameCacheHits{0};
+			uint64_t m_totalAllocations{0};
+			uint64_t m_totalCacheHits{0};
+			uint32_t m_setsPerPool;
+			uint32_t m_currentFrameIndex{0};
+			uint32_t m_poolCount{0};
+	};
+}
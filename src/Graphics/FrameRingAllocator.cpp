@@ -0,0 +1,284 @@
+/*
+ * src/Graphics/FrameRingAllocator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "FrameRingAllocator.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+#include "Vulkan/Buffer.hpp"
+#include "Vulkan/DeferredDestructor.hpp"
+#include "Vulkan/Device.hpp"
+
+namespace EmEn::Graphics
+{
+	using namespace Vulkan;
+
+	namespace
+	{
+		/**
+		 * @brief Rounds a size up to a multiple of an alignment.
+		 * @param size The size.
+		 * @param alignment The alignment. Must be a power of two.
+		 * @return VkDeviceSize
+		 */
+		[[nodiscard]]
+		constexpr
+		VkDeviceSize
+		alignUp (VkDeviceSize size, VkDeviceSize alignment) noexcept
+		{
+			return (size + alignment - 1) & ~(alignment - 1);
+		}
+	}
+
+	FrameRingAllocator::FrameRingAllocator (const std::shared_ptr< Device > & device, DeferredDestructor * deferredDestructor, uint32_t partitionCount, VkDeviceSize partitionSize) noexcept
+		: m_device{device},
+		m_deferredDestructor{deferredDestructor},
+		m_partitionSize{partitionSize},
+		m_partitionCount{std::max(partitionCount, 1U)}
+	{
+
+	}
+
+	FrameRingAllocator::~FrameRingAllocator ()
+	{
+		this->retireBuffer();
+	}
+
+	bool
+	FrameRingAllocator::createOnHardware () noexcept
+	{
+		if ( m_device == nullptr )
+		{
+			Tracer::error(ClassId, "No device to create the ring buffer !");
+
+			return false;
+		}
+
+		/* NOTE: The same offsets serve uniform and storage dynamic descriptors,
+		 * both alignments are powers of two, so the largest satisfies both. */
+		const auto & limits = m_device->physicalDevice()->propertiesVK10().limits;
+
+		m_alignment = std::max({limits.minUniformBufferOffsetAlignment, limits.minStorageBufferOffsetAlignment, VkDeviceSize{16}});
+
+		return this->resize(m_partitionCount, m_partitionSize);
+	}
+
+	bool
+	FrameRingAllocator::resize (uint32_t partitionCount, VkDeviceSize partitionSize) noexcept
+	{
+		partitionSize = alignUp(partitionSize, m_alignment);
+
+		/* NOTE: Dynamic offsets are 32 bits wide. */
+		if ( partitionSize * partitionCount > std::numeric_limits< uint32_t >::max() )
+		{
+			TraceError{ClassId} << "A ring buffer of " << partitionCount << " x " << partitionSize << " bytes exceeds the dynamic offset range !";
+
+			return false;
+		}
+
+		auto buffer = std::make_shared< Buffer >(m_device, 0, partitionSize * partitionCount, VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, true);
+		buffer->setIdentifier(ClassId, "Ring", "Buffer");
+
+		if ( !buffer->createOnHardware() )
+		{
+			TraceError{ClassId} << "Unable to create a ring buffer of " << partitionCount << " x " << partitionSize << " bytes !";
+
+			return false;
+		}
+
+		auto * mappedData = buffer->mapMemoryAs< std::byte >();
+
+		if ( mappedData == nullptr )
+		{
+			TraceError{ClassId} << "Unable to map the ring buffer !";
+
+			return false;
+		}
+
+		this->retireBuffer();
+
+		m_buffer = std::move(buffer);
+		m_mappedData = mappedData;
+		m_partitionCount = partitionCount;
+		m_partitionSize = partitionSize;
+		m_partitionOffset = 0;
+		m_flushedCursor = 0;
+		m_cursor.store(0, std::memory_order_release);
+		m_generation++;
+
+		return true;
+	}
+
+	void
+	FrameRingAllocator::retireBuffer () noexcept
+	{
+		if ( m_buffer == nullptr )
+		{
+			return;
+		}
+
+		m_mappedData = nullptr;
+
+		const auto bytes = m_buffer->bytes();
+
+		/* NOTE: Other partitions of the buffer may still be read by frames in flight. */
+		auto retire = [buffer = std::move(m_buffer)] () {
+			buffer->unmapMemory();
+		};
+
+		if ( m_deferredDestructor != nullptr )
+		{
+			m_deferredDestructor->retireAction(std::move(retire), bytes);
+		}
+		else
+		{
+			retire();
+		}
+	}
+
+	void
+	FrameRingAllocator::beginFrame (uint32_t frameIndex) noexcept
+	{
+		if ( m_buffer == nullptr )
+		{
+			return;
+		}
+
+		/* NOTE: Usage of the frame recorded in the current partition, including the refused bytes. */
+		const auto missingBytes = m_missingBytes.exchange(0, std::memory_order_relaxed);
+
+		m_lastFrameUsage = std::min(m_cursor.load(std::memory_order_acquire), m_partitionSize) + missingBytes;
+		m_highWaterMark = std::max(m_highWaterMark, m_lastFrameUsage);
+
+		if ( missingBytes > 0 || frameIndex >= m_partitionCount )
+		{
+			const auto partitionCount = std::max(m_partitionCount, frameIndex + 1);
+			const auto partitionSize = missingBytes > 0 ? std::bit_ceil(m_lastFrameUsage) : m_partitionSize;
+
+			if ( this->resize(partitionCount, partitionSize) )
+			{
+				if ( missingBytes > 0 )
+				{
+					m_growthCount++;
+
+					TraceInfo{ClassId} << "A frame needed " << m_lastFrameUsage << " bytes, partitions grown to " << m_partitionSize << " bytes.";
+				}
+			}
+			else if ( frameIndex >= m_partitionCount )
+			{
+				/* NOTE: Without a partition for this frame, nothing can be allocated safely. */
+				this->retireBuffer();
+
+				return;
+			}
+		}
+
+		m_partitionOffset = static_cast< VkDeviceSize >(frameIndex) * m_partitionSize;
+		m_flushedCursor = 0;
+		m_cursor.store(0, std::memory_order_release);
+	}
+
+	FrameRingAllocator::Allocation
+	FrameRingAllocator::allocate (uint32_t size) noexcept
+	{
+		if ( m_mappedData == nullptr || size == 0 )
+		{
+			return {};
+		}
+
+		/* NOTE: Every size is rounded to the alignment, so every cursor value stays aligned. */
+		const auto alignedSize = alignUp(size, m_alignment);
+
+		auto cursor = m_cursor.load(std::memory_order_relaxed);
+
+		do
+		{
+			if ( cursor + alignedSize > m_partitionSize )
+			{
+				m_missingBytes.fetch_add(alignedSize, std::memory_order_relaxed);
+				m_failedAllocationCount.fetch_add(1, std::memory_order_relaxed);
+
+				return {};
+			}
+		}
+		while ( !m_cursor.compare_exchange_weak(cursor, cursor + alignedSize, std::memory_order_acq_rel, std::memory_order_relaxed) );
+
+		const auto offset = m_partitionOffset + cursor;
+
+		return {
+			.offset = static_cast< uint32_t >(offset),
+			.size = size,
+			.data = m_mappedData + offset
+		};
+	}
+
+	void
+	FrameRingAllocator::flush () noexcept
+	{
+		if ( m_buffer == nullptr )
+		{
+			return;
+		}
+
+		const auto cursor = std::min(m_cursor.load(std::memory_order_acquire), m_partitionSize);
+
+		if ( cursor > m_flushedCursor )
+		{
+			m_buffer->flushMemory(m_partitionOffset + m_flushedCursor, cursor - m_flushedCursor);
+
+			m_flushedCursor = cursor;
+		}
+	}
+
+	VkDescriptorBufferInfo
+	FrameRingAllocator::descriptorInfo (VkDeviceSize range) const noexcept
+	{
+		if ( m_buffer == nullptr )
+		{
+			return {};
+		}
+
+		return m_buffer->getDescriptorInfo(0, static_cast< uint32_t >(range));
+	}
+
+	FrameRingAllocator::Statistics
+	FrameRingAllocator::statistics () const noexcept
+	{
+		return {
+			.partitionSize = m_partitionSize,
+			.lastFrameUsage = m_lastFrameUsage,
+			.highWaterMark = m_highWaterMark,
+			.failedAllocationCount = m_failedAllocationCount.load(std::memory_order_relaxed),
+			.growthCount = m_growthCount
+		};
+	}
+}
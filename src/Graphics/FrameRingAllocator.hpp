@@ -0,0 +1,294 @@
+/*
+ * src/Graphics/FrameRingAllocator.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+/* Third-party inclusions. */
+#include <vulkan/vulkan.h>
+
+/* Forward declarations. */
+namespace EmEn::Vulkan
+{
+	class Buffer;
+	class DeferredDestructor;
+	class Device;
+}
+
+namespace EmEn::Graphics
+{
+	/**
+	 * @brief A persistently mapped ring buffer for the transient uniform and storage data of a frame.
+	 *
+	 * The buffer is split in one partition per frame in flight. Allocations bump an atomic cursor in
+	 * the partition of the current frame, so any recording thread can allocate without a lock. Each
+	 * allocation is aligned to the device uniform and storage buffer offset alignments: its offset
+	 * is directly usable as a dynamic offset against a descriptor set pointing at the buffer.
+	 *
+	 * A partition is recycled by beginFrame(), called right after the fence of its frame signaled.
+	 * When a frame runs out of space, the allocation fails and the missing bytes are counted; the
+	 * next beginFrame() grows every partition to fit (power of two) and retires the previous buffer
+	 * through the deferred destructor.
+	 *
+	 * @note The data lives one frame. Long-lived data still belongs to SharedUniformBuffer seats.
+	 * @note Consumers owning a descriptor set on the buffer must rewrite it when generation() changes.
+	 * @since 0.9.53
+	 */
+	class EMEN_API FrameRingAllocator final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"FrameRingAllocator"};
+
+			/** @brief Default size of one frame partition, in bytes. */
+			static constexpr VkDeviceSize DefaultPartitionSize{1024 * 1024};
+
+			/** @brief A transient allocation. Invalid (null data) when the frame partition is full. */
+			struct Allocation
+			{
+				/** @brief The offset from the buffer start, used as the dynamic offset. */
+				uint32_t offset{0};
+				/** @brief The requested size in bytes. */
+				uint32_t size{0};
+				/** @brief The mapped memory to write the data to. */
+				std::byte * data{nullptr};
+
+				/**
+				 * @brief Returns whether the allocation succeeded.
+				 * @return bool
+				 */
+				[[nodiscard]]
+				bool
+				isValid () const noexcept
+				{
+					return data != nullptr;
+				}
+			};
+
+			/** @brief The usage statistics, in bytes. */
+			struct Statistics
+			{
+				/** @brief The size of one frame partition. */
+				VkDeviceSize partitionSize{0};
+				/** @brief The bytes used by the last completed frame, including the missing ones. */
+				VkDeviceSize lastFrameUsage{0};
+				/** @brief The highest usage of a frame since the creation. */
+				VkDeviceSize highWaterMark{0};
+				/** @brief The number of allocations refused because a partition was full. */
+				uint64_t failedAllocationCount{0};
+				/** @brief The number of times the buffer grew. */
+				uint32_t growthCount{0};
+			};
+
+			/**
+			 * @brief Constructs a frame ring allocator.
+			 * @param device A reference to the device smart pointer.
+			 * @param deferredDestructor A pointer to the renderer deferred-destruction queue.
+			 * @param partitionCount The number of partitions, one per frame in flight.
+			 * @param partitionSize The initial size of one partition in bytes. Default 1 MiB.
+			 */
+			FrameRingAllocator (const std::shared_ptr< Vulkan::Device > & device, Vulkan::DeferredDestructor * deferredDestructor, uint32_t partitionCount, VkDeviceSize partitionSize = DefaultPartitionSize) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			FrameRingAllocator (const FrameRingAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			FrameRingAllocator (FrameRingAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return FrameRingAllocator &
+			 */
+			FrameRingAllocator & operator= (const FrameRingAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return FrameRingAllocator &
+			 */
+			FrameRingAllocator & operator= (FrameRingAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the frame ring allocator.
+			 */
+			~FrameRingAllocator ();
+
+			/**
+			 * @brief Creates and maps the ring buffer.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool createOnHardware () noexcept;
+
+			/**
+			 * @brief Recycles the partition of a frame in flight and makes it the current one.
+			 * @note Call from the render thread, right after the frame fence wait. Grows the
+			 * buffer if the previous frame ran out of space.
+			 * @param frameIndex The frame-in-flight index.
+			 * @return void
+			 */
+			void beginFrame (uint32_t frameIndex) noexcept;
+
+			/**
+			 * @brief Allocates transient memory in the partition of the current frame.
+			 * @note Thread-safe and lock-free.
+			 * @param size The size in bytes.
+			 * @return Allocation
+			 */
+			[[nodiscard]]
+			Allocation allocate (uint32_t size) noexcept;
+
+			/**
+			 * @brief Allocates transient memory and copies a structure in it.
+			 * @tparam data_t The type of the structure. Must be trivially copyable.
+			 * @param data A reference to the structure.
+			 * @return Allocation
+			 */
+			template< typename data_t >
+			[[nodiscard]]
+			Allocation
+			push (const data_t & data) noexcept
+			{
+				static_assert(std::is_trivially_copyable_v< data_t >, "The data must be trivially copyable !");
+
+				const auto allocation = this->allocate(sizeof(data_t));
+
+				if ( allocation.isValid() )
+				{
+					std::memcpy(allocation.data, &data, sizeof(data_t));
+				}
+
+				return allocation;
+			}
+
+			/**
+			 * @brief Makes the data written since the last flush visible to the device.
+			 * @note Call from the render thread before each queue submission of the frame.
+			 * This is a no-op on host-coherent memory.
+			 * @return void
+			 */
+			void flush () noexcept;
+
+			/**
+			 * @brief Returns the ring buffer.
+			 * @note The buffer changes when it grows, see generation().
+			 * @return const Vulkan::Buffer *
+			 */
+			[[nodiscard]]
+			const Vulkan::Buffer *
+			buffer () const noexcept
+			{
+				return m_buffer.get();
+			}
+
+			/**
+			 * @brief Returns the buffer generation, incremented each time the buffer is replaced.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			generation () const noexcept
+			{
+				return m_generation;
+			}
+
+			/**
+			 * @brief Returns the descriptor info for a dynamic descriptor on the buffer.
+			 * @param range The size of the data read by one draw.
+			 * @return VkDescriptorBufferInfo
+			 */
+			[[nodiscard]]
+			VkDescriptorBufferInfo descriptorInfo (VkDeviceSize range) const noexcept;
+
+			/**
+			 * @brief Returns the offset alignment of the allocations.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize
+			alignment () const noexcept
+			{
+				return m_alignment;
+			}
+
+			/**
+			 * @brief Returns the usage statistics.
+			 * @return Statistics
+			 */
+			[[nodiscard]]
+			Statistics statistics () const noexcept;
+
+		private:
+
+			/**
+			 * @brief Replaces the buffer with a new one, retiring the previous buffer.
+			 * @param partitionCount The number of partitions.
+			 * @param partitionSize The size of one partition in bytes.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool resize (uint32_t partitionCount, VkDeviceSize partitionSize) noexcept;
+
+			/**
+			 * @brief Unmaps the current buffer and hands it to the deferred destructor.
+			 * @return void
+			 */
+			void retireBuffer () noexcept;
+
+			std::shared_ptr< Vulkan::Device > m_device;
+			Vulkan::DeferredDestructor * m_deferredDestructor{nullptr};
+			std::shared_ptr< Vulkan::Buffer > m_buffer;
+			std::byte * m_mappedData{nullptr};
+			VkDeviceSize m_alignment{1};
+			VkDeviceSize m_partitionSize;
+			VkDeviceSize m_partitionOffset{0};
+			VkDeviceSize m_flushedCursor{0};
+			VkDeviceSize m_highWaterMark{0};
+			VkDeviceSize m_lastFrameUsage{0};
+			std::atomic< VkDeviceSize > m_cursor{0};
+			std::atomic< VkDeviceSize > m_missingBytes{0};
+			std::atomic< uint64_t > m_failedAllocationCount{0};
+			uint32_t m_partitionCount;
+			uint32_t m_generation{0};
+			uint32_t m_growthCount{0};
+	};
+}
@@ -344,10 +344,14 @@ namespace EmEn::Graphics::Geometry
 			m_vertexBufferObject.reset();
 		}
 
-		if ( m_pendingDestructionVBO != nullptr )
 		{
-			m_pendingDestructionVBO->destroyFromHardware();
-			m_pendingDestructionVBO.reset();
+			const std::lock_guard< std::mutex > lock{m_incomingVBOAccess};
+
+			if ( m_incomingVBO != nullptr )
+			{
+				m_incomingVBO->destroyFromHardware();
+				m_incomingVBO.reset();
+			}
 		}
 
 		if ( m_indexBufferObject != nullptr )
@@ -689,13 +693,6 @@ namespace EmEn::Graphics::Geometry
 		/* Mark as updating. */
 		m_isUpdating.store(true, std::memory_order_release);
 
-		/* Destroy the previously pending VBO (safe now, it's been at least one frame). */
-		if ( m_pendingDestructionVBO != nullptr )
-		{
-			m_pendingDestructionVBO->destroyFromHardware();
-			m_pendingDestructionVBO.reset();
-		}
-
 		/* Overwrite local data. */
 		m_localData = grid;
 
@@ -746,9 +743,40 @@ namespace EmEn::Graphics::Geometry
 			return false;
 		}
 
-		/* Swap VBOs: new one becomes active, old one is queued for deferred destruction. */
-		std::swap(m_vertexBufferObject, newVBO);
-		m_pendingDestructionVBO = std::move(newVBO);
+		/* NOTE: The active VBO keeps being drawn while the new one is uploaded.
+		 * The swap happens on the rendering thread at the next frame begin, see commitBackgroundUpdate(). */
+		{
+			const std::lock_guard< std::mutex > lock{m_incomingVBOAccess};
+
+			m_incomingVBO = std::move(newVBO);
+		}
+
+		this->serviceProvider().graphicsRenderer().scheduleGeometryCommit(std::static_pointer_cast< const AdaptiveVertexGridResource >(this->shared_from_this()));
+
+		return true;
+	}
+
+	bool
+	AdaptiveVertexGridResource::commitBackgroundUpdate () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_incomingVBOAccess};
+
+		if ( m_incomingVBO == nullptr )
+		{
+			return true;
+		}
+
+		auto & renderer = this->serviceProvider().graphicsRenderer();
+
+		if ( !renderer.transferManager().isTransferComplete(m_incomingVBO->transferTicket()) )
+		{
+			return false;
+		}
+
+		/* Swap VBOs: new one becomes active, old one is retired until the frames using it are complete. */
+		std::swap(m_vertexBufferObject, m_incomingVBO);
+
+		renderer.deferredDestructor().retireObject(std::move(m_incomingVBO));
 
 		m_isUpdating.store(false, std::memory_order_release);
 
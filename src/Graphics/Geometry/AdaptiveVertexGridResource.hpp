@@ -33,6 +33,7 @@
 #include <array>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 /* Local inclusions for inheritances. */
@@ -446,7 +447,8 @@ namespace EmEn::Graphics::Geometry
 
 			/**
 			 * @brief Updates the geometry with new grid data.
-			 * @note The grid must have the same point count as the current local data.
+			 * @note The grid must have the same point count as the current local data. The new vertex buffer
+			 * is drawn once its upload is complete (see commitBackgroundUpdate()), the previous one until then.
 			 * @param grid A reference to the new grid data.
 			 * @return bool True if update succeeded.
 			 */
@@ -479,6 +481,9 @@ namespace EmEn::Graphics::Geometry
 			[[nodiscard]]
 			std::array< uint32_t, 2 > getAdaptiveDrawCallRange (uint32_t drawCallIndex, const Base::Math::Vector< 3, float > & viewPosition) const noexcept override;
 
+			/** @copydoc EmEn::Graphics::Geometry::Interface::commitBackgroundUpdate() */
+			bool commitBackgroundUpdate () const noexcept override;
+
 			/** @copydoc EmEn::Graphics::Geometry::Interface::prepareAdaptiveRendering() */
 			void prepareAdaptiveRendering (const Base::Math::Vector< 3, float > & viewPosition) const noexcept override;
 
@@ -537,8 +542,8 @@ namespace EmEn::Graphics::Geometry
 			[[nodiscard]]
 			uint32_t addVertexToBuffer (uint32_t pointIndex, std::vector< float > & vertexAttributes, uint32_t vertexElementCount) const noexcept;
 
-			/* Vulkan buffers. */
-			std::unique_ptr< Vulkan::VertexBufferObject > m_vertexBufferObject;
+			/* Vulkan buffers. NOTE: The vertex buffer is swapped by commitBackgroundUpdate() on the rendering thread, before any recording. */
+			mutable std::unique_ptr< Vulkan::VertexBufferObject > m_vertexBufferObject;
 			std::unique_ptr< Vulkan::IndexBufferObject > m_indexBufferObject;
 			/* Local data. */
 			Base::VertexFactory::Grid< float > m_localData;
@@ -556,9 +561,10 @@ namespace EmEn::Graphics::Geometry
 			float m_lodBaseMultiplier{0.125F};
 			float m_lodThresholdGrowth{2.0F};
 			/* Thread safety for VBO updates. */
-			std::atomic< bool > m_isUpdating{false};
-			/* Deferred VBO destruction (to avoid Vulkan use-after-free). */
-			std::unique_ptr< Vulkan::VertexBufferObject > m_pendingDestructionVBO;
+			mutable std::atomic< bool > m_isUpdating{false};
+			/* VBO of a background update, waiting for its upload to complete. */
+			mutable std::mutex m_incomingVBOAccess;
+			mutable std::unique_ptr< Vulkan::VertexBufferObject > m_incomingVBO;
 			/* Cached stitching data (updated by prepareAdaptiveRendering()). */
 			mutable std::vector< uint32_t > m_cachedSectorLODs;
 			mutable std::vector< std::array< uint32_t, 2 > > m_cachedStitchingDrawCalls;
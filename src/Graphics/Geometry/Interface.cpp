@@ -252,6 +252,15 @@ namespace EmEn::Graphics::Geometry
 			}
 		}
 
+		/* NOTE: The vertex and index uploads are batched on the rendering queue,
+		 * the BLAS build is submitted elsewhere and must find them complete. */
+		if ( !this->serviceProvider().graphicsRenderer().transferManager().waitPendingTransfers() )
+		{
+			TraceError{TracerTag} << "Unable to complete the buffer uploads before building the BLAS for geometry '" << this->name() << "' !";
+
+			return;
+		}
+
 		m_accelerationStructure = accelerationStructureBuilder->buildBLAS(geometries);
 
 		if ( m_accelerationStructure == nullptr )
@@ -260,6 +269,24 @@ namespace EmEn::Graphics::Geometry
 		}
 	}
 
+	bool
+	Interface::isUploadComplete () const noexcept
+	{
+		const auto & transferManager = this->serviceProvider().graphicsRenderer().transferManager();
+
+		if ( const auto * vbo = this->vertexBufferObject(); vbo != nullptr && !transferManager.isTransferComplete(vbo->transferTicket()) )
+		{
+			return false;
+		}
+
+		if ( const auto * ibo = this->indexBufferObject(); ibo != nullptr && !transferManager.isTransferComplete(ibo->transferTicket()) )
+		{
+			return false;
+		}
+
+		return true;
+	}
+
 	bool
 	Interface::onDependenciesLoaded () noexcept
 	{
@@ -274,6 +274,27 @@ namespace EmEn::Graphics::Geometry
 			[[nodiscard]]
 			virtual bool useIndexBuffer () const noexcept = 0;
 
+			/**
+			 * @brief Returns whether the uploads of the vertex and index buffers can be read by the rendering queue.
+			 * @note Always true unless the uploads run on a dedicated transfer queue.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isUploadComplete () const noexcept;
+
+			/**
+			 * @brief Switches to the buffers of a background update once their upload is complete.
+			 * @note Called by Graphics::Renderer::commitGeometryUpdates() on the rendering thread, before any
+			 * command buffer is recorded. Until then, the previous buffers are drawn.
+			 * @return bool True when no update is waiting anymore.
+			 */
+			virtual
+			bool
+			commitBackgroundUpdate () const noexcept
+			{
+				return true;
+			}
+
 			/**
 			 * @brief Creates the geometry in the video memory from the local data.
 			 * @param transferManager A reference to the transfer manager.
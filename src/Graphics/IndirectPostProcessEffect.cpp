@@ -38,6 +38,7 @@
 #include "Vulkan/CommandBuffer.hpp"
 #include "Vulkan/DescriptorSet.hpp"
 #include "Vulkan/DescriptorSetLayout.hpp"
+#include "Vulkan/Device.hpp"
 #include "Vulkan/Framebuffer.hpp"
 #include "Vulkan/GraphicsPipeline.hpp"
 #include "Vulkan/LayoutManager.hpp"
@@ -189,6 +190,38 @@ namespace EmEn::Graphics
 
 	void
 	IndirectPostProcessEffect::recordFullscreenPass (const CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const GraphicsPipeline & pipeline, const PipelineLayout & pipelineLayout, const DescriptorSet & descriptorSet, const void * pushConstants, uint32_t pushConstantsSize, const DescriptorSet * bindlessSet) noexcept
+	{
+		recordFullscreenPass(commandBuffer, target, pipeline, pipelineLayout, descriptorSet.handle(), pushConstants, pushConstantsSize, bindlessSet);
+	}
+
+	void
+	IndirectPostProcessEffect::recordFullscreenPass (const CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const GraphicsPipeline & pipeline, const PipelineLayout & pipelineLayout, VkDescriptorSet descriptorSetHandle, const void * pushConstants, uint32_t pushConstantsSize, const DescriptorSet * bindlessSet) noexcept
+	{
+		beginFullscreenPass(commandBuffer, target, pipeline, pipelineLayout, pushConstants, pushConstantsSize);
+
+		commandBuffer.bind(descriptorSetHandle, pipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS, 0);
+
+		/* Optional: the global bindless table (reserved IBL/environment slots) at set 1. */
+		if ( bindlessSet != nullptr )
+		{
+			commandBuffer.bind(*bindlessSet, pipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS, 1);
+		}
+
+		endFullscreenPass(commandBuffer, target);
+	}
+
+	void
+	IndirectPostProcessEffect::recordFullscreenPass (const CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const GraphicsPipeline & pipeline, const PipelineLayout & pipelineLayout, const DescriptorSet & descriptorSet, uint32_t dynamicOffset, const void * pushConstants, uint32_t pushConstantsSize) noexcept
+	{
+		beginFullscreenPass(commandBuffer, target, pipeline, pipelineLayout, pushConstants, pushConstantsSize);
+
+		commandBuffer.bind(descriptorSet, pipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS, 0, dynamicOffset);
+
+		endFullscreenPass(commandBuffer, target);
+	}
+
+	void
+	IndirectPostProcessEffect::beginFullscreenPass (const CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const GraphicsPipeline & pipeline, const PipelineLayout & pipelineLayout, const void * pushConstants, uint32_t pushConstantsSize) noexcept
 	{
 		target.beginRenderPass(commandBuffer);
 
@@ -222,15 +255,11 @@ namespace EmEn::Graphics
 				pushConstants
 			);
 		}
+	}
 
-		commandBuffer.bind(descriptorSet, pipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS, 0);
-
-		/* Optional: the global bindless table (reserved IBL/environment slots) at set 1. */
-		if ( bindlessSet != nullptr )
-		{
-			commandBuffer.bind(*bindlessSet, pipelineLayout, VK_PIPELINE_BIND_POINT_GRAPHICS, 1);
-		}
-
+	void
+	IndirectPostProcessEffect::endFullscreenPass (const CommandBuffer & commandBuffer, const IntermediateRenderTarget & target) noexcept
+	{
 		commandBuffer.draw(3, 1);
 
 		target.endRenderPass(commandBuffer);
@@ -258,7 +287,7 @@ namespace EmEn::Graphics
 	/* ---- Shared descriptor set layout helpers ---- */
 
 	std::shared_ptr< DescriptorSetLayout >
-	IndirectPostProcessEffect::getInputLayout (uint32_t samplerCount, uint32_t uniformBufferCount) const noexcept
+	IndirectPostProcessEffect::getInputLayout (uint32_t samplerCount, uint32_t uniformBufferCount, bool dynamicUniformBuffers) const noexcept
 	{
 		auto & layoutManager = m_renderer.layoutManager();
 
@@ -268,7 +297,7 @@ namespace EmEn::Graphics
 
 		if ( uniformBufferCount > 0 )
 		{
-			layoutId += "_" + std::to_string(uniformBufferCount) + "UBO";
+			layoutId += "_" + std::to_string(uniformBufferCount) + (dynamicUniformBuffers ? "DynamicUBO" : "UBO");
 		}
 
 		auto layout = layoutManager.getDescriptorSetLayout(layoutId);
@@ -286,7 +315,14 @@ namespace EmEn::Graphics
 			/* Uniform buffers are laid out after the samplers. */
 			for ( uint32_t bufferIndex = 0; bufferIndex < uniformBufferCount; ++bufferIndex )
 			{
-				layout->declareUniformBuffer(samplerCount + bufferIndex, VK_SHADER_STAGE_FRAGMENT_BIT);
+				if ( dynamicUniformBuffers )
+				{
+					layout->declareUniformBufferDynamic(samplerCount + bufferIndex, VK_SHADER_STAGE_FRAGMENT_BIT);
+				}
+				else
+				{
+					layout->declareUniformBuffer(samplerCount + bufferIndex, VK_SHADER_STAGE_FRAGMENT_BIT);
+				}
 			}
 
 			if ( !layoutManager.createDescriptorSetLayout(layout) )
@@ -371,4 +407,20 @@ namespace EmEn::Graphics
 
 		return result;
 	}
+
+	VkDescriptorSet
+	IndirectPostProcessEffect::frameDescriptorSet (const DescriptorSet & perFrameSet, const FrameDescriptorAllocator::Writes & writes) const noexcept
+	{
+		if ( auto * descriptorAllocator = m_renderer.frameDescriptorAllocator(); descriptorAllocator != nullptr )
+		{
+			if ( auto * descriptorSetHandle = descriptorAllocator->get(*perFrameSet.descriptorSetLayout(), writes); descriptorSetHandle != VK_NULL_HANDLE )
+			{
+				return descriptorSetHandle;
+			}
+		}
+
+		writes.apply(m_renderer.device()->handle(), perFrameSet.handle());
+
+		return perFrameSet.handle();
+	}
 }
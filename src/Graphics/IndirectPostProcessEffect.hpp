@@ -36,6 +36,7 @@
 #include "PostProcessEffect.hpp"
 
 /* Local inclusions for usages. */
+#include "FrameDescriptorAllocator.hpp"
 #include "Math/Vector.hpp"
 #include "PostProcessor.hpp"
 #include "StaticVector.hpp"
@@ -595,6 +596,36 @@ void main()
 			 */
 			static void recordFullscreenPass (const Vulkan::CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const Vulkan::GraphicsPipeline & pipeline, const Vulkan::PipelineLayout & pipelineLayout, const Vulkan::DescriptorSet & descriptorSet, const void * pushConstants, uint32_t pushConstantsSize, const Vulkan::DescriptorSet * bindlessSet = nullptr) noexcept;
 
+			/**
+			 * @brief Records a fullscreen pass into a command buffer, binding a descriptor set handle.
+			 * @note Used with the transient sets of the frame descriptor allocator.
+			 * @param commandBuffer A reference to the active command buffer.
+			 * @param target The intermediate render target to render into.
+			 * @param pipeline The graphics pipeline to use.
+			 * @param pipelineLayout The pipeline layout for push constants and descriptor binding.
+			 * @param descriptorSetHandle The descriptor set handle to bind.
+			 * @param pushConstants Pointer to the push constants data.
+			 * @param pushConstantsSize Size of the push constants data in bytes.
+			 * @param bindlessSet The global bindless descriptor set, bound at set 1. Default none.
+			 * @return void
+			 */
+			static void recordFullscreenPass (const Vulkan::CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const Vulkan::GraphicsPipeline & pipeline, const Vulkan::PipelineLayout & pipelineLayout, VkDescriptorSet descriptorSetHandle, const void * pushConstants, uint32_t pushConstantsSize, const Vulkan::DescriptorSet * bindlessSet = nullptr) noexcept;
+
+			/**
+			 * @brief Records a fullscreen pass into a command buffer, binding a descriptor set with one dynamic uniform buffer.
+			 * @note Used with the transient data of the frame ring allocator.
+			 * @param commandBuffer A reference to the active command buffer.
+			 * @param target The intermediate render target to render into.
+			 * @param pipeline The graphics pipeline to use.
+			 * @param pipelineLayout The pipeline layout for push constants and descriptor binding.
+			 * @param descriptorSet The descriptor set to bind.
+			 * @param dynamicOffset The offset of the uniform data in the dynamic buffer.
+			 * @param pushConstants Pointer to the push constants data.
+			 * @param pushConstantsSize Size of the push constants data in bytes.
+			 * @return void
+			 */
+			static void recordFullscreenPass (const Vulkan::CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const Vulkan::GraphicsPipeline & pipeline, const Vulkan::PipelineLayout & pipelineLayout, const Vulkan::DescriptorSet & descriptorSet, uint32_t dynamicOffset, const void * pushConstants, uint32_t pushConstantsSize) noexcept;
+
 			/* ---- Shared descriptor set layout helpers ---- */
 
 			/**
@@ -605,10 +636,11 @@ void main()
 			 * minimum guarantee (maxPushConstantsSize) MUST use a uniform buffer instead.
 			 * @param samplerCount The number of combined image samplers (1, 2, 3, etc.).
 			 * @param uniformBufferCount The number of uniform buffers. Default 0 (samplers only).
+			 * @param dynamicUniformBuffers Declares the uniform buffers as dynamic, for the frame ring allocator. Default false.
 			 * @return std::shared_ptr< Vulkan::DescriptorSetLayout >
 			 */
 			[[nodiscard]]
-			std::shared_ptr< Vulkan::DescriptorSetLayout > getInputLayout (uint32_t samplerCount, uint32_t uniformBufferCount = 0) const noexcept;
+			std::shared_ptr< Vulkan::DescriptorSetLayout > getInputLayout (uint32_t samplerCount, uint32_t uniformBufferCount = 0, bool dynamicUniformBuffers = false) const noexcept;
 
 			/**
 			 * @brief Allocates per-frame uniform buffers (one per frame-in-flight).
@@ -643,8 +675,39 @@ void main()
 			[[nodiscard]]
 			std::vector< std::unique_ptr< Vulkan::DescriptorSet > > createPerFrameDescriptorSets (const std::shared_ptr< Vulkan::DescriptorSetLayout > & layout, const char * classId, const std::string & baseName) const noexcept;
 
+			/**
+			 * @brief Returns a descriptor set of the current frame holding the writes.
+			 * @note The set comes from the renderer frame descriptor allocator. Without one, the
+			 * persistent per-frame set is rewritten and returned instead.
+			 * @param perFrameSet A reference to the persistent set of the current frame, also giving the layout.
+			 * @param writes A reference to the descriptor writes.
+			 * @return VkDescriptorSet
+			 */
+			[[nodiscard]]
+			VkDescriptorSet frameDescriptorSet (const Vulkan::DescriptorSet & perFrameSet, const FrameDescriptorAllocator::Writes & writes) const noexcept;
+
 		private:
 
+			/**
+			 * @brief Begins a fullscreen pass: render pass, pipeline, viewport, scissor and push constants.
+			 * @param commandBuffer A reference to the active command buffer.
+			 * @param target The intermediate render target to render into.
+			 * @param pipeline The graphics pipeline to use.
+			 * @param pipelineLayout The pipeline layout for push constants.
+			 * @param pushConstants Pointer to the push constants data. Can be null.
+			 * @param pushConstantsSize Size of the push constants data in bytes.
+			 * @return void
+			 */
+			static void beginFullscreenPass (const Vulkan::CommandBuffer & commandBuffer, const IntermediateRenderTarget & target, const Vulkan::GraphicsPipeline & pipeline, const Vulkan::PipelineLayout & pipelineLayout, const void * pushConstants, uint32_t pushConstantsSize) noexcept;
+
+			/**
+			 * @brief Ends a fullscreen pass: draw, render pass end and the write to read barrier.
+			 * @param commandBuffer A reference to the active command buffer.
+			 * @param target The intermediate render target rendered into.
+			 * @return void
+			 */
+			static void endFullscreenPass (const Vulkan::CommandBuffer & commandBuffer, const IntermediateRenderTarget & target) noexcept;
+
 			Renderer & m_renderer;
 	};
 }
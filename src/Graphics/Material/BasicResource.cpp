@@ -38,6 +38,7 @@
 #include "Saphir/Generator/Abstract.hpp"
 #include "Saphir/Keys.hpp"
 #include "Saphir/LightGenerator.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Tracer.hpp"
 #include "Vulkan/LayoutManager.hpp"
 
@@ -426,7 +427,7 @@ namespace EmEn::Graphics::Material
 	{
 		if ( m_sharedUniformBuffer != nullptr )
 		{
-			m_sharedUniformBuffer->removeElement(this);
+			m_sharedUniformBuffer->removeElement(this, m_sharedUBOIndex);
 		}
 
 		/* Reset to defaults. */
@@ -652,6 +653,23 @@ namespace EmEn::Graphics::Material
 		}
 	}
 
+	void
+	BasicResource::appendProgramKey (ProgramKeyBuilder & key) const noexcept
+	{
+		Interface::appendProgramKey(key);
+
+		if ( m_textureComponent != nullptr )
+		{
+			key.add(true);
+
+			m_textureComponent->appendProgramKey(key);
+		}
+		else
+		{
+			key.add(false);
+		}
+	}
+
 	bool
 	BasicResource::setupLightGenerator (LightGenerator & lightGenerator) const noexcept
 	{
@@ -194,6 +194,9 @@ namespace EmEn::Graphics::Material
 			/** @copydoc EmEn::Graphics::Material::Interface::collectRTTextures() */
 			void collectRTTextures (std::vector< RTTextureSlot > & outSlots) const noexcept override;
 
+			/** @copydoc EmEn::Graphics::Material::Interface::appendProgramKey() */
+			void appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept override;
+
 			/** @copydoc EmEn::Graphics::Material::Interface::setupLightGenerator() */
 			[[nodiscard]]
 			bool setupLightGenerator (Saphir::LightGenerator & lightGenerator) const noexcept override;
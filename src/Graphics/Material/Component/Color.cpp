@@ -29,8 +29,17 @@
 /* STL inclusions. */
 #include <sstream>
 
+/* Local inclusions. */
+#include "Saphir/ProgramKey.hpp"
+
 namespace EmEn::Graphics::Material::Component
 {
+	void
+	Color::appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept
+	{
+		key.add(Type::Color).add(m_variableName);
+	}
+
 	std::ostream &
 	operator<< (std::ostream & out, const Color & obj)
 	{
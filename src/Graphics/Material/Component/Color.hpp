@@ -119,6 +119,9 @@ namespace EmEn::Graphics::Material::Component
 				return {0, 0, nullptr, nullptr};
 			}
 
+			/** @copydoc EmEn::Graphics::Material::Component::Interface::appendProgramKey() */
+			void appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept override;
+
 			/**
 			 * @brief Sets a new color.
 			 * @param color A reference to a color.
@@ -44,6 +44,11 @@ namespace EmEn
 		class TextureInterface;
 	}
 
+	namespace Saphir
+	{
+		class ProgramKeyBuilder;
+	}
+
 	namespace Graphics
 	{
 		namespace TextureResource
@@ -158,6 +163,14 @@ namespace EmEn::Graphics::Material::Component
 			[[nodiscard]]
 			virtual Saphir::Declaration::Sampler getSampler (uint32_t materialSet) const noexcept = 0;
 
+			/**
+			 * @brief Adds what this component changes in the generated program to a program key.
+			 * @note The component type and variable name, plus the sampler configuration for a texture.
+			 * @param key A reference to the program key builder.
+			 * @return void
+			 */
+			virtual void appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept = 0;
+
 		protected:
 
 			/** 
@@ -36,6 +36,7 @@
 #include "Graphics/TextureResource/Texture3D.hpp"
 #include "Graphics/TextureResource/TextureCubemap.hpp"
 #include "Resources/Container.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Graphics::Material::Component
@@ -196,6 +197,27 @@ namespace EmEn::Graphics::Material::Component
 		return m_texture->isCreated();
 	}
 
+	void
+	Texture::appendProgramKey (ProgramKeyBuilder & key) const noexcept
+	{
+		key.add(Type::Texture)
+			.add(m_variableName)
+			.add(m_samplerName)
+			.add(m_binding)
+			.add(m_UVWChannel)
+			.add(m_alphaEnabled);
+
+		/* NOTE: The sampler type and the coordinates dimension come from the texture itself. */
+		if ( m_texture != nullptr )
+		{
+			key.add(this->textureType()).add(m_texture->request3DTextureCoordinates());
+		}
+		else
+		{
+			key.add(false);
+		}
+	}
+
 	Key
 	Texture::textureType () const noexcept
 	{
@@ -170,6 +170,9 @@ namespace EmEn::Graphics::Material::Component
 				return {materialSet, this->binding(), this->textureType(), this->samplerName()};
 			}
 
+			/** @copydoc EmEn::Graphics::Material::Component::Interface::appendProgramKey() */
+			void appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept override;
+
 			/**
 			 * @brief Sets a texture interface.
 			 * @note No resource loading behavior, useful for render-to-texture.
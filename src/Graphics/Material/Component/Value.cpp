@@ -26,8 +26,17 @@
 
 #include "Value.hpp"
 
+/* Local inclusions. */
+#include "Saphir/ProgramKey.hpp"
+
 namespace EmEn::Graphics::Material::Component
 {
+	void
+	Value::appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept
+	{
+		key.add(Type::Value).add(m_variableName);
+	}
+
 	std::ostream &
 	operator<< (std::ostream & out, const Value & obj)
 	{
@@ -116,6 +116,9 @@ namespace EmEn::Graphics::Material::Component
 				return {0, 0, nullptr, nullptr};
 			}
 
+			/** @copydoc EmEn::Graphics::Material::Component::Interface::appendProgramKey() */
+			void appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept override;
+
 		private:
 
 			/**
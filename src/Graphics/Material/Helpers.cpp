@@ -30,13 +30,17 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 /* Local inclusions. */
+#include "Component/Interface.hpp"
 #include "Graphics/Geometry/Interface.hpp"
 #include "Interface.hpp"
 #include "Saphir/Code.hpp"
 #include "Saphir/Generator/Abstract.hpp"
 #include "Saphir/Keys.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Graphics::Material
@@ -454,4 +458,28 @@ namespace EmEn::Graphics::Material
 
 		return true;
 	}
+
+	void
+	appendComponentsToProgramKey (const std::unordered_map< ComponentType, std::unique_ptr< Component::Interface > > & components, ProgramKeyBuilder & key) noexcept
+	{
+		/* NOTE: The map iteration order depends on its history, the key must not. */
+		std::vector< std::pair< ComponentType, const Component::Interface * > > sortedComponents;
+		sortedComponents.reserve(components.size());
+
+		for ( const auto & [componentType, component] : components )
+		{
+			sortedComponents.emplace_back(componentType, component.get());
+		}
+
+		std::ranges::sort(sortedComponents, {}, &std::pair< ComponentType, const Component::Interface * >::first);
+
+		key.add(sortedComponents.size());
+
+		for ( const auto & [componentType, component] : sortedComponents )
+		{
+			key.add(componentType);
+
+			component->appendProgramKey(key);
+		}
+	}
 }
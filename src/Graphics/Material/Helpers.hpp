@@ -26,6 +26,10 @@
 
 #pragma once
 
+/* STL inclusions. */
+#include <memory>
+#include <unordered_map>
+
 /* Local inclusions for usages. */
 #include "Graphics/Types.hpp"
 #include "FastJSON.hpp"
@@ -40,6 +44,7 @@ namespace EmEn
 			class Abstract;
 		}
 
+		class ProgramKeyBuilder;
 		class VertexShader;
 	}
 
@@ -47,6 +52,11 @@ namespace EmEn
 	{
 		namespace Material
 		{
+			namespace Component
+			{
+				class Interface;
+			}
+
 			class Interface;
 		}
 
@@ -170,4 +180,12 @@ namespace EmEn::Graphics::Material
 	 */
 	[[nodiscard]]
 	EMEN_API bool getComponentAsValue (const Json::Value & data, const char * componentType, float & value) noexcept;
+
+	/**
+	 * @brief Adds the components of a material to a program key, in component type order.
+	 * @param components A reference to the material components.
+	 * @param key A reference to the program key builder.
+	 * @return void
+	 */
+	EMEN_API void appendComponentsToProgramKey (const std::unordered_map< ComponentType, std::unique_ptr< Component::Interface > > & components, Saphir::ProgramKeyBuilder & key) noexcept;
 }
@@ -31,6 +31,7 @@
 #include "Graphics/Renderer.hpp"
 #include "Helpers.hpp"
 #include "Saphir/Declaration/UniformBlock.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Graphics::Material
@@ -52,6 +53,30 @@ namespace EmEn::Graphics::Material
 		/* Default: no textures. */
 	}
 
+	void
+	Interface::appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept
+	{
+		/* NOTE: Only the material bits, without the creation state. The resource bits (direct loading) share the same flags. */
+		constexpr auto ProgramFlagsMask = ((static_cast< uint32_t >(IsAnimated) << 1) - 1) & ~static_cast< uint32_t >(IsCreated);
+
+		key.add(this->classUID())
+			.add(this->flags() & ProgramFlagsMask)
+			.add(this->blendingMode())
+			.add(this->isComplex())
+			.add(this->useEnvironmentCubemap())
+			.add(this->requiresGrabPass())
+			.add(this->requiresAlphaTestedShadows());
+
+		if ( const auto & layout = this->descriptorSetLayout(); layout != nullptr )
+		{
+			key.add(layout->getHash());
+		}
+		else
+		{
+			key.add(0U);
+		}
+	}
+
 	bool
 	Interface::onDependenciesLoaded () noexcept
 	{
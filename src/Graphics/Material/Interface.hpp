@@ -72,6 +72,7 @@ namespace EmEn
 		}
 
 		class LightGenerator;
+		class ProgramKeyBuilder;
 		class VertexShader;
 		class FragmentShader;
 	}
@@ -448,6 +449,17 @@ namespace EmEn::Graphics::Material
 			 */
 			virtual void collectRTTextures (std::vector< RTTextureSlot > & outSlots) const noexcept;
 
+			/**
+			 * @brief Adds every input of this material that changes the generated program to a program key.
+			 * @note Called before any GLSL generation to find a cached program. The base version adds the
+			 * material class, its flags, the blending mode and the descriptor set layout. A material whose
+			 * code depends on more (components, baked constants, options) must override this and call the
+			 * base version. Values read from the uniform buffer at runtime must stay out of the key.
+			 * @param key A reference to the program key builder.
+			 * @return void
+			 */
+			virtual void appendProgramKey (Saphir::ProgramKeyBuilder & key) const noexcept;
+
 			/**
 			 * @brief Configures the light generator with this material.
 			 * @param lightGenerator A reference to the light generator.
@@ -55,6 +55,7 @@
 #include "Saphir/Generator/Abstract.hpp"
 #include "Saphir/Keys.hpp"
 #include "Saphir/LightGenerator.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Saphir/VertexShader.hpp"
 #include "Tracer.hpp"
 #include "Vulkan/DescriptorSet.hpp"
@@ -1451,7 +1452,7 @@ namespace EmEn::Graphics::Material
 	{
 		if ( m_sharedUniformBuffer != nullptr )
 		{
-			m_sharedUniformBuffer->removeElement(this);
+			m_sharedUniformBuffer->removeElement(this, m_sharedUBOIndex);
 		}
 
 		/* Reset to defaults. */
@@ -1685,6 +1686,33 @@ namespace EmEn::Graphics::Material
 		}
 	}
 
+	void
+	PBRResource::appendProgramKey (ProgramKeyBuilder & key) const noexcept
+	{
+		Interface::appendProgramKey(key);
+
+		appendComponentsToProgramKey(m_components, key);
+
+		/* NOTE: These options select code paths, the reflectivity amount is written as a constant. */
+		key.add(m_postProcessReflectivityAmount)
+			.add(m_invertRoughness)
+			.add(m_isUsingEnvironmentCubemap)
+			.add(m_reflectionIsArtistic)
+			.add(m_reflectionSourceIsAbsolute)
+			.add(m_refractionSourceIsAbsolute)
+			.add(m_isUsingEnvironmentCubemapForRefraction)
+			.add(m_isUsingEnvironmentCubemapForTransmission)
+			.add(m_isUsingGrabPassForTransmission)
+			.add(m_isUsingDepthBasedOpacity)
+			.add(m_useParallaxOcclusionMapping);
+
+		/* NOTE: Only whether these lobes are active changes the code, their amount lives in the uniform buffer. */
+		key.add(m_materialProperties[ClearCoatFactorOffset] > 0.0F)
+			.add(m_materialProperties[SubsurfaceIntensityOffset] > 0.0F)
+			.add(m_materialProperties[SheenColorOffset] > 0.0F || m_materialProperties[SheenColorOffset + 1] > 0.0F || m_materialProperties[SheenColorOffset + 2] > 0.0F)
+			.add(m_materialProperties[DispersionOffset] > 0.0F);
+	}
+
 	bool
 	PBRResource::setupLightGenerator (LightGenerator & lightGenerator) const noexcept
 	{
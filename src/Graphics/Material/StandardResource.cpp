@@ -56,6 +56,7 @@
 #include "Saphir/Generator/Abstract.hpp"
 #include "Saphir/Keys.hpp"
 #include "Saphir/LightGenerator.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Saphir/VertexShader.hpp"
 #include "Tracer.hpp"
 #include "Vulkan/DescriptorSet.hpp"
@@ -962,7 +963,7 @@ namespace EmEn::Graphics::Material
 	void
 	StandardResource::destroy () noexcept
 	{
-		m_sharedUniformBuffer->removeElement(this);
+		m_sharedUniformBuffer->removeElement(this, m_sharedUBOIndex);
 
 		/* Reset to defaults. */
 		this->resetFlags();
@@ -1175,6 +1176,24 @@ namespace EmEn::Graphics::Material
 		}
 	}
 
+	void
+	StandardResource::appendProgramKey (ProgramKeyBuilder & key) const noexcept
+	{
+		Interface::appendProgramKey(key);
+
+		appendComponentsToProgramKey(m_components, key);
+
+		/* NOTE: These options select code paths, the alpha threshold and the reflectivity amount are written as constants. */
+		key.add(m_alphaThresholdToDiscard)
+			.add(m_postProcessReflectivityAmount)
+			.add(m_isUsingEnvironmentCubemap)
+			.add(m_reflectionIsArtistic)
+			.add(m_reflectionSourceIsAbsolute)
+			.add(m_refractionSourceIsAbsolute)
+			.add(m_isUsingEnvironmentCubemapForRefraction)
+			.add(m_useParallaxOcclusionMapping);
+	}
+
 	bool
 	StandardResource::setupLightGenerator (LightGenerator & lightGenerator) const noexcept
 	{
@@ -31,6 +31,8 @@
 #include <chrono>
 #include <cmath>
 #include <numbers>
+#include <string>
+#include <utility>
 
 /* Local inclusions. */
 #include "CombinePass.hpp"
@@ -40,6 +42,7 @@
 #include "IndirectPostProcessEffect.hpp"
 #include "VertexFactory/ShapeGenerator.hpp"
 #include "PostProcessStack.hpp"
+#include "RenderGraph.hpp"
 #include "Renderer.hpp"
 #include "Resources/Manager.hpp"
 #include "Saphir/Generator/PostProcessing.hpp"
@@ -51,6 +54,7 @@
 #include "Vulkan/CommandBuffer.hpp"
 #include "Vulkan/DescriptorSet.hpp"
 #include "Vulkan/DescriptorSetLayout.hpp"
+#include "Vulkan/Image.hpp"
 #include "Vulkan/PipelineLayout.hpp"
 #include "Vulkan/Sync/ImageMemoryBarrier.hpp"
 
@@ -1396,6 +1400,137 @@ namespace EmEn::Graphics
 
 	/* GPU execution — single-pass camera lens effects. */
 
+	void
+	PostProcessor::describeRenderGraph (const PostProcessStack & stack, RenderGraph & graph) const noexcept
+	{
+		if ( m_grabPass == nullptr || !m_grabPass->isCreated() )
+		{
+			return;
+		}
+
+		const auto importGBuffer = [&graph] (bool available, const char * name) {
+			return available ? graph.importImage(name, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) : RenderGraph::InvalidIndex;
+		};
+
+		const auto depth = importGBuffer(m_grabPass->hasDepth(), "Depth");
+		const auto normals = importGBuffer(m_grabPass->hasNormals(), "Normals");
+		const auto materialProperties = importGBuffer(m_grabPass->hasMaterialProperties(), "MaterialProperties");
+		const auto albedo = importGBuffer(m_grabPass->hasAlbedo(), "Albedo");
+		const auto velocity = importGBuffer(m_grabPass->hasVelocity(), "Velocity");
+
+		auto currentColor = graph.importImage("SceneColor", VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+		/* NOTE: The effect outputs, the overlay results and the combine group targets only live
+		 * inside the chain. They are described as transients of the grab pass color size and
+		 * format, so the compile step plans which of them can share memory. */
+		RenderGraph::ImageDescription chainImage{};
+
+		if ( const auto colorImage = m_grabPass->image(); colorImage != nullptr )
+		{
+			chainImage.width = colorImage->width();
+			chainImage.height = colorImage->height();
+			chainImage.format = colorImage->createInfo().format;
+			chainImage.memorySize = colorImage->bytes();
+		}
+
+		const auto readGBuffers = [&] (uint32_t passIndex, const IndirectPostProcessEffect & effect) {
+			for ( const auto & [required, resourceIndex] : {std::pair{effect.requiresDepth(), depth}, std::pair{effect.requiresNormals(), normals}, std::pair{effect.requiresMaterialProperties(), materialProperties}, std::pair{effect.requiresAlbedo(), albedo}, std::pair{effect.requiresVelocity(), velocity}} )
+			{
+				if ( required )
+				{
+					graph.read(passIndex, resourceIndex, RenderGraphAccess::FragmentShaderRead);
+				}
+			}
+		};
+
+		/* NOTE: Same grouping as executeIndirectPostProcessEffects(), without the upstream
+		 * color flush which depends on the frame context. */
+		std::vector< std::pair< const IndirectPostProcessEffect *, uint32_t > > combineGroup;
+		uint32_t combineGroupIndex = 0;
+
+		const auto flushCombineGroup = [&] () {
+			if ( combineGroup.empty() )
+			{
+				return;
+			}
+
+			const auto passIndex = graph.addPass("Combine" + std::to_string(combineGroupIndex));
+
+			graph.read(passIndex, currentColor, RenderGraphAccess::FragmentShaderRead);
+
+			for ( const auto & [effect, result] : combineGroup )
+			{
+				graph.read(passIndex, result, RenderGraphAccess::FragmentShaderRead);
+			}
+
+			currentColor = graph.declareTransientImage("CombineGroup" + std::to_string(combineGroupIndex), chainImage);
+
+			graph.write(passIndex, currentColor, RenderGraphAccess::ColorAttachmentWrite);
+
+			combineGroupIndex++;
+			combineGroup.clear();
+		};
+
+		for ( const auto & effect : stack.effects() )
+		{
+			if ( effect == nullptr || !effect->isEnabled() )
+			{
+				continue;
+			}
+
+			if ( (effect->requiresDepth() && depth == RenderGraph::InvalidIndex) ||
+				(effect->requiresHDR() && !m_cachedRequiresHDR) ||
+				(effect->requiresNormals() && normals == RenderGraph::InvalidIndex) ||
+				(effect->requiresMaterialProperties() && materialProperties == RenderGraph::InvalidIndex) ||
+				(effect->requiresAlbedo() && albedo == RenderGraph::InvalidIndex) ||
+				(effect->requiresVelocity() && velocity == RenderGraph::InvalidIndex) )
+			{
+				continue;
+			}
+
+			if ( effect->requiresRayTracing() && (!m_renderer.device()->rayTracingEnabled() || !m_renderer.isRayTracingSettingEnabled()) )
+			{
+				continue;
+			}
+
+			const bool isOverlay = m_combinePass != nullptr && effect->producesOverlay();
+
+			if ( !isOverlay )
+			{
+				flushCombineGroup();
+			}
+
+			const auto passIndex = graph.addPass(effect->label());
+
+			readGBuffers(passIndex, *effect);
+
+			if ( isOverlay )
+			{
+				const auto result = graph.declareTransientImage(std::string{effect->label()} + "Result", chainImage);
+
+				graph.read(passIndex, currentColor, RenderGraphAccess::FragmentShaderRead);
+				graph.write(passIndex, result, RenderGraphAccess::ColorAttachmentWrite);
+
+				combineGroup.emplace_back(effect.get(), result);
+
+				continue;
+			}
+
+			graph.read(passIndex, currentColor, RenderGraphAccess::FragmentShaderRead);
+
+			currentColor = graph.declareTransientImage(std::string{effect->label()} + "Output", chainImage);
+
+			graph.write(passIndex, currentColor, RenderGraphAccess::ColorAttachmentWrite);
+		}
+
+		flushCombineGroup();
+
+		/* NOTE: The final composite renders into the swap chain render pass. */
+		const auto finalPass = graph.addPass("FinalComposite", true);
+
+		graph.read(finalPass, currentColor, RenderGraphAccess::FragmentShaderRead);
+	}
+
 	bool
 	PostProcessor::executeDirectPostProcessEffects (const Vulkan::CommandBuffer & commandBuffer, const std::vector< std::shared_ptr< DirectPostProcessEffect > > & lensEffects) const noexcept
 	{
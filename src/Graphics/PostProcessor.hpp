@@ -71,6 +71,7 @@ namespace EmEn
 		class GrabPass;
 		class IndirectPostProcessEffect;
 		class PostProcessStack;
+		class RenderGraph;
 		class Renderer;
 
 		namespace Geometry
@@ -352,6 +353,20 @@ namespace EmEn::Graphics
 			 */
 			bool executeDirectPostProcessEffects (const Vulkan::CommandBuffer & commandBuffer, const std::vector< std::shared_ptr< DirectPostProcessEffect > > & lensEffects) const noexcept;
 
+			/**
+			 * @brief Describes the indirect effect chain of a stack as a render graph.
+			 * @note Effect level description: one pass per effect, one pass per combine group and
+			 * the final composite. The scene color and the G-buffers are imported. The effect outputs, the overlay
+			 * results and the combine group targets are transients of the grab pass color size and format: the
+			 * compiled memory slots give the memory the chain needs with aliasing, the effects still own their targets.
+			 * The light set availability is not known here, light dependent effects are kept.
+			 * @note Diagnostic only: the graph is dumped, its barriers and slots are not applied by the recording.
+			 * @param stack A reference to the post-process stack.
+			 * @param graph A writable reference to an empty render graph.
+			 * @return void
+			 */
+			void describeRenderGraph (const PostProcessStack & stack, RenderGraph & graph) const noexcept;
+
 			/* Static. */
 
 			/**
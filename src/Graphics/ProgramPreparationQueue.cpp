@@ -0,0 +1,160 @@
+/*
+ * src/Graphics/ProgramPreparationQueue.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "ProgramPreparationQueue.hpp"
+
+/* Local inclusions. */
+#include "Graphics/RenderableInstance/Abstract.hpp"
+#include "Graphics/RenderTarget/Abstract.hpp"
+#include "ThreadPool.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Graphics
+{
+	using namespace Base;
+
+	/* NOTE: Kept out of the exported class, a thread local data member cannot have a DLL interface. */
+	static thread_local bool s_isPreparationThread{false};
+
+	ProgramPreparationQueue::State
+	ProgramPreparationQueue::poll (const std::shared_ptr< RenderableInstance::Abstract > & renderableInstance, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, std::string & errorMessage) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		const auto entryIt = m_entries.find({renderableInstance.get(), renderTarget.get()});
+
+		if ( entryIt == m_entries.end() )
+		{
+			return State::None;
+		}
+
+		if ( entryIt->second.pending )
+		{
+			return State::Pending;
+		}
+
+		/* NOTE: The failure belongs to a destroyed instance which had the same address. */
+		if ( entryIt->second.renderableInstance.lock() != renderableInstance )
+		{
+			m_entries.erase(entryIt);
+
+			return State::None;
+		}
+
+		errorMessage = std::move(entryIt->second.errorMessage);
+
+		m_entries.erase(entryIt);
+
+		return State::Failed;
+	}
+
+	bool
+	ProgramPreparationQueue::submit (ThreadPool & threadPool, const std::shared_ptr< RenderableInstance::Abstract > & renderableInstance, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, Task task) noexcept
+	{
+		const Key key{renderableInstance.get(), renderTarget.get()};
+
+		{
+			const std::lock_guard< std::mutex > lock{m_access};
+
+			/* NOTE: An identical request is already in flight, or its failure is not polled yet. */
+			if ( m_entries.contains(key) )
+			{
+				return false;
+			}
+
+			m_entries.emplace(key, Entry{renderableInstance, {}, true});
+
+			m_pendingCount++;
+		}
+
+		/* NOTE: The task owns the instance and the render target until it finishes. */
+		threadPool.enqueue([this, key, renderableInstance, renderTarget, task = std::move(task)] () mutable {
+			std::string errorMessage;
+
+			s_isPreparationThread = true;
+
+			const auto success = task(errorMessage);
+
+			s_isPreparationThread = false;
+
+			/* NOTE: Release the references before signaling, a waiter may destroy the scene right after. */
+			task = nullptr;
+			renderableInstance.reset();
+			renderTarget.reset();
+
+			const std::lock_guard< std::mutex > lock{m_access};
+
+			if ( const auto entryIt = m_entries.find(key); entryIt != m_entries.end() )
+			{
+				if ( success )
+				{
+					m_entries.erase(entryIt);
+				}
+				else
+				{
+					entryIt->second.errorMessage = std::move(errorMessage);
+					entryIt->second.pending = false;
+				}
+			}
+
+			m_pendingCount--;
+
+			m_idle.notify_all();
+		});
+
+		return true;
+	}
+
+	void
+	ProgramPreparationQueue::waitIdle () noexcept
+	{
+		std::unique_lock< std::mutex > lock{m_access};
+
+		if ( m_pendingCount > 0 )
+		{
+			TraceDebug{ClassId} << "Waiting for " << m_pendingCount << " program preparation(s) ...";
+		}
+
+		m_idle.wait(lock, [this] {
+			return m_pendingCount == 0;
+		});
+	}
+
+	bool
+	ProgramPreparationQueue::isPreparationThread () noexcept
+	{
+		return s_isPreparationThread;
+	}
+
+	size_t
+	ProgramPreparationQueue::pendingCount () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_access};
+
+		return m_pendingCount;
+	}
+}
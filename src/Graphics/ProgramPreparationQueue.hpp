@@ -0,0 +1,202 @@
+/*
+ * src/Graphics/ProgramPreparationQueue.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+/* Forward declarations. */
+namespace EmEn
+{
+	namespace Base
+	{
+		class ThreadPool;
+	}
+
+	namespace Graphics
+	{
+		namespace RenderableInstance
+		{
+			class Abstract;
+		}
+
+		namespace RenderTarget
+		{
+			class Abstract;
+		}
+	}
+}
+
+namespace EmEn::Graphics
+{
+	/**
+	 * @brief Tracks the program preparations of renderable instances running on the thread pool.
+	 *
+	 * The render thread submits the preparation of an instance for a render target once, then polls
+	 * it every frame and skips the instance while it is pending. A second submission for the same
+	 * pair while the first one runs is ignored. A successful preparation leaves no trace: the programs
+	 * are published in the renderable program cache by the task itself. A failure is kept with its
+	 * message until the render thread polls it, because marking an instance broken is a render
+	 * thread operation.
+	 *
+	 * @note Every method is thread-safe.
+	 * @since 0.9.53
+	 */
+	class EMEN_API ProgramPreparationQueue final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ProgramPreparationQueue"};
+
+			/** @brief The state of a preparation. */
+			enum class State : uint8_t
+			{
+				/** @brief No preparation is running or has failed for this pair. */
+				None,
+				/** @brief The preparation is queued or running. */
+				Pending,
+				/** @brief The preparation has failed, the error message is available once. */
+				Failed
+			};
+
+			/** @brief A preparation task. It returns false and fills the error message on failure. */
+			using Task = std::function< bool (std::string &) >;
+
+			/**
+			 * @brief Constructs a program preparation queue.
+			 */
+			ProgramPreparationQueue () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ProgramPreparationQueue (const ProgramPreparationQueue & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ProgramPreparationQueue (ProgramPreparationQueue && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ProgramPreparationQueue &
+			 */
+			ProgramPreparationQueue & operator= (const ProgramPreparationQueue & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ProgramPreparationQueue &
+			 */
+			ProgramPreparationQueue & operator= (ProgramPreparationQueue && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the program preparation queue after the last running task.
+			 */
+			~ProgramPreparationQueue ()
+			{
+				this->waitIdle();
+			}
+
+			/**
+			 * @brief Returns the state of the preparation of an instance for a render target.
+			 * @note A failed state is consumed by this call, the next poll returns None.
+			 * @param renderableInstance A reference to the renderable instance smart pointer.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param errorMessage A reference to a string receiving the failure message.
+			 * @return State
+			 */
+			[[nodiscard]]
+			State poll (const std::shared_ptr< RenderableInstance::Abstract > & renderableInstance, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, std::string & errorMessage) noexcept;
+
+			/**
+			 * @brief Submits the preparation of an instance for a render target to the thread pool.
+			 * @param threadPool A reference to the thread pool.
+			 * @param renderableInstance A reference to the renderable instance smart pointer.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param task The preparation task.
+			 * @return bool False if a preparation for this pair is already pending.
+			 */
+			bool submit (Base::ThreadPool & threadPool, const std::shared_ptr< RenderableInstance::Abstract > & renderableInstance, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, Task task) noexcept;
+
+			/**
+			 * @brief Blocks until every submitted preparation is finished.
+			 * @note Must be called before releasing anything a task may use (scene, render targets, renderer caches).
+			 * @return void
+			 */
+			void waitIdle () noexcept;
+
+			/**
+			 * @brief Returns the number of preparations queued or running.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t pendingCount () const noexcept;
+
+			/**
+			 * @brief Returns whether the calling thread is running a preparation task.
+			 * @note A preparation task already runs on the thread pool, it must not split work over the same pool.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool isPreparationThread () noexcept;
+
+		private:
+
+			/** @brief The renderable instance and render target addresses. */
+			using Key = std::pair< const void *, const void * >;
+
+			/**
+			 * @brief A preparation in flight or failed.
+			 * @note The weak pointer detects an address reused by a new instance after a failure.
+			 */
+			struct Entry
+			{
+				std::weak_ptr< RenderableInstance::Abstract > renderableInstance;
+				std::string errorMessage;
+				bool pending{true};
+			};
+
+			std::map< Key, Entry > m_entries;
+			mutable std::mutex m_access;
+			std::condition_variable m_idle;
+			size_t m_pendingCount{0};
+	};
+}
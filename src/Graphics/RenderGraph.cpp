@@ -0,0 +1,899 @@
+/*
+ * src/Graphics/RenderGraph.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "RenderGraph.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+
+namespace EmEn::Graphics
+{
+	namespace
+	{
+		/** @brief What an access means for the synchronization. */
+		struct AccessInfo
+		{
+			VkImageLayout layout;
+			VkPipelineStageFlags stageMask;
+			VkAccessFlags accessMask;
+			bool isWrite;
+		};
+
+		[[nodiscard]]
+		constexpr
+		AccessInfo
+		accessInfo (RenderGraphAccess access) noexcept
+		{
+			switch ( access )
+			{
+				case RenderGraphAccess::ColorAttachmentWrite :
+					return {VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, true};
+
+				case RenderGraphAccess::DepthAttachmentWrite :
+					return {VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT, true};
+
+				case RenderGraphAccess::DepthAttachmentRead :
+					return {VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT, VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT, false};
+
+				case RenderGraphAccess::FragmentShaderRead :
+					return {VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT, false};
+
+				case RenderGraphAccess::ComputeShaderRead :
+					return {VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_READ_BIT, false};
+
+				case RenderGraphAccess::ComputeShaderWrite :
+					return {VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_ACCESS_SHADER_WRITE_BIT, true};
+
+				case RenderGraphAccess::TransferRead :
+					return {VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_READ_BIT, false};
+
+				case RenderGraphAccess::TransferWrite :
+					return {VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_ACCESS_TRANSFER_WRITE_BIT, true};
+			}
+
+			return {VK_IMAGE_LAYOUT_GENERAL, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT, true};
+		}
+
+		[[nodiscard]]
+		const char *
+		layoutName (VkImageLayout layout) noexcept
+		{
+			switch ( layout )
+			{
+				case VK_IMAGE_LAYOUT_UNDEFINED :
+					return "UNDEFINED";
+
+				case VK_IMAGE_LAYOUT_GENERAL :
+					return "GENERAL";
+
+				case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL :
+					return "COLOR_ATTACHMENT";
+
+				case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL :
+					return "DEPTH_STENCIL_ATTACHMENT";
+
+				case VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL :
+					return "DEPTH_STENCIL_READ_ONLY";
+
+				case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL :
+					return "SHADER_READ_ONLY";
+
+				case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL :
+					return "TRANSFER_SRC";
+
+				case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL :
+					return "TRANSFER_DST";
+
+				case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR :
+					return "PRESENT_SRC";
+
+				default :
+					return "OTHER";
+			}
+		}
+
+		[[nodiscard]]
+		bool
+		overlaps (uint32_t firstA, uint32_t lastA, uint32_t firstB, uint32_t lastB) noexcept
+		{
+			return firstA <= lastB && firstB <= lastA;
+		}
+	}
+
+	const char *
+	to_cstring (RenderGraphAccess access) noexcept
+	{
+		switch ( access )
+		{
+			case RenderGraphAccess::ColorAttachmentWrite :
+				return "ColorAttachmentWrite";
+
+			case RenderGraphAccess::DepthAttachmentWrite :
+				return "DepthAttachmentWrite";
+
+			case RenderGraphAccess::DepthAttachmentRead :
+				return "DepthAttachmentRead";
+
+			case RenderGraphAccess::FragmentShaderRead :
+				return "FragmentShaderRead";
+
+			case RenderGraphAccess::ComputeShaderRead :
+				return "ComputeShaderRead";
+
+			case RenderGraphAccess::ComputeShaderWrite :
+				return "ComputeShaderWrite";
+
+			case RenderGraphAccess::TransferRead :
+				return "TransferRead";
+
+			case RenderGraphAccess::TransferWrite :
+				return "TransferWrite";
+		}
+
+		return "Unknown";
+	}
+
+	uint32_t
+	RenderGraph::declareTransientImage (const std::string & name, const ImageDescription & description) noexcept
+	{
+		m_compiled = false;
+
+		auto & resource = m_resources.emplace_back();
+		resource.name = name;
+		resource.description = description;
+
+		return static_cast< uint32_t >(m_resources.size() - 1);
+	}
+
+	uint32_t
+	RenderGraph::importImage (const std::string & name, VkImageLayout initialLayout, VkImageLayout finalLayout) noexcept
+	{
+		m_compiled = false;
+
+		auto & resource = m_resources.emplace_back();
+		resource.name = name;
+		resource.initialLayout = initialLayout;
+		resource.finalLayout = finalLayout;
+		resource.imported = true;
+
+		return static_cast< uint32_t >(m_resources.size() - 1);
+	}
+
+	uint32_t
+	RenderGraph::addPass (const std::string & name, bool hasSideEffects) noexcept
+	{
+		m_compiled = false;
+
+		auto & pass = m_passes.emplace_back();
+		pass.name = name;
+		pass.hasSideEffects = hasSideEffects;
+
+		return static_cast< uint32_t >(m_passes.size() - 1);
+	}
+
+	bool
+	RenderGraph::read (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access) noexcept
+	{
+		if ( passIndex >= m_passes.size() || resourceIndex >= m_resources.size() )
+		{
+			TraceError{ClassId} << "Invalid read declaration (pass #" << passIndex << ", resource #" << resourceIndex << ") !";
+
+			return false;
+		}
+
+		if ( accessInfo(access).isWrite )
+		{
+			TraceError{ClassId} << "The access '" << to_cstring(access) << "' is not a read !";
+
+			return false;
+		}
+
+		m_compiled = false;
+
+		const auto version = static_cast< uint32_t >(m_resources[resourceIndex].producers.size() - 1);
+
+		m_passes[passIndex].reads.emplace_back(Access{resourceIndex, version, access});
+
+		return true;
+	}
+
+	bool
+	RenderGraph::write (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access) noexcept
+	{
+		return this->declareWrite(passIndex, resourceIndex, access, false);
+	}
+
+	bool
+	RenderGraph::modify (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access) noexcept
+	{
+		return this->declareWrite(passIndex, resourceIndex, access, true);
+	}
+
+	bool
+	RenderGraph::declareWrite (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access, bool loadsPrevious) noexcept
+	{
+		if ( passIndex >= m_passes.size() || resourceIndex >= m_resources.size() )
+		{
+			TraceError{ClassId} << "Invalid write declaration (pass #" << passIndex << ", resource #" << resourceIndex << ") !";
+
+			return false;
+		}
+
+		if ( !accessInfo(access).isWrite )
+		{
+			TraceError{ClassId} << "The access '" << to_cstring(access) << "' is not a write !";
+
+			return false;
+		}
+
+		m_compiled = false;
+
+		auto & producers = m_resources[resourceIndex].producers;
+		producers.emplace_back(passIndex);
+
+		m_passes[passIndex].writes.emplace_back(Access{resourceIndex, static_cast< uint32_t >(producers.size() - 1), access, loadsPrevious});
+
+		return true;
+	}
+
+	bool
+	RenderGraph::compile () noexcept
+	{
+		m_compiled = false;
+		m_executionOrder.clear();
+		m_finalBarriers.clear();
+		m_memorySlots.clear();
+
+		/* NOTE: A transient image has no content before its first write. */
+		for ( const auto & pass : m_passes )
+		{
+			for ( const auto & access : pass.reads )
+			{
+				if ( access.version == 0 && !m_resources[access.resourceIndex].imported )
+				{
+					TraceError{ClassId} << "The pass '" << pass.name << "' reads the transient image '" << m_resources[access.resourceIndex].name << "' before any write !";
+
+					return false;
+				}
+			}
+
+			for ( const auto & access : pass.writes )
+			{
+				if ( access.loadsPrevious && access.version == 1 && !m_resources[access.resourceIndex].imported )
+				{
+					TraceError{ClassId} << "The pass '" << pass.name << "' modifies the transient image '" << m_resources[access.resourceIndex].name << "' before any write !";
+
+					return false;
+				}
+			}
+		}
+
+		this->cullPasses();
+
+		for ( uint32_t passIndex = 0; passIndex < m_passes.size(); ++passIndex )
+		{
+			if ( !m_passes[passIndex].culled )
+			{
+				m_executionOrder.emplace_back(passIndex);
+			}
+		}
+
+		this->assignMemorySlots();
+		this->scheduleBarriers();
+
+		m_compiled = true;
+
+		return true;
+	}
+
+	void
+	RenderGraph::clear () noexcept
+	{
+		m_passes.clear();
+		m_resources.clear();
+		m_executionOrder.clear();
+		m_finalBarriers.clear();
+		m_memorySlots.clear();
+		m_compiled = false;
+	}
+
+	bool
+	RenderGraph::isPassCulled (uint32_t passIndex) const noexcept
+	{
+		return passIndex >= m_passes.size() || m_passes[passIndex].culled;
+	}
+
+	const std::vector< RenderGraph::Barrier > &
+	RenderGraph::passBarriers (uint32_t passIndex) const noexcept
+	{
+		static const std::vector< Barrier > empty{};
+
+		if ( passIndex >= m_passes.size() )
+		{
+			return empty;
+		}
+
+		return m_passes[passIndex].barriers;
+	}
+
+	uint32_t
+	RenderGraph::memorySlot (uint32_t resourceIndex) const noexcept
+	{
+		if ( resourceIndex >= m_resources.size() )
+		{
+			return InvalidIndex;
+		}
+
+		return m_resources[resourceIndex].memorySlot;
+	}
+
+	VkDeviceSize
+	RenderGraph::transientMemorySize () const noexcept
+	{
+		VkDeviceSize size = 0;
+
+		for ( const auto & resource : m_resources )
+		{
+			if ( resource.memorySlot != InvalidIndex )
+			{
+				size += resource.description.memorySize;
+			}
+		}
+
+		return size;
+	}
+
+	VkDeviceSize
+	RenderGraph::aliasedMemorySize () const noexcept
+	{
+		return std::accumulate(m_memorySlots.cbegin(), m_memorySlots.cend(), VkDeviceSize{0}, [] (VkDeviceSize sum, const MemorySlot & slot) {
+			return sum + slot.size;
+		});
+	}
+
+	void
+	RenderGraph::cullPasses () noexcept
+	{
+		/* NOTE: needed[resource][version] tells whether a kept pass or an output consumes that version. */
+		std::vector< std::vector< bool > > needed(m_resources.size());
+
+		for ( size_t resourceIndex = 0; resourceIndex < m_resources.size(); ++resourceIndex )
+		{
+			const auto & resource = m_resources[resourceIndex];
+
+			needed[resourceIndex].resize(resource.producers.size(), false);
+
+			if ( resource.finalLayout != VK_IMAGE_LAYOUT_UNDEFINED )
+			{
+				needed[resourceIndex].back() = true;
+			}
+		}
+
+		/* NOTE: A reader is always declared after the producer of the version it reads,
+		 * so one walk in reverse order settles every pass. */
+		for ( auto passIt = m_passes.rbegin(); passIt != m_passes.rend(); ++passIt )
+		{
+			auto & pass = *passIt;
+
+			pass.culled = !pass.hasSideEffects && std::ranges::none_of(pass.writes, [&needed] (const Access & access) {
+				return needed[access.resourceIndex][access.version];
+			});
+
+			pass.barriers.clear();
+
+			if ( pass.culled )
+			{
+				continue;
+			}
+
+			for ( const auto & access : pass.reads )
+			{
+				needed[access.resourceIndex][access.version] = true;
+			}
+
+			/* NOTE: A modification consumes the version it loads. */
+			for ( const auto & access : pass.writes )
+			{
+				if ( access.loadsPrevious )
+				{
+					needed[access.resourceIndex][access.version - 1] = true;
+				}
+			}
+		}
+	}
+
+	void
+	RenderGraph::assignMemorySlots () noexcept
+	{
+		for ( auto & resource : m_resources )
+		{
+			resource.firstUse = InvalidIndex;
+			resource.lastUse = InvalidIndex;
+			resource.memorySlot = InvalidIndex;
+		}
+
+		for ( uint32_t position = 0; position < m_executionOrder.size(); ++position )
+		{
+			const auto & pass = m_passes[m_executionOrder[position]];
+
+			for ( const auto * accesses : {&pass.reads, &pass.writes} )
+			{
+				for ( const auto & access : *accesses )
+				{
+					auto & resource = m_resources[access.resourceIndex];
+
+					resource.firstUse = std::min(resource.firstUse, position);
+					resource.lastUse = resource.lastUse == InvalidIndex ? position : std::max(resource.lastUse, position);
+				}
+			}
+		}
+
+		std::vector< uint32_t > transients;
+
+		for ( uint32_t resourceIndex = 0; resourceIndex < m_resources.size(); ++resourceIndex )
+		{
+			const auto & resource = m_resources[resourceIndex];
+
+			if ( !resource.imported && resource.firstUse != InvalidIndex )
+			{
+				transients.emplace_back(resourceIndex);
+			}
+		}
+
+		/* NOTE: The largest images are placed first, so a slot is sized by its first
+		 * occupant and the smaller images fill the gaps between the large lifetimes. */
+		std::ranges::stable_sort(transients, [this] (uint32_t indexA, uint32_t indexB) {
+			return m_resources[indexA].description.memorySize > m_resources[indexB].description.memorySize;
+		});
+
+		for ( const auto resourceIndex : transients )
+		{
+			auto & resource = m_resources[resourceIndex];
+
+			for ( uint32_t slotIndex = 0; slotIndex < m_memorySlots.size(); ++slotIndex )
+			{
+				auto & slot = m_memorySlots[slotIndex];
+
+				if ( resource.description.memorySize > slot.size || (slot.memoryTypeBits & resource.description.memoryTypeBits) == 0 )
+				{
+					continue;
+				}
+
+				const bool disjoint = std::ranges::none_of(slot.resourceIndexes, [this, &resource] (uint32_t occupantIndex) {
+					const auto & occupant = m_resources[occupantIndex];
+
+					return overlaps(resource.firstUse, resource.lastUse, occupant.firstUse, occupant.lastUse);
+				});
+
+				if ( disjoint )
+				{
+					slot.memoryTypeBits &= resource.description.memoryTypeBits;
+					slot.resourceIndexes.emplace_back(resourceIndex);
+
+					resource.memorySlot = slotIndex;
+
+					break;
+				}
+			}
+
+			if ( resource.memorySlot == InvalidIndex )
+			{
+				resource.memorySlot = static_cast< uint32_t >(m_memorySlots.size());
+
+				m_memorySlots.emplace_back(MemorySlot{resource.description.memorySize, resource.description.memoryTypeBits, {resourceIndex}});
+			}
+		}
+	}
+
+	void
+	RenderGraph::scheduleBarriers () noexcept
+	{
+		std::vector< ResourceState > states(m_resources.size());
+
+		for ( size_t resourceIndex = 0; resourceIndex < m_resources.size(); ++resourceIndex )
+		{
+			states[resourceIndex].layout = m_resources[resourceIndex].initialLayout;
+		}
+
+		for ( uint32_t position = 0; position < m_executionOrder.size(); ++position )
+		{
+			auto & pass = m_passes[m_executionOrder[position]];
+
+			for ( const auto * accesses : {&pass.reads, &pass.writes} )
+			{
+				for ( const auto & access : *accesses )
+				{
+					const auto & resource = m_resources[access.resourceIndex];
+					auto & state = states[access.resourceIndex];
+
+					/* NOTE: An image taking over a memory slot must wait for the previous
+					 * occupant to be done with the memory, its content is discarded. */
+					if ( resource.firstUse == position && resource.memorySlot != InvalidIndex )
+					{
+						uint32_t previousIndex = InvalidIndex;
+
+						for ( const auto occupantIndex : m_memorySlots[resource.memorySlot].resourceIndexes )
+						{
+							const auto & occupant = m_resources[occupantIndex];
+
+							if ( occupant.lastUse < position && (previousIndex == InvalidIndex || occupant.lastUse > m_resources[previousIndex].lastUse) )
+							{
+								previousIndex = occupantIndex;
+							}
+						}
+
+						if ( previousIndex != InvalidIndex && state.writeStages == 0 && state.readStages == 0 )
+						{
+							const auto & previousState = states[previousIndex];
+
+							state.writeStages = previousState.writeStages | previousState.readStages;
+							state.writeAccess = previousState.writeAccess;
+						}
+					}
+
+					RenderGraph::transition(access.resourceIndex, access.type, access.loadsPrevious, state, pass.barriers);
+				}
+			}
+		}
+
+		for ( uint32_t resourceIndex = 0; resourceIndex < m_resources.size(); ++resourceIndex )
+		{
+			const auto & resource = m_resources[resourceIndex];
+			const auto & state = states[resourceIndex];
+
+			if ( resource.finalLayout == VK_IMAGE_LAYOUT_UNDEFINED || resource.finalLayout == state.layout )
+			{
+				continue;
+			}
+
+			const auto srcStageMask = state.writeStages | state.readStages;
+
+			m_finalBarriers.emplace_back(Barrier{
+				.resourceIndex = resourceIndex,
+				.oldLayout = state.layout,
+				.newLayout = resource.finalLayout,
+				.srcStageMask = srcStageMask != 0 ? srcStageMask : static_cast< VkPipelineStageFlags >(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+				.dstStageMask = VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+				.srcAccessMask = state.writeAccess,
+				.dstAccessMask = 0
+			});
+		}
+	}
+
+	void
+	RenderGraph::transition (uint32_t resourceIndex, RenderGraphAccess type, bool loadsPrevious, ResourceState & state, std::vector< Barrier > & barriers) noexcept
+	{
+		auto info = accessInfo(type);
+
+		/* NOTE: A compute or transfer modification also reads the previous content. */
+		if ( loadsPrevious )
+		{
+			if ( type == RenderGraphAccess::ComputeShaderWrite )
+			{
+				info.accessMask |= VK_ACCESS_SHADER_READ_BIT;
+			}
+			else if ( type == RenderGraphAccess::TransferWrite )
+			{
+				info.accessMask |= VK_ACCESS_TRANSFER_READ_BIT;
+			}
+		}
+
+		const bool layoutChange = state.layout != info.layout;
+
+		if ( info.isWrite )
+		{
+			/* NOTE: A write waits for the previous writes (WAW) and the previous reads (WAR).
+			 * The reads only need an execution dependency, they have nothing to make available. */
+			const auto srcStageMask = state.writeStages | state.readStages;
+
+			if ( layoutChange || srcStageMask != 0 )
+			{
+				barriers.emplace_back(Barrier{
+					.resourceIndex = resourceIndex,
+					.oldLayout = state.layout,
+					.newLayout = info.layout,
+					.srcStageMask = srcStageMask != 0 ? srcStageMask : static_cast< VkPipelineStageFlags >(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+					.dstStageMask = info.stageMask,
+					.srcAccessMask = state.writeAccess,
+					.dstAccessMask = info.accessMask
+				});
+			}
+
+			state = ResourceState{info.layout, info.stageMask, info.accessMask & (VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT | VK_ACCESS_SHADER_WRITE_BIT | VK_ACCESS_TRANSFER_WRITE_BIT), 0, 0};
+
+			return;
+		}
+
+		/* NOTE: A read already made visible to this stage, in the same layout, needs nothing.
+		 * Several readers of the same version therefore share one barrier per stage. */
+		if ( !layoutChange && (state.readStages & info.stageMask) == info.stageMask )
+		{
+			return;
+		}
+
+		if ( layoutChange )
+		{
+			/* NOTE: A layout transition is a write, the previous readers must be done. */
+			const auto srcStageMask = state.writeStages | state.readStages;
+
+			barriers.emplace_back(Barrier{
+				.resourceIndex = resourceIndex,
+				.oldLayout = state.layout,
+				.newLayout = info.layout,
+				.srcStageMask = srcStageMask != 0 ? srcStageMask : static_cast< VkPipelineStageFlags >(VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT),
+				.dstStageMask = info.stageMask,
+				.srcAccessMask = state.writeAccess,
+				.dstAccessMask = info.accessMask
+			});
+
+			state = ResourceState{info.layout, info.stageMask, 0, info.stageMask, info.accessMask};
+
+			return;
+		}
+
+		if ( state.writeStages != 0 )
+		{
+			barriers.emplace_back(Barrier{
+				.resourceIndex = resourceIndex,
+				.oldLayout = state.layout,
+				.newLayout = info.layout,
+				.srcStageMask = state.writeStages,
+				.dstStageMask = info.stageMask,
+				.srcAccessMask = state.writeAccess,
+				.dstAccessMask = info.accessMask
+			});
+		}
+
+		state.readStages |= info.stageMask;
+		state.readAccess |= info.accessMask;
+	}
+
+	std::string
+	RenderGraph::dump () const noexcept
+	{
+		std::stringstream output;
+
+		const auto printBarrier = [this, &output] (const Barrier & barrier) {
+			output <<
+				"    barrier '" << m_resources[barrier.resourceIndex].name << "' " << layoutName(barrier.oldLayout) << " -> " << layoutName(barrier.newLayout) <<
+				" (stages 0x" << std::hex << barrier.srcStageMask << " -> 0x" << barrier.dstStageMask <<
+				", access 0x" << barrier.srcAccessMask << " -> 0x" << barrier.dstAccessMask << std::dec << ")" "\n";
+		};
+
+		output << "Render graph : " << m_passes.size() << " passes (" << m_passes.size() - m_executionOrder.size() << " culled), " << m_resources.size() << " images" << (m_compiled ? "" : ", NOT COMPILED") << "\n";
+
+		for ( uint32_t passIndex = 0; passIndex < m_passes.size(); ++passIndex )
+		{
+			const auto & pass = m_passes[passIndex];
+
+			output << "  Pass #" << passIndex << " '" << pass.name << "'" << (pass.culled ? " [culled]" : "") << (pass.hasSideEffects ? " [side effects]" : "") << "\n";
+
+			for ( const auto & barrier : pass.barriers )
+			{
+				printBarrier(barrier);
+			}
+
+			for ( const auto & access : pass.reads )
+			{
+				output << "    read   '" << m_resources[access.resourceIndex].name << "' v" << access.version << " (" << to_cstring(access.type) << ")" "\n";
+			}
+
+			for ( const auto & access : pass.writes )
+			{
+				output << "    " << (access.loadsPrevious ? "modify" : "write ") << " '" << m_resources[access.resourceIndex].name << "' v" << access.version << " (" << to_cstring(access.type) << ")" "\n";
+			}
+		}
+
+		if ( !m_finalBarriers.empty() )
+		{
+			output << "  Final" "\n";
+
+			for ( const auto & barrier : m_finalBarriers )
+			{
+				printBarrier(barrier);
+			}
+		}
+
+		for ( uint32_t slotIndex = 0; slotIndex < m_memorySlots.size(); ++slotIndex )
+		{
+			const auto & slot = m_memorySlots[slotIndex];
+
+			output << "  Memory slot #" << slotIndex << " (" << slot.size << " bytes) :";
+
+			for ( const auto resourceIndex : slot.resourceIndexes )
+			{
+				const auto & resource = m_resources[resourceIndex];
+
+				output << " '" << resource.name << "' [" << resource.firstUse << ", " << resource.lastUse << "]";
+			}
+
+			output << "\n";
+		}
+
+		output << "  Transient memory : " << this->transientMemorySize() << " bytes, aliased : " << this->aliasedMemorySize() << " bytes" "\n";
+
+		return output.str();
+	}
+
+	bool
+	RenderGraph::selfTest (std::string & report) noexcept
+	{
+		std::stringstream failures;
+
+		const auto check = [&failures] (bool condition, const char * message) {
+			if ( !condition )
+			{
+				failures << message << "\n";
+			}
+		};
+
+		constexpr VkDeviceSize FullSize{1920 * 1080 * 8};
+		constexpr VkDeviceSize HalfSize{960 * 540 * 8};
+
+		RenderGraph graph;
+
+		const auto sceneColor = graph.importImage("SceneColor", VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		const auto output = graph.importImage("Output", VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		const auto blurH = graph.declareTransientImage("BlurH", {960, 540, VK_FORMAT_R16G16B16A16_SFLOAT, HalfSize});
+		const auto blurV = graph.declareTransientImage("BlurV", {960, 540, VK_FORMAT_R16G16B16A16_SFLOAT, HalfSize});
+		const auto composite = graph.declareTransientImage("Composite", {1920, 1080, VK_FORMAT_R16G16B16A16_SFLOAT, FullSize});
+		const auto unused = graph.declareTransientImage("Unused", {1920, 1080, VK_FORMAT_R16G16B16A16_SFLOAT, FullSize});
+
+		const auto passBlurH = graph.addPass("BlurH");
+		graph.read(passBlurH, sceneColor, RenderGraphAccess::FragmentShaderRead);
+		graph.write(passBlurH, blurH, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passBlurV = graph.addPass("BlurV");
+		graph.read(passBlurV, blurH, RenderGraphAccess::FragmentShaderRead);
+		graph.write(passBlurV, blurV, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passUnused = graph.addPass("Unused");
+		graph.read(passUnused, sceneColor, RenderGraphAccess::FragmentShaderRead);
+		graph.write(passUnused, unused, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passComposite = graph.addPass("Composite");
+		graph.read(passComposite, sceneColor, RenderGraphAccess::FragmentShaderRead);
+		graph.read(passComposite, blurV, RenderGraphAccess::FragmentShaderRead);
+		graph.write(passComposite, composite, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passResolve = graph.addPass("Resolve");
+		graph.read(passResolve, composite, RenderGraphAccess::FragmentShaderRead);
+		graph.write(passResolve, output, RenderGraphAccess::ColorAttachmentWrite);
+
+		check(graph.compile(), "The graph does not compile.");
+
+		/* Culling. */
+		check(graph.isPassCulled(passUnused), "The pass writing an unread image is not culled.");
+		check(graph.executionOrder() == std::vector< uint32_t >{passBlurH, passBlurV, passComposite, passResolve}, "The execution order is wrong.");
+
+		/* Barriers: the scene color is already readable, each transient gets one transition
+		 * to its attachment layout, then one to the shader read layout for its reader. */
+		check(graph.passBarriers(passBlurH).size() == 1, "BlurH must only transition its attachment.");
+		check(graph.passBarriers(passBlurV).size() == 2, "BlurV must transition its input and its attachment.");
+
+		const auto & compositeBarriers = graph.passBarriers(passComposite);
+
+		check(compositeBarriers.size() == 2, "Composite must transition its blurred input and its attachment.");
+
+		if ( !compositeBarriers.empty() )
+		{
+			const auto & barrier = compositeBarriers.front();
+
+			check(barrier.resourceIndex == blurV && barrier.oldLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL && barrier.newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, "The blurred input transition is wrong.");
+			check(barrier.srcStageMask == VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT && barrier.srcAccessMask == VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, "The blurred input does not wait for its write.");
+		}
+
+		check(graph.finalBarriers().size() == 1 && graph.finalBarriers().front().newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, "The output is not left in its final layout.");
+
+		/* Aliasing: BlurH dies before BlurV's reader, Composite starts after BlurH died. */
+		check(graph.memorySlot(unused) == InvalidIndex, "A culled image got memory.");
+		check(graph.memorySlot(blurH) != graph.memorySlot(blurV), "Overlapping images share memory.");
+		check(graph.memorySlot(composite) != graph.memorySlot(blurV), "Overlapping images share memory.");
+		check(graph.memorySlot(blurH) == graph.memorySlot(composite), "BlurH does not reuse the memory of Composite.");
+		check(graph.aliasedMemorySize() == FullSize + HalfSize, "The aliased memory size is wrong.");
+		check(graph.transientMemorySize() == FullSize + HalfSize * 2, "The transient memory size is wrong.");
+
+		/* Aliasing barrier: Composite waits for the last reader of BlurH. */
+		if ( compositeBarriers.size() == 2 )
+		{
+			check((compositeBarriers.back().srcStageMask & VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT) != 0, "Composite does not wait for the previous occupant of its memory.");
+		}
+
+		/* Load-and-keep: a modification keeps the producer of the content it loads,
+		 * a plain write over a version nobody read culls its producer. */
+		RenderGraph loadGraph;
+
+		const auto hdrColor = loadGraph.declareTransientImage("HDRColor", {1920, 1080, VK_FORMAT_R16G16B16A16_SFLOAT, FullSize});
+		const auto finalColor = loadGraph.importImage("FinalColor", VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+		const auto passOverwritten = loadGraph.addPass("Overwritten");
+		loadGraph.write(passOverwritten, hdrColor, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passOpaque = loadGraph.addPass("Opaque");
+		loadGraph.write(passOpaque, hdrColor, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passTranslucent = loadGraph.addPass("Translucent");
+		loadGraph.modify(passTranslucent, hdrColor, RenderGraphAccess::ColorAttachmentWrite);
+
+		const auto passToneMapping = loadGraph.addPass("ToneMapping");
+		loadGraph.read(passToneMapping, hdrColor, RenderGraphAccess::FragmentShaderRead);
+		loadGraph.write(passToneMapping, finalColor, RenderGraphAccess::ColorAttachmentWrite);
+
+		check(loadGraph.compile(), "The load-and-keep graph does not compile.");
+		check(loadGraph.isPassCulled(passOverwritten), "The pass overwritten without being read is not culled.");
+		check(!loadGraph.isPassCulled(passOpaque), "The producer of the content loaded by a modification is culled.");
+		check(loadGraph.executionOrder() == std::vector< uint32_t >{passOpaque, passTranslucent, passToneMapping}, "The load-and-keep execution order is wrong.");
+
+		const auto & translucentBarriers = loadGraph.passBarriers(passTranslucent);
+
+		check(translucentBarriers.size() == 1, "The modification must wait once for the previous write.");
+
+		if ( !translucentBarriers.empty() )
+		{
+			const auto & barrier = translucentBarriers.front();
+
+			check(barrier.oldLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL && barrier.newLayout == VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, "The modification changes the layout of the loaded content.");
+			check(barrier.srcAccessMask == VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT && (barrier.dstAccessMask & VK_ACCESS_COLOR_ATTACHMENT_READ_BIT) != 0, "The modification does not wait for the loaded content.");
+		}
+
+		/* A transient modified before any write is an error. */
+		RenderGraph unloadedGraph;
+
+		const auto unloadedImage = unloadedGraph.declareTransientImage("Image", {16, 16, VK_FORMAT_R8G8B8A8_UNORM, 1024});
+		const auto unloadedPass = unloadedGraph.addPass("Pass", true);
+		unloadedGraph.modify(unloadedPass, unloadedImage, RenderGraphAccess::ColorAttachmentWrite);
+
+		check(!unloadedGraph.compile(), "A transient image modified before any write compiles.");
+
+		/* A transient read before any write is an error. */
+		RenderGraph invalidGraph;
+
+		const auto image = invalidGraph.declareTransientImage("Image", {16, 16, VK_FORMAT_R8G8B8A8_UNORM, 1024});
+		const auto pass = invalidGraph.addPass("Pass", true);
+		invalidGraph.read(pass, image, RenderGraphAccess::FragmentShaderRead);
+
+		check(!invalidGraph.compile(), "A transient image read before any write compiles.");
+
+		report = failures.str();
+
+		if ( !report.empty() )
+		{
+			report += graph.dump() + loadGraph.dump();
+
+			return false;
+		}
+
+		report = graph.dump() + loadGraph.dump();
+
+		return true;
+	}
+}
@@ -0,0 +1,390 @@
+/*
+ * src/Graphics/RenderGraph.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+/* Third-party inclusions. */
+#include <vulkan/vulkan.h>
+
+namespace EmEn::Graphics
+{
+	/**
+	 * @brief The ways a render graph pass can use an image.
+	 * @since 0.9.53
+	 */
+	enum class RenderGraphAccess : uint8_t
+	{
+		ColorAttachmentWrite,
+		DepthAttachmentWrite,
+		DepthAttachmentRead,
+		FragmentShaderRead,
+		ComputeShaderRead,
+		ComputeShaderWrite,
+		TransferRead,
+		TransferWrite
+	};
+
+	/**
+	 * @brief Returns a C-string version of the access.
+	 * @param access The access.
+	 * @return const char *
+	 */
+	[[nodiscard]]
+	EMEN_API const char * to_cstring (RenderGraphAccess access) noexcept;
+
+	/**
+	 * @brief A frame-level render graph compiler.
+	 *
+	 * Passes declare the images they read and write, in submission order. The compile step
+	 * culls the passes contributing to no output, schedules the minimal image barrier before
+	 * each kept pass and lets the transient images whose lifetimes don't overlap share the
+	 * same memory.
+	 *
+	 * Every write produces a new version of the image, a read consumes the latest version
+	 * declared before it. A modification (load-and-keep attachment, blending over the previous
+	 * content) does both: it consumes the latest version and produces the next one, so the
+	 * producer of the loaded content is kept. The declaration order is therefore the dependency
+	 * order, the compile step never moves a pass before one it depends on.
+	 *
+	 * @note This is a pure CPU component, it does not touch the device. The barriers and
+	 * the memory slots are plain descriptions. The post-process chain is its only client and
+	 * only dumps them, the recording code does not apply them yet.
+	 * @since 0.9.53
+	 */
+	class EMEN_API RenderGraph final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"RenderGraph"};
+
+			/** @brief The index returned for an invalid declaration. */
+			static constexpr uint32_t InvalidIndex{std::numeric_limits< uint32_t >::max()};
+
+			/** @brief The description of a transient image, owned by the graph for the duration of the frame. */
+			struct ImageDescription
+			{
+				uint32_t width{0};
+				uint32_t height{0};
+				VkFormat format{VK_FORMAT_UNDEFINED};
+				/** @brief The memory size from the image requirements. */
+				VkDeviceSize memorySize{0};
+				/** @brief The compatible memory types from the image requirements. Two images can share memory only if they have a type in common. */
+				uint32_t memoryTypeBits{std::numeric_limits< uint32_t >::max()};
+			};
+
+			/** @brief An image layout transition and its synchronization scope. */
+			struct Barrier
+			{
+				uint32_t resourceIndex{InvalidIndex};
+				VkImageLayout oldLayout{VK_IMAGE_LAYOUT_UNDEFINED};
+				VkImageLayout newLayout{VK_IMAGE_LAYOUT_UNDEFINED};
+				VkPipelineStageFlags srcStageMask{VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT};
+				VkPipelineStageFlags dstStageMask{VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT};
+				VkAccessFlags srcAccessMask{0};
+				VkAccessFlags dstAccessMask{0};
+			};
+
+			/** @brief A block of memory shared by transient images with disjoint lifetimes. */
+			struct MemorySlot
+			{
+				VkDeviceSize size{0};
+				uint32_t memoryTypeBits{0};
+				std::vector< uint32_t > resourceIndexes;
+			};
+
+			/**
+			 * @brief Constructs an empty render graph.
+			 */
+			RenderGraph () noexcept = default;
+
+			/**
+			 * @brief Declares a transient image.
+			 * @param name The image name, for the dump.
+			 * @param description A reference to the image description.
+			 * @return uint32_t The resource index.
+			 */
+			uint32_t declareTransientImage (const std::string & name, const ImageDescription & description) noexcept;
+
+			/**
+			 * @brief Declares an image owned outside the graph.
+			 * @param name The image name, for the dump.
+			 * @param initialLayout The layout of the image before the first pass.
+			 * @param finalLayout The layout the image must be left in. VK_IMAGE_LAYOUT_UNDEFINED when the image is not an output of the graph.
+			 * @return uint32_t The resource index.
+			 */
+			uint32_t importImage (const std::string & name, VkImageLayout initialLayout, VkImageLayout finalLayout = VK_IMAGE_LAYOUT_UNDEFINED) noexcept;
+
+			/**
+			 * @brief Declares a pass.
+			 * @param name The pass name, for the dump.
+			 * @param hasSideEffects Keeps the pass even if it contributes to no output (readback, profiling).
+			 * @return uint32_t The pass index.
+			 */
+			uint32_t addPass (const std::string & name, bool hasSideEffects = false) noexcept;
+
+			/**
+			 * @brief Declares an image read by a pass.
+			 * @param passIndex The pass index.
+			 * @param resourceIndex The resource index.
+			 * @param access The read access.
+			 * @return bool
+			 */
+			bool read (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access) noexcept;
+
+			/**
+			 * @brief Declares an image written by a pass.
+			 * @param passIndex The pass index.
+			 * @param resourceIndex The resource index.
+			 * @param access The write access.
+			 * @return bool
+			 */
+			bool write (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access) noexcept;
+
+			/**
+			 * @brief Declares an image modified by a pass: the previous content is loaded, then written.
+			 * @param passIndex The pass index.
+			 * @param resourceIndex The resource index.
+			 * @param access The write access.
+			 * @return bool
+			 */
+			bool modify (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access) noexcept;
+
+			/**
+			 * @brief Compiles the graph: culling, barriers and memory aliasing.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool compile () noexcept;
+
+			/**
+			 * @brief Clears every declaration and the compilation result.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+			/**
+			 * @brief Returns whether the graph is compiled.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isCompiled () const noexcept
+			{
+				return m_compiled;
+			}
+
+			/**
+			 * @brief Returns the kept pass indexes, in execution order.
+			 * @return const std::vector< uint32_t > &
+			 */
+			[[nodiscard]]
+			const std::vector< uint32_t > &
+			executionOrder () const noexcept
+			{
+				return m_executionOrder;
+			}
+
+			/**
+			 * @brief Returns whether a pass was culled.
+			 * @param passIndex The pass index.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isPassCulled (uint32_t passIndex) const noexcept;
+
+			/**
+			 * @brief Returns the barriers to record before a pass.
+			 * @param passIndex The pass index.
+			 * @return const std::vector< Barrier > &
+			 */
+			[[nodiscard]]
+			const std::vector< Barrier > & passBarriers (uint32_t passIndex) const noexcept;
+
+			/**
+			 * @brief Returns the barriers to record after the last pass, leaving the outputs in their final layout.
+			 * @return const std::vector< Barrier > &
+			 */
+			[[nodiscard]]
+			const std::vector< Barrier > &
+			finalBarriers () const noexcept
+			{
+				return m_finalBarriers;
+			}
+
+			/**
+			 * @brief Returns the memory slots of the transient images.
+			 * @return const std::vector< MemorySlot > &
+			 */
+			[[nodiscard]]
+			const std::vector< MemorySlot > &
+			memorySlots () const noexcept
+			{
+				return m_memorySlots;
+			}
+
+			/**
+			 * @brief Returns the memory slot of a transient image.
+			 * @param resourceIndex The resource index.
+			 * @return uint32_t InvalidIndex for an imported or unused image.
+			 */
+			[[nodiscard]]
+			uint32_t memorySlot (uint32_t resourceIndex) const noexcept;
+
+			/**
+			 * @brief Returns the memory the transient images would use without aliasing.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize transientMemorySize () const noexcept;
+
+			/**
+			 * @brief Returns the memory the transient images use with aliasing.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize aliasedMemorySize () const noexcept;
+
+			/**
+			 * @brief Returns a readable description of the compiled graph.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string dump () const noexcept;
+
+			/**
+			 * @brief Compiles a known graph and checks the culling, the barriers and the aliasing.
+			 * @param report A reference to a string receiving the failures.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool selfTest (std::string & report) noexcept;
+
+		private:
+
+			/** @brief One image use by a pass. */
+			struct Access
+			{
+				uint32_t resourceIndex{InvalidIndex};
+				/** @brief The resource version read, or produced by a write. */
+				uint32_t version{0};
+				RenderGraphAccess type{RenderGraphAccess::FragmentShaderRead};
+				/** @brief A write loading the previous version, which it consumes. */
+				bool loadsPrevious{false};
+			};
+
+			struct Pass
+			{
+				std::string name;
+				std::vector< Access > reads;
+				std::vector< Access > writes;
+				std::vector< Barrier > barriers;
+				bool hasSideEffects{false};
+				bool culled{false};
+			};
+
+			struct Resource
+			{
+				std::string name;
+				ImageDescription description;
+				VkImageLayout initialLayout{VK_IMAGE_LAYOUT_UNDEFINED};
+				VkImageLayout finalLayout{VK_IMAGE_LAYOUT_UNDEFINED};
+				/** @brief The pass that produced each version. Version 0 is the content before the graph. */
+				std::vector< uint32_t > producers{InvalidIndex};
+				uint32_t firstUse{InvalidIndex};
+				uint32_t lastUse{InvalidIndex};
+				uint32_t memorySlot{InvalidIndex};
+				bool imported{false};
+			};
+
+			/** @brief The synchronization state of an image between two passes. */
+			struct ResourceState
+			{
+				VkImageLayout layout{VK_IMAGE_LAYOUT_UNDEFINED};
+				VkPipelineStageFlags writeStages{0};
+				VkAccessFlags writeAccess{0};
+				VkPipelineStageFlags readStages{0};
+				VkAccessFlags readAccess{0};
+			};
+
+			/**
+			 * @brief Declares a write, loading the previous version or not.
+			 * @param passIndex The pass index.
+			 * @param resourceIndex The resource index.
+			 * @param access The write access.
+			 * @param loadsPrevious Whether the previous version is loaded.
+			 * @return bool
+			 */
+			bool declareWrite (uint32_t passIndex, uint32_t resourceIndex, RenderGraphAccess access, bool loadsPrevious) noexcept;
+
+			/**
+			 * @brief Marks the passes contributing to no output as culled.
+			 * @return void
+			 */
+			void cullPasses () noexcept;
+
+			/**
+			 * @brief Computes the lifetimes of the images and the barriers of the kept passes.
+			 * @return void
+			 */
+			void scheduleBarriers () noexcept;
+
+			/**
+			 * @brief Assigns the transient images to memory slots.
+			 * @return void
+			 */
+			void assignMemorySlots () noexcept;
+
+			/**
+			 * @brief Adds the barrier needed for an access to an image, and updates its state.
+			 * @param resourceIndex The resource index.
+			 * @param type The access type.
+			 * @param loadsPrevious Whether a write loads the previous content.
+			 * @param state A reference to the resource state.
+			 * @param barriers A reference to the barrier list.
+			 * @return void
+			 */
+			static void transition (uint32_t resourceIndex, RenderGraphAccess type, bool loadsPrevious, ResourceState & state, std::vector< Barrier > & barriers) noexcept;
+
+			std::vector< Pass > m_passes;
+			std::vector< Resource > m_resources;
+			std::vector< uint32_t > m_executionOrder;
+			std::vector< Barrier > m_finalBarriers;
+			std::vector< MemorySlot > m_memorySlots;
+			bool m_compiled{false};
+	};
+}
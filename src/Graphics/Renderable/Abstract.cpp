@@ -62,6 +62,19 @@ namespace EmEn::Graphics::Renderable
 		m_programCache[renderTarget][key] = program;
 	}
 
+	void
+	Abstract::cachePrograms (const std::shared_ptr< const RenderTarget::Abstract > & renderTarget, const std::vector< std::pair< ProgramCacheKey, std::shared_ptr< Saphir::Program > > > & programs) const noexcept
+	{
+		const std::lock_guard lock{m_programCacheMutex};
+
+		auto & renderTargetPrograms = m_programCache[renderTarget];
+
+		for ( const auto & [key, program] : programs )
+		{
+			renderTargetPrograms[key] = program;
+		}
+	}
+
 	void
 	Abstract::clearProgramCache (const std::shared_ptr< const RenderTarget::Abstract > & renderTarget) const noexcept
 	{
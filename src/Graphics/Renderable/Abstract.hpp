@@ -30,6 +30,8 @@
 #include <memory>
 #include <shared_mutex>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 /* Local inclusions for inheritances. */
 #include "Resources/ResourceTrait.hpp"
@@ -198,6 +200,15 @@ namespace EmEn::Graphics::Renderable
 			 */
 			void cacheProgram (const std::shared_ptr< const RenderTarget::Abstract > & renderTarget, const ProgramCacheKey & key, const std::shared_ptr< Saphir::Program > & program) const noexcept;
 
+			/**
+			 * @brief Caches a batch of programs for the given render target at once.
+			 * @note Used by the asynchronous preparation: readers never observe a partially prepared render target.
+			 * @param renderTarget A reference to the render target.
+			 * @param programs A reference to a list of program cache keys and programs.
+			 * @return void
+			 */
+			void cachePrograms (const std::shared_ptr< const RenderTarget::Abstract > & renderTarget, const std::vector< std::pair< ProgramCacheKey, std::shared_ptr< Saphir::Program > > > & programs) const noexcept;
+
 			/**
 			 * @brief Clears all cached programs for a specific render target.
 			 * @param renderTarget A reference to the render target.
@@ -77,6 +77,43 @@ namespace EmEn::Graphics::Renderable
 		return m_geometry->localData().getNormalAt(worldPosition[X], worldPosition[Z]);
 	}
 
+	void
+	BasicGroundResource::getLevelsAt (const float * positionsX, const float * positionsZ, float * levels, size_t count, ThreadPool * threadPool) const noexcept
+	{
+		if ( !m_heightField.isValid() )
+		{
+			GroundLevelInterface::getLevelsAt(positionsX, positionsZ, levels, count, threadPool);
+
+			return;
+		}
+
+		m_heightField.levelsAt(positionsX, positionsZ, levels, count, threadPool);
+	}
+
+	void
+	BasicGroundResource::getNormalsAt (const float * positionsX, const float * positionsZ, Vector< 3, float > * normals, size_t count, ThreadPool * threadPool) const noexcept
+	{
+		if ( !m_heightField.isValid() )
+		{
+			GroundLevelInterface::getNormalsAt(positionsX, positionsZ, normals, count, threadPool);
+
+			return;
+		}
+
+		m_heightField.normalsAt(positionsX, positionsZ, normals, count, threadPool);
+	}
+
+	bool
+	BasicGroundResource::raycast (const Vector< 3, float > & origin, const Vector< 3, float > & direction, float maxDistance, float & hitDistance) const noexcept
+	{
+		if ( !m_heightField.isValid() )
+		{
+			return GroundLevelInterface::raycast(origin, direction, maxDistance, hitDistance);
+		}
+
+		return m_heightField.raycast(origin, direction, maxDistance, hitDistance);
+	}
+
 	bool
 	BasicGroundResource::load () noexcept
 	{
@@ -455,6 +492,12 @@ namespace EmEn::Graphics::Renderable
 			}
 		}
 
+		/* NOTE: Copy the ground levels for the batched queries and the raycasts. */
+		if ( m_geometry != nullptr && !m_heightField.buildFromGrid(m_geometry->localData()) )
+		{
+			TraceWarning{ClassId} << "Unable to build the height field of '" << this->name() << "', ground queries will use the vertex grid.";
+		}
+
 		this->setReadyForInstantiation(true);
 
 		return true;
@@ -38,6 +38,7 @@
 
 /* Local inclusions for usages. */
 #include "Graphics/Geometry/VertexGridResource.hpp"
+#include "Scenes/GroundHeightField.hpp"
 
 /* Forward declarations. */
 namespace EmEn::Resources
@@ -224,6 +225,16 @@ namespace EmEn::Graphics::Renderable
 			[[nodiscard]]
 			Base::Math::Vector< 3, float > getNormalAt (const Base::Math::Vector< 3, float > & worldPosition) const noexcept override;
 
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getLevelsAt() const */
+			void getLevelsAt (const float * positionsX, const float * positionsZ, float * levels, size_t count, Base::ThreadPool * threadPool) const noexcept override;
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getNormalsAt() const */
+			void getNormalsAt (const float * positionsX, const float * positionsZ, Base::Math::Vector< 3, float > * normals, size_t count, Base::ThreadPool * threadPool) const noexcept override;
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::raycast() const */
+			[[nodiscard]]
+			bool raycast (const Base::Math::Vector< 3, float > & origin, const Base::Math::Vector< 3, float > & direction, float maxDistance, float & hitDistance) const noexcept override;
+
 			/** @copydoc EmEn::Scenes::GroundLevelInterface::updateVisibility() */
 			void
 			updateVisibility (const Base::Math::Vector< 3, float > & worldPosition) noexcept override
@@ -329,6 +340,7 @@ namespace EmEn::Graphics::Renderable
 
 			std::shared_ptr< Geometry::VertexGridResource > m_geometry;
 			std::shared_ptr< Material::Interface > m_material;
+			Scenes::GroundHeightField m_heightField;
 			RasterizationOptions m_rasterizationOptions;
 	};
 }
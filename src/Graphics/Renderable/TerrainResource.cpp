@@ -523,6 +523,12 @@ namespace EmEn::Graphics::Renderable
 			}
 		}
 
+		/* NOTE: Copy the ground levels for the batched queries and the raycasts. */
+		if ( !m_heightField.buildFromGrid(m_localData) )
+		{
+			TraceWarning{ClassId} << "Unable to build the height field of '" << this->name() << "', ground queries will use the vertex grid.";
+		}
+
 		this->setReadyForInstantiation(true);
 
 		return true;
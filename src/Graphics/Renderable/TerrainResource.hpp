@@ -36,6 +36,7 @@
 /* Local inclusions for usages. */
 #include "Graphics/Geometry/AdaptiveVertexGridResource.hpp"
 #include "Graphics/Geometry/VertexGridResource.hpp"
+#include "Scenes/GroundHeightField.hpp"
 
 /* Forward declarations. */
 namespace EmEn::Resources
@@ -230,6 +231,47 @@ namespace EmEn::Graphics::Renderable
 				return m_localData.getNormalAt(worldPosition[Base::Math::X], worldPosition[Base::Math::Z]);
 			}
 
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getLevelsAt() const */
+			void
+			getLevelsAt (const float * positionsX, const float * positionsZ, float * levels, size_t count, Base::ThreadPool * threadPool) const noexcept override
+			{
+				if ( !m_heightField.isValid() )
+				{
+					GroundLevelInterface::getLevelsAt(positionsX, positionsZ, levels, count, threadPool);
+
+					return;
+				}
+
+				m_heightField.levelsAt(positionsX, positionsZ, levels, count, threadPool);
+			}
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getNormalsAt() const */
+			void
+			getNormalsAt (const float * positionsX, const float * positionsZ, Base::Math::Vector< 3, float > * normals, size_t count, Base::ThreadPool * threadPool) const noexcept override
+			{
+				if ( !m_heightField.isValid() )
+				{
+					GroundLevelInterface::getNormalsAt(positionsX, positionsZ, normals, count, threadPool);
+
+					return;
+				}
+
+				m_heightField.normalsAt(positionsX, positionsZ, normals, count, threadPool);
+			}
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::raycast() const */
+			[[nodiscard]]
+			bool
+			raycast (const Base::Math::Vector< 3, float > & origin, const Base::Math::Vector< 3, float > & direction, float maxDistance, float & hitDistance) const noexcept override
+			{
+				if ( !m_heightField.isValid() )
+				{
+					return GroundLevelInterface::raycast(origin, direction, maxDistance, hitDistance);
+				}
+
+				return m_heightField.raycast(origin, direction, maxDistance, hitDistance);
+			}
+
 			/** @copydoc EmEn::Scenes::GroundLevelInterface::updateVisibility() */
 			void updateVisibility (const Base::Math::Vector< 3, float > & worldPosition) noexcept override;
 
@@ -346,6 +388,7 @@ namespace EmEn::Graphics::Renderable
 			std::shared_ptr< Geometry::AdaptiveVertexGridResource > m_geometry;
 			std::shared_ptr< Material::Interface > m_material;
 			Base::VertexFactory::Grid< float > m_localData;
+			Scenes::GroundHeightField m_heightField;
 			Base::Math::Vector< 2, float > m_lastAdaptiveGridPositionUpdated;
 			RasterizationOptions m_rasterizationOptions;
 			float m_visibleSize{DefaultVisibleSize};
@@ -576,6 +576,26 @@ namespace EmEn::Graphics::RenderableInstance
 		return m_renderable->hasAnyCachedProgramsForRenderPass(renderTarget, renderPassHandle);
 	}
 
+	const Geometry::Interface *
+	Abstract::drawableGeometry (uint32_t LODLevel) const noexcept
+	{
+		const auto * geometry = m_renderable->geometry(LODLevel);
+
+		if ( geometry == nullptr )
+		{
+			return nullptr;
+		}
+
+		/* NOTE: With a dedicated transfer queue, a geometry is loaded before its buffers are copied.
+		 * Each LOD is drawn once the rendering queue owns its buffers, the frames in between do not wait for the copy. */
+		if ( !geometry->isUploadComplete() )
+		{
+			return nullptr;
+		}
+
+		return geometry;
+	}
+
 	bool
 	Abstract::isMissingSkinningResources () const noexcept
 	{
@@ -633,8 +653,9 @@ namespace EmEn::Graphics::RenderableInstance
 		 * (Scenes::Scene::checkRenderableInstanceForRendering) re-invokes this method on
 		 * subsequent frames until the renderable becomes ready. There is NO event that
 		 * relaunches program generation: the resource LoadFinished event only refreshes
-		 * entity-level properties (AABB, mass), and Vulkan program/pipeline creation must
-		 * run on the render thread, never on the resource loader thread. */
+		 * entity-level properties (AABB, mass), and Vulkan program/pipeline creation is driven
+		 * by the render thread (inline or through a program preparation task), never by the
+		 * resource loader thread. */
 		if ( !m_renderable->isReadyForInstantiation() )
 		{
 			return true;
@@ -705,8 +726,9 @@ namespace EmEn::Graphics::RenderableInstance
 		 * (Scenes::Scene::checkRenderableInstanceForRendering) re-invokes this method on
 		 * subsequent frames until the renderable becomes ready. There is NO event that
 		 * relaunches program generation: the resource LoadFinished event only refreshes
-		 * entity-level properties (AABB, mass), and Vulkan program/pipeline creation must
-		 * run on the render thread, never on the resource loader thread. */
+		 * entity-level properties (AABB, mass), and Vulkan program/pipeline creation is driven
+		 * by the render thread (inline or through a program preparation task), never by the
+		 * resource loader thread. */
 		if ( !m_renderable->isReadyForInstantiation() )
 		{
 			return true;
@@ -718,6 +740,21 @@ namespace EmEn::Graphics::RenderableInstance
 			return false;
 		}
 
+		std::string errorMessage;
+
+		if ( !this->generateRenderPrograms(scene, renderTarget, renderPassTypes, renderer, errorMessage) )
+		{
+			this->setBroken(errorMessage);
+
+			return false;
+		}
+
+		return true;
+	}
+
+	bool
+	Abstract::generateRenderPrograms (const Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const StaticVector< RenderPassType, MaxPassCount > & renderPassTypes, Renderer & renderer, std::string & errorMessage) noexcept
+	{
 		const auto layerCount = m_renderable->layerCount();
 
 		/* NOTE: These tests only exist in debug mode because they are already performed beyond
@@ -726,13 +763,13 @@ namespace EmEn::Graphics::RenderableInstance
 		{
 			if ( layerCount == 0 )
 			{
-				std::stringstream errorMessage;
+				std::stringstream message;
 
-				errorMessage <<
+				message <<
 					"The renderable interface has no layer ! It must have at least one. "
 					"Unable to setup the renderable instance '" << m_renderable->name() << "' for rendering.";
 
-				this->setBroken(errorMessage.str());
+				errorMessage = message.str();
 
 				return false;
 			}
@@ -740,18 +777,23 @@ namespace EmEn::Graphics::RenderableInstance
 			/* NOTE: The geometry interface is the same for every layer of the renderable interface. */
 			if ( const auto * geometry = m_renderable->geometry(0); geometry == nullptr )
 			{
-				std::stringstream errorMessage;
+				std::stringstream message;
 
-				errorMessage <<
+				message <<
 					"The renderable interface has no geometry interface ! "
 					"Unable to setup the renderable instance '" << m_renderable->name() << "' for rendering.";
 
-				this->setBroken(errorMessage.str());
+				errorMessage = message.str();
 
 				return false;
 			}
 		}
 
+		/* NOTE: The programs are published in one batch at the end. isReadyToRender() tests
+		 * for any program of the render pass, a partial publication would let the instance be
+		 * drawn while a preparation task is still generating its other passes. */
+		std::vector< std::pair< Renderable::ProgramCacheKey, std::shared_ptr< Saphir::Program > > > programs;
+
 		const auto mainRenderPassHandle = reinterpret_cast< uint64_t >(renderTarget->framebuffer()->renderPass()->handle());
 
 		/* If the render target provides a post-process framebuffer (e.g. SwapChain),
@@ -804,8 +846,8 @@ namespace EmEn::Graphics::RenderableInstance
 				{
 					const auto * material = m_renderable->material(layerIndex);
 
-					std::stringstream errorMessage;
-					errorMessage <<
+					std::stringstream message;
+					message <<
 						"Unable to generate the shader program !\n"
 						"  Renderable  : " << m_renderable->name() << "\n"
 						"  Material	: " << (material != nullptr ? material->name() : "null") << "\n"
@@ -813,13 +855,12 @@ namespace EmEn::Graphics::RenderableInstance
 						"  RenderPass  : " << to_string(renderPassType) << "\n"
 						"  Layer	   : " << layerIndex;
 
-					this->setBroken(errorMessage.str());
+					errorMessage = message.str();
 
 					return false;
 				}
 
-				/* Cache the program on the Renderable for future instances. */
-				m_renderable->cacheProgram(renderTarget, cacheKey, generator.shaderProgram());
+				programs.emplace_back(cacheKey, generator.shaderProgram());
 			}
 		}
 
@@ -845,11 +886,13 @@ namespace EmEn::Graphics::RenderableInstance
 					continue;
 				}
 
-				/* Cache the program on the Renderable for future instances. */
-				m_renderable->cacheProgram(renderTarget, cacheKey, generator.shaderProgram());
+				programs.emplace_back(cacheKey, generator.shaderProgram());
 			}
 		}
 
+		/* Cache the programs on the Renderable for future instances. */
+		m_renderable->cachePrograms(renderTarget, programs);
+
 		return true;
 	}
 
@@ -1006,6 +1049,11 @@ namespace EmEn::Graphics::RenderableInstance
 	void
 	Abstract::castShadows (uint32_t readStateIndex, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex, const CartesianFrame< float > * worldCoordinates, const CommandBuffer & commandBuffer, uint32_t LODLevel) const noexcept
 	{
+		if ( this->drawableGeometry(LODLevel) == nullptr )
+		{
+			return;
+		}
+
 		const auto renderPassHandle = reinterpret_cast< uint64_t >(renderTarget->framebuffer()->renderPass()->handle());
 		const auto cacheKey = this->buildProgramCacheKey(Renderable::ProgramType::ShadowCasting, RenderPassType::SimplePass, renderPassHandle, layerIndex);
 		const auto program = this->resolveProgram(renderTarget, cacheKey);
@@ -1112,6 +1160,13 @@ namespace EmEn::Graphics::RenderableInstance
 	void
 	Abstract::render (uint32_t readStateIndex, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Scenes::Component::AbstractLightEmitter * lightEmitter, RenderPassType renderPassType, uint32_t layerIndex, const CartesianFrame< float > * worldCoordinates, const CommandBuffer & commandBuffer, uint32_t LODLevel, const BindlessTextureManager * bindlessTexturesManager, const DescriptorSet * sceneTransformsDS) const noexcept
 	{
+		const auto * geometry = this->drawableGeometry(LODLevel);
+
+		if ( geometry == nullptr )
+		{
+			return;
+		}
+
 		/* For grab-pass layers on render targets with a post-process framebuffer,
 		 * use the post-process render pass handle (pipelines were created for it). */
 		const auto * postProcessFB = renderTarget->postProcessFramebuffer();
@@ -1139,7 +1194,6 @@ namespace EmEn::Graphics::RenderableInstance
 			return;
 		}
 
-		const auto * geometry = m_renderable->geometry(LODLevel);
 		const auto pipelineLayout = program->pipelineLayout();
 
 		/* Bind the graphics pipeline. */
@@ -1307,6 +1361,13 @@ namespace EmEn::Graphics::RenderableInstance
 	void
 	Abstract::render (uint32_t readStateIndex, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Scenes::Component::AbstractLightEmitter * lightEmitter, RenderPassType renderPassType, uint32_t layerIndex, const CartesianFrame< float > * worldCoordinates, const CommandBuffer & commandBuffer, RenderStateTracker & tracker, uint32_t LODLevel, const BindlessTextureManager * bindlessTexturesManager, const DescriptorSet * sceneTransformsDS) const noexcept
 	{
+		const auto * geometry = this->drawableGeometry(LODLevel);
+
+		if ( geometry == nullptr )
+		{
+			return;
+		}
+
 		/* For grab-pass layers on render targets with a post-process framebuffer,
 		 * use the post-process render pass handle (pipelines were created for it). */
 		const auto * postProcessFB = renderTarget->postProcessFramebuffer();
@@ -1334,7 +1395,6 @@ namespace EmEn::Graphics::RenderableInstance
 			return;
 		}
 
-		const auto * geometry = m_renderable->geometry(LODLevel);
 		const auto pipelineLayout = program->pipelineLayout();
 		const auto pipelineHandle = program->graphicsPipeline()->handle();
 
@@ -1577,6 +1637,11 @@ namespace EmEn::Graphics::RenderableInstance
 	void
 	Abstract::renderTBNSpace (uint32_t readStateIndex, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t layerIndex, const CartesianFrame< float > * worldCoordinates, const CommandBuffer & commandBuffer) const noexcept
 	{
+		if ( this->drawableGeometry(0) == nullptr )
+		{
+			return;
+		}
+
 		const auto renderPassHandle = reinterpret_cast< uint64_t >(renderTarget->framebuffer()->renderPass()->handle());
 		const auto cacheKey = this->buildProgramCacheKey(Renderable::ProgramType::TBNSpace, RenderPassType::SimplePass, renderPassHandle, layerIndex);
 		const auto program = this->resolveProgram(renderTarget, cacheKey);
@@ -37,6 +37,7 @@
 #include <mutex>
 #include <source_location>
 #include <string>
+#include <utility>
 #include <vector>
 
 /* Local inclusions for inheritances. */
@@ -547,6 +548,14 @@ namespace EmEn::Graphics::RenderableInstance
 				return !m_skinningDescriptorSets.empty();
 			}
 
+			/**
+			 * @brief Returns whether the renderable declares skeletal data while the skinning GPU resources are not created yet.
+			 * @note No program can be generated for this instance before prepareSkinningResources().
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isMissingSkinningResources () const noexcept;
+
 			/**
 			 * @brief Sets the frame cursor used to select the skinning SSBO section of the frame
 			 * being recorded and to deduplicate the per-frame pose upload.
@@ -703,6 +712,37 @@ namespace EmEn::Graphics::RenderableInstance
 			[[nodiscard]]
 			bool getReadyForRender (const Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Base::StaticVector< RenderPassType, MaxPassCount > & renderPassTypes, Renderer & renderer) noexcept;
 
+			/**
+			 * @brief Generates and caches the rendering programs of this instance for a render target.
+			 * @note This is the generation part of getReadyForRender(). It does not change the
+			 * instance state, so it can run on a thread pool task; the caller reports a failure
+			 * with setBroken() from the render thread. The renderable must be ready for instantiation
+			 * and prepareSkinningResources() must have succeeded. The programs are published
+			 * all at once when every one of them is generated.
+			 * @param scene A reference to the scene.
+			 * @param renderTarget A reference to the render target smart pointer.
+			 * @param renderPassTypes A list of render pass types to prepare.
+			 * @param renderer A writable reference to the graphics renderer for shader generation.
+			 * @param errorMessage A reference to a string receiving the failure message.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool generateRenderPrograms (const Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Base::StaticVector< RenderPassType, MaxPassCount > & renderPassTypes, Renderer & renderer, std::string & errorMessage) noexcept;
+
+			/**
+			 * @brief Creates the skeletal skinning GPU resources if the renderable declares
+			 * skeletal data and the instance does not own them yet.
+			 * @note MUST be called before any program generation: the pipeline layout seals the
+			 * PerModel set on the RENDERABLE (SkeletalDataTrait::hasSkeletalData()), while the
+			 * command recording binds it on the INSTANCE (hasSkinningResources()). Creating the
+			 * resources here — render thread, renderable ready — makes both the same instant.
+			 * The animator itself stays with the Scenes::Component::Visual component; until it
+			 * uploads a first pose, the SSBO sections hold identity matrices (bind pose).
+			 * @param renderer A reference to the graphics renderer.
+			 * @return bool
+			 */
+			bool prepareSkinningResources (Renderer & renderer) noexcept;
+
 			/**
 			 * @brief Ensures TBN space debug programs are generated and cached for this instance.
 			 * @note Called on-demand when TBN rendering is requested, since the flag may be
@@ -1054,22 +1094,14 @@ namespace EmEn::Graphics::RenderableInstance
 			 * second instance from being declared ready on the first one's cached program.
 			 * @return bool
 			 */
-			[[nodiscard]]
-			bool isMissingSkinningResources () const noexcept;
-
 			/**
-			 * @brief Creates the skeletal skinning GPU resources if the renderable declares
-			 * skeletal data and the instance does not own them yet.
-			 * @note MUST be called before any program generation: the pipeline layout seals the
-			 * PerModel set on the RENDERABLE (SkeletalDataTrait::hasSkeletalData()), while the
-			 * command recording binds it on the INSTANCE (hasSkinningResources()). Creating the
-			 * resources here — render thread, renderable ready — makes both the same instant.
-			 * The animator itself stays with the Scenes::Component::Visual component; until it
-			 * uploads a first pose, the SSBO sections hold identity matrices (bind pose).
-			 * @param renderer A reference to the graphics renderer.
-			 * @return bool
+			 * @brief Returns the geometry of a LOD when its buffers can be drawn.
+			 * @note Null when the geometry is missing or its uploads are not complete yet.
+			 * @param LODLevel The LOD level to draw.
+			 * @return const Geometry::Interface *
 			 */
-			bool prepareSkinningResources (Renderer & renderer) noexcept;
+			[[nodiscard]]
+			const Geometry::Interface * drawableGeometry (uint32_t LODLevel) const noexcept;
 
 			/**
 			 * @brief Builds a program cache key for this instance's current configuration.
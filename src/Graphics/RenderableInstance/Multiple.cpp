@@ -372,6 +372,18 @@ namespace EmEn::Graphics::RenderableInstance
 		return true;
 	}
 
+	void
+	Multiple::writeLocalData (const std::function< void (float *, uint32_t) > & writer) noexcept
+	{
+		/* [VULKAN-CPU-SYNC] Protects local data (Logic Thread) */
+		const std::lock_guard< std::mutex > lock{m_localDataAccess};
+
+		writer(m_localData.data(), this->renderable()->isSprite() ? SpriteVBOElementCount : this->meshVBOElementCount());
+
+		/* Mark GPU data out of date. */
+		this->disableFlag(ArePositionsSynchronized);
+	}
+
 	bool
 	Multiple::updateVideoMemory() noexcept
 	{
@@ -29,6 +29,7 @@
 /* STL inclusions. */
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -55,6 +56,13 @@ namespace EmEn::Graphics::RenderableInstance
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"RenderableInstanceMultiple"};
 
+			/* Position vector + scale vector */
+			static constexpr uint32_t SpriteVBOElementCount{3U + 3U};
+			/* Model matrix 4x4 + normal matrix 3x3 */
+			static constexpr uint32_t MeshVBOElementCount{16U + 9U};
+			/* Model matrix 4x4 + normal matrix 3x3 + previous model matrix 4x4 (motion history) */
+			static constexpr uint32_t MeshVBOWithHistoryElementCount{16U + 9U + 16U};
+
 			/**
 			 * @brief Constructs a renderable instance.
 			 * @param device A reference to the device smart-pointer.
@@ -131,6 +139,17 @@ namespace EmEn::Graphics::RenderableInstance
 			[[nodiscard]]
 			bool updateLocalData (const std::vector< Base::Math::CartesianFrame< float > > & instanceLocations, uint32_t instanceOffset = 0) noexcept;
 
+			/**
+			 * @brief Gives a direct access to the local data for a bulk update.
+			 * @note The writer receives the local data and the number of floats per instance of the current layout
+			 * (SpriteVBOElementCount, MeshVBOElementCount or MeshVBOWithHistoryElementCount). The local data lock
+			 * is held during the call, so the writer is free to split the work over worker threads.
+			 * @param writer A reference to a function.
+			 * @return void
+			 * @since 0.9.53
+			 */
+			void writeLocalData (const std::function< void (float *, uint32_t) > & writer) noexcept;
+
 			/**
 			 * @brief Copies local data to video memory.
 			 * @return bool
@@ -235,13 +254,6 @@ namespace EmEn::Graphics::RenderableInstance
 			//static constexpr uint32_t MeshVBOElementCount = 16UL + 12UL;
 			//static constexpr uint32_t MeshVBOElementBytes = 64UL + 48UL;
 
-			/* Position vector + scale vector */
-			static constexpr uint32_t SpriteVBOElementCount{3U + 3U};
-			/* Model matrix 4x4 + normal matrix 3x3 */
-			static constexpr uint32_t MeshVBOElementCount{16U + 9U};
-			/* Model matrix 4x4 + normal matrix 3x3 + previous model matrix 4x4 (motion history) */
-			static constexpr uint32_t MeshVBOWithHistoryElementCount{16U + 9U + 16U};
-
 			/**
 			 * @brief Returns the per-instance element count of the mesh VBO layout.
 			 * @note Depends on the EnableInstanceMotionHistory creation flag.
@@ -37,6 +37,7 @@
 #include "PixelFactory/FileIO.hpp"
 #include "MDI/BatchBuilder.hpp"
 #include "PrimaryServices.hpp"
+#include "RenderGraph.hpp"
 #include "VideoFrameConverter.hpp"
 #include "Vulkan/Instance.hpp"
 #include "Vulkan/SwapChain.hpp"
@@ -86,6 +87,40 @@ namespace EmEn::Graphics
 			return true;
 		}, "Captures the current framebuffer and saves it as a PNG.");
 
+		this->bindCommand("testRenderGraph", [] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			/* Self-test of the render graph compiler: culling, barrier schedule and
+			 * transient memory aliasing of a known post-process like graph. */
+			std::string report;
+
+			if ( !RenderGraph::selfTest(report) )
+			{
+				outputs.emplace_back(Severity::Error, std::stringstream{} << "Render graph self-test failed !" "\n" << report);
+
+				return false;
+			}
+
+			outputs.emplace_back(Severity::Success, std::stringstream{} << "Render graph self-test passed." "\n" << report);
+
+			return true;
+		}, "Self-tests the render graph compiler (culling, barriers, transient memory aliasing) and dumps the test graph.");
+
+		this->bindCommand("testShaderManager", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			/* Self-test of the shader compilation without GPU: known shaders compiled
+			 * sequentially, then concurrently on the thread pool, must give the same binaries. */
+			std::string report;
+
+			if ( !this->shaderManager().selfTest(report) )
+			{
+				outputs.emplace_back(Severity::Error, std::stringstream{} << "Shader manager self-test failed !" "\n" << report);
+
+				return false;
+			}
+
+			outputs.emplace_back(Severity::Success, std::stringstream{} << "Shader manager self-test passed." "\n" << report);
+
+			return true;
+		}, "Self-tests the shader compilation (SPIR-V output, reentrant parallel compilation). No GPU work is involved.");
+
 		this->bindCommand("testVideoFrameConverter", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
 			/* Self-test of the GPU BGRA->I420 converter (hardware video-encode path):
 			 * converts a procedural pattern and compares byte-for-byte against the CPU
@@ -350,5 +385,22 @@ namespace EmEn::Graphics
 
 			return true;
 		}, "Returns Multi-Draw Indirect statistics from the last frame as JSON (batched/fallback/skipped counts, batched ratio %).");
+
+		this->bindCommand("getDeferredDestructionStats", [this] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			const auto statistics = m_deferredDestructor.statistics();
+
+			std::stringstream json;
+			json << "{"
+				<< R"("pendingCount":)" << statistics.pendingCount << ","
+				<< R"("pendingBytes":)" << statistics.pendingBytes << ","
+				<< R"("retiredCount":)" << statistics.retiredCount << ","
+				<< R"("lastTickReleasedCount":)" << statistics.lastTickReleasedCount << ","
+				<< R"("delayTicks":)" << statistics.delayTicks
+				<< "}";
+
+			outputs.emplace_back(Severity::Info, json.str());
+
+			return true;
+		}, "Returns the deferred destruction queue statistics as JSON (pending entries and known bytes, retired total, last tick releases).");
 	}
 }
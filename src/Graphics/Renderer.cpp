@@ -31,6 +31,7 @@
 
 /* STL inclusions. */
 #include <algorithm>
+#include <atomic>
 #include <ranges>
 #include <thread>
 
@@ -39,6 +40,7 @@
 #include "Arguments.hpp"
 #include "DummyColorProjectionTexture.hpp"
 #include "DummyShadowTexture.hpp"
+#include "Geometry/Interface.hpp"
 #include "GrabPass.hpp"
 #include "IBLTexture.hpp"
 #include "SkinnedGeometryProcessor.hpp"
@@ -48,6 +50,7 @@
 #include "Overlay/Manager.hpp"
 #include "PostProcessStack.hpp"
 #include "PrimaryServices.hpp"
+#include "RenderGraph.hpp"
 #include "Resources/Manager.hpp"
 #include "Saphir/Program.hpp"
 #include "SceneRenderTarget.hpp"
@@ -56,6 +59,7 @@
 #include "Scenes/LightSet.hpp"
 #include "Scenes/Scene.hpp"
 #include "Scenes/SceneMetaData.hpp"
+#include "ThreadPool.hpp"
 #include "TextureResource/TextureCubemap.hpp"
 #include "Vulkan/AccelerationStructureBuilder.hpp"
 #include "Vulkan/DescriptorPool.hpp"
@@ -187,6 +191,7 @@ namespace EmEn::Graphics
 
 		/* Initialize a transfer manager for graphics. */
 		m_transferManager.setDevice(m_device);
+		m_transferManager.setBatchQueue(m_graphicsQueue);
 
 		if ( m_transferManager.initialize(m_subServicesEnabled) )
 		{
@@ -455,6 +460,9 @@ namespace EmEn::Graphics
 		m_rayTracingSettingEnabled = m_primaryServices.settings().getOrSetDefault< bool >(GraphicsRayTracingEnabledKey, DefaultGraphicsRayTracingEnabled);
 		m_shadowMapsEnabled = m_primaryServices.settings().getOrSetDefault< bool >(GraphicsShadowMappingEnabledKey, DefaultGraphicsShadowMappingEnabled);
 		m_MDIEnabled = m_primaryServices.settings().getOrSetDefault< bool >(GraphicsMDIEnabledKey, DefaultGraphicsMDIEnabled);
+		m_parallelRecordingEnabled = m_primaryServices.settings().getOrSetDefault< bool >(GraphicsParallelRecordingEnabledKey, DefaultGraphicsParallelRecordingEnabled);
+		m_parallelRecordingMinimumChunkSize = m_primaryServices.settings().getOrSetDefault< uint32_t >(GraphicsParallelRecordingMinimumChunkSizeKey, DefaultGraphicsParallelRecordingMinimumChunkSize);
+		m_renderGraphDumpEnabled = m_primaryServices.settings().getOrSetDefault< bool >(GraphicsRenderGraphDumpKey, DefaultGraphicsRenderGraphDump);
 
 		/* NOTE: Graphics device selection from the vulkan instance.
 		 * The Vulkan instance doesn't directly create a device on its initialization. */
@@ -739,6 +747,25 @@ namespace EmEn::Graphics
 			}
 		}
 
+		/* Initialize the per-frame ring allocator for transient uniform and storage data. */
+		if ( m_device != nullptr )
+		{
+			const auto partitionSize = m_primaryServices.settings().getOrSetDefault< uint32_t >(GraphicsFrameRingAllocatorPartitionSizeKey, DefaultGraphicsFrameRingAllocatorPartitionSize);
+
+			m_frameRingAllocator = std::make_unique< FrameRingAllocator >(m_device, &m_deferredDestructor, this->framesInFlight(), partitionSize);
+
+			if ( !m_frameRingAllocator->createOnHardware() )
+			{
+				TraceWarning{ClassId} << "Unable to create the frame ring allocator !";
+
+				m_frameRingAllocator.reset();
+			}
+
+			const auto setsPerPool = m_primaryServices.settings().getOrSetDefault< uint32_t >(GraphicsFrameDescriptorAllocatorSetsPerPoolKey, DefaultGraphicsFrameDescriptorAllocatorSetsPerPool);
+
+			m_frameDescriptorAllocator = std::make_unique< FrameDescriptorAllocator >(m_device, this->framesInFlight(), setsPerPool);
+		}
+
 		return true;
 	}
 
@@ -770,9 +797,37 @@ namespace EmEn::Graphics
 			this->requestShutdown();
 		}
 
+		/* NOTE: No program preparation may still be writing in the caches released below. */
+		m_programPreparationQueue.waitIdle();
+
 		/* NOTE: Final device idle to ensure all GPU work is complete. */
 		m_device->waitIdle("Renderer::onTerminate()");
 
+		/* NOTE: The ring buffer is retired through the deferred destructor, flushed right below. */
+		if ( m_frameRingAllocator != nullptr )
+		{
+			const auto statistics = m_frameRingAllocator->statistics();
+
+			TraceInfo{ClassId} <<
+				"Frame ring allocator : " << statistics.partitionSize << " bytes per frame, "
+				"high-water mark " << statistics.highWaterMark << " bytes, "
+				<< statistics.growthCount << " growth(s), " << statistics.failedAllocationCount << " refused allocation(s).";
+
+			m_frameRingAllocator.reset();
+		}
+
+		if ( m_frameDescriptorAllocator != nullptr )
+		{
+			const auto statistics = m_frameDescriptorAllocator->statistics();
+
+			TraceInfo{ClassId} <<
+				"Frame descriptor allocator : " << statistics.poolCount << " pool(s), "
+				<< statistics.totalAllocations << " set(s) allocated, "
+				"cache hit rate " << statistics.cacheHitRate() * 100.0F << "%.";
+
+			m_frameDescriptorAllocator.reset();
+		}
+
 		/* NOTE: The device is idle, pending retirements can be destroyed now. */
 		m_deferredDestructor.flush();
 
@@ -795,6 +850,8 @@ namespace EmEn::Graphics
 
 			m_samplers.clear();
 
+			const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
 			for ( const auto & pipeline: m_graphicsPipelines | std::views::values )
 			{
 				pipeline->destroyFromHardware();
@@ -804,6 +861,7 @@ namespace EmEn::Graphics
 
 			/* NOTE: Clear the program cache to release shared pointers before Vulkan resources are destroyed. */
 			m_programs.clear();
+			m_programGenerationAccesses.clear();
 		}
 
 		/* NOTE: Release default resources before Vulkan resources are destroyed.
@@ -1045,6 +1103,9 @@ namespace EmEn::Graphics
 	bool
 	Renderer::recreateSceneTarget () noexcept
 	{
+		/* NOTE: A program preparation may be generating programs against the target being replaced. */
+		m_programPreparationQueue.waitIdle();
+
 		if ( m_sceneTarget != nullptr )
 		{
 			/* Retire the previous target: in-flight command buffers still reference
@@ -1225,23 +1286,40 @@ namespace EmEn::Graphics
 			hash ^= reinterpret_cast< uintptr_t >(pipelineLayout->handle()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
 		}
 
-		if ( const auto pipelineIt = m_graphicsPipelines.find(hash); pipelineIt != m_graphicsPipelines.cend() )
 		{
-			graphicsPipeline = pipelineIt->second;
+			const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
+			if ( const auto pipelineIt = m_graphicsPipelines.find(hash); pipelineIt != m_graphicsPipelines.cend() )
+			{
+				graphicsPipeline = pipelineIt->second;
 
-			m_pipelineReusedCount++;
+				m_pipelineReusedCount.fetch_add(1, std::memory_order_relaxed);
 
-			return true;
+				return true;
+			}
 		}
 
+		/* NOTE: The pipeline is created outside the cache lock, generations of other programs keep going. */
 		if ( !graphicsPipeline->finalize(renderPass, program.pipelineLayout(), program.useTesselation(), m_vulkanInstance.isDynamicStateExtensionEnabled()) )
 		{
 			return false;
 		}
 
-		m_pipelineBuiltCount++;
+		const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
+		/* NOTE: Another program may have created the same pipeline meanwhile, the first one registered is kept. */
+		if ( const auto [pipelineIt, inserted] = m_graphicsPipelines.emplace(hash, graphicsPipeline); !inserted )
+		{
+			graphicsPipeline = pipelineIt->second;
+
+			m_pipelineReusedCount.fetch_add(1, std::memory_order_relaxed);
+
+			return true;
+		}
+
+		m_pipelineBuiltCount.fetch_add(1, std::memory_order_relaxed);
 
-		return m_graphicsPipelines.emplace(hash, graphicsPipeline).second;
+		return true;
 	}
 
 	[[nodiscard]]
@@ -1262,9 +1340,26 @@ namespace EmEn::Graphics
 		return m_swapChain != nullptr ? m_swapChain->postProcessFramebuffer() : nullptr;
 	}
 
+	std::shared_ptr< std::recursive_mutex >
+	Renderer::programGenerationAccess (const ProgramKey & programKey) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
+		auto & generationAccess = m_programGenerationAccesses[programKey];
+
+		if ( generationAccess == nullptr )
+		{
+			generationAccess = std::make_shared< std::recursive_mutex >();
+		}
+
+		return generationAccess;
+	}
+
 	std::shared_ptr< Saphir::Program >
-	Renderer::findCachedProgram (size_t programKey) const noexcept
+	Renderer::findCachedProgram (const ProgramKey & programKey) const noexcept
 	{
+		const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
 		if ( const auto programIt = m_programs.find(programKey); programIt != m_programs.cend() )
 		{
 			return programIt->second;
@@ -1274,23 +1369,98 @@ namespace EmEn::Graphics
 	}
 
 	bool
-	Renderer::cacheProgram (size_t programKey, const std::shared_ptr< Program > & program) noexcept
+	Renderer::cacheProgram (const ProgramKey & programKey, const std::shared_ptr< Program > & program, const char * generatorLabel) noexcept
 	{
 		if ( program == nullptr )
 		{
 			return false;
 		}
 
+		const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
 		const auto [it, inserted] = m_programs.emplace(programKey, program);
 
 		if ( inserted )
 		{
-			m_programBuiltCount++;
+			m_programBuiltCount.fetch_add(1, std::memory_order_relaxed);
+
+			if ( program->hasSpecializationConstants() )
+			{
+				++m_programSpecializedCounts[generatorLabel];
+			}
 		}
 
 		return inserted;
 	}
 
+	std::map< std::string, uint32_t >
+	Renderer::programSpecializedCounts () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
+		return m_programSpecializedCounts;
+	}
+
+	bool
+	Renderer::bakeShaderArchive (const std::filesystem::path & filepath) noexcept
+	{
+		/* NOTE: The programs are copied out of the lock, the compilation can be long. */
+		std::vector< std::shared_ptr< Program > > programs;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_programCacheAccess};
+
+			programs.reserve(m_programs.size());
+
+			for ( const auto & program : m_programs | std::views::values )
+			{
+				programs.emplace_back(program);
+			}
+		}
+
+		std::vector< const AbstractShader * > shaders;
+
+		for ( const auto & program : programs )
+		{
+			for ( const auto * shader : program->getShaderList() )
+			{
+				shaders.emplace_back(shader);
+			}
+		}
+
+		if ( shaders.empty() )
+		{
+			TraceWarning{ClassId} << "No program generated yet, the shader archive " << filepath << " is not written.";
+
+			return false;
+		}
+
+		TraceInfo{ClassId} << "Baking " << shaders.size() << " shaders from " << programs.size() << " programs into " << filepath << " ...";
+
+		return m_shaderManager.bakeArchive(shaders, filepath, m_primaryServices.threadPool().get());
+	}
+
+	void
+	Renderer::scheduleGeometryCommit (const std::shared_ptr< const Geometry::Interface > & geometry) noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_pendingGeometryCommitsAccess};
+
+		m_pendingGeometryCommits.emplace_back(geometry);
+	}
+
+	void
+	Renderer::commitGeometryUpdates () noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_pendingGeometryCommitsAccess};
+
+		/* NOTE: A geometry is forgotten once committed or destroyed, the others wait for their upload. */
+		std::erase_if(m_pendingGeometryCommits, [] (const std::weak_ptr< const Geometry::Interface > & pendingGeometry) {
+			const auto geometry = pendingGeometry.lock();
+
+			return geometry == nullptr || geometry->commitBackgroundUpdate();
+		});
+	}
+
 	void
 	Renderer::applyFrameRateLimit () const noexcept
 	{
@@ -1338,6 +1508,16 @@ namespace EmEn::Graphics
 			m_statistics.stop();
 
 			currentFrameScope.prepareForNewFrame();
+
+			if ( m_frameRingAllocator != nullptr )
+			{
+				m_frameRingAllocator->beginFrame(0);
+			}
+
+			if ( m_frameDescriptorAllocator != nullptr )
+			{
+				m_frameDescriptorAllocator->beginFrame(0);
+			}
 		}
 		else
 		{
@@ -1359,6 +1539,10 @@ namespace EmEn::Graphics
 			 * deduplicates the per-frame pose upload (see RenderableInstance::Abstract). */
 			RenderableInstance::Abstract::setSkinningFrameCursor(++m_skinningFrameCursor);
 
+			/* NOTE: The geometries updated in the background switch to their new buffers here,
+			 * before any recording, the draw paths only read them. */
+			this->commitGeometryUpdates();
+
 			scene->beginRenderFrame();
 
 			if ( this->isShadowMapsEnabled() )
@@ -1428,6 +1612,13 @@ namespace EmEn::Graphics
 			VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT
 		);
 
+		m_transferManager.submitPendingTransfers();
+
+		if ( m_frameRingAllocator != nullptr )
+		{
+			m_frameRingAllocator->flush();
+		}
+
 		const auto submitResult = m_graphicsQueue->submit(
 			*commandBuffer,
 			SynchInfo{}
@@ -1551,6 +1742,17 @@ namespace EmEn::Graphics
 		 * reference them has finished execution and been re-recorded. */
 		m_deferredDestructor.tick();
 
+		/* The fence also releases the ring allocator partition and the transient descriptor sets of this frame. */
+		if ( m_frameRingAllocator != nullptr )
+		{
+			m_frameRingAllocator->beginFrame(m_currentFrameIndex);
+		}
+
+		if ( m_frameDescriptorAllocator != nullptr )
+		{
+			m_frameDescriptorAllocator->beginFrame(m_currentFrameIndex);
+		}
+
 		/* 3. Get the new frame to render to.
 		 * NOTE: The returned index addresses a SWAP-CHAIN IMAGE, in an arbitrary order that has
 		 * nothing to do with m_currentFrameIndex. Everything indexed by it (the present
@@ -1587,6 +1789,10 @@ namespace EmEn::Graphics
 			 * deduplicates the per-frame pose upload (see RenderableInstance::Abstract). */
 			RenderableInstance::Abstract::setSkinningFrameCursor(++m_skinningFrameCursor);
 
+			/* NOTE: The geometries updated in the background switch to their new buffers here,
+			 * before any recording, the draw paths only read them. */
+			this->commitGeometryUpdates();
+
 			scene->beginRenderFrame();
 
 			if ( this->isShadowMapsEnabled() )
@@ -1696,6 +1902,18 @@ namespace EmEn::Graphics
 				{
 					TraceError{ClassId} << "Unable to reconfigure the post-processor with the scene target!";
 				}
+				else if ( m_renderGraphDumpEnabled )
+				{
+					/* NOTE: Diagnostic only, the compiled graph is logged and discarded. */
+					RenderGraph renderGraph;
+
+					m_postProcessor.describeRenderGraph(*stack, renderGraph);
+
+					if ( renderGraph.compile() )
+					{
+						TraceInfo{ClassId} << "Post-process chain reconfigured." "\n" << renderGraph.dump();
+					}
+				}
 			}
 		}
 		else if ( !m_postProcessingActive && m_sceneTarget != nullptr )
@@ -1763,6 +1981,14 @@ namespace EmEn::Graphics
 			 * re-acquisition of that image proves the previous present released it. */
 			auto presentSemaphoreHandle = m_presentSemaphores[imageIndex]->handle();
 
+			/* NOTE: The batched buffer uploads go first on the same queue. */
+			m_transferManager.submitPendingTransfers();
+
+			if ( m_frameRingAllocator != nullptr )
+			{
+				m_frameRingAllocator->flush();
+			}
+
 			if ( !m_graphicsQueue->submit(*commandBuffer, SynchInfo{}
 					.waits(currentFrameScope.secondarySemaphores(), waitStages)
 					.signals({&presentSemaphoreHandle, 1})
@@ -1779,11 +2005,17 @@ namespace EmEn::Graphics
 
 		m_currentFrameIndex = (m_currentFrameIndex + 1) % m_rendererFrameScope.size();
 
+		/* NOTE: Pipelines compiled during this session are kept on disk at a regular pace, not only at exit. */
+		if ( const auto threadPool = m_primaryServices.threadPool(); threadPool != nullptr )
+		{
+			m_device->autoSavePipelineCache(*threadPool);
+		}
+
 		this->applyFrameRateLimit();
 	}
 
 	void
-	Renderer::renderFrameDirect (const std::shared_ptr< Scenes::Scene > & scene, const Overlay::Manager & overlayManager, const Scenes::Editor::Manager * editorManager, RendererFrameScope & /*currentFrameScope*/, const std::shared_ptr< CommandBuffer > & commandBuffer) noexcept
+	Renderer::renderFrameDirect (const std::shared_ptr< Scenes::Scene > & scene, const Overlay::Manager & overlayManager, const Scenes::Editor::Manager * editorManager, RendererFrameScope & currentFrameScope, const std::shared_ptr< CommandBuffer > & commandBuffer) noexcept
 	{
 		auto * const scenePtr = scene.get();
 
@@ -1799,11 +2031,25 @@ namespace EmEn::Graphics
 			scenePtr->recordTLASBuild(commandBuffer->handle(), m_skinnedGeometryProcessor.get());
 		}
 
+		/* NOTE: With parallel recording, the scene lists go to secondary command buffers recorded
+		 * before the render pass begins. The pass then holds nothing else, as required for a subpass
+		 * begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS. */
+		Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > scenePassCommandBuffers;
+
+		if ( sceneHasContent && m_parallelRecordingEnabled && !this->recordScenePassLists(currentFrameScope, *scenePtr, m_swapChain, scenePassCommandBuffers) )
+		{
+			scenePassCommandBuffers.clear();
+		}
+
 		/* Render pass 1: Scene rendering (clears buffers). */
-		commandBuffer->beginRenderPass(*m_swapChain->framebuffer(), m_swapChain->renderArea(), m_swapChainClearColors, VK_SUBPASS_CONTENTS_INLINE);
+		commandBuffer->beginRenderPass(*m_swapChain->framebuffer(), m_swapChain->renderArea(), m_swapChainClearColors, scenePassCommandBuffers.empty() ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
 
 		/* Render opaque and translucent objects in the MSAA render pass. */
-		if ( sceneHasContent )
+		if ( !scenePassCommandBuffers.empty() )
+		{
+			commandBuffer->executeCommands({scenePassCommandBuffers.data(), scenePassCommandBuffers.size()});
+		}
+		else if ( sceneHasContent )
 		{
 			scenePtr->renderOpaque(m_swapChain, *commandBuffer);
 			scenePtr->renderTranslucent(m_swapChain, *commandBuffer);
@@ -1898,7 +2144,7 @@ namespace EmEn::Graphics
 	}
 
 	void
-	Renderer::renderFrameWithInternal (const std::shared_ptr< Scenes::Scene > & scene, const Overlay::Manager & overlayManager, const Scenes::Editor::Manager * editorManager, RendererFrameScope & /*currentFrameScope*/, const std::shared_ptr< CommandBuffer > & commandBuffer) noexcept
+	Renderer::renderFrameWithInternal (const std::shared_ptr< Scenes::Scene > & scene, const Overlay::Manager & overlayManager, const Scenes::Editor::Manager * editorManager, RendererFrameScope & currentFrameScope, const std::shared_ptr< CommandBuffer > & commandBuffer) noexcept
 	{
 		auto * const scenePtr = scene.get();
 
@@ -1935,36 +2181,52 @@ namespace EmEn::Graphics
 		const bool sceneTargetHasAlbedo = m_sceneTarget->albedoFormat() != VK_FORMAT_UNDEFINED;
 		const bool sceneTargetHasVelocity = m_sceneTarget->velocityFormat() != VK_FORMAT_UNDEFINED;
 
+		/* NOTE: With parallel recording, the scene lists go to secondary command buffers recorded
+		 * before the render pass begins. The pass then holds nothing else, as required for a subpass
+		 * begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS. */
+		Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > scenePassCommandBuffers;
+
+		if ( sceneHasContent && m_parallelRecordingEnabled && !this->recordScenePassLists(currentFrameScope, *scenePtr, m_sceneTarget, scenePassCommandBuffers) )
+		{
+			scenePassCommandBuffers.clear();
+		}
+
+		const auto scenePassContents = scenePassCommandBuffers.empty() ? VK_SUBPASS_CONTENTS_INLINE : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
+
 		if ( sceneTargetHasAlbedo && sceneTargetHasVelocity )
 		{
-			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), m_clearColors, VK_SUBPASS_CONTENTS_INLINE);
+			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), m_clearColors, scenePassContents);
 		}
 		else if ( sceneTargetHasAlbedo )
 		{
 			const std::array< VkClearValue, 5 > cv{m_clearColors[0], m_clearColors[1], m_clearColors[2], m_clearColors[3], m_clearColors[5]};
-			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, VK_SUBPASS_CONTENTS_INLINE);
+			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, scenePassContents);
 		}
 		else if ( sceneTargetHasNormals && sceneTargetHasMaterialProperties )
 		{
 			const std::array< VkClearValue, 4 > cv{m_clearColors[0], m_clearColors[1], m_clearColors[2], m_clearColors[5]};
-			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, VK_SUBPASS_CONTENTS_INLINE);
+			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, scenePassContents);
 		}
 		else if ( sceneTargetHasNormals )
 		{
 			const std::array< VkClearValue, 3 > cv{m_clearColors[0], m_clearColors[1], m_clearColors[5]};
-			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, VK_SUBPASS_CONTENTS_INLINE);
+			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, scenePassContents);
 		}
 		else if ( sceneTargetHasMaterialProperties )
 		{
 			const std::array< VkClearValue, 3 > cv{m_clearColors[0], m_clearColors[2], m_clearColors[5]};
-			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, VK_SUBPASS_CONTENTS_INLINE);
+			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), cv, scenePassContents);
 		}
 		else
 		{
-			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), m_swapChainClearColors, VK_SUBPASS_CONTENTS_INLINE);
+			commandBuffer->beginRenderPass(*m_sceneTarget->framebuffer(), m_sceneTarget->renderArea(), m_swapChainClearColors, scenePassContents);
 		}
 
-		if ( sceneHasContent )
+		if ( !scenePassCommandBuffers.empty() )
+		{
+			commandBuffer->executeCommands({scenePassCommandBuffers.data(), scenePassCommandBuffers.size()});
+		}
+		else if ( sceneHasContent )
 		{
 			scenePtr->renderOpaque(m_sceneTarget, *commandBuffer);
 			scenePtr->renderTranslucent(m_sceneTarget, *commandBuffer);
@@ -2124,9 +2386,40 @@ namespace EmEn::Graphics
 				return;
 			}
 
-			commandBuffer->beginRenderPass(*shadowMap->framebuffer(), shadowMap->renderArea(), m_shadowMapClearValues, VK_SUBPASS_CONTENTS_INLINE);
+			if ( m_parallelRecordingEnabled )
+			{
+				const auto chunkCount = scene.prepareShadowCasting(shadowMap, RendererFrameScope::MaxSecondaryRecorders, m_parallelRecordingMinimumChunkSize);
+
+				/* NOTE: A single chunk is not worth a secondary command buffer, neither is a failed
+				 * parallel recording: both fall back to the chunks recorded inline. */
+				Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > commandBufferHandles;
 
-			scene.castShadows(shadowMap, *commandBuffer);
+				if ( chunkCount > 1 && !this->recordShadowCastingChunks(currentFrameScope, scene, shadowMap, chunkCount, commandBufferHandles) )
+				{
+					commandBufferHandles.clear();
+				}
+
+				if ( commandBufferHandles.empty() )
+				{
+					commandBuffer->beginRenderPass(*shadowMap->framebuffer(), shadowMap->renderArea(), m_shadowMapClearValues, VK_SUBPASS_CONTENTS_INLINE);
+
+					for ( uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+					{
+						scene.castShadowsChunk(shadowMap, chunkIndex, *commandBuffer);
+					}
+				}
+				else
+				{
+					commandBuffer->beginRenderPass(*shadowMap->framebuffer(), shadowMap->renderArea(), m_shadowMapClearValues, VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS);
+					commandBuffer->executeCommands({commandBufferHandles.data(), commandBufferHandles.size()});
+				}
+			}
+			else
+			{
+				commandBuffer->beginRenderPass(*shadowMap->framebuffer(), shadowMap->renderArea(), m_shadowMapClearValues, VK_SUBPASS_CONTENTS_INLINE);
+
+				scene.castShadows(shadowMap, *commandBuffer);
+			}
 
 			commandBuffer->endRenderPass();
 
@@ -2139,6 +2432,13 @@ namespace EmEn::Graphics
 
 			const auto semaphoreHandle = shadowMap->semaphore()->handle();
 
+			m_transferManager.submitPendingTransfers();
+
+			if ( m_frameRingAllocator != nullptr )
+			{
+				m_frameRingAllocator->flush();
+			}
+
 			const auto submitted = queue->submit(
 				*commandBuffer,
 				SynchInfo{}
@@ -2156,6 +2456,164 @@ namespace EmEn::Graphics
 		});
 	}
 
+	bool
+	Renderer::recordShadowCastingChunks (RendererFrameScope & currentFrameScope, const Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & shadowMap, uint32_t chunkCount, Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > & commandBufferHandles) const noexcept
+	{
+		const auto threadPool = m_primaryServices.threadPool();
+
+		if ( threadPool == nullptr || chunkCount > RendererFrameScope::MaxSecondaryRecorders )
+		{
+			return false;
+		}
+
+		if ( !currentFrameScope.prepareSecondaryRecorders(chunkCount) )
+		{
+			return false;
+		}
+
+		/* NOTE: The command buffers are taken on the render thread, one per recorder, so the
+		 * tasks only touch their own command pool while recording. */
+		Base::StaticVector< std::shared_ptr< CommandBuffer >, RendererFrameScope::MaxSecondaryRecorders > commandBuffers;
+
+		for ( uint32_t chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex )
+		{
+			auto commandBuffer = currentFrameScope.getSecondaryCommandBuffer(chunkIndex);
+
+			if ( commandBuffer == nullptr )
+			{
+				return false;
+			}
+
+			commandBuffers.emplace_back(std::move(commandBuffer));
+		}
+
+		const auto & framebuffer = *shadowMap->framebuffer();
+
+		std::atomic< bool > success{true};
+
+		threadPool->parallelFor(uint32_t{0}, chunkCount, [&] (uint32_t chunkIndex) {
+			const auto & commandBuffer = *commandBuffers[chunkIndex];
+
+			if ( !commandBuffer.beginSecondary(framebuffer) )
+			{
+				success.store(false, std::memory_order_relaxed);
+
+				return;
+			}
+
+			scene.castShadowsChunk(shadowMap, chunkIndex, commandBuffer);
+
+			if ( !commandBuffer.end() )
+			{
+				success.store(false, std::memory_order_relaxed);
+			}
+		});
+
+		if ( !success.load(std::memory_order_relaxed) )
+		{
+			TraceError{ClassId} << "Unable to record the secondary command buffers for render target '" << shadowMap->id() << "' !";
+
+			return false;
+		}
+
+		for ( const auto & commandBuffer : commandBuffers )
+		{
+			commandBufferHandles.emplace_back(commandBuffer->handle());
+		}
+
+		return true;
+	}
+
+	bool
+	Renderer::recordScenePassLists (RendererFrameScope & currentFrameScope, Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > & commandBufferHandles) const noexcept
+	{
+		/* NOTE: Recorder #0 takes the opaque list, recorder #1 the translucent list. */
+		constexpr uint32_t ListCount{2};
+
+		const auto * framebuffer = renderTarget->framebuffer();
+
+		if ( framebuffer == nullptr || !currentFrameScope.prepareSecondaryRecorders(ListCount) )
+		{
+			return false;
+		}
+
+		Base::StaticVector< std::shared_ptr< CommandBuffer >, RendererFrameScope::MaxSecondaryRecorders > commandBuffers;
+
+		for ( uint32_t listIndex = 0; listIndex < ListCount; ++listIndex )
+		{
+			auto commandBuffer = currentFrameScope.getSecondaryCommandBuffer(listIndex);
+
+			if ( commandBuffer == nullptr )
+			{
+				return false;
+			}
+
+			commandBuffers.emplace_back(std::move(commandBuffer));
+		}
+
+		std::atomic< bool > success{true};
+
+		const auto recordList = [&] (uint32_t listIndex) {
+			const auto & commandBuffer = *commandBuffers[listIndex];
+
+			if ( !commandBuffer.beginSecondary(*framebuffer) )
+			{
+				success.store(false, std::memory_order_relaxed);
+
+				return;
+			}
+
+			if ( listIndex == 0 )
+			{
+				scene.renderOpaque(renderTarget, commandBuffer);
+			}
+			else
+			{
+				scene.renderTranslucent(renderTarget, commandBuffer);
+
+				/* NOTE: Drawn after the translucent list, like in the inline recording. */
+				if ( m_TBNSpaceRenderingEnabled )
+				{
+					scene.renderTBNSpace(renderTarget, commandBuffer);
+				}
+			}
+
+			if ( !commandBuffer.end() )
+			{
+				success.store(false, std::memory_order_relaxed);
+			}
+		};
+
+		/* NOTE: The TBN space drawing prepares programs of any renderable instance, the opaque ones included. */
+		const auto threadPool = m_primaryServices.threadPool();
+
+		if ( threadPool != nullptr && !m_TBNSpaceRenderingEnabled && !scene.opaqueAndTranslucentShareInstances() )
+		{
+			threadPool->parallelFor(uint32_t{0}, ListCount, recordList);
+		}
+		else
+		{
+			for ( uint32_t listIndex = 0; listIndex < ListCount; ++listIndex )
+			{
+				recordList(listIndex);
+			}
+		}
+
+		if ( !success.load(std::memory_order_relaxed) )
+		{
+			TraceError{ClassId} << "Unable to record the secondary command buffers of the scene pass for render target '" << renderTarget->id() << "' !";
+
+			return false;
+		}
+
+		for ( const auto & commandBuffer : commandBuffers )
+		{
+			commandBufferHandles.emplace_back(commandBuffer->handle());
+		}
+
+		return true;
+	}
+
 	void
 	Renderer::renderRenderToTextures (RendererFrameScope & currentFrameScope, Scenes::Scene & scene, const Queue * queue) const noexcept
 	{
@@ -2229,6 +2687,13 @@ namespace EmEn::Graphics
 
 			const auto signalSemaphoreHandle = renderToTexture->semaphore()->handle();
 
+			m_transferManager.submitPendingTransfers();
+
+			if ( m_frameRingAllocator != nullptr )
+			{
+				m_frameRingAllocator->flush();
+			}
+
 			bool submitted = false;
 
 			/* Only the first render-to-texture waits on primary (shadow map) semaphores.
@@ -2422,6 +2887,9 @@ namespace EmEn::Graphics
 	bool
 	Renderer::recreateRenderingSubSystem (bool withSurface, bool useNativeCode) noexcept
 	{
+		/* NOTE: Program preparations are generating pipelines against the current render passes. */
+		m_programPreparationQueue.waitIdle();
+
 		/* NOTE: Wait the device to finish all his work before destroying/recreating the swap-chain. */
 		this->device()->waitIdle("Renderer::recreateSystem()");
 
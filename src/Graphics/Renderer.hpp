@@ -31,9 +31,13 @@
 #include <cstdint>
 #include <any>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <filesystem>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -51,13 +55,17 @@
 /* Local inclusions for usages. */
 #include "BindlessTextureManager.hpp"
 #include "ExternalInput.hpp"
+#include "FrameDescriptorAllocator.hpp"
+#include "FrameRingAllocator.hpp"
 #include "PixelFactory/Color.hpp"
 #include "PixelFactory/Pixmap.hpp"
 #include "StaticVector.hpp"
 #include "Time/Statistics/RealTime.hpp"
 #include "PostProcessor.hpp"
+#include "ProgramPreparationQueue.hpp"
 #include "Recorder.hpp"
 #include "RendererFrameScope.hpp"
+#include "Saphir/ProgramKey.hpp"
 #include "Saphir/ShaderManager.hpp"
 #include "SharedUBOManager.hpp"
 #include "Vulkan/DeferredDestructor.hpp"
@@ -195,12 +203,12 @@ namespace EmEn::Graphics
 	 *
 	 * # Thread Safety
 	 *
-	 * All cache maps (m_programs, m_pipelines, m_samplers) are written during initialization
-	 * phase only. Once rendering begins, maps are read-only from the render thread
-	 * (no mutex needed for O(1) lookup performance).
-	 *
-	 * **Future consideration:** If dynamic pipeline creation is needed during runtime,
-	 * protect cache modifications with std::shared_mutex (read-write lock).
+	 * The program and pipeline caches (m_programs, m_graphicsPipelines) are written by the
+	 * shader program generations, which run on the render thread and on the thread pool
+	 * (see ProgramPreparationQueue). They are guarded by m_programCacheAccess, held for the
+	 * lookups and insertions only. A generation holds the programGenerationAccess() lock of
+	 * its program key, so distinct programs are generated in parallel and an identical one
+	 * is generated once. The sampler cache is render thread only.
 	 */
 	class EMEN_API Renderer final : public ServiceInterface, public Base::ObserverTrait, public Base::ObservableTrait, public Console::ControllableTrait
 	{
@@ -666,6 +674,30 @@ namespace EmEn::Graphics
 				return m_GPUProfiler.get();
 			}
 
+			/**
+			 * @brief Returns the per-frame ring allocator for transient uniform and storage data.
+			 * @note Null until the renderer is initialized with a device.
+			 * @return FrameRingAllocator *
+			 */
+			[[nodiscard]]
+			FrameRingAllocator *
+			frameRingAllocator () const noexcept
+			{
+				return m_frameRingAllocator.get();
+			}
+
+			/**
+			 * @brief Returns the per-frame allocator for transient descriptor sets.
+			 * @note Null until the renderer is initialized with a device.
+			 * @return FrameDescriptorAllocator *
+			 */
+			[[nodiscard]]
+			FrameDescriptorAllocator *
+			frameDescriptorAllocator () const noexcept
+			{
+				return m_frameDescriptorAllocator.get();
+			}
+
 			/**
 			 * @brief Controls the state of rendering to textures.
 			 * @param state The state.
@@ -995,6 +1027,37 @@ namespace EmEn::Graphics
 				return m_deferredDestructor;
 			}
 
+			/**
+			 * @brief Schedules the commit of a geometry updated in the background.
+			 * @note The new buffers are switched to once per frame on the rendering thread, before any
+			 * command buffer is recorded, so the parallel recorders never see the swap.
+			 * @param geometry A reference to the geometry smart pointer.
+			 * @return void
+			 */
+			void scheduleGeometryCommit (const std::shared_ptr< const Geometry::Interface > & geometry) noexcept;
+
+			/**
+			 * @brief Returns the queue of the program preparations running on the thread pool.
+			 * @return ProgramPreparationQueue &
+			 */
+			[[nodiscard]]
+			ProgramPreparationQueue &
+			programPreparationQueue () noexcept
+			{
+				return m_programPreparationQueue;
+			}
+
+			/**
+			 * @brief Returns the lock serializing the generations of one shader program.
+			 * @note Held by Saphir::Generator::Abstract::generateShaderProgram() for the whole generation.
+			 * Generations of distinct programs run in parallel, two requests of the same program compile
+			 * it once. It is recursive because a generation may be nested in a caller which already holds it.
+			 * @param programKey A reference to the key of the program to generate.
+			 * @return std::shared_ptr< std::recursive_mutex >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< std::recursive_mutex > programGenerationAccess (const Saphir::ProgramKey & programKey) noexcept;
+
 			/**
 			 * @brief Returns the internal scene render target.
 			 * @return std::shared_ptr< SceneRenderTarget >
@@ -1237,20 +1300,33 @@ namespace EmEn::Graphics
 
 			/**
 			 * @brief Finds a cached shader program by its unique key.
-			 * @note This allows early lookup before shader generation to avoid redundant work.
-			 * @param programKey The unique key identifying the program configuration.
+			 * @note The key is computed from the generator inputs, so the lookup happens before any shader generation.
+			 * @param programKey A reference to the unique key identifying the program configuration.
 			 * @return std::shared_ptr< Saphir::Program > The cached program or nullptr if not found.
 			 */
 			[[nodiscard]]
-			std::shared_ptr< Saphir::Program > findCachedProgram (size_t programKey) const noexcept;
+			std::shared_ptr< Saphir::Program > findCachedProgram (const Saphir::ProgramKey & programKey) const noexcept;
 
 			/**
 			 * @brief Caches a shader program for future reuse.
-			 * @param programKey The unique key identifying the program configuration.
+			 * @param programKey A reference to the unique key identifying the program configuration.
 			 * @param program The program to cache.
+			 * @param generatorLabel The class label of the generator which built the program.
 			 * @return bool True if the program was successfully cached.
 			 */
-			bool cacheProgram (size_t programKey, const std::shared_ptr< Saphir::Program > & program) noexcept;
+			bool cacheProgram (const Saphir::ProgramKey & programKey, const std::shared_ptr< Saphir::Program > & program, const char * generatorLabel) noexcept;
+
+			/**
+			 * @brief Writes a shader archive with the shaders of every cached program.
+			 * @note The program cache holds the variants generated so far (rendering, shadow casting, MDI,
+			 * TBN space, overlay and post-processing). Call Scenes::Scene::generateProgramVariants() first,
+			 * so it also holds the variants of the instances the scene has not drawn yet. The shader manager
+			 * reads the archive at startup from "data-stores/Shaders/" in the data directories.
+			 * @param filepath A reference to the archive path.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool bakeShaderArchive (const std::filesystem::path & filepath) noexcept;
 
 			/**
 			 * @brief Notifies that a cached program was reused.
@@ -1260,7 +1336,7 @@ namespace EmEn::Graphics
 			void
 			notifyProgramReused () noexcept
 			{
-				m_programReusedCount++;
+				m_programReusedCount.fetch_add(1, std::memory_order_relaxed);
 			}
 
 			/**
@@ -1363,30 +1439,38 @@ namespace EmEn::Graphics
 			uint32_t
 			pipelineBuiltCount () const noexcept
 			{
-				return m_pipelineBuiltCount;
+				return m_pipelineBuiltCount.load(std::memory_order_relaxed);
 			}
 
 			[[nodiscard]]
 			uint32_t
 			pipelineReusedCount () const noexcept
 			{
-				return m_pipelineReusedCount;
+				return m_pipelineReusedCount.load(std::memory_order_relaxed);
 			}
 
 			[[nodiscard]]
 			uint32_t
 			programBuiltCount () const noexcept
 			{
-				return m_programBuiltCount;
+				return m_programBuiltCount.load(std::memory_order_relaxed);
 			}
 
 			[[nodiscard]]
 			uint32_t
 			programsReusedCount () const noexcept
 			{
-				return m_programReusedCount;
+				return m_programReusedCount.load(std::memory_order_relaxed);
 			}
 
+			/**
+			 * @brief Returns the number of built programs specialized at pipeline creation, per generator class label.
+			 * @note These programs share their shader modules with the other variants of the same uber-shader.
+			 * @return std::map< std::string, uint32_t >
+			 */
+			[[nodiscard]]
+			std::map< std::string, uint32_t > programSpecializedCounts () const noexcept;
+
 		private:
 
 			/** @copydoc EmEn::ServiceInterface::onInitialize() */
@@ -1418,6 +1502,33 @@ namespace EmEn::Graphics
 			 */
 			void renderShadowMaps (RendererFrameScope & currentFrameScope, Scenes::Scene & scene, const Vulkan::Queue * queue) const noexcept;
 
+			/**
+			 * @brief Records the chunks of a shadow map draw list into secondary command buffers on the thread pool.
+			 * @note Scenes::Scene::prepareShadowCasting() must have been called for this shadow map.
+			 * @param currentFrameScope A writable reference to the current frame scope, the one being rendered.
+			 * @param scene A reference to the scene.
+			 * @param shadowMap A reference to the shadow map smart pointer.
+			 * @param chunkCount The number of chunks to record.
+			 * @param commandBufferHandles A writable reference to a list of recorded secondary command buffer handles.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool recordShadowCastingChunks (RendererFrameScope & currentFrameScope, const Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & shadowMap, uint32_t chunkCount, Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > & commandBufferHandles) const noexcept;
+
+			/**
+			 * @brief Records the opaque and the translucent lists of the main scene pass into two secondary command buffers.
+			 * @note Scenes::Scene::prepareRender() must have been called for this render target. The lists are recorded
+			 * on the thread pool at the same time, unless they share a renderable instance or the TBN space is drawn:
+			 * then both are recorded on the calling thread, one after the other.
+			 * @param currentFrameScope A writable reference to the current frame scope, the one being rendered.
+			 * @param scene A reference to the scene.
+			 * @param renderTarget A reference to the render target smart pointer of the main scene pass.
+			 * @param commandBufferHandles A writable reference to a list of recorded secondary command buffer handles, opaque first.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool recordScenePassLists (RendererFrameScope & currentFrameScope, Scenes::Scene & scene, const std::shared_ptr< RenderTarget::Abstract > & renderTarget, Base::StaticVector< VkCommandBuffer, RendererFrameScope::MaxSecondaryRecorders > & commandBufferHandles) const noexcept;
+
 			/**
 			 * @brief Updates every dynamic texture2Ds from the scene.
 			 * @param currentFrameScope A writable reference to the current frame scope, the one being rendered.
@@ -1470,6 +1581,13 @@ namespace EmEn::Graphics
 			 */
 			void applyFrameRateLimit () const noexcept;
 
+			/**
+			 * @brief Commits the background geometry updates with a complete upload.
+			 * @note Called at the beginning of a frame, before any recording. The others stay scheduled.
+			 * @return void
+			 */
+			void commitGeometryUpdates () noexcept;
+
 			/**
 			 * @brief Recreates the internal scene render target on resize.
 			 * @return bool
@@ -1584,8 +1702,17 @@ namespace EmEn::Graphics
 			 * lens effect removed from the camera can never be destroyed while an in-flight
 			 * command buffer still references its pipeline. Indexed by currentFrameIndex(). */
 			std::array< std::shared_ptr< const DirectEffectList >, 5 > m_lensEffectsSnapshots{};
-			std::unordered_map< size_t, std::shared_ptr< Saphir::Program > > m_programs;
+			std::unordered_map< Saphir::ProgramKey, std::shared_ptr< Saphir::Program > > m_programs;
 			std::unordered_map< size_t, std::shared_ptr< Vulkan::GraphicsPipeline > > m_graphicsPipelines;
+			/** @brief One generation lock per program key, see programGenerationAccess(). */
+			std::unordered_map< Saphir::ProgramKey, std::shared_ptr< std::recursive_mutex > > m_programGenerationAccesses;
+			/** @brief Number of specialized programs built by each generator. */
+			std::map< std::string, uint32_t > m_programSpecializedCounts;
+			/** @brief Geometries with a background update waiting for its commit, see scheduleGeometryCommit(). */
+			std::vector< std::weak_ptr< const Geometry::Interface > > m_pendingGeometryCommits;
+			std::mutex m_pendingGeometryCommitsAccess;
+			/** @brief Guards the program, pipeline and generation lock maps, and the specialized program counts. */
+			mutable std::mutex m_programCacheAccess;
 			/** @brief Transparent hash for heterogeneous string_view lookup in unordered_map. */
 			struct TransparentStringHash
 			{
@@ -1629,12 +1756,13 @@ namespace EmEn::Graphics
 			std::chrono::high_resolution_clock::time_point m_frameStartTime;
 			std::chrono::nanoseconds m_frameDuration{0}; // 0 = frame limiter disabled
 			uint32_t m_frameRateLimit{0}; // 0 = disabled, otherwise FPS target
+			uint32_t m_parallelRecordingMinimumChunkSize{64};
 			/** @brief Monotonic rendered-frame counter feeding the skinning frame cursor (render thread only). */
 			uint64_t m_skinningFrameCursor{0};
-			uint32_t m_pipelineBuiltCount{0};
-			uint32_t m_pipelineReusedCount{0};
-			uint32_t m_programBuiltCount{0};
-			uint32_t m_programReusedCount{0};
+			std::atomic< uint32_t > m_pipelineBuiltCount{0};
+			std::atomic< uint32_t > m_pipelineReusedCount{0};
+			std::atomic< uint32_t > m_programBuiltCount{0};
+			std::atomic< uint32_t > m_programReusedCount{0};
 			std::shared_ptr< TextureResource::TextureCubemap > m_defaultTextureCubemap;
 			std::shared_ptr< DummyShadowTexture > m_dummyShadowTexture2D;
 			std::shared_ptr< DummyShadowTexture > m_dummyShadowTextureCube;
@@ -1655,6 +1783,12 @@ namespace EmEn::Graphics
 			std::unique_ptr< MDI::BatchBuilder > m_MDIBatchBuilder;
 			/** @brief Per-pass GPU timing service (timestamp queries). Null when disabled. */
 			std::unique_ptr< Vulkan::GPUProfiler > m_GPUProfiler;
+			/** @brief Transient per-frame uniform and storage data, one partition per frame in flight. */
+			std::unique_ptr< FrameRingAllocator > m_frameRingAllocator;
+			/** @brief Transient descriptor sets, pools reset in bulk per frame in flight. */
+			std::unique_ptr< FrameDescriptorAllocator > m_frameDescriptorAllocator;
+			/** @brief Program preparations running on the thread pool, destroyed before everything its tasks use. */
+			ProgramPreparationQueue m_programPreparationQueue;
 			bool m_debugMode{false};
 			bool m_windowLess{false};
 			bool m_rayTracingSettingEnabled{true};
@@ -1664,6 +1798,8 @@ namespace EmEn::Graphics
 			bool m_grabPassEnabled{false};
 			bool m_shutdownRequested{false};
 			bool m_MDIEnabled{false};
+			bool m_parallelRecordingEnabled{false};
+			bool m_renderGraphDumpEnabled{false};
 			/* Decided once per recorded frame: the post-processor master switch AND actual work
 			 * to run (a non-empty scene chain or a camera carrying lens effects). Keeping the two
 			 * apart is what lets the switch default to ON without putting an effect-less scene
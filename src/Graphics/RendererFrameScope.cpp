@@ -29,6 +29,10 @@
 /* Project configuration. */
 #include "emeraude_config.hpp"
 
+/* STL inclusions. */
+#include <algorithm>
+#include <string>
+
 /* Local inclusions. */
 #include "Vulkan/Sync/Fence.hpp"
 #include "Vulkan/Sync/Semaphore.hpp"
@@ -111,6 +115,71 @@ namespace EmEn::Graphics
 		return commandBuffer;
 	}
 
+	bool
+	RendererFrameScope::prepareSecondaryRecorders (uint32_t recorderCount) noexcept
+	{
+		recorderCount = std::min(recorderCount, MaxSecondaryRecorders);
+
+		for ( uint32_t recorderIndex = 0; recorderIndex < recorderCount; ++recorderIndex )
+		{
+			auto & recorder = m_secondaryRecorders[recorderIndex];
+
+			if ( recorder.commandPool != nullptr )
+			{
+				continue;
+			}
+
+			const auto device = m_commandPool->device();
+
+			/* NOTE: Same as the frame command pool, the whole pool is reset once the frame fence is signaled. */
+			recorder.commandPool = std::make_shared< CommandPool >(device, device->getGraphicsFamilyIndex(), true, false, false);
+			recorder.commandPool->setIdentifier(ClassId, RendererFrameScope::getFrameName(m_frameIndex) + "Recorder" + std::to_string(recorderIndex), "CommandPool");
+
+			if ( !recorder.commandPool->createOnHardware() )
+			{
+				TraceError{ClassId} << "Unable to create the secondary command pool #" << recorderIndex << " for frame #" << m_frameIndex << " !";
+
+				recorder.commandPool.reset();
+
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	std::shared_ptr< CommandBuffer >
+	RendererFrameScope::getSecondaryCommandBuffer (uint32_t recorderIndex) noexcept
+	{
+		if ( recorderIndex >= MaxSecondaryRecorders || m_secondaryRecorders[recorderIndex].commandPool == nullptr )
+		{
+			TraceError{ClassId} << "The secondary recorder #" << recorderIndex << " is not prepared !";
+
+			return {};
+		}
+
+		auto & recorder = m_secondaryRecorders[recorderIndex];
+
+		if ( recorder.usedCount < recorder.commandBuffers.size() )
+		{
+			return recorder.commandBuffers[recorder.usedCount++];
+		}
+
+		auto commandBuffer = std::make_shared< CommandBuffer >(recorder.commandPool, false);
+
+		if ( !commandBuffer->isCreated() )
+		{
+			TraceError{ClassId} << "Unable to create a secondary command buffer for the recorder #" << recorderIndex << " !";
+
+			return {};
+		}
+
+		recorder.commandBuffers.emplace_back(commandBuffer);
+		recorder.usedCount++;
+
+		return commandBuffer;
+	}
+
 	void
 	RendererFrameScope::declareSemaphore (const std::shared_ptr< Sync::Semaphore > & semaphore, bool primary) noexcept
 	{
@@ -143,6 +212,21 @@ namespace EmEn::Graphics
 		m_primarySemaphores.clear();
 		m_secondarySemaphores.clear();
 
+		for ( auto & recorder : m_secondaryRecorders )
+		{
+			if ( recorder.commandPool == nullptr )
+			{
+				continue;
+			}
+
+			recorder.usedCount = 0;
+
+			if ( !recorder.commandPool->resetCommandBuffers(false) )
+			{
+				return false;
+			}
+		}
+
 		return m_commandPool->resetCommandBuffers(false);
 	}
 }
@@ -27,8 +27,10 @@
 #pragma once
 
 /* STL inclusions */
+#include <array>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 /* Local inclusions. */
 #include "StaticVector.hpp"
@@ -58,6 +60,9 @@ namespace EmEn::Graphics
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"RendererFrameScope"};
 
+			/** @brief The maximum number of secondary command buffer recorders working on the same frame. */
+			static constexpr uint32_t MaxSecondaryRecorders{8};
+
 			/**
 			 * @brief Constructs a render frame scope.
 			 */
@@ -103,6 +108,25 @@ namespace EmEn::Graphics
 			[[nodiscard]]
 			std::shared_ptr< Vulkan::CommandBuffer > getCommandBuffer (const RenderTarget::Abstract * renderTarget) noexcept;
 
+			/**
+			 * @brief Prepares the command pools of the secondary command buffer recorders.
+			 * @note Must be called from the rendering thread before dispatching the recording tasks.
+			 * @param recorderCount The number of recorders needed. Clamped to MaxSecondaryRecorders.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool prepareSecondaryRecorders (uint32_t recorderCount) noexcept;
+
+			/**
+			 * @brief Returns a fresh secondary command buffer from a recorder.
+			 * @note Each recorder owns its command pool, so different recorders can be used from different threads at the same time.
+			 * A recorder must not be used by two threads at once.
+			 * @param recorderIndex The recorder index, lower than the count given to prepareSecondaryRecorders().
+			 * @return std::shared_ptr< Vulkan::CommandBuffer >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< Vulkan::CommandBuffer > getSecondaryCommandBuffer (uint32_t recorderIndex) noexcept;
+
 			/**
 			 * @brief Returns the frame index.
 			 * @return uint32_t
@@ -194,7 +218,19 @@ namespace EmEn::Graphics
 				return "Frame" + std::to_string(frameIndex);
 			}
 
+			/**
+			 * @brief A command pool dedicated to one recording thread and its secondary command buffers.
+			 * @note The command buffers are kept across frames and handed out again after the pool reset.
+			 */
+			struct SecondaryRecorder
+			{
+				std::shared_ptr< Vulkan::CommandPool > commandPool;
+				std::vector< std::shared_ptr< Vulkan::CommandBuffer > > commandBuffers;
+				size_t usedCount{0};
+			};
+
 			std::shared_ptr< Vulkan::CommandPool > m_commandPool;
+			std::array< SecondaryRecorder, MaxSecondaryRecorders > m_secondaryRecorders;
 			std::unordered_map< const RenderTarget::Abstract *, std::shared_ptr< Vulkan::CommandBuffer > > m_commandBuffers;
 			Base::StaticVector< VkSemaphore, 16 > m_primarySemaphores;
 			Base::StaticVector< VkSemaphore, 16 > m_secondarySemaphores;
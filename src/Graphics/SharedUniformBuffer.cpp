@@ -27,8 +27,7 @@
 #include "SharedUniformBuffer.hpp"
 
 /* STL inclusions. */
-#include <mutex>
-#include <ranges>
+#include <sstream>
 
 /* Local inclusions. */
 #include "Math/Base.hpp"
@@ -55,6 +54,9 @@ namespace EmEn::Graphics
 				break;
 			}
 		}
+
+		m_elements = std::make_unique< std::atomic< const void * >[] >(m_elementCount);
+		m_seats.reset(m_elementCount);
 	}
 
 	SharedUniformBuffer::SharedUniformBuffer (const std::shared_ptr< Device > & device, Renderer & renderer, const descriptor_set_creator_t & descriptorSetCreator, uint32_t uniformBlockSize, uint32_t maxElementCount) noexcept
@@ -70,6 +72,9 @@ namespace EmEn::Graphics
 				break;
 			}
 		}
+
+		m_elements = std::make_unique< std::atomic< const void * >[] >(m_elementCount);
+		m_seats.reset(m_elementCount);
 	}
 
 	uint32_t
@@ -154,60 +159,43 @@ namespace EmEn::Graphics
 	bool
 	SharedUniformBuffer::addElement (const void * element, uint32_t & offset) noexcept
 	{
-		/* NOTE: Scanning for a free seat and claiming it MUST be atomic, otherwise two concurrent
-		 * owners both see the same seat as free and both take it, ending up sharing a single UBO
-		 * offset. The corruption is silent: no error is reported, the two owners simply overwrite
-		 * each other's uniform block. */
-		const std::lock_guard< std::mutex > lock{m_elementsAccess};
-
-		offset = 0;
+		/* NOTE: The seat is claimed by an atomic operation on the bitmap, two concurrent
+		 * owners can never share a single UBO offset. */
+		const auto seat = m_seats.allocate();
 
-		for ( auto & seat : m_elements )
+		if ( !seat )
 		{
-			if ( seat == nullptr )
-			{
-				seat = element;
+			offset = 0;
 
-				return true;
-			}
-
-			offset++;
+			return false;
 		}
 
-		return false;
+		offset = *seat;
+
+		m_elements[offset].store(element, std::memory_order_release);
+
+		return true;
 	}
 
 	void
-	SharedUniformBuffer::removeElement (const void * element) noexcept
+	SharedUniformBuffer::removeElement (const void * element, uint32_t index) noexcept
 	{
-		const std::lock_guard< std::mutex > lock{m_elementsAccess};
-
-		const auto elementIt = std::ranges::find_if(m_elements, [element] (const auto & seat) {
-			return seat == element;
-		});
-
-		if ( elementIt != m_elements.end() )
+		if ( index >= m_elementCount || element == nullptr )
 		{
-			*elementIt = nullptr;
+			return;
 		}
-	}
 
-	uint32_t
-	SharedUniformBuffer::elementCount () const noexcept
-	{
-		const std::lock_guard< std::mutex > lock{m_elementsAccess};
-
-		uint32_t count = 0;
+		/* NOTE: Owners call this on destruction even when their addElement() failed,
+		 * the index then points to a seat another thread may be claiming or releasing.
+		 * Only the owner registered in the entry wins the exchange and frees the seat. */
+		auto expected = element;
 
-		for ( const auto & seat : m_elements )
+		if ( !m_elements[index].compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel) )
 		{
-			if ( seat != nullptr )
-			{
-				count++;
-			}
+			return;
 		}
 
-		return count;
+		m_seats.release(index);
 	}
 
 	bool
@@ -270,7 +258,7 @@ namespace EmEn::Graphics
 			return false;
 		}
 
-		m_elements.resize(m_uniformBufferObjects.size() * m_maxElementCountPerUBO, nullptr);
+		m_elementCount = static_cast< uint32_t >(m_uniformBufferObjects.size()) * m_maxElementCountPerUBO;
 
 		return true;
 	}
@@ -297,7 +285,7 @@ namespace EmEn::Graphics
 		auto * descriptorSet = m_descriptorSets.emplace_back(descriptorSetCreator(renderer, *uniformBufferObject)).get();
 		descriptorSet->setIdentifier(ClassId, chunkId, "DescriptorSet");
 
-		m_elements.resize(m_uniformBufferObjects.size() * m_maxElementCountPerUBO, nullptr);
+		m_elementCount = static_cast< uint32_t >(m_uniformBufferObjects.size()) * m_maxElementCountPerUBO;
 
 		return true;
 	}
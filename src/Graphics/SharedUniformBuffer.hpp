@@ -27,14 +27,15 @@
 #pragma once
 
 /* STL inclusions. */
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <vector>
 
 /* Local inclusions for usages. */
+#include "SlotAllocator.hpp"
 #include "Vulkan/DescriptorSet.hpp"
 #include "Vulkan/UniformBufferObject.hpp"
 
@@ -126,6 +127,7 @@ namespace EmEn::Graphics
 
 			/**
 			 * @brief Adds a new element to the uniform buffer object.
+			 * @note Thread-safe and lock-free, the lowest free seat is claimed in constant time.
 			 * @param element A raw pointer to link the element.
 			 * @param offset A reference to an unsigned integer to get the offset.
 			 * @return bool
@@ -135,17 +137,24 @@ namespace EmEn::Graphics
 
 			/**
 			 * @brief Removes an element from the uniform buffer object.
+			 * @note Thread-safe and lock-free. Nothing is released if the seat is not owned by the element,
+			 * so it is safe to call for an element whose addElement() failed.
 			 * @param element A raw pointer from the linked element.
+			 * @param index The element index given by addElement().
 			 * @return void
 			 */
-			void removeElement (const void * element) noexcept;
+			void removeElement (const void * element, uint32_t index) noexcept;
 
 			/**
 			 * @brief Returns the number of elements present in the buffer.
 			 * @return uint32_t
 			 */
 			[[nodiscard]]
-			uint32_t elementCount () const noexcept;
+			uint32_t
+			elementCount () const noexcept
+			{
+				return m_seats.usedCount();
+			}
 
 			/**
 			 * @brief Writes element data to the UBO.
@@ -239,12 +248,14 @@ namespace EmEn::Graphics
 			uint32_t m_blockAlignedSize{0};
 			std::vector< std::unique_ptr< Vulkan::UniformBufferObject > > m_uniformBufferObjects;
 			std::vector< std::unique_ptr< Vulkan::DescriptorSet > > m_descriptorSets;
-			std::vector< const void * > m_elements;
-			/* NOTE: Guards the seat table only. Owners are registered concurrently from the resource
-			 * thread pool, and claiming a seat is a scan followed by a write: without this lock two
-			 * owners can claim the same seat, hence the same UBO offset, and then silently overwrite
-			 * each other's uniform block. It does NOT guard writeElementData(): once a seat is granted
-			 * its owner holds it exclusively and writes to a byte range that belongs to no one else. */
-			mutable std::mutex m_elementsAccess;
+			/* NOTE: Owners are registered concurrently from the resource thread pool. Claiming a seat
+			 * is a single atomic operation on the bitmap, so two owners can never get the same seat,
+			 * hence the same UBO offset. Once a seat is granted its owner holds it exclusively: it
+			 * writes its own entry of m_elements and a byte range of the UBO that belongs to no one else.
+			 * The entries are atomic: a stale owner (whose addElement() failed) reads them while the
+			 * rightful one writes them, and releases nothing unless its own pointer is exchanged out. */
+			SlotAllocator m_seats;
+			std::unique_ptr< std::atomic< const void * >[] > m_elements;
+			uint32_t m_elementCount{0};
 	};
 }
@@ -0,0 +1,180 @@
+/*
+ * src/Graphics/SlotAllocator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "SlotAllocator.hpp"
+
+/* STL inclusions. */
+#include <bit>
+
+namespace EmEn::Graphics
+{
+	namespace
+	{
+		/**
+		 * @brief Returns a word with the lowest bits set.
+		 * @param count The number of bits, up to 64.
+		 * @return uint64_t
+		 */
+		[[nodiscard]]
+		constexpr
+		uint64_t
+		lowBits (uint32_t count) noexcept
+		{
+			return count >= 64 ? ~uint64_t{0} : (uint64_t{1} << count) - 1;
+		}
+	}
+
+	SlotAllocator::SlotAllocator (uint32_t capacity) noexcept
+	{
+		this->reset(capacity);
+	}
+
+	void
+	SlotAllocator::reset (uint32_t capacity) noexcept
+	{
+		m_capacity = capacity;
+		m_wordCount = (capacity + WordBits - 1) / WordBits;
+		m_summaryCount = (m_wordCount + WordBits - 1) / WordBits;
+		m_usedCount.store(0, std::memory_order_relaxed);
+
+		m_words = std::make_unique< std::atomic< uint64_t >[] >(m_wordCount);
+		m_summary = std::make_unique< std::atomic< uint64_t >[] >(m_summaryCount);
+
+		/* NOTE: The bits past the capacity in the last word stay clear: they never look free. */
+		for ( uint32_t wordIndex = 0; wordIndex < m_wordCount; wordIndex++ )
+		{
+			m_words[wordIndex].store(lowBits(capacity - wordIndex * WordBits), std::memory_order_relaxed);
+		}
+
+		for ( uint32_t summaryIndex = 0; summaryIndex < m_summaryCount; summaryIndex++ )
+		{
+			m_summary[summaryIndex].store(lowBits(m_wordCount - summaryIndex * WordBits), std::memory_order_relaxed);
+		}
+	}
+
+	std::optional< uint32_t >
+	SlotAllocator::allocateInWord (uint32_t wordIndex) noexcept
+	{
+		auto & word = m_words[wordIndex];
+
+		auto bits = word.load(std::memory_order_relaxed);
+
+		while ( bits != 0 )
+		{
+			const auto bit = static_cast< uint32_t >(std::countr_zero(bits));
+			const auto remaining = bits & (bits - 1);
+
+			if ( word.compare_exchange_weak(bits, remaining, std::memory_order_acq_rel, std::memory_order_relaxed) )
+			{
+				if ( remaining == 0 )
+				{
+					auto & summary = m_summary[wordIndex / WordBits];
+					const auto summaryBit = uint64_t{1} << (wordIndex % WordBits);
+
+					summary.fetch_and(~summaryBit, std::memory_order_seq_cst);
+
+					/* NOTE: A release may have refilled the word and set its summary bit just
+					 * before the clear above. Restore the bit, the word must stay reachable. */
+					if ( word.load(std::memory_order_seq_cst) != 0 )
+					{
+						summary.fetch_or(summaryBit, std::memory_order_seq_cst);
+					}
+				}
+
+				m_usedCount.fetch_add(1, std::memory_order_relaxed);
+
+				return wordIndex * WordBits + bit;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	std::optional< uint32_t >
+	SlotAllocator::allocate () noexcept
+	{
+		for ( uint32_t summaryIndex = 0; summaryIndex < m_summaryCount; summaryIndex++ )
+		{
+			auto candidates = m_summary[summaryIndex].load(std::memory_order_acquire);
+
+			while ( candidates != 0 )
+			{
+				const auto wordIndex = summaryIndex * WordBits + static_cast< uint32_t >(std::countr_zero(candidates));
+
+				if ( const auto slot = this->allocateInWord(wordIndex) )
+				{
+					return slot;
+				}
+
+				/* NOTE: The word was emptied by another thread in between, try the next one. */
+				candidates &= candidates - 1;
+			}
+		}
+
+		return std::nullopt;
+	}
+
+	bool
+	SlotAllocator::release (uint32_t slot) noexcept
+	{
+		if ( slot >= m_capacity )
+		{
+			return false;
+		}
+
+		const auto wordIndex = slot / WordBits;
+		const auto bit = uint64_t{1} << (slot % WordBits);
+
+		const auto previous = m_words[wordIndex].fetch_or(bit, std::memory_order_seq_cst);
+
+		if ( (previous & bit) != 0 )
+		{
+			return false;
+		}
+
+		m_usedCount.fetch_sub(1, std::memory_order_relaxed);
+
+		/* NOTE: Only the release refilling an empty word has to publish it in the summary. */
+		if ( previous == 0 )
+		{
+			m_summary[wordIndex / WordBits].fetch_or(uint64_t{1} << (wordIndex % WordBits), std::memory_order_seq_cst);
+		}
+
+		return true;
+	}
+
+	bool
+	SlotAllocator::isAllocated (uint32_t slot) const noexcept
+	{
+		if ( slot >= m_capacity )
+		{
+			return false;
+		}
+
+		return (m_words[slot / WordBits].load(std::memory_order_relaxed) & (uint64_t{1} << (slot % WordBits))) == 0;
+	}
+}
@@ -0,0 +1,174 @@
+/*
+ * src/Graphics/SlotAllocator.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+namespace EmEn::Graphics
+{
+	/**
+	 * @brief A lock-free allocator of fixed-capacity slots, for fixed-stride GPU buffers.
+	 *
+	 * Free slots are bits set in 64-bit words. A summary level keeps one bit per word, set when the
+	 * word may hold a free slot, so an allocation finds a slot with two find-first-set operations
+	 * instead of scanning the slots. Releasing a slot sets its bit back. Both operations are
+	 * compare-and-swap loops on the words: no lock is taken, and threads only contend on the same word.
+	 *
+	 * The lowest free slot is always preferred, which keeps the used slots packed at the start of the
+	 * buffer (SharedUniformBuffer spreads the slots over several UBOs).
+	 *
+	 * @note The summary is a hint: a set bit may point to a word emptied in between, and the
+	 * allocation then looks further. A word holding a free slot always has its summary bit set.
+	 * @since 0.9.53
+	 */
+	class EMEN_API SlotAllocator final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"SlotAllocator"};
+
+			/** @brief Number of slots per bitmap word. */
+			static constexpr uint32_t WordBits{64};
+
+			/**
+			 * @brief Constructs a slot allocator.
+			 * @param capacity The number of slots, all free.
+			 */
+			explicit SlotAllocator (uint32_t capacity = 0) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			SlotAllocator (const SlotAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			SlotAllocator (SlotAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return SlotAllocator &
+			 */
+			SlotAllocator & operator= (const SlotAllocator & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return SlotAllocator &
+			 */
+			SlotAllocator & operator= (SlotAllocator && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the slot allocator.
+			 */
+			~SlotAllocator () = default;
+
+			/**
+			 * @brief Resets the allocator to a new capacity, every slot free.
+			 * @warning Not thread-safe. Call before handing out slots (construction time).
+			 * @param capacity The number of slots.
+			 * @return void
+			 */
+			void reset (uint32_t capacity) noexcept;
+
+			/**
+			 * @brief Claims the lowest free slot.
+			 * @note Thread-safe and lock-free.
+			 * @return std::optional< uint32_t > No value when every slot is used.
+			 */
+			[[nodiscard]]
+			std::optional< uint32_t > allocate () noexcept;
+
+			/**
+			 * @brief Releases a slot.
+			 * @note Thread-safe and lock-free.
+			 * @param slot The slot index.
+			 * @return bool False if the slot is out of range or already free.
+			 */
+			bool release (uint32_t slot) noexcept;
+
+			/**
+			 * @brief Returns whether a slot is in use.
+			 * @param slot The slot index.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isAllocated (uint32_t slot) const noexcept;
+
+			/**
+			 * @brief Returns the number of slots.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			capacity () const noexcept
+			{
+				return m_capacity;
+			}
+
+			/**
+			 * @brief Returns the number of slots in use.
+			 * @return uint32_t
+			 */
+			[[nodiscard]]
+			uint32_t
+			usedCount () const noexcept
+			{
+				return m_usedCount.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			/**
+			 * @brief Tries to claim a slot in a bitmap word.
+			 * @param wordIndex The bitmap word index.
+			 * @return std::optional< uint32_t >
+			 */
+			[[nodiscard]]
+			std::optional< uint32_t > allocateInWord (uint32_t wordIndex) noexcept;
+
+			std::unique_ptr< std::atomic< uint64_t >[] > m_words;
+			std::unique_ptr< std::atomic< uint64_t >[] > m_summary;
+			std::atomic< uint32_t > m_usedCount{0};
+			uint32_t m_capacity{0};
+			uint32_t m_wordCount{0};
+			uint32_t m_summaryCount{0};
+	};
+}
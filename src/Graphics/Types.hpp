@@ -197,6 +197,31 @@ namespace EmEn::Graphics
 		return value == RenderPassType::DirectionalLightPassCSM || value == RenderPassType::DirectionalLightPassFullCSM;
 	}
 
+	/**
+	 * @brief Returns whether the shadow map switch of a render pass type can be a specialization constant.
+	 * @note Only the directional (without CSM) and spot light passes without color projection qualify. Their plain and shadow
+	 * map variants share the uniform block and the 2D shadow sampler, the point light uses a cubemap sampler the dummy shadow
+	 * texture of the light set cannot fill.
+	 * @param value The render pass type.
+	 * @return bool
+	 */
+	[[nodiscard]]
+	constexpr bool
+	renderPassSupportsShadowSpecialization (RenderPassType value) noexcept
+	{
+		switch ( value )
+		{
+			case RenderPassType::DirectionalLightPass :
+			case RenderPassType::DirectionalLightPassShadowMap :
+			case RenderPassType::SpotLightPass :
+			case RenderPassType::SpotLightPassShadowMap :
+				return true;
+
+			default:
+				return false;
+		}
+	}
+
 	/**
 	 * @brief Returns whether a render pass type uses color projection mapping.
 	 * @param value The render pass type.
@@ -855,7 +855,7 @@ namespace EmEn::Overlay
 			//info.DescriptorPoolSize = 1;
 			info.MinImageCount = frameCount;
 			info.ImageCount = frameCount;
-			info.PipelineCache = VK_NULL_HANDLE;
+			info.PipelineCache = device->pipelineCacheHandle();
 			info.PipelineInfoMain.RenderPass = overlayFramebuffer->renderPass()->handle();
 			info.PipelineInfoMain.Subpass = 0;
 			info.UseDynamicRendering = false;
@@ -28,6 +28,7 @@
 
 /* Local inclusions. */
 #include "CapsuleCollisionModel.hpp"
+#include "ConvexHullCollisionModel.hpp"
 #include "Math/Space3D/Collisions/CapsuleCuboid.hpp"
 #include "Math/Space3D/Collisions/PointCuboid.hpp"
 #include "Math/Space3D/Collisions/SamePrimitive.hpp"
@@ -56,6 +57,9 @@ namespace EmEn::Physics
 
 			case CollisionModelType::Capsule:
 				return this->collideWithCapsule(thisWorldFrame, static_cast< const CapsuleCollisionModel & >(other), otherWorldFrame);
+
+			case CollisionModelType::ConvexHull:
+				return this->collideWithConvexHull(thisWorldFrame, static_cast< const ConvexHullCollisionModel & >(other), otherWorldFrame);
 		}
 
 		return {};
@@ -232,4 +236,10 @@ namespace EmEn::Physics
 
 		return results;
 	}
+
+	CollisionDetectionResults
+	AABBCollisionModel::collideWithConvexHull (const CartesianFrame< float > & thisWorldFrame, const ConvexHullCollisionModel & other, const CartesianFrame< float > & otherWorldFrame) const noexcept
+	{
+		return other.collideFromOtherSide(otherWorldFrame, *this, thisWorldFrame);
+	}
 }
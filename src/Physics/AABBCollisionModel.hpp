@@ -41,6 +41,7 @@ namespace EmEn::Physics
 	class PointCollisionModel;
 	class SphereCollisionModel;
 	class CapsuleCollisionModel;
+	class ConvexHullCollisionModel;
 }
 
 namespace EmEn::Physics
@@ -228,6 +229,17 @@ namespace EmEn::Physics
 			[[nodiscard]]
 			CollisionDetectionResults collideWithCapsule (const Base::Math::CartesianFrame< float > & thisWorldFrame, const CapsuleCollisionModel & other, const Base::Math::CartesianFrame< float > & otherWorldFrame) const noexcept;
 
+			/**
+			 * @brief Collision test: AABB vs ConvexHull.
+			 * @note Delegates to the hull GJK/EPA narrowphase.
+			 * @param thisWorldFrame World frame of this AABB.
+			 * @param other The convex hull model.
+			 * @param otherWorldFrame World frame of the convex hull.
+			 * @return CollisionDetectionResults
+			 */
+			[[nodiscard]]
+			CollisionDetectionResults collideWithConvexHull (const Base::Math::CartesianFrame< float > & thisWorldFrame, const ConvexHullCollisionModel & other, const Base::Math::CartesianFrame< float > & otherWorldFrame) const noexcept;
+
 			/** @copydoc CollisionModelInterface::overrideShapeParameters() */
 			void
 			overrideShapeParameters (const Base::Math::Vector< 3, float > & dimensions, const Base::Math::Vector< 3, float > & centerOffset) noexcept override
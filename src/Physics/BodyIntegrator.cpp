@@ -0,0 +1,138 @@
+/*
+ * src/Physics/BodyIntegrator.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "BodyIntegrator.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cmath>
+
+/* Local inclusions. */
+#include "Constants.hpp"
+#include "ThreadPool.hpp"
+
+namespace EmEn::Physics
+{
+	using namespace Base::Math;
+
+	size_t
+	BodyIntegrator::add (const Vector< 3, float > & velocity, float frictionFactor, bool clampDownwardVelocity, float gravityStep, float dragFactor) noexcept
+	{
+		const auto index = m_velocityX.size();
+
+		m_velocityX.push_back(velocity[X]);
+		m_velocityY.push_back(velocity[Y]);
+		m_velocityZ.push_back(velocity[Z]);
+		m_frictionFactor.push_back(frictionFactor);
+		m_clampDownward.push_back(clampDownwardVelocity ? 1.0F : 0.0F);
+		m_gravityStep.push_back(gravityStep);
+		m_dragFactor.push_back(dragFactor);
+		m_speed.push_back(0.0F);
+
+		return index;
+	}
+
+	void
+	BodyIntegrator::integrate (Base::ThreadPool * threadPool) noexcept
+	{
+		const auto count = this->size();
+
+		if ( count == 0 )
+		{
+			return;
+		}
+
+		if ( threadPool == nullptr || count < ParallelThreshold )
+		{
+			this->integrateRange(0, count);
+
+			return;
+		}
+
+		const auto chunkCount = static_cast< uint32_t >((count + ChunkSize - 1) / ChunkSize);
+
+		/* NOTE: Chunks never share a cache line of output, each task owns a contiguous range. */
+		threadPool->parallelFor(uint32_t{0}, chunkCount, [this, count] (uint32_t chunkIndex) {
+			const auto first = static_cast< size_t >(chunkIndex) * ChunkSize;
+
+			this->integrateRange(first, std::min(first + ChunkSize, count));
+		});
+	}
+
+	void
+	BodyIntegrator::clear () noexcept
+	{
+		m_velocityX.clear();
+		m_velocityY.clear();
+		m_velocityZ.clear();
+		m_frictionFactor.clear();
+		m_clampDownward.clear();
+		m_gravityStep.clear();
+		m_dragFactor.clear();
+		m_speed.clear();
+	}
+
+	void
+	BodyIntegrator::integrateRange (size_t first, size_t last) noexcept
+	{
+		constexpr auto DeltaTime{WorldPhysicsUpdateCycleDurationS< float >};
+
+		float * velocityX = m_velocityX.data();
+		float * velocityY = m_velocityY.data();
+		float * velocityZ = m_velocityZ.data();
+		float * speed = m_speed.data();
+		const float * frictionFactor = m_frictionFactor.data();
+		const float * clampDownward = m_clampDownward.data();
+		const float * gravityStep = m_gravityStep.data();
+		const float * dragFactor = m_dragFactor.data();
+
+		/* NOTE: Branchless body so the loop is vectorized. Every flag is encoded as a 0/1 factor. */
+		for ( auto index = first; index < last; ++index )
+		{
+			/* Ground friction on the horizontal plane. */
+			const auto x = velocityX[index] * frictionFactor[index];
+			const auto z = velocityZ[index] * frictionFactor[index];
+
+			/* Y-down: a stable surface cancels the downward (positive) velocity, then gravity applies. */
+			auto y = velocityY[index];
+			y -= clampDownward[index] * std::max(y, 0.0F);
+			y += gravityStep[index];
+
+			/* Quadratic drag: Δv = -v̂ × (0.5 × Cd × ρ × |v|² × S / m) × Δt = -v × (factor × |v| × Δt). */
+			const auto preDragSpeed = std::sqrt(x * x + y * y + z * z);
+			const auto dragScale = 1.0F - dragFactor[index] * preDragSpeed * DeltaTime;
+
+			const auto newX = x * dragScale;
+			const auto newY = y * dragScale;
+			const auto newZ = z * dragScale;
+
+			velocityX[index] = newX;
+			velocityY[index] = newY;
+			velocityZ[index] = newZ;
+			speed[index] = std::sqrt(newX * newX + newY * newY + newZ * newZ);
+		}
+	}
+}
@@ -0,0 +1,156 @@
+/*
+ * src/Physics/BodyIntegrator.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Math/Vector.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Base
+{
+	class ThreadPool;
+}
+
+namespace EmEn::Physics
+{
+	/**
+	 * @brief Integrates the linear motion of every active body of a scene in one pass.
+	 *
+	 * The per-body integration inputs (velocity, friction, gravity step, drag factor) are gathered
+	 * into a structure of arrays, integrated by a branchless kernel over contiguous float streams
+	 * (vectorized by the compiler), split in chunks over the thread pool for large batches, then
+	 * read back by each body to apply its displacement.
+	 *
+	 * The kernel reproduces MovableTrait::updateSimulation() step by step: friction, stable surface
+	 * clamp, gravity, quadratic drag then displacement over WorldPhysicsUpdateCycleDurationS.
+	 *
+	 * @note Arrays are cleared, never shrunk, the gathering does not allocate after the first ticks.
+	 * @see MovableTrait::gatherIntegrationState(), MovableTrait::applyIntegrationResults()
+	 * @since 0.9.53
+	 */
+	class EMEN_API BodyIntegrator final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"BodyIntegrator"};
+
+			/** @brief Number of bodies integrated by one thread pool task. */
+			static constexpr size_t ChunkSize{1024};
+
+			/** @brief Number of bodies under which the batch is integrated on the calling thread. */
+			static constexpr size_t ParallelThreshold{4096};
+
+			/**
+			 * @brief Constructs a body integrator.
+			 */
+			BodyIntegrator () noexcept = default;
+
+			/**
+			 * @brief Adds a body to the batch.
+			 * @param velocity A reference to the body linear velocity.
+			 * @param frictionFactor The horizontal velocity factor (1 when not grounded).
+			 * @param clampDownwardVelocity Whether a downward velocity (Y+) must be cancelled (grounded on a stable surface).
+			 * @param gravityStep The gravity velocity added this tick (0 when not applied).
+			 * @param dragFactor The drag factor 0.5 × Cd × ρ × S / m (0 for massless bodies).
+			 * @return size_t The index of the body in the batch.
+			 */
+			size_t add (const Base::Math::Vector< 3, float > & velocity, float frictionFactor, bool clampDownwardVelocity, float gravityStep, float dragFactor) noexcept;
+
+			/**
+			 * @brief Integrates every body of the batch.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			void integrate (Base::ThreadPool * threadPool) noexcept;
+
+			/**
+			 * @brief Clears the batch, keeping the allocated memory.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+			/**
+			 * @brief Returns the number of bodies in the batch.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			size () const noexcept
+			{
+				return m_velocityX.size();
+			}
+
+			/**
+			 * @brief Returns the integrated velocity of a body.
+			 * @param index The body index.
+			 * @return Base::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			Base::Math::Vector< 3, float >
+			velocity (size_t index) const noexcept
+			{
+				return {m_velocityX[index], m_velocityY[index], m_velocityZ[index]};
+			}
+
+			/**
+			 * @brief Returns the integrated speed of a body.
+			 * @param index The body index.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			speed (size_t index) const noexcept
+			{
+				return m_speed[index];
+			}
+
+		private:
+
+			/**
+			 * @brief Integrates a contiguous range of bodies.
+			 * @param first The first body index.
+			 * @param last The index past the last body.
+			 * @return void
+			 */
+			void integrateRange (size_t first, size_t last) noexcept;
+
+			std::vector< float > m_velocityX;
+			std::vector< float > m_velocityY;
+			std::vector< float > m_velocityZ;
+			std::vector< float > m_frictionFactor;
+			std::vector< float > m_clampDownward;
+			std::vector< float > m_gravityStep;
+			std::vector< float > m_dragFactor;
+			std::vector< float > m_speed;
+	};
+}
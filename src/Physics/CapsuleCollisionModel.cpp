@@ -28,6 +28,7 @@
 
 /* Local inclusions. */
 #include "AABBCollisionModel.hpp"
+#include "ConvexHullCollisionModel.hpp"
 #include "Math/Space3D/Capsule.hpp"
 #include "Math/Space3D/Collisions/CapsuleCuboid.hpp"
 #include "Math/Space3D/Collisions/CapsulePoint.hpp"
@@ -57,6 +58,9 @@ namespace EmEn::Physics
 
 			case CollisionModelType::Capsule:
 				return this->collideWithCapsule(thisWorldFrame, static_cast< const CapsuleCollisionModel & >(other), otherWorldFrame);
+
+			case CollisionModelType::ConvexHull:
+				return this->collideWithConvexHull(thisWorldFrame, static_cast< const ConvexHullCollisionModel & >(other), otherWorldFrame);
 		}
 
 		return {};
@@ -188,4 +192,10 @@ namespace EmEn::Physics
 
 		return results;
 	}
+
+	CollisionDetectionResults
+	CapsuleCollisionModel::collideWithConvexHull (const CartesianFrame< float > & thisWorldFrame, const ConvexHullCollisionModel & other, const CartesianFrame< float > & otherWorldFrame) const noexcept
+	{
+		return other.collideFromOtherSide(otherWorldFrame, *this, thisWorldFrame);
+	}
 }
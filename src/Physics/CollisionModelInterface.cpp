@@ -0,0 +1,44 @@
+/*
+ * src/Physics/CollisionModelInterface.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+#include "CollisionModelInterface.hpp"
+
+/* STL inclusions. */
+#include <atomic>
+
+namespace
+{
+	/* NOTE: Kept out of the class, a static data member cannot be exported from the shared library on every platform. */
+	std::atomic< uint64_t > NextInstanceId{1};
+}
+
+namespace EmEn::Physics
+{
+	uint64_t
+	CollisionModelInterface::nextInstanceId () noexcept
+	{
+		return NextInstanceId.fetch_add(1, std::memory_order_relaxed);
+	}
+}
@@ -29,6 +29,9 @@
 /* Project configuration. */
 #include "emeraude_export.hpp"
 
+/* STL inclusions. */
+#include <cstdint>
+
 /* Local inclusions for usages. */
 #include "Math/CartesianFrame.hpp"
 #include "Math/Space3D/AACuboid.hpp"
@@ -46,7 +49,8 @@ namespace EmEn::Physics
 		Point,
 		Sphere,
 		AABB,
-		Capsule
+		Capsule,
+		ConvexHull
 	};
 
 	/**
@@ -120,6 +124,7 @@ namespace EmEn::Physics
 			 *	   - Sphere: radius
 			 *	   - AABB: max(halfWidth, halfHeight, halfDepth)
 			 *	   - Capsule: half-height + radius
+			 *	   - ConvexHull: farthest vertex from the local origin
 			 * @return float The maximum bounding radius.
 			 */
 			[[nodiscard]]
@@ -132,6 +137,7 @@ namespace EmEn::Physics
 			 *	   - Sphere: radius = max(dimensions) * 0.5
 			 *	   - AABB: halfExtents = dimensions * 0.5
 			 *	   - Capsule: radius = max(width, depth) * 0.5, height = dimensions.y
+			 *	   - ConvexHull: vertices rescaled to fit the dimensions
 			 * @param dimensions The dimensions (width, height, depth) of the bounding shape.
 			 * @param centerOffset The offset of the shape center from the entity's origin.
 			 */
@@ -179,8 +185,60 @@ namespace EmEn::Physics
 			 */
 			virtual void resetShapeParameters () noexcept = 0;
 
+			/**
+			 * @brief Returns the identifier of this model instance.
+			 * @note Unlike the address, it is never given to another model during the run, caches keyed
+			 * by it cannot match a new model allocated where a destroyed one was.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			instanceId () const noexcept
+			{
+				return m_instanceId;
+			}
+
 		protected:
 
-			CollisionModelInterface () = default;
+			/**
+			 * @brief Constructs a collision model with a new instance identifier.
+			 */
+			CollisionModelInterface () noexcept
+				: m_instanceId{nextInstanceId()}
+			{
+
+			}
+
+			/**
+			 * @brief Copy constructor, the copy gets its own instance identifier.
+			 * @param copy A reference to the copied instance.
+			 */
+			CollisionModelInterface (const CollisionModelInterface & /*copy*/) noexcept
+				: m_instanceId{nextInstanceId()}
+			{
+
+			}
+
+			/**
+			 * @brief Copy assignment, the instance identifier is kept.
+			 * @param copy A reference to the copied instance.
+			 * @return CollisionModelInterface &
+			 */
+			CollisionModelInterface &
+			operator= (const CollisionModelInterface & /*copy*/) noexcept
+			{
+				return *this;
+			}
+
+		private:
+
+			/**
+			 * @brief Returns a new instance identifier.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t nextInstanceId () noexcept;
+
+			uint64_t m_instanceId;
 	};
 }
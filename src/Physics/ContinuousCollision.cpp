@@ -0,0 +1,265 @@
+/*
+ * src/Physics/ContinuousCollision.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "ContinuousCollision.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+/* Local inclusions. */
+#include "AABBCollisionModel.hpp"
+#include "ConvexCollision.hpp"
+#include "SphereCollisionModel.hpp"
+
+namespace EmEn::Physics
+{
+	using namespace Base::Math;
+
+	namespace
+	{
+		/** @brief Maximum conservative advancement steps. */
+		constexpr uint32_t AdvancementMaxIterations{32};
+		/** @brief Gap under which the shapes are considered touching, in meters. */
+		constexpr float AdvancementTolerance{1.0e-3F};
+		/** @brief Maximum samples along a path against a height field. */
+		constexpr uint32_t HeightFieldMaxSamples{64};
+		/** @brief Bisection steps refining a height field crossing. */
+		constexpr uint32_t HeightFieldRefinementSteps{10};
+
+		/**
+		 * @brief Returns a copy of a frame translated at a fraction of a displacement.
+		 * @param frame A reference to the start frame.
+		 * @param displacement A reference to the full displacement.
+		 * @param time The normalized time.
+		 * @return CartesianFrame< float >
+		 */
+		[[nodiscard]]
+		CartesianFrame< float >
+		frameAt (const CartesianFrame< float > & frame, const Vector< 3, float > & displacement, float time) noexcept
+		{
+			auto movedFrame = frame;
+			movedFrame.setPosition(frame.position() + displacement * time);
+
+			return movedFrame;
+		}
+	}
+
+	TimeOfImpactResults
+	computeTimeOfImpact (const CollisionModelInterface & modelA, const CartesianFrame< float > & startFrameA, const Vector< 3, float > & displacementA, const CollisionModelInterface & modelB, const CartesianFrame< float > & startFrameB, const Vector< 3, float > & displacementB) noexcept
+	{
+		TimeOfImpactResults results;
+
+		/* NOTE: B is observed from A, only the relative motion matters for the advancement bound. */
+		const auto relativeDisplacement = displacementA - displacementB;
+
+		if ( relativeDisplacement.length() <= AdvancementTolerance )
+		{
+			return results;
+		}
+
+		Vector< 3, float > axis;
+		float time = 0.0F;
+
+		for ( uint32_t iteration = 0; iteration < AdvancementMaxIterations; ++iteration )
+		{
+			const auto shapeA = SupportMapping::fromModel(modelA, frameAt(startFrameA, displacementA, time));
+			const auto shapeB = SupportMapping::fromModel(modelB, frameAt(startFrameB, displacementB, time));
+			const auto gjk = computeGJK(shapeA, shapeB, axis);
+
+			axis = gjk.m_separatingAxis;
+
+			/* NOTE: Already overlapping at the start of the tick, this is a discrete contact. */
+			if ( gjk.m_overlap || gjk.m_distance <= 0.0F )
+			{
+				if ( time > 0.0F )
+				{
+					results.m_impactDetected = true;
+					results.m_time = time;
+					results.m_contact = shapeA.center();
+					results.m_impactNormal = (shapeA.center() - shapeB.center()).normalized();
+				}
+
+				return results;
+			}
+
+			/* NOTE: The separating axis points from B toward A in both GJK exits. The separated-cores
+			 * early-out leaves no simplex (no closest points) and a distance that is a lower bound,
+			 * which keeps the advancement conservative. */
+			const auto towardB = -gjk.m_separatingAxis.normalized();
+			const auto gap = gjk.m_distance - shapeA.margin() - shapeB.margin();
+
+			if ( gap <= AdvancementTolerance )
+			{
+				if ( time > 0.0F )
+				{
+					results.m_impactDetected = true;
+					results.m_time = time;
+					results.m_contact = gjk.m_simplexSize > 0 ? gjk.m_closestOnA + towardB * shapeA.margin() : shapeA.support(towardB);
+					results.m_impactNormal = -towardB;
+				}
+
+				return results;
+			}
+
+			/* NOTE: The separating plane moves at most at the closing speed along its normal,
+			 * so advancing by gap / closingDistance can never step over the first contact. */
+			const auto closingDistance = Vector< 3, float >::dotProduct(relativeDisplacement, towardB);
+
+			if ( closingDistance <= AdvancementTolerance * 0.1F )
+			{
+				return results;
+			}
+
+			time += gap / closingDistance;
+
+			if ( time > 1.0F )
+			{
+				return results;
+			}
+		}
+
+		return results;
+	}
+
+	TimeOfImpactResults
+	computeTimeOfImpactWithHeightField (const Vector< 3, float > & start, const Vector< 3, float > & displacement, const std::function< float (const Vector< 3, float > &) > & getLevelAt, float sampleSpacing) noexcept
+	{
+		TimeOfImpactResults results;
+
+		/* NOTE: Y- is up, a point is under the surface when its Y is greater than the level. */
+		const auto depthAt = [&] (float time) {
+			const auto point = start + displacement * time;
+
+			return point[Y] - getLevelAt(point);
+		};
+
+		/* NOTE: Already under the surface, this is a discrete contact. */
+		if ( depthAt(0.0F) > 0.0F )
+		{
+			return results;
+		}
+
+		const auto distance = displacement.length();
+		const auto sampleCount = std::clamp(static_cast< uint32_t >(std::ceil(distance / std::max(sampleSpacing, 0.01F))), 1U, HeightFieldMaxSamples);
+
+		float previousTime = 0.0F;
+
+		for ( uint32_t sample = 1; sample <= sampleCount; ++sample )
+		{
+			const auto time = static_cast< float >(sample) / static_cast< float >(sampleCount);
+
+			if ( depthAt(time) <= 0.0F )
+			{
+				previousTime = time;
+
+				continue;
+			}
+
+			/* Refine the crossing between the last point above and the first point below. */
+			auto above = previousTime;
+			auto below = time;
+
+			for ( uint32_t step = 0; step < HeightFieldRefinementSteps; ++step )
+			{
+				const auto middle = (above + below) * 0.5F;
+
+				if ( depthAt(middle) > 0.0F )
+				{
+					below = middle;
+				}
+				else
+				{
+					above = middle;
+				}
+			}
+
+			results.m_impactDetected = true;
+			results.m_time = above;
+			results.m_contact = start + displacement * above;
+
+			return results;
+		}
+
+		return results;
+	}
+
+	bool
+	selfTestContinuousCollision (std::string & report) noexcept
+	{
+		std::stringstream output;
+		auto success = true;
+
+		/* A 0.1 m sphere crossing a 2 cm thick wall in a single tick: the discrete pass never sees it. */
+		const SphereCollisionModel sphere{0.1F};
+		const AABBCollisionModel wall{0.01F, 1.0F, 1.0F};
+
+		CartesianFrame< float > sphereFrame;
+		sphereFrame.setPosition({-1.0F, 0.0F, 0.0F});
+
+		const CartesianFrame< float > wallFrame;
+		const Vector< 3, float > displacement{2.0F, 0.0F, 0.0F};
+
+		const auto impact = computeTimeOfImpact(sphere, sphereFrame, displacement, wall, wallFrame, {});
+
+		/* NOTE: First contact when the sphere surface reaches the wall face: x = -0.01 - 0.1. */
+		const auto expectedTime = (1.0F - 0.11F) / 2.0F;
+
+		output << "Fast sphere through a thin box : ";
+
+		if ( !impact.m_impactDetected || std::abs(impact.m_time - expectedTime) > 0.01F || impact.m_impactNormal[X] > -0.9F )
+		{
+			output << "FAILED (impact " << impact.m_impactDetected << ", time " << impact.m_time << ", expected " << expectedTime << ")" "\n";
+
+			success = false;
+		}
+		else
+		{
+			output << "OK (time " << impact.m_time << ")" "\n";
+		}
+
+		/* The same sphere moving away from the wall never touches it. */
+		const auto miss = computeTimeOfImpact(sphere, sphereFrame, -displacement, wall, wallFrame, {});
+
+		output << "Sphere moving away : ";
+
+		if ( miss.m_impactDetected )
+		{
+			output << "FAILED (impact at time " << miss.m_time << ")" "\n";
+
+			success = false;
+		}
+		else
+		{
+			output << "OK" "\n";
+		}
+
+		report = output.str();
+
+		return success;
+	}
+}
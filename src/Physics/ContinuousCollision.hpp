@@ -0,0 +1,88 @@
+/*
+ * src/Physics/ContinuousCollision.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <functional>
+#include <string>
+
+/* Local inclusions for usages. */
+#include "CollisionModelInterface.hpp"
+
+namespace EmEn::Physics
+{
+	/** @brief Penetration left when a swept body is clamped at its time of impact, so the discrete pass still sees the contact. */
+	constexpr auto ContinuousCollisionSkin{0.002F};
+
+	/**
+	 * @brief Results of a time of impact query.
+	 */
+	struct EMEN_API TimeOfImpactResults
+	{
+		Base::Math::Vector< 3, float > m_contact;	  /**< World contact point at the time of impact. */
+		Base::Math::Vector< 3, float > m_impactNormal; /**< Normal at the time of impact (points from B toward A). */
+		float m_time{1.0F};							  /**< Normalized time of impact in [0, 1] along the displacements. */
+		bool m_impactDetected{false};				  /**< Whether an impact occurs during the displacements. */
+	};
+
+	/**
+	 * @brief Computes the first time of impact of two collision models translating linearly over one tick.
+	 * @note Uses conservative advancement on the GJK distance, so spheres and capsules are swept exactly
+	 * (point and segment cores) and every other model type works through its support mapping.
+	 * Rotation during the tick is ignored. Bodies already overlapping at the start return no impact,
+	 * the discrete pass handles them.
+	 * @param modelA A reference to the first collision model.
+	 * @param startFrameA A reference to the world frame of A at the start of the tick.
+	 * @param displacementA A reference to the displacement of A over the tick.
+	 * @param modelB A reference to the second collision model.
+	 * @param startFrameB A reference to the world frame of B at the start of the tick.
+	 * @param displacementB A reference to the displacement of B over the tick (zero for static bodies).
+	 * @return TimeOfImpactResults
+	 */
+	[[nodiscard]]
+	EMEN_API TimeOfImpactResults computeTimeOfImpact (const CollisionModelInterface & modelA, const Base::Math::CartesianFrame< float > & startFrameA, const Base::Math::Vector< 3, float > & displacementA, const CollisionModelInterface & modelB, const Base::Math::CartesianFrame< float > & startFrameB, const Base::Math::Vector< 3, float > & displacementB) noexcept;
+
+	/**
+	 * @brief Computes the first time a point (the lowest point of a body) crosses below a height function.
+	 * @note The path is sampled then refined by bisection. Y- is up, so "below" means a greater Y value.
+	 * @param start A reference to the point at the start of the tick.
+	 * @param displacement A reference to the displacement over the tick.
+	 * @param getLevelAt A function returning the surface level under a world position.
+	 * @param sampleSpacing The maximum distance between two samples along the path (typically the body radius).
+	 * @return TimeOfImpactResults The normal is left to the caller.
+	 */
+	[[nodiscard]]
+	EMEN_API TimeOfImpactResults computeTimeOfImpactWithHeightField (const Base::Math::Vector< 3, float > & start, const Base::Math::Vector< 3, float > & displacement, const std::function< float (const Base::Math::Vector< 3, float > &) > & getLevelAt, float sampleSpacing) noexcept;
+
+	/**
+	 * @brief Self-tests the time of impact queries on known configurations (a fast sphere through a thin box).
+	 * @param report A reference to a string receiving the test report.
+	 * @return bool
+	 */
+	[[nodiscard]]
+	EMEN_API bool selfTestContinuousCollision (std::string & report) noexcept;
+}
@@ -0,0 +1,912 @@
+/*
+ * src/Physics/ConvexCollision.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "ConvexCollision.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <limits>
+
+/* Local inclusions. */
+#include "AABBCollisionModel.hpp"
+#include "CapsuleCollisionModel.hpp"
+#include "ConvexHullCollisionModel.hpp"
+#include "PointCollisionModel.hpp"
+#include "SphereCollisionModel.hpp"
+
+namespace EmEn::Physics
+{
+	using namespace Base::Math;
+
+	namespace
+	{
+		/** @brief Maximum GJK iterations before accepting the current estimate. */
+		constexpr uint32_t GJKMaxIterations{64};
+		/** @brief Maximum EPA expansions before accepting the closest face. */
+		constexpr uint32_t EPAMaxIterations{64};
+		/** @brief Relative GJK convergence tolerance on the squared distance. */
+		constexpr float GJKRelativeTolerance{1.0e-6F};
+		/** @brief Squared distance under which the cores are considered touching. */
+		constexpr float GJKOverlapTolerance{1.0e-10F};
+		/** @brief EPA convergence tolerance in meters. */
+		constexpr float EPATolerance{1.0e-4F};
+
+		/**
+		 * @brief GJK simplex, holding the Minkowski difference vertices and their support points.
+		 */
+		struct Simplex
+		{
+			std::array< Vector< 3, float >, 4 > w{};
+			std::array< Vector< 3, float >, 4 > a{};
+			std::array< Vector< 3, float >, 4 > b{};
+			std::array< float, 4 > lambda{};
+			uint32_t size{0};
+
+			void
+			push (const Vector< 3, float > & pointW, const Vector< 3, float > & pointA, const Vector< 3, float > & pointB) noexcept
+			{
+				w[size] = pointW;
+				a[size] = pointA;
+				b[size] = pointB;
+				size++;
+			}
+
+			/* NOTE: Keeps only the listed vertices (in that order) with their barycentric weights. */
+			void
+			keep (std::initializer_list< uint32_t > indices, std::initializer_list< float > weights) noexcept
+			{
+				std::array< Vector< 3, float >, 4 > newW{};
+				std::array< Vector< 3, float >, 4 > newA{};
+				std::array< Vector< 3, float >, 4 > newB{};
+				uint32_t count = 0;
+
+				for ( const auto index : indices )
+				{
+					newW[count] = w[index];
+					newA[count] = a[index];
+					newB[count] = b[index];
+					count++;
+				}
+
+				w = newW;
+				a = newA;
+				b = newB;
+				size = count;
+				count = 0;
+
+				for ( const auto weight : weights )
+				{
+					lambda[count++] = weight;
+				}
+			}
+
+			[[nodiscard]]
+			bool
+			contains (const Vector< 3, float > & point) const noexcept
+			{
+				for ( uint32_t index = 0; index < size; ++index )
+				{
+					const auto delta = w[index] - point;
+
+					if ( Vector< 3, float >::dotProduct(delta, delta) < GJKOverlapTolerance )
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			[[nodiscard]]
+			Vector< 3, float >
+			closestPoint () const noexcept
+			{
+				Vector< 3, float > point{0.0F, 0.0F, 0.0F};
+
+				for ( uint32_t index = 0; index < size; ++index )
+				{
+					point += w[index] * lambda[index];
+				}
+
+				return point;
+			}
+		};
+
+		/**
+		 * @brief Reduces a segment simplex [0,1] to the sub-simplex closest to the origin.
+		 */
+		void
+		reduceSegment (Simplex & simplex, uint32_t i0, uint32_t i1) noexcept
+		{
+			const auto & p0 = simplex.w[i0];
+			const auto segment = simplex.w[i1] - p0;
+			const auto lengthSquared = Vector< 3, float >::dotProduct(segment, segment);
+
+			if ( lengthSquared <= std::numeric_limits< float >::epsilon() )
+			{
+				simplex.keep({i0}, {1.0F});
+
+				return;
+			}
+
+			const auto t = -Vector< 3, float >::dotProduct(p0, segment) / lengthSquared;
+
+			if ( t <= 0.0F )
+			{
+				simplex.keep({i0}, {1.0F});
+			}
+			else if ( t >= 1.0F )
+			{
+				simplex.keep({i1}, {1.0F});
+			}
+			else
+			{
+				simplex.keep({i0, i1}, {1.0F - t, t});
+			}
+		}
+
+		/**
+		 * @brief Reduces a triangle simplex to the sub-simplex closest to the origin (Ericson's Voronoi regions).
+		 */
+		void
+		reduceTriangle (Simplex & simplex, uint32_t i0, uint32_t i1, uint32_t i2) noexcept
+		{
+			const auto & a = simplex.w[i0];
+			const auto & b = simplex.w[i1];
+			const auto & c = simplex.w[i2];
+
+			const auto ab = b - a;
+			const auto ac = c - a;
+
+			const auto d1 = -Vector< 3, float >::dotProduct(ab, a);
+			const auto d2 = -Vector< 3, float >::dotProduct(ac, a);
+
+			if ( d1 <= 0.0F && d2 <= 0.0F )
+			{
+				simplex.keep({i0}, {1.0F});
+
+				return;
+			}
+
+			const auto d3 = -Vector< 3, float >::dotProduct(ab, b);
+			const auto d4 = -Vector< 3, float >::dotProduct(ac, b);
+
+			if ( d3 >= 0.0F && d4 <= d3 )
+			{
+				simplex.keep({i1}, {1.0F});
+
+				return;
+			}
+
+			const auto vc = d1 * d4 - d3 * d2;
+
+			if ( vc <= 0.0F && d1 >= 0.0F && d3 <= 0.0F )
+			{
+				const auto v = d1 / (d1 - d3);
+
+				simplex.keep({i0, i1}, {1.0F - v, v});
+
+				return;
+			}
+
+			const auto d5 = -Vector< 3, float >::dotProduct(ab, c);
+			const auto d6 = -Vector< 3, float >::dotProduct(ac, c);
+
+			if ( d6 >= 0.0F && d5 <= d6 )
+			{
+				simplex.keep({i2}, {1.0F});
+
+				return;
+			}
+
+			const auto vb = d5 * d2 - d1 * d6;
+
+			if ( vb <= 0.0F && d2 >= 0.0F && d6 <= 0.0F )
+			{
+				const auto w = d2 / (d2 - d6);
+
+				simplex.keep({i0, i2}, {1.0F - w, w});
+
+				return;
+			}
+
+			const auto va = d3 * d6 - d5 * d4;
+
+			if ( va <= 0.0F && (d4 - d3) >= 0.0F && (d5 - d6) >= 0.0F )
+			{
+				const auto w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+
+				simplex.keep({i1, i2}, {1.0F - w, w});
+
+				return;
+			}
+
+			const auto denominator = va + vb + vc;
+
+			if ( std::abs(denominator) <= std::numeric_limits< float >::epsilon() )
+			{
+				/* NOTE: Degenerate triangle, fall back on its longest edge. */
+				reduceSegment(simplex, i0, Vector< 3, float >::dotProduct(ab, ab) > Vector< 3, float >::dotProduct(ac, ac) ? i1 : i2);
+
+				return;
+			}
+
+			const auto v = vb / denominator;
+			const auto w = vc / denominator;
+
+			simplex.keep({i0, i1, i2}, {1.0F - v - w, v, w});
+		}
+
+		/**
+		 * @brief Returns whether the origin lies on the other side of the plane (a,b,c) than the point d.
+		 */
+		[[nodiscard]]
+		bool
+		isOriginOutsideOfPlane (const Vector< 3, float > & a, const Vector< 3, float > & b, const Vector< 3, float > & c, const Vector< 3, float > & d) noexcept
+		{
+			const auto normal = Vector< 3, float >::crossProduct(b - a, c - a);
+			const auto signOrigin = -Vector< 3, float >::dotProduct(a, normal);
+			const auto signD = Vector< 3, float >::dotProduct(d - a, normal);
+
+			/* NOTE: A flat tetrahedron has no inside, treat every face as a candidate. */
+			if ( signD * signD <= std::numeric_limits< float >::epsilon() * std::numeric_limits< float >::epsilon() )
+			{
+				return true;
+			}
+
+			return signOrigin * signD < 0.0F;
+		}
+
+		/**
+		 * @brief Reduces a tetrahedron simplex. Keeps all four vertices when the origin is inside.
+		 */
+		void
+		reduceTetrahedron (Simplex & simplex) noexcept
+		{
+			constexpr std::array< std::array< uint32_t, 4 >, 4 > Faces{{
+				{0, 1, 2, 3},
+				{0, 3, 1, 2},
+				{0, 2, 3, 1},
+				{1, 3, 2, 0}
+			}};
+
+			auto bestDistance = std::numeric_limits< float >::max();
+			Simplex best{};
+			bool outside = false;
+
+			for ( const auto & face : Faces )
+			{
+				if ( !isOriginOutsideOfPlane(simplex.w[face[0]], simplex.w[face[1]], simplex.w[face[2]], simplex.w[face[3]]) )
+				{
+					continue;
+				}
+
+				outside = true;
+
+				auto candidate = simplex;
+				reduceTriangle(candidate, face[0], face[1], face[2]);
+
+				const auto point = candidate.closestPoint();
+				const auto distance = Vector< 3, float >::dotProduct(point, point);
+
+				if ( distance < bestDistance )
+				{
+					bestDistance = distance;
+					best = candidate;
+				}
+			}
+
+			if ( outside )
+			{
+				simplex = best;
+
+				return;
+			}
+
+			/* NOTE: The origin is enclosed, the lambdas are irrelevant for EPA. */
+			simplex.lambda = {0.25F, 0.25F, 0.25F, 0.25F};
+		}
+
+		/**
+		 * @brief Updates the simplex to the smallest sub-simplex supporting the closest point to the origin.
+		 */
+		void
+		reduceSimplex (Simplex & simplex) noexcept
+		{
+			switch ( simplex.size )
+			{
+				case 1 :
+					simplex.lambda[0] = 1.0F;
+					break;
+
+				case 2 :
+					reduceSegment(simplex, 0, 1);
+					break;
+
+				case 3 :
+					reduceTriangle(simplex, 0, 1, 2);
+					break;
+
+				case 4 :
+					reduceTetrahedron(simplex);
+					break;
+
+				default:
+					break;
+			}
+		}
+
+		/**
+		 * @brief EPA polytope face.
+		 */
+		struct PolytopeFace
+		{
+			Vector< 3, float > normal;
+			float distance{0.0F};
+			std::array< uint32_t, 3 > indices{};
+		};
+
+		/**
+		 * @brief Builds an outward face from three polytope vertices.
+		 */
+		[[nodiscard]]
+		bool
+		makeFace (const std::vector< Vector< 3, float > > & vertices, uint32_t i0, uint32_t i1, uint32_t i2, PolytopeFace & face) noexcept
+		{
+			auto normal = Vector< 3, float >::crossProduct(vertices[i1] - vertices[i0], vertices[i2] - vertices[i0]);
+			const auto length = normal.length();
+
+			if ( length <= std::numeric_limits< float >::epsilon() )
+			{
+				return false;
+			}
+
+			normal /= length;
+
+			face.normal = normal;
+			face.distance = Vector< 3, float >::dotProduct(normal, vertices[i0]);
+			face.indices = {i0, i1, i2};
+
+			return true;
+		}
+
+		/**
+		 * @brief Grows a lower-dimension GJK simplex to a tetrahedron for EPA.
+		 * @return bool False if the Minkowski difference is flat in every probed direction.
+		 */
+		[[nodiscard]]
+		bool
+		completeTetrahedron (Simplex & simplex, const SupportMapping & shapeA, const SupportMapping & shapeB) noexcept
+		{
+			const std::array< Vector< 3, float >, 6 > Axes{
+				Vector< 3, float >{1.0F, 0.0F, 0.0F}, Vector< 3, float >{-1.0F, 0.0F, 0.0F},
+				Vector< 3, float >{0.0F, 1.0F, 0.0F}, Vector< 3, float >{0.0F, -1.0F, 0.0F},
+				Vector< 3, float >{0.0F, 0.0F, 1.0F}, Vector< 3, float >{0.0F, 0.0F, -1.0F}
+			};
+
+			const auto tryDirection = [&simplex, &shapeA, &shapeB] (const Vector< 3, float > & direction) {
+				const auto pointA = shapeA.coreSupport(direction);
+				const auto pointB = shapeB.coreSupport(-direction);
+				const auto pointW = pointA - pointB;
+
+				if ( simplex.contains(pointW) )
+				{
+					return false;
+				}
+
+				simplex.push(pointW, pointA, pointB);
+
+				return true;
+			};
+
+			if ( simplex.size == 1 )
+			{
+				for ( const auto & axis : Axes )
+				{
+					if ( tryDirection(axis) )
+					{
+						break;
+					}
+				}
+			}
+
+			if ( simplex.size == 2 )
+			{
+				const auto segment = simplex.w[1] - simplex.w[0];
+
+				for ( const auto & axis : Axes )
+				{
+					const auto direction = Vector< 3, float >::crossProduct(segment, axis);
+
+					if ( direction.length() > std::numeric_limits< float >::epsilon() && tryDirection(direction) )
+					{
+						const auto normal = Vector< 3, float >::crossProduct(simplex.w[1] - simplex.w[0], simplex.w[2] - simplex.w[0]);
+
+						if ( normal.length() > std::numeric_limits< float >::epsilon() )
+						{
+							break;
+						}
+
+						simplex.size = 2;
+					}
+				}
+			}
+
+			if ( simplex.size == 3 )
+			{
+				const auto normal = Vector< 3, float >::crossProduct(simplex.w[1] - simplex.w[0], simplex.w[2] - simplex.w[0]);
+
+				for ( const auto & direction : {normal, -normal} )
+				{
+					if ( tryDirection(direction) )
+					{
+						const auto volume = Vector< 3, float >::dotProduct(simplex.w[3] - simplex.w[0], normal);
+
+						if ( std::abs(volume) > std::numeric_limits< float >::epsilon() )
+						{
+							break;
+						}
+
+						simplex.size = 3;
+					}
+				}
+			}
+
+			return simplex.size == 4;
+		}
+
+		/**
+		 * @brief Runs EPA from a tetrahedron enclosing the origin.
+		 * @return bool False if the polytope degenerated.
+		 */
+		[[nodiscard]]
+		bool
+		computeEPA (const Simplex & simplex, const SupportMapping & shapeA, const SupportMapping & shapeB, Vector< 3, float > & normal, float & depth, Vector< 3, float > & contactOnA) noexcept
+		{
+			std::vector< Vector< 3, float > > vertices{simplex.w.begin(), simplex.w.end()};
+			std::vector< Vector< 3, float > > verticesA{simplex.a.begin(), simplex.a.end()};
+			std::vector< PolytopeFace > faces;
+			std::vector< std::array< uint32_t, 2 > > horizon;
+
+			vertices.reserve(4 + EPAMaxIterations);
+			verticesA.reserve(4 + EPAMaxIterations);
+			faces.reserve(4 + EPAMaxIterations * 2);
+
+			/* NOTE: Wind the initial tetrahedron so that every normal points away from the opposite vertex. */
+			constexpr std::array< std::array< uint32_t, 4 >, 4 > TetrahedronFaces{{
+				{0, 1, 2, 3},
+				{0, 3, 1, 2},
+				{0, 2, 3, 1},
+				{1, 3, 2, 0}
+			}};
+
+			for ( const auto & indices : TetrahedronFaces )
+			{
+				PolytopeFace face;
+
+				if ( !makeFace(vertices, indices[0], indices[1], indices[2], face) )
+				{
+					return false;
+				}
+
+				if ( Vector< 3, float >::dotProduct(face.normal, vertices[indices[3]] - vertices[indices[0]]) > 0.0F )
+				{
+					if ( !makeFace(vertices, indices[0], indices[2], indices[1], face) )
+					{
+						return false;
+					}
+				}
+
+				faces.push_back(face);
+			}
+
+			size_t closestFaceIndex = 0;
+
+			for ( uint32_t iteration = 0; iteration < EPAMaxIterations; ++iteration )
+			{
+				closestFaceIndex = 0;
+
+				for ( size_t faceIndex = 1; faceIndex < faces.size(); ++faceIndex )
+				{
+					if ( faces[faceIndex].distance < faces[closestFaceIndex].distance )
+					{
+						closestFaceIndex = faceIndex;
+					}
+				}
+
+				const auto closestFace = faces[closestFaceIndex];
+				const auto pointA = shapeA.coreSupport(closestFace.normal);
+				const auto pointB = shapeB.coreSupport(-closestFace.normal);
+				const auto pointW = pointA - pointB;
+
+				if ( Vector< 3, float >::dotProduct(pointW, closestFace.normal) - closestFace.distance < EPATolerance )
+				{
+					break;
+				}
+
+				/* Remove every face visible from the new point and collect the horizon. */
+				const auto newIndex = static_cast< uint32_t >(vertices.size());
+
+				vertices.push_back(pointW);
+				verticesA.push_back(pointA);
+				horizon.clear();
+
+				for ( size_t faceIndex = 0; faceIndex < faces.size(); )
+				{
+					const auto & face = faces[faceIndex];
+
+					if ( Vector< 3, float >::dotProduct(face.normal, pointW - vertices[face.indices[0]]) <= 0.0F )
+					{
+						++faceIndex;
+
+						continue;
+					}
+
+					for ( uint32_t edge = 0; edge < 3; ++edge )
+					{
+						const std::array< uint32_t, 2 > current{face.indices[edge], face.indices[(edge + 1) % 3]};
+						const auto reverse = std::find(horizon.begin(), horizon.end(), std::array< uint32_t, 2 >{current[1], current[0]});
+
+						if ( reverse != horizon.end() )
+						{
+							horizon.erase(reverse);
+						}
+						else
+						{
+							horizon.push_back(current);
+						}
+					}
+
+					faces[faceIndex] = faces.back();
+					faces.pop_back();
+				}
+
+				for ( const auto & edge : horizon )
+				{
+					PolytopeFace face;
+
+					if ( makeFace(vertices, edge[0], edge[1], newIndex, face) )
+					{
+						faces.push_back(face);
+					}
+				}
+
+				if ( faces.empty() )
+				{
+					return false;
+				}
+			}
+
+			closestFaceIndex = 0;
+
+			for ( size_t faceIndex = 1; faceIndex < faces.size(); ++faceIndex )
+			{
+				if ( faces[faceIndex].distance < faces[closestFaceIndex].distance )
+				{
+					closestFaceIndex = faceIndex;
+				}
+			}
+
+			const auto & face = faces[closestFaceIndex];
+
+			normal = face.normal;
+			depth = std::max(0.0F, face.distance);
+
+			/* NOTE: Project the origin on the closest face and use its barycentric coordinates to get the contact on A. */
+			const auto & p0 = vertices[face.indices[0]];
+			const auto v0 = vertices[face.indices[1]] - p0;
+			const auto v1 = vertices[face.indices[2]] - p0;
+			const auto v2 = (normal * face.distance) - p0;
+			const auto d00 = Vector< 3, float >::dotProduct(v0, v0);
+			const auto d01 = Vector< 3, float >::dotProduct(v0, v1);
+			const auto d11 = Vector< 3, float >::dotProduct(v1, v1);
+			const auto d20 = Vector< 3, float >::dotProduct(v2, v0);
+			const auto d21 = Vector< 3, float >::dotProduct(v2, v1);
+			const auto denominator = d00 * d11 - d01 * d01;
+
+			if ( std::abs(denominator) > std::numeric_limits< float >::epsilon() )
+			{
+				const auto v = (d11 * d20 - d01 * d21) / denominator;
+				const auto w = (d00 * d21 - d01 * d20) / denominator;
+
+				contactOnA = verticesA[face.indices[0]] * (1.0F - v - w) + verticesA[face.indices[1]] * v + verticesA[face.indices[2]] * w;
+			}
+			else
+			{
+				contactOnA = verticesA[face.indices[0]];
+			}
+
+			return true;
+		}
+	}
+
+	SupportMapping
+	SupportMapping::fromModel (const CollisionModelInterface & model, const CartesianFrame< float > & worldFrame) noexcept
+	{
+		SupportMapping mapping;
+
+		switch ( model.modelType() )
+		{
+			case CollisionModelType::Point :
+				mapping.m_points[0] = worldFrame.position();
+				mapping.m_pointCount = 1;
+				mapping.m_center = worldFrame.position();
+				break;
+
+			case CollisionModelType::Sphere :
+				mapping.m_points[0] = worldFrame.position();
+				mapping.m_pointCount = 1;
+				mapping.m_center = worldFrame.position();
+				mapping.m_margin = static_cast< const SphereCollisionModel & >(model).radius();
+				break;
+
+			case CollisionModelType::AABB :
+			{
+				/* NOTE: Same semantics as AABBCollisionModel, the box stays axis-aligned in world space. */
+				const auto worldAABB = model.getAABB(worldFrame);
+				const auto & minimum = worldAABB.minimum();
+				const auto & maximum = worldAABB.maximum();
+
+				for ( size_t corner = 0; corner < 8; ++corner )
+				{
+					mapping.m_points[corner] = {
+						(corner & 1U) != 0 ? maximum[X] : minimum[X],
+						(corner & 2U) != 0 ? maximum[Y] : minimum[Y],
+						(corner & 4U) != 0 ? maximum[Z] : minimum[Z]
+					};
+				}
+
+				mapping.m_pointCount = 8;
+				mapping.m_center = (minimum + maximum) * 0.5F;
+			}
+				break;
+
+			case CollisionModelType::Capsule :
+			{
+				const auto worldCapsule = static_cast< const CapsuleCollisionModel & >(model).toWorldCapsule(worldFrame);
+
+				mapping.m_points[0] = worldCapsule.startPoint();
+				mapping.m_points[1] = worldCapsule.endPoint();
+				mapping.m_pointCount = 2;
+				mapping.m_center = (mapping.m_points[0] + mapping.m_points[1]) * 0.5F;
+				mapping.m_margin = worldCapsule.radius();
+			}
+				break;
+
+			case CollisionModelType::ConvexHull :
+				mapping.m_hull = &static_cast< const ConvexHullCollisionModel & >(model);
+				mapping.m_rotation = worldFrame.getRotationMatrix3();
+				mapping.m_inverseRotation = mapping.m_rotation;
+				mapping.m_inverseRotation.transpose();
+				mapping.m_position = worldFrame.position();
+				mapping.m_scale = worldFrame.scalingFactor();
+				mapping.m_center = worldFrame.position();
+				break;
+		}
+
+		return mapping;
+	}
+
+	Vector< 3, float >
+	SupportMapping::coreSupport (const Vector< 3, float > & direction) const noexcept
+	{
+		if ( m_hull != nullptr )
+		{
+			/* NOTE: Maximize dot(d, R·(S⊙v)) = dot(S⊙(Rᵀ·d), v), so only the direction is transformed. */
+			const auto rotated = m_inverseRotation * direction;
+			const Vector< 3, float > localDirection{rotated[X] * m_scale[X], rotated[Y] * m_scale[Y], rotated[Z] * m_scale[Z]};
+			const auto & vertices = m_hull->localVertices();
+
+			if ( vertices.empty() )
+			{
+				return m_position;
+			}
+
+			const auto & local = vertices[m_hull->localSupportIndex(localDirection)];
+
+			return m_position + m_rotation * Vector< 3, float >{local[X] * m_scale[X], local[Y] * m_scale[Y], local[Z] * m_scale[Z]};
+		}
+
+		size_t bestIndex = 0;
+		auto bestDot = Vector< 3, float >::dotProduct(m_points[0], direction);
+
+		for ( size_t index = 1; index < m_pointCount; ++index )
+		{
+			const auto dot = Vector< 3, float >::dotProduct(m_points[index], direction);
+
+			if ( dot > bestDot )
+			{
+				bestDot = dot;
+				bestIndex = index;
+			}
+		}
+
+		return m_points[bestIndex];
+	}
+
+	Vector< 3, float >
+	SupportMapping::support (const Vector< 3, float > & direction) const noexcept
+	{
+		const auto core = this->coreSupport(direction);
+
+		if ( m_margin <= 0.0F )
+		{
+			return core;
+		}
+
+		const auto length = direction.length();
+
+		if ( length <= std::numeric_limits< float >::epsilon() )
+		{
+			return core;
+		}
+
+		return core + direction * (m_margin / length);
+	}
+
+	GJKResults
+	computeGJK (const SupportMapping & shapeA, const SupportMapping & shapeB, const Vector< 3, float > & initialAxis) noexcept
+	{
+		GJKResults results;
+
+		const auto marginSum = shapeA.margin() + shapeB.margin();
+
+		auto axis = initialAxis;
+
+		if ( Vector< 3, float >::dotProduct(axis, axis) <= GJKOverlapTolerance )
+		{
+			axis = shapeA.center() - shapeB.center();
+
+			if ( Vector< 3, float >::dotProduct(axis, axis) <= GJKOverlapTolerance )
+			{
+				axis = {1.0F, 0.0F, 0.0F};
+			}
+		}
+
+		Simplex simplex;
+
+		for ( ; results.m_iterations < GJKMaxIterations; ++results.m_iterations )
+		{
+			/* NOTE: The support of A - B in direction -axis. */
+			const auto pointA = shapeA.coreSupport(-axis);
+			const auto pointB = shapeB.coreSupport(axis);
+			const auto pointW = pointA - pointB;
+
+			const auto axisDotW = Vector< 3, float >::dotProduct(axis, pointW);
+			const auto axisLengthSquared = Vector< 3, float >::dotProduct(axis, axis);
+
+			/* Early-out: the axis already separates the cores by more than the margins. */
+			if ( axisDotW > 0.0F && axisDotW * axisDotW > axisLengthSquared * marginSum * marginSum )
+			{
+				results.m_overlap = false;
+				results.m_distance = axisDotW / std::sqrt(axisLengthSquared);
+				results.m_separatingAxis = axis;
+				results.m_simplexSize = 0;
+
+				return results;
+			}
+
+			/* Convergence: the new support point does not bring the estimate closer. */
+			if ( simplex.size > 0 && (axisLengthSquared - axisDotW <= GJKRelativeTolerance * axisLengthSquared || simplex.contains(pointW)) )
+			{
+				break;
+			}
+
+			simplex.push(pointW, pointA, pointB);
+			reduceSimplex(simplex);
+
+			axis = simplex.closestPoint();
+
+			if ( simplex.size == 4 || Vector< 3, float >::dotProduct(axis, axis) <= GJKOverlapTolerance )
+			{
+				results.m_overlap = true;
+
+				break;
+			}
+		}
+
+		results.m_simplexSize = simplex.size;
+
+		for ( uint32_t index = 0; index < simplex.size; ++index )
+		{
+			results.m_simplexA[index] = simplex.a[index];
+			results.m_simplexB[index] = simplex.b[index];
+			results.m_closestOnA += simplex.a[index] * simplex.lambda[index];
+			results.m_closestOnB += simplex.b[index] * simplex.lambda[index];
+		}
+
+		results.m_separatingAxis = axis;
+		results.m_distance = results.m_overlap ? 0.0F : axis.length();
+
+		return results;
+	}
+
+	CollisionDetectionResults
+	collideConvexShapes (const SupportMapping & shapeA, const SupportMapping & shapeB, Vector< 3, float > & separatingAxis) noexcept
+	{
+		CollisionDetectionResults results;
+
+		const auto gjk = computeGJK(shapeA, shapeB, separatingAxis);
+
+		separatingAxis = gjk.m_separatingAxis;
+
+		const auto marginSum = shapeA.margin() + shapeB.margin();
+
+		if ( !gjk.m_overlap )
+		{
+			if ( gjk.m_simplexSize == 0 || gjk.m_distance >= marginSum )
+			{
+				return results;
+			}
+
+			/* Shallow contact: the cores are apart, only the margins (sphere/capsule radii) overlap. */
+			const auto towardB = (gjk.m_closestOnB - gjk.m_closestOnA) / gjk.m_distance;
+
+			results.m_collisionDetected = true;
+			results.m_depth = marginSum - gjk.m_distance;
+			results.m_impactNormal = -towardB;
+			results.m_MTV = results.m_impactNormal * results.m_depth;
+			results.m_contact = gjk.m_closestOnA + towardB * shapeA.margin();
+
+			return results;
+		}
+
+		/* Deep contact: the cores overlap, EPA gives the penetration of the cores. */
+		Simplex simplex;
+
+		for ( uint32_t index = 0; index < gjk.m_simplexSize; ++index )
+		{
+			simplex.push(gjk.m_simplexA[index] - gjk.m_simplexB[index], gjk.m_simplexA[index], gjk.m_simplexB[index]);
+		}
+
+		Vector< 3, float > normal;
+		Vector< 3, float > contactOnA;
+		float depth = 0.0F;
+
+		if ( !completeTetrahedron(simplex, shapeA, shapeB) || !computeEPA(simplex, shapeA, shapeB, normal, depth, contactOnA) )
+		{
+			/* NOTE: Touching or flat configuration, separate along the centers with the margins only. */
+			normal = shapeB.center() - shapeA.center();
+
+			const auto length = normal.length();
+
+			normal = length > std::numeric_limits< float >::epsilon() ? normal / length : Vector< 3, float >::negativeY();
+			depth = 0.0F;
+			contactOnA = gjk.m_closestOnA;
+		}
+
+		/* NOTE: The EPA normal points from A toward B in the Minkowski sense, translating A by -normal·depth separates the shapes. */
+		results.m_collisionDetected = true;
+		results.m_depth = depth + marginSum;
+		results.m_impactNormal = -normal;
+		results.m_MTV = results.m_impactNormal * results.m_depth;
+		results.m_contact = contactOnA + normal * shapeA.margin();
+
+		return results;
+	}
+}
@@ -0,0 +1,168 @@
+/*
+ * src/Physics/ConvexCollision.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "CollisionModelInterface.hpp"
+#include "Math/Matrix.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Physics
+{
+	class ConvexHullCollisionModel;
+}
+
+namespace EmEn::Physics
+{
+	/**
+	 * @brief World-space support mapping of a convex shape, as consumed by GJK/EPA.
+	 *
+	 * A shape is described by its "core" (a point, a segment, a box or a convex point cloud)
+	 * and a margin (radius) inflating that core. Spheres and capsules are therefore exact:
+	 * a sphere is a point with a margin, a capsule a segment with a margin.
+	 *
+	 * Small cores (up to 8 points) are stored inline in world space. Convex hulls keep a
+	 * pointer to the hull model and transform the search direction into local space
+	 * instead of transforming every vertex, so building a mapping never allocates.
+	 *
+	 * @since 0.9.53
+	 */
+	class EMEN_API SupportMapping final
+	{
+		public:
+
+			/** @brief Maximum number of inline world-space core points (AABB corners). */
+			static constexpr size_t MaxInlinePoints{8};
+
+			/**
+			 * @brief Creates the support mapping of any collision model in world space.
+			 * @param model A reference to the collision model.
+			 * @param worldFrame A reference to the model world frame.
+			 * @return SupportMapping
+			 */
+			[[nodiscard]]
+			static SupportMapping fromModel (const CollisionModelInterface & model, const Base::Math::CartesianFrame< float > & worldFrame) noexcept;
+
+			/**
+			 * @brief Returns the farthest core point in a world direction (margin excluded).
+			 * @param direction The search direction in world space. Does not need to be normalized.
+			 * @return Base::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			Base::Math::Vector< 3, float > coreSupport (const Base::Math::Vector< 3, float > & direction) const noexcept;
+
+			/**
+			 * @brief Returns the farthest point of the inflated shape in a world direction.
+			 * @param direction The search direction in world space. Does not need to be normalized.
+			 * @return Base::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			Base::Math::Vector< 3, float > support (const Base::Math::Vector< 3, float > & direction) const noexcept;
+
+			/**
+			 * @brief Returns the margin (radius) inflating the core.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			margin () const noexcept
+			{
+				return m_margin;
+			}
+
+			/**
+			 * @brief Returns the world-space center of the shape, used to seed the search direction.
+			 * @return const Base::Math::Vector< 3, float > &
+			 */
+			[[nodiscard]]
+			const Base::Math::Vector< 3, float > &
+			center () const noexcept
+			{
+				return m_center;
+			}
+
+		private:
+
+			/**
+			 * @brief Constructs an empty support mapping.
+			 */
+			SupportMapping () noexcept = default;
+
+			std::array< Base::Math::Vector< 3, float >, MaxInlinePoints > m_points{};
+			Base::Math::Matrix< 3, float > m_rotation;
+			Base::Math::Matrix< 3, float > m_inverseRotation;
+			Base::Math::Vector< 3, float > m_position;
+			Base::Math::Vector< 3, float > m_scale{1.0F, 1.0F, 1.0F};
+			Base::Math::Vector< 3, float > m_center;
+			const ConvexHullCollisionModel * m_hull{nullptr};
+			size_t m_pointCount{0};
+			float m_margin{0.0F};
+	};
+
+	/**
+	 * @brief Results of a GJK distance query between two convex cores.
+	 */
+	struct EMEN_API GJKResults
+	{
+		std::array< Base::Math::Vector< 3, float >, 4 > m_simplexA{}; /**< Simplex support points on A (valid up to m_simplexSize). */
+		std::array< Base::Math::Vector< 3, float >, 4 > m_simplexB{}; /**< Simplex support points on B (valid up to m_simplexSize). */
+		Base::Math::Vector< 3, float > m_closestOnA;	/**< Closest point on the core of A. */
+		Base::Math::Vector< 3, float > m_closestOnB;	/**< Closest point on the core of B. */
+		Base::Math::Vector< 3, float > m_separatingAxis; /**< Last search direction, reusable to warm-start the next query. */
+		float m_distance{0.0F};							/**< Distance between the cores (0 when overlapping). */
+		uint32_t m_iterations{0};						/**< Number of GJK iterations performed. */
+		uint32_t m_simplexSize{0};						/**< Number of valid simplex vertices. */
+		bool m_overlap{false};							/**< Whether the cores intersect. */
+	};
+
+	/**
+	 * @brief Runs GJK on the cores of two convex shapes.
+	 * @param shapeA A reference to the first shape.
+	 * @param shapeB A reference to the second shape.
+	 * @param initialAxis The initial search direction (a cached separating axis from the previous tick, or zero).
+	 * @return GJKResults
+	 */
+	[[nodiscard]]
+	EMEN_API GJKResults computeGJK (const SupportMapping & shapeA, const SupportMapping & shapeB, const Base::Math::Vector< 3, float > & initialAxis) noexcept;
+
+	/**
+	 * @brief Collides two convex shapes through GJK, then EPA when their cores overlap.
+	 * @note Results follow the CollisionModelInterface convention: m_MTV pushes A out of B,
+	 * m_impactNormal points from B toward A.
+	 * @param shapeA A reference to the first shape.
+	 * @param shapeB A reference to the second shape.
+	 * @param separatingAxis A reference to the warm-start axis. Read as the initial direction and updated with the final one.
+	 * @return CollisionDetectionResults
+	 */
+	[[nodiscard]]
+	EMEN_API CollisionDetectionResults collideConvexShapes (const SupportMapping & shapeA, const SupportMapping & shapeB, Base::Math::Vector< 3, float > & separatingAxis) noexcept;
+}
@@ -0,0 +1,407 @@
+/*
+ * src/Physics/ConvexHullCollisionModel.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "ConvexHullCollisionModel.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+/* Local inclusions. */
+#include "ConvexCollision.hpp"
+#include "ThreadPool.hpp"
+
+namespace EmEn::Physics
+{
+	using namespace Base::Math;
+	using namespace Base::Math::Space3D;
+
+	ConvexHullCollisionModel::ConvexHullCollisionModel (std::vector< Vector< 3, float > > localVertices) noexcept
+		: m_localVertices{std::move(localVertices)}
+	{
+		this->updateBounds();
+	}
+
+	std::unique_ptr< ConvexHullCollisionModel >
+	ConvexHullCollisionModel::generate (const std::vector< Vector< 3, float > > & points, uint32_t maxVertices) noexcept
+	{
+		if ( points.empty() || maxVertices < 4 )
+		{
+			return nullptr;
+		}
+
+		/* 1. Keep only the points that are extreme in at least one sampled direction.
+		 * NOTE: Directions follow a Fibonacci sphere, every selected point is a hull vertex. */
+		const auto directionCount = std::max< uint32_t >(64, maxVertices * 4);
+		const auto goldenAngle = std::numbers::pi_v< float > * (3.0F - std::sqrt(5.0F));
+
+		std::vector< bool > isExtreme(points.size(), false);
+		std::vector< size_t > candidates;
+
+		for ( uint32_t directionIndex = 0; directionIndex < directionCount; ++directionIndex )
+		{
+			const auto y = 1.0F - (2.0F * (static_cast< float >(directionIndex) + 0.5F) / static_cast< float >(directionCount));
+			const auto ringRadius = std::sqrt(std::max(0.0F, 1.0F - y * y));
+			const auto theta = goldenAngle * static_cast< float >(directionIndex);
+			const Vector< 3, float > direction{std::cos(theta) * ringRadius, y, std::sin(theta) * ringRadius};
+
+			size_t bestIndex = 0;
+			auto bestDot = std::numeric_limits< float >::lowest();
+
+			for ( size_t pointIndex = 0; pointIndex < points.size(); ++pointIndex )
+			{
+				const auto dot = Vector< 3, float >::dotProduct(points[pointIndex], direction);
+
+				if ( dot > bestDot )
+				{
+					bestDot = dot;
+					bestIndex = pointIndex;
+				}
+			}
+
+			if ( !isExtreme[bestIndex] )
+			{
+				isExtreme[bestIndex] = true;
+				candidates.push_back(bestIndex);
+			}
+		}
+
+		/* 2. Reduce the vertex count by farthest point sampling over the extreme points.
+		 * NOTE: This keeps the silhouette spread out instead of clustering vertices on dense mesh areas. */
+		std::vector< Vector< 3, float > > hullVertices;
+
+		if ( candidates.size() <= maxVertices )
+		{
+			hullVertices.reserve(candidates.size());
+
+			for ( const auto index : candidates )
+			{
+				hullVertices.push_back(points[index]);
+			}
+		}
+		else
+		{
+			std::vector< float > distanceToSelection(candidates.size(), std::numeric_limits< float >::max());
+			size_t nextCandidate = 0;
+
+			hullVertices.reserve(maxVertices);
+
+			while ( hullVertices.size() < maxVertices )
+			{
+				const auto & selected = points[candidates[nextCandidate]];
+
+				hullVertices.push_back(selected);
+
+				auto farthestDistance = -1.0F;
+
+				for ( size_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex )
+				{
+					const auto delta = points[candidates[candidateIndex]] - selected;
+
+					distanceToSelection[candidateIndex] = std::min(distanceToSelection[candidateIndex], Vector< 3, float >::dotProduct(delta, delta));
+
+					if ( distanceToSelection[candidateIndex] > farthestDistance )
+					{
+						farthestDistance = distanceToSelection[candidateIndex];
+						nextCandidate = candidateIndex;
+					}
+				}
+
+				if ( farthestDistance <= 0.0F )
+				{
+					break;
+				}
+			}
+		}
+
+		/* NOTE: GJK and EPA need a tetrahedron inside the hull, a flat polygon would make EPA degenerate. */
+		if ( !spansVolume(hullVertices) )
+		{
+			return nullptr;
+		}
+
+		return std::make_unique< ConvexHullCollisionModel >(std::move(hullVertices));
+	}
+
+	std::unique_ptr< ConvexHullCollisionModel >
+	ConvexHullCollisionModel::generate (const VertexFactory::Shape< float > & shape, uint32_t maxVertices) noexcept
+	{
+		std::vector< Vector< 3, float > > points;
+		points.reserve(shape.vertices().size());
+
+		for ( const auto & vertex : shape.vertices() )
+		{
+			points.emplace_back(vertex.position());
+		}
+
+		return generate(points, maxVertices);
+	}
+
+	std::future< std::unique_ptr< ConvexHullCollisionModel > >
+	ConvexHullCollisionModel::generateAsync (Base::ThreadPool & threadPool, std::vector< Vector< 3, float > > points, uint32_t maxVertices) noexcept
+	{
+		/* NOTE: The promise is shared because the thread pool task must stay copyable. */
+		auto promise = std::make_shared< std::promise< std::unique_ptr< ConvexHullCollisionModel > > >();
+		auto future = promise->get_future();
+
+		threadPool.enqueue([promise, points = std::move(points), maxVertices] {
+			promise->set_value(generate(points, maxVertices));
+		});
+
+		return future;
+	}
+
+	CollisionDetectionResults
+	ConvexHullCollisionModel::isCollidingWith (const CartesianFrame< float > & thisWorldFrame, const CollisionModelInterface & other, const CartesianFrame< float > & otherWorldFrame) const noexcept
+	{
+		const auto shapeA = SupportMapping::fromModel(*this, thisWorldFrame);
+		const auto shapeB = SupportMapping::fromModel(other, otherWorldFrame);
+		const auto otherInstanceId = other.instanceId();
+		const auto slot = cacheSlot(otherInstanceId);
+
+		/* Warm-start GJK with the axis found against the same model on the previous tick. */
+		Vector< 3, float > separatingAxis;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_supportCacheAccess};
+
+			if ( m_supportCache[slot].otherInstanceId == otherInstanceId )
+			{
+				separatingAxis = m_supportCache[slot].axis;
+			}
+		}
+
+		const auto results = collideConvexShapes(shapeA, shapeB, separatingAxis);
+
+		{
+			const std::lock_guard< std::mutex > lock{m_supportCacheAccess};
+
+			m_supportCache[slot].otherInstanceId = otherInstanceId;
+			m_supportCache[slot].axis = separatingAxis;
+		}
+
+		return results;
+	}
+
+	CollisionDetectionResults
+	ConvexHullCollisionModel::collideFromOtherSide (const CartesianFrame< float > & thisWorldFrame, const CollisionModelInterface & other, const CartesianFrame< float > & otherWorldFrame) const noexcept
+	{
+		auto results = this->isCollidingWith(thisWorldFrame, other, otherWorldFrame);
+
+		if ( results.m_collisionDetected )
+		{
+			results.m_MTV = -results.m_MTV;
+			results.m_impactNormal = -results.m_impactNormal;
+		}
+
+		return results;
+	}
+
+	AACuboid< float >
+	ConvexHullCollisionModel::getAABB (const CartesianFrame< float > & worldFrame) const noexcept
+	{
+		if ( m_localVertices.empty() )
+		{
+			return {};
+		}
+
+		const auto rotation = worldFrame.getRotationMatrix3();
+		const auto & position = worldFrame.position();
+		const auto & scale = worldFrame.scalingFactor();
+
+		Vector< 3, float > minimum{std::numeric_limits< float >::max(), std::numeric_limits< float >::max(), std::numeric_limits< float >::max()};
+		Vector< 3, float > maximum{std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest()};
+
+		for ( const auto & vertex : m_localVertices )
+		{
+			const auto worldVertex = position + rotation * Vector< 3, float >{vertex[X] * scale[X], vertex[Y] * scale[Y], vertex[Z] * scale[Z]};
+
+			for ( size_t axis = 0; axis < 3; ++axis )
+			{
+				minimum[axis] = std::min(minimum[axis], worldVertex[axis]);
+				maximum[axis] = std::max(maximum[axis], worldVertex[axis]);
+			}
+		}
+
+		return AACuboid< float >{maximum, minimum};
+	}
+
+	size_t
+	ConvexHullCollisionModel::localSupportIndex (const Vector< 3, float > & localDirection) const noexcept
+	{
+		size_t bestIndex = 0;
+		auto bestDot = std::numeric_limits< float >::lowest();
+
+		for ( size_t index = 0; index < m_localVertices.size(); ++index )
+		{
+			const auto dot = Vector< 3, float >::dotProduct(m_localVertices[index], localDirection);
+
+			if ( dot > bestDot )
+			{
+				bestDot = dot;
+				bestIndex = index;
+			}
+		}
+
+		return bestIndex;
+	}
+
+	void
+	ConvexHullCollisionModel::clearSupportCache () const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_supportCacheAccess};
+
+		m_supportCache.fill({});
+	}
+
+	void
+	ConvexHullCollisionModel::overrideShapeParameters (const Vector< 3, float > & dimensions, const Vector< 3, float > & centerOffset) noexcept
+	{
+		if ( !m_localAABB.isValid() )
+		{
+			return;
+		}
+
+		const auto center = m_localAABB.centroid();
+		const std::array< float, 3 > extents{m_localAABB.width(), m_localAABB.height(), m_localAABB.depth()};
+
+		for ( auto & vertex : m_localVertices )
+		{
+			for ( size_t axis = 0; axis < 3; ++axis )
+			{
+				const auto factor = extents[axis] > std::numeric_limits< float >::epsilon() ? dimensions[axis] / extents[axis] : 1.0F;
+
+				vertex[axis] = (vertex[axis] - center[axis]) * factor + centerOffset[axis];
+			}
+		}
+
+		this->updateBounds();
+		this->clearSupportCache();
+	}
+
+	void
+	ConvexHullCollisionModel::updateBounds () noexcept
+	{
+		if ( m_localVertices.empty() )
+		{
+			m_localAABB = {};
+			m_radius = 0.0F;
+
+			return;
+		}
+
+		Vector< 3, float > minimum{std::numeric_limits< float >::max(), std::numeric_limits< float >::max(), std::numeric_limits< float >::max()};
+		Vector< 3, float > maximum{std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest(), std::numeric_limits< float >::lowest()};
+
+		m_radius = 0.0F;
+
+		for ( const auto & vertex : m_localVertices )
+		{
+			for ( size_t axis = 0; axis < 3; ++axis )
+			{
+				minimum[axis] = std::min(minimum[axis], vertex[axis]);
+				maximum[axis] = std::max(maximum[axis], vertex[axis]);
+			}
+
+			m_radius = std::max(m_radius, vertex.length());
+		}
+
+		m_localAABB = AACuboid< float >{maximum, minimum};
+	}
+
+	bool
+	ConvexHullCollisionModel::spansVolume (const std::vector< Vector< 3, float > > & vertices) noexcept
+	{
+		if ( vertices.size() < 4 )
+		{
+			return false;
+		}
+
+		/* NOTE: Greedy widest tetrahedron: the farthest vertex from the first one,
+		 * then the farthest from that line, then the farthest from that plane. */
+		const auto & origin = vertices[0];
+
+		auto farthestVertex = [&vertices] (const auto & distance) {
+			size_t bestIndex = 0;
+			auto bestDistance = -1.0F;
+
+			for ( size_t index = 0; index < vertices.size(); ++index )
+			{
+				if ( const auto value = distance(vertices[index]); value > bestDistance )
+				{
+					bestDistance = value;
+					bestIndex = index;
+				}
+			}
+
+			return bestIndex;
+		};
+
+		const auto edge = vertices[farthestVertex([&origin] (const auto & vertex) {
+			const auto delta = vertex - origin;
+
+			return Vector< 3, float >::dotProduct(delta, delta);
+		})] - origin;
+
+		const auto edgeLengthSquared = Vector< 3, float >::dotProduct(edge, edge);
+
+		if ( edgeLengthSquared <= std::numeric_limits< float >::epsilon() )
+		{
+			return false;
+		}
+
+		const auto normal = Vector< 3, float >::crossProduct(edge, vertices[farthestVertex([&origin, &edge] (const auto & vertex) {
+			const auto cross = Vector< 3, float >::crossProduct(edge, vertex - origin);
+
+			return Vector< 3, float >::dotProduct(cross, cross);
+		})] - origin);
+
+		/* NOTE: |edge × side| is the edge length times the width, the triple product adds the thickness.
+		 * Both are compared to the edge length, so long thin props are kept and only flat ones rejected. */
+		const auto edgeLength = std::sqrt(edgeLengthSquared);
+		const auto normalLength = normal.length();
+		const auto minimumSize = MinimumThicknessRatio * edgeLength;
+
+		if ( normalLength <= minimumSize * edgeLength )
+		{
+			return false;
+		}
+
+		const auto tripleProduct = std::abs(Vector< 3, float >::dotProduct(normal, vertices[farthestVertex([&origin, &normal] (const auto & vertex) {
+			return std::abs(Vector< 3, float >::dotProduct(normal, vertex - origin));
+		})] - origin));
+
+		return tripleProduct / normalLength > minimumSize;
+	}
+
+	size_t
+	ConvexHullCollisionModel::cacheSlot (uint64_t otherInstanceId) noexcept
+	{
+		return static_cast< size_t >(otherInstanceId % SupportCacheSize);
+	}
+}
@@ -0,0 +1,273 @@
+/*
+ * src/Physics/ConvexHullCollisionModel.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <array>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "CollisionModelInterface.hpp"
+
+/* Local inclusions for usages. */
+#include "VertexFactory/Shape.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Base
+{
+	class ThreadPool;
+}
+
+namespace EmEn::Physics
+{
+	/**
+	 * @brief Collision model using a convex hull built from a mesh.
+	 *
+	 * The hull is a reduced set of local-space vertices. Collision against every other
+	 * model type goes through GJK (separated or shallow contacts) and EPA (penetration),
+	 * see ConvexCollision.hpp. One hull per prop replaces the bundle of spheres, boxes and
+	 * capsules otherwise needed to approximate its silhouette.
+	 *
+	 * The last GJK separating axis is cached per opposing collision model and reused on the
+	 * next tick as the initial search direction. Resting and slowly moving pairs usually
+	 * converge in one or two iterations instead of re-discovering the axis from scratch.
+	 *
+	 * @note The hull is generated from geometry, so the automatic shape merging done by
+	 *	   AbstractEntity from component bounding volumes does not apply to it.
+	 * @since 0.9.53
+	 */
+	class EMEN_API ConvexHullCollisionModel final : public CollisionModelInterface
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ConvexHullCollisionModel"};
+
+			/** @brief Default maximum number of hull vertices kept by the generator. */
+			static constexpr uint32_t DefaultMaxVertices{32};
+
+			/** @brief The thickness, relative to the hull size, under which a hull is flat and rejected. */
+			static constexpr float MinimumThicknessRatio{1.0e-4F};
+
+			/** @brief Number of cached separating axes (direct-mapped on the opposing model instance identifier). */
+			static constexpr size_t SupportCacheSize{16};
+
+			/**
+			 * @brief Constructs a convex hull collision model from already reduced local vertices.
+			 * @note Use generate() to build a hull from raw mesh positions.
+			 * @param localVertices The hull vertices in local space.
+			 */
+			explicit ConvexHullCollisionModel (std::vector< Base::Math::Vector< 3, float > > localVertices) noexcept;
+
+			/**
+			 * @brief Generates a convex hull from a point cloud, with vertex count reduction.
+			 * @note This is O(points × sampling directions) and meant to run offline or on a worker thread.
+			 * @param points A reference to the source positions in local space.
+			 * @param maxVertices The maximum number of vertices kept in the hull. Default DefaultMaxVertices.
+			 * @return std::unique_ptr< ConvexHullCollisionModel > A null pointer if the hull has no volume (points, segments or flat polygons).
+			 */
+			[[nodiscard]]
+			static std::unique_ptr< ConvexHullCollisionModel > generate (const std::vector< Base::Math::Vector< 3, float > > & points, uint32_t maxVertices = DefaultMaxVertices) noexcept;
+
+			/**
+			 * @brief Generates a convex hull from the vertices of a shape.
+			 * @param shape A reference to a shape.
+			 * @param maxVertices The maximum number of vertices kept in the hull. Default DefaultMaxVertices.
+			 * @return std::unique_ptr< ConvexHullCollisionModel > A null pointer if the hull of the shape has no volume.
+			 */
+			[[nodiscard]]
+			static std::unique_ptr< ConvexHullCollisionModel > generate (const Base::VertexFactory::Shape< float > & shape, uint32_t maxVertices = DefaultMaxVertices) noexcept;
+
+			/**
+			 * @brief Generates a convex hull on the thread pool, typically at load time.
+			 * @param threadPool A reference to the thread pool.
+			 * @param points The source positions in local space (moved into the task).
+			 * @param maxVertices The maximum number of vertices kept in the hull. Default DefaultMaxVertices.
+			 * @return std::future< std::unique_ptr< ConvexHullCollisionModel > >
+			 */
+			[[nodiscard]]
+			static std::future< std::unique_ptr< ConvexHullCollisionModel > > generateAsync (Base::ThreadPool & threadPool, std::vector< Base::Math::Vector< 3, float > > points, uint32_t maxVertices = DefaultMaxVertices) noexcept;
+
+			/** @copydoc CollisionModelInterface::modelType() */
+			[[nodiscard]]
+			CollisionModelType
+			modelType () const noexcept override
+			{
+				return CollisionModelType::ConvexHull;
+			}
+
+			/** @copydoc CollisionModelInterface::isCollidingWith() */
+			[[nodiscard]]
+			CollisionDetectionResults isCollidingWith (const Base::Math::CartesianFrame< float > & thisWorldFrame, const CollisionModelInterface & other, const Base::Math::CartesianFrame< float > & otherWorldFrame) const noexcept override;
+
+			/**
+			 * @brief Runs the hull narrowphase from the point of view of the other model.
+			 * @note Used by the primitive models to dispatch against a hull. The hull owns the
+			 * GJK/EPA path and its warm-start cache, the results are flipped so that m_MTV
+			 * pushes the other model out of this hull.
+			 * @param thisWorldFrame World frame of this hull.
+			 * @param other The other collision model.
+			 * @param otherWorldFrame World frame of the other model.
+			 * @return CollisionDetectionResults
+			 */
+			[[nodiscard]]
+			CollisionDetectionResults collideFromOtherSide (const Base::Math::CartesianFrame< float > & thisWorldFrame, const CollisionModelInterface & other, const Base::Math::CartesianFrame< float > & otherWorldFrame) const noexcept;
+
+			/** @copydoc CollisionModelInterface::getAABB() */
+			[[nodiscard]]
+			Base::Math::Space3D::AACuboid< float >
+			getAABB () const noexcept override
+			{
+				return m_localAABB;
+			}
+
+			/** @copydoc CollisionModelInterface::getAABB(const Base::Math::CartesianFrame< float > &) */
+			[[nodiscard]]
+			Base::Math::Space3D::AACuboid< float > getAABB (const Base::Math::CartesianFrame< float > & worldFrame) const noexcept override;
+
+			/** @copydoc CollisionModelInterface::getRadius() */
+			[[nodiscard]]
+			float
+			getRadius () const noexcept override
+			{
+				return m_radius;
+			}
+
+			/**
+			 * @brief Returns the hull vertices in local space.
+			 * @return const std::vector< Base::Math::Vector< 3, float > > &
+			 */
+			[[nodiscard]]
+			const std::vector< Base::Math::Vector< 3, float > > &
+			localVertices () const noexcept
+			{
+				return m_localVertices;
+			}
+
+			/**
+			 * @brief Returns the index of the farthest local vertex in a local direction.
+			 * @param localDirection The search direction in local space.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t localSupportIndex (const Base::Math::Vector< 3, float > & localDirection) const noexcept;
+
+			/**
+			 * @brief Clears the cached separating axes.
+			 * @note Only useful when the hull is reused in a completely different context (e.g. after a teleport).
+			 * @return void
+			 */
+			void clearSupportCache () const noexcept;
+
+			/**
+			 * @brief Rescales and recenters the hull to fit the given dimensions.
+			 * @param dimensions The dimensions (width, height, depth) of the bounding shape.
+			 * @param centerOffset The offset of the shape center from the entity's origin.
+			 */
+			void overrideShapeParameters (const Base::Math::Vector< 3, float > & dimensions, const Base::Math::Vector< 3, float > & centerOffset) noexcept override;
+
+			/** @copydoc CollisionModelInterface::areShapeParametersOverridden() */
+			[[nodiscard]]
+			bool
+			areShapeParametersOverridden () const noexcept override
+			{
+				/* NOTE: A hull always comes from explicit geometry, it must never be merged with component bounding volumes. */
+				return true;
+			}
+
+			/** @copydoc CollisionModelInterface::mergeShapeParameters() */
+			void
+			mergeShapeParameters (const Base::Math::Vector< 3, float > & /*dimensions*/, const Base::Math::Vector< 3, float > & /*centerOffset*/) noexcept override
+			{
+				/* The hull shape comes from geometry, nothing to merge. */
+			}
+
+			/** @copydoc CollisionModelInterface::mergeShapeParameters(const Base::Math::Space3D::AACuboid< float > &) */
+			void
+			mergeShapeParameters (const Base::Math::Space3D::AACuboid< float > & /*aabb*/) noexcept override
+			{
+				/* The hull shape comes from geometry, nothing to merge. */
+			}
+
+			/** @copydoc CollisionModelInterface::mergeShapeParameters(const Base::Math::Space3D::Sphere< float > &) */
+			void
+			mergeShapeParameters (const Base::Math::Space3D::Sphere< float > & /*sphere*/) noexcept override
+			{
+				/* The hull shape comes from geometry, nothing to merge. */
+			}
+
+			/** @copydoc CollisionModelInterface::resetShapeParameters() */
+			void
+			resetShapeParameters () noexcept override
+			{
+				/* The hull shape comes from geometry, nothing to reset. */
+			}
+
+		private:
+
+			/**
+			 * @brief A cached separating axis against one opposing model.
+			 */
+			struct SupportCacheEntry
+			{
+				uint64_t otherInstanceId{0};
+				Base::Math::Vector< 3, float > axis;
+			};
+
+			/**
+			 * @brief Updates the local AABB and bounding radius from the vertices.
+			 * @return void
+			 */
+			void updateBounds () noexcept;
+
+			/**
+			 * @brief Returns whether vertices span a volume, by the thickness of their widest tetrahedron.
+			 * @param vertices A reference to the vertices.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool spansVolume (const std::vector< Base::Math::Vector< 3, float > > & vertices) noexcept;
+
+			/**
+			 * @brief Returns the cache slot for an opposing model.
+			 * @param otherInstanceId The instance identifier of the opposing model.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			static size_t cacheSlot (uint64_t otherInstanceId) noexcept;
+
+			std::vector< Base::Math::Vector< 3, float > > m_localVertices;
+			Base::Math::Space3D::AACuboid< float > m_localAABB;
+			mutable std::array< SupportCacheEntry, SupportCacheSize > m_supportCache{};
+			mutable std::mutex m_supportCacheAccess;
+			float m_radius{0.0F};
+	};
+}
@@ -27,6 +27,7 @@
 #include "MovableTrait.hpp"
 
 /* Local inclusions. */
+#include "BodyIntegrator.hpp"
 
 namespace EmEn::Physics
 {
@@ -76,6 +77,7 @@ namespace EmEn::Physics
 	MovableTrait::stopMovement () noexcept
 	{
 		m_linearVelocity.reset();
+		m_lastPhysicsDisplacement.reset();
 		m_angularVelocity.reset();
 
 		m_linearSpeed = 0.0F;
@@ -144,49 +146,121 @@ namespace EmEn::Physics
 		/* Apply the movement */
 		if ( m_linearSpeed > 0.0F )
 		{
+			m_lastPhysicsDisplacement = m_linearVelocity * WorldPhysicsUpdateCycleDurationS< float >;
+
 			/* Dispatch the final move to the entity according to the new velocity. */
-			this->moveFromPhysics(m_linearVelocity * WorldPhysicsUpdateCycleDurationS< float >);
+			this->moveFromPhysics(m_lastPhysicsDisplacement);
 
 			isMoveOccurs = true;
 		}
+		else
+		{
+			m_lastPhysicsDisplacement.reset();
+		}
 
-		/* Apply the drag force on rotation if there is angular speed and rotation is enabled. */
-		if ( m_rotationEnabled && m_angularSpeed > 0.0F )
+		if ( this->integrateAngularMotion() )
 		{
-			/*
-			 * Angular drag is implemented as a simple damping coefficient.
-			 * A more physically accurate implementation would use:
-			 * Td = B * m * (V / Vt) * L^2 * w
-			 * Where:
-			 *   Td = drag torque
-			 *   B = angular drag coefficient
-			 *   V = volume of a submerged portion of polyhedron
-			 *   Vt = total volume of polyhedron
-			 *   L = approximation of the average width of the polyhedron
-			 *   w = angular velocity
-			 *
-			 * For now, we use a simplified damping approach where the angular drag coefficient
-			 * (0.0 to 1.0) determines how much angular velocity is retained each frame.
-			 * 0.0 = no drag (perpetual rotation), 1.0 = immediate stop.
-			 */
-			const auto angularDrag = objectProperties.angularDragCoefficient();
-
-			/* Apply damping: velocity *= (1 - drag) */
-			m_angularVelocity *= 1.0F - angularDrag;
-			m_angularSpeed = m_angularVelocity.length();
-
-			/* Dispatch the final rotation to the entity according to the new angular velocity. */
-			this->rotateFromPhysics(
-				m_angularSpeed * WorldPhysicsUpdateCycleDurationS< float >,
-				m_angularVelocity / m_angularSpeed
-			);
+			isMoveOccurs = true;
+		}
+
+		return isMoveOccurs;
+	}
+
+	size_t
+	MovableTrait::gatherIntegrationState (const EnvironmentPhysicalProperties & envProperties, BodyIntegrator & integrator) noexcept
+	{
+		const auto & objectProperties = this->getBodyPhysicalProperties();
+
+		/* Decay grounded state each frame. */
+		this->updateGroundedState();
+
+		/* NOTE: Same rules as updateSimulation(), encoded as the batch inputs. */
+		const bool isOnStableSurface = this->isGroundedOnTerrain() || this->isGroundedOnBoundary();
+		const auto frictionFactor = this->isGrounded() ? 1.0F - objectProperties.stickiness() : 1.0F;
+		const bool isGravityApplied = !isOnStableSurface && !this->isFreeFlyModeEnabled() && !objectProperties.isMassNull();
+
+		/* NOTE: The drag goes through addForce() in the per-body path, which discards it for massless bodies. */
+		const auto dragFactor = objectProperties.isMassNull() ?
+			0.0F :
+			0.5F * objectProperties.dragCoefficient() * envProperties.atmosphericDensity() * objectProperties.surface() * objectProperties.inverseMass();
+
+		return integrator.add(
+			m_linearVelocity,
+			frictionFactor,
+			isOnStableSurface,
+			isGravityApplied ? envProperties.steppedSurfaceGravity() : 0.0F,
+			dragFactor
+		);
+	}
+
+	bool
+	MovableTrait::applyIntegrationResults (const BodyIntegrator & integrator, size_t index) noexcept
+	{
+		m_linearVelocity = integrator.velocity(index);
+		m_linearSpeed = integrator.speed(index);
+
+		bool isMoveOccurs = false;
+
+		if ( m_linearSpeed > 0.0F )
+		{
+			m_lastPhysicsDisplacement = m_linearVelocity * WorldPhysicsUpdateCycleDurationS< float >;
+
+			this->moveFromPhysics(m_lastPhysicsDisplacement);
+
+			isMoveOccurs = true;
+		}
+		else
+		{
+			m_lastPhysicsDisplacement.reset();
+		}
 
+		if ( this->integrateAngularMotion() )
+		{
 			isMoveOccurs = true;
 		}
 
 		return isMoveOccurs;
 	}
 
+	bool
+	MovableTrait::integrateAngularMotion () noexcept
+	{
+		if ( !m_rotationEnabled || m_angularSpeed <= 0.0F )
+		{
+			return false;
+		}
+
+		/*
+		 * Angular drag is implemented as a simple damping coefficient.
+		 * A more physically accurate implementation would use:
+		 * Td = B * m * (V / Vt) * L^2 * w
+		 * Where:
+		 *   Td = drag torque
+		 *   B = angular drag coefficient
+		 *   V = volume of a submerged portion of polyhedron
+		 *   Vt = total volume of polyhedron
+		 *   L = approximation of the average width of the polyhedron
+		 *   w = angular velocity
+		 *
+		 * For now, we use a simplified damping approach where the angular drag coefficient
+		 * (0.0 to 1.0) determines how much angular velocity is retained each frame.
+		 * 0.0 = no drag (perpetual rotation), 1.0 = immediate stop.
+		 */
+		const auto angularDrag = this->getBodyPhysicalProperties().angularDragCoefficient();
+
+		/* Apply damping: velocity *= (1 - drag) */
+		m_angularVelocity *= 1.0F - angularDrag;
+		m_angularSpeed = m_angularVelocity.length();
+
+		/* Dispatch the final rotation to the entity according to the new angular velocity. */
+		this->rotateFromPhysics(
+			m_angularSpeed * WorldPhysicsUpdateCycleDurationS< float >,
+			m_angularVelocity / m_angularSpeed
+		);
+
+		return true;
+	}
+
 	void
 	MovableTrait::setGrounded (GroundedSource source, const MovableTrait * groundedOn) noexcept
 	{
@@ -264,37 +338,29 @@ namespace EmEn::Physics
 	bool
 	MovableTrait::checkSimulationInertia () noexcept
 	{
-		constexpr auto VelocityThreshold{0.05F}; /* 5 cm/s */
+		/* Sleep only allowed when ACTIVELY touching a stable surface this frame. */
+		if ( !this->updateRestState() || !this->isActivelyOnStableSurface() )
+		{
+			return false;
+		}
 
-		/* Check if velocity is negligible. */
-		const bool isStable = (m_linearSpeed < VelocityThreshold) && (m_angularSpeed < VelocityThreshold);
+		/* Clamp micro-velocities to zero. */
+		this->stopMovement();
 
-		/* Sleep only allowed when ACTIVELY touching a stable surface this frame.
-		 * m_groundedFrames == GroundedGracePeriod means we just touched the surface.
-		 * Grace period alone (bouncing but not touching) must not allow sleep. */
-		const bool isActivelyOnStableSurface =
-			(m_groundedFrames == GroundedGracePeriod) &&
-			(m_groundedSource == GroundedSource::Ground || m_groundedSource == GroundedSource::Boundary);
+		return true;
+	}
 
-		if ( isStable && isActivelyOnStableSurface )
+	bool
+	MovableTrait::updateRestState () noexcept
+	{
+		constexpr auto VelocityThreshold{0.05F}; /* 5 cm/s */
+
+		if ( m_linearSpeed < VelocityThreshold && m_angularSpeed < VelocityThreshold )
 		{
-			/* Increment stable frames counter. */
 			if ( m_stableFrames < StableFramesThreshold )
 			{
 				m_stableFrames++;
 			}
-
-			/* After enough stable frames, entity can sleep. */
-			if ( m_stableFrames >= StableFramesThreshold )
-			{
-				/* Clamp micro-velocities to zero. */
-				m_linearVelocity.reset();
-				m_angularVelocity.reset();
-				m_linearSpeed = 0.0F;
-				m_angularSpeed = 0.0F;
-
-				return true;
-			}
 		}
 		else
 		{
@@ -302,6 +368,13 @@ namespace EmEn::Physics
 			m_stableFrames = 0;
 		}
 
-		return false;
+		return m_stableFrames >= StableFramesThreshold;
+	}
+
+	bool
+	MovableTrait::isActivelyOnStableSurface () const noexcept
+	{
+		/* NOTE: m_groundedFrames == GroundedGracePeriod means we just touched the surface. */
+		return m_groundedFrames == GroundedGracePeriod && (m_groundedSource == GroundedSource::Ground || m_groundedSource == GroundedSource::Boundary);
 	}
 }
@@ -39,6 +39,11 @@ namespace EmEn::Scenes
 	class AbstractEntity;
 }
 
+namespace EmEn::Physics
+{
+	class BodyIntegrator;
+}
+
 
 namespace EmEn::Physics
 {
@@ -339,6 +344,24 @@ namespace EmEn::Physics
 			 */
 			bool updateSimulation (const EnvironmentPhysicalProperties & envProperties) noexcept;
 
+			/**
+			 * @brief Gathers the linear integration inputs of this body into a batch integrator.
+			 * @note Batched counterpart of updateSimulation(), the grounded state decays here.
+			 * Call applyIntegrationResults() with the returned index once the batch is integrated.
+			 * @param envProperties A reference to physical environment properties.
+			 * @param integrator A reference to the batch integrator.
+			 * @return size_t The index of this body in the batch.
+			 */
+			size_t gatherIntegrationState (const EnvironmentPhysicalProperties & envProperties, BodyIntegrator & integrator) noexcept;
+
+			/**
+			 * @brief Reads back the integrated velocity, then moves and rotates the body.
+			 * @param integrator A reference to the integrated batch.
+			 * @param index The index returned by gatherIntegrationState().
+			 * @return bool True if a movement occurs.
+			 */
+			bool applyIntegrationResults (const BodyIntegrator & integrator, size_t index) noexcept;
+
 			/**
 			 * @brief Sets whether this is affected by all physical interactions.
 			 * @note If false, the method stopMovement() will be called.
@@ -418,14 +441,79 @@ namespace EmEn::Physics
 				return m_freeFlyModeEnabled;
 			}
 
+			/**
+			 * @brief Enables the continuous collision detection for this body.
+			 * @note Meant for small fast bodies (projectiles, debris) which would tunnel through thin colliders
+			 * at the fixed physics step. The body displacement is swept against static entities, the ground
+			 * and other bodies, and clamped at the first time of impact. Only flagged bodies pay the cost.
+			 * @param state The state.
+			 * @return void
+			 */
+			void
+			enableContinuousCollision (bool state) noexcept
+			{
+				m_continuousCollisionEnabled = state;
+			}
+
+			/**
+			 * @brief Returns whether the continuous collision detection is enabled for this body.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isContinuousCollisionEnabled () const noexcept
+			{
+				return m_continuousCollisionEnabled;
+			}
+
+			/**
+			 * @brief Returns the linear displacement applied by the last simulation step.
+			 * @note Used by the continuous collision detection to rebuild the swept path.
+			 * @return const Base::Math::Vector< 3, float > &
+			 */
+			[[nodiscard]]
+			const Base::Math::Vector< 3, float > &
+			lastPhysicsDisplacement () const noexcept
+			{
+				return m_lastPhysicsDisplacement;
+			}
+
 			/**
 			 * @brief Check for simulation inertia.
+			 * @note This is the sleep rule for a body alone : at rest and actively lying on the ground or a boundary floor.
+			 * Bodies in contact with other bodies are put to sleep by island, see Scenes::ContactIslands.
 			 * @warning This method is not physically correct, and its aim is to reduce useless physics computation.
 			 * @return bool
 			 */
 			[[nodiscard]]
 			bool checkSimulationInertia () noexcept;
 
+			/**
+			 * @brief Counts the consecutive frames with a negligible velocity.
+			 * @note Must be called once per simulation step.
+			 * @return bool True if the body is at rest.
+			 */
+			bool updateRestState () noexcept;
+
+			/**
+			 * @brief Returns whether the velocity of the body has been negligible long enough.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isAtRest () const noexcept
+			{
+				return m_stableFrames >= StableFramesThreshold;
+			}
+
+			/**
+			 * @brief Returns whether the body touched the ground or a boundary floor during this frame.
+			 * @note The grace period alone (bouncing but not touching) does not count.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isActivelyOnStableSurface () const noexcept;
+
 			/**
 			 * @brief Returns the world position (public accessor for physics engine).
 			 * @return Base::Math::Vector< 3, float >
@@ -576,6 +664,12 @@ namespace EmEn::Physics
 
 		private:
 
+			/**
+			 * @brief Applies the angular damping and dispatches the rotation of this tick.
+			 * @return bool True if a rotation occurs.
+			 */
+			bool integrateAngularMotion () noexcept;
+
 			/** @brief Threshold for considering entity stable (in frames). ~500ms at 60 FPS. */
 			static constexpr uint8_t StableFramesThreshold{30};
 			/** @brief Grace period before losing grounded state (in frames). ~250ms at 60 FPS. */
@@ -584,6 +678,7 @@ namespace EmEn::Physics
 			Base::Math::Vector< 3, float > m_linearVelocity;
 			Base::Math::Vector< 3, float > m_angularVelocity; // Omega
 			Base::Math::Vector< 3, float > m_centerOfMass;
+			Base::Math::Vector< 3, float > m_lastPhysicsDisplacement;
 			Base::Math::Matrix< 3, float > m_inverseWorldInertia; // Cached I^-1 in world space
 			const MovableTrait * m_groundedOn{nullptr}; ///< Entity we're grounded on (if source is Entity).
 			float m_linearSpeed{0.0F};
@@ -594,5 +689,6 @@ namespace EmEn::Physics
 			bool m_isMovable{true};
 			bool m_rotationEnabled{false};
 			bool m_freeFlyModeEnabled{false};
+			bool m_continuousCollisionEnabled{false};
 	};
 }
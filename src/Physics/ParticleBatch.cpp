@@ -0,0 +1,325 @@
+/*
+ * src/Physics/ParticleBatch.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "ParticleBatch.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cmath>
+
+/* Local inclusions. */
+#include "Constants.hpp"
+#include "ThreadPool.hpp"
+#include "Utility.hpp"
+#include "Scenes/Component/AbstractModifier.hpp"
+
+namespace EmEn::Physics
+{
+	using namespace Base::Math;
+
+	namespace
+	{
+		/**
+		 * @brief Returns the next value of a xorshift generator as a float in [-0.5, 0.5].
+		 * @note Thread pool tasks own their generator, the shared engine random is never touched from workers.
+		 * @param state A reference to the generator state. Must not be 0.
+		 * @return float
+		 */
+		[[nodiscard]]
+		float
+		nextChaos (uint32_t & state) noexcept
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+
+			return static_cast< float >(state >> 8) * (1.0F / 16777216.0F) - 0.5F;
+		}
+	}
+
+	ParticleBatch::ParticleBatch (size_t capacity) noexcept
+		: m_positionX(capacity, 0.0F),
+		m_positionY(capacity, 0.0F),
+		m_positionZ(capacity, 0.0F),
+		m_previousPositionX(capacity, 0.0F),
+		m_previousPositionY(capacity, 0.0F),
+		m_previousPositionZ(capacity, 0.0F),
+		m_velocityX(capacity, 0.0F),
+		m_velocityY(capacity, 0.0F),
+		m_velocityZ(capacity, 0.0F),
+		m_size(capacity, 0.0F),
+		m_lifetime(capacity, 0.0F),
+		m_spawnFrames(capacity)
+	{
+
+	}
+
+	bool
+	ParticleBatch::spawn (const CartesianFrame< float > & frame, float spreadingRadius, float lifetime, float size) noexcept
+	{
+		if ( m_liveCount >= this->capacity() )
+		{
+			return false;
+		}
+
+		const auto index = m_liveCount++;
+
+		auto & spawnFrame = m_spawnFrames[index];
+		spawnFrame = frame;
+
+		if ( spreadingRadius > 0.0F )
+		{
+			const auto half = spreadingRadius * 0.5F;
+
+			spawnFrame.translate(
+				Base::Utility::quickRandom(-half, +half),
+				Base::Utility::quickRandom(-half, +half),
+				Base::Utility::quickRandom(-half, +half),
+				true
+			);
+		}
+
+		const auto & position = spawnFrame.position();
+
+		m_positionX[index] = position[X];
+		m_positionY[index] = position[Y];
+		m_positionZ[index] = position[Z];
+		m_previousPositionX[index] = position[X];
+		m_previousPositionY[index] = position[Y];
+		m_previousPositionZ[index] = position[Z];
+		m_velocityX[index] = 0.0F;
+		m_velocityY[index] = 0.0F;
+		m_velocityZ[index] = 0.0F;
+		m_size[index] = std::abs(size);
+		m_lifetime[index] = lifetime;
+
+		return true;
+	}
+
+	void
+	ParticleBatch::simulate (const ParticleSimulationParameters & parameters, const std::vector< const Scenes::Component::AbstractModifier * > & modifiers, const SpanFunction & customFunction, Base::ThreadPool * threadPool, uint32_t seed) noexcept
+	{
+		if ( m_liveCount == 0 )
+		{
+			return;
+		}
+
+		this->forEachChunk([&] (size_t first, size_t last) {
+			/* NOTE: Each chunk gets its own chaos sequence, the result does not depend on the thread count. */
+			const auto chunkSeed = (seed * 2654435761U) ^ (static_cast< uint32_t >(first / ChunkSize) * 40503U) ^ 0x9E3779B9U;
+
+			this->simulateRange(first, last, parameters, modifiers, customFunction, chunkSeed == 0 ? 1U : chunkSeed);
+		}, threadPool);
+
+		this->pack();
+	}
+
+	void
+	ParticleBatch::forEachChunk (const std::function< void (size_t, size_t) > & function, Base::ThreadPool * threadPool) const noexcept
+	{
+		const auto count = m_liveCount;
+
+		if ( count == 0 )
+		{
+			return;
+		}
+
+		if ( threadPool == nullptr || count < ParallelThreshold )
+		{
+			for ( size_t first = 0; first < count; first += ChunkSize )
+			{
+				function(first, std::min(first + ChunkSize, count));
+			}
+
+			return;
+		}
+
+		const auto chunkCount = static_cast< uint32_t >((count + ChunkSize - 1) / ChunkSize);
+
+		threadPool->parallelFor(uint32_t{0}, chunkCount, [&function, count] (uint32_t chunkIndex) {
+			const auto first = static_cast< size_t >(chunkIndex) * ChunkSize;
+
+			function(first, std::min(first + ChunkSize, count));
+		});
+	}
+
+	ParticleSpan
+	ParticleBatch::span (size_t first, size_t last) noexcept
+	{
+		return {
+			m_positionX.data() + first,
+			m_positionY.data() + first,
+			m_positionZ.data() + first,
+			m_velocityX.data() + first,
+			m_velocityY.data() + first,
+			m_velocityZ.data() + first,
+			m_size.data() + first,
+			m_lifetime.data() + first,
+			last - first
+		};
+	}
+
+	void
+	ParticleBatch::simulateRange (size_t first, size_t last, const ParticleSimulationParameters & parameters, const std::vector< const Scenes::Component::AbstractModifier * > & modifiers, const SpanFunction & customFunction, uint32_t seed) noexcept
+	{
+		constexpr auto DeltaTime{WorldPhysicsUpdateCycleDurationS< float >};
+		constexpr auto DeltaTimeMS{WorldPhysicsUpdateCycleDurationMS< float >};
+
+		auto particles = this->span(first, last);
+		const auto count = particles.count;
+
+		float * positionX = particles.positionX;
+		float * positionY = particles.positionY;
+		float * positionZ = particles.positionZ;
+		float * velocityX = particles.velocityX;
+		float * velocityY = particles.velocityY;
+		float * velocityZ = particles.velocityZ;
+		float * size = particles.size;
+		float * lifetime = particles.lifetime;
+
+		/* NOTE: The position before any displacement of this tick, read back for the motion vectors. */
+		std::copy_n(positionX, count, m_previousPositionX.data() + first);
+		std::copy_n(positionY, count, m_previousPositionY.data() + first);
+		std::copy_n(positionZ, count, m_previousPositionZ.data() + first);
+
+		if ( customFunction )
+		{
+			customFunction(particles);
+		}
+		else if ( parameters.inverseMass > 0.0F )
+		{
+			/* Scene modifiers, one pass per modifier over the chunk. */
+			const auto forceScale = parameters.inverseMass * DeltaTime;
+
+			for ( const auto * modifier : modifiers )
+			{
+				CartesianFrame< float > particleFrame;
+
+				for ( size_t index = 0; index < count; ++index )
+				{
+					particleFrame.setPosition({positionX[index], positionY[index], positionZ[index]});
+
+					const auto force = parameters.toWorld == nullptr ?
+						modifier->getForceAppliedTo(particleFrame, size[index] * 0.5F) :
+						modifier->getForceAppliedTo(CartesianFrame< float >{*parameters.toWorld * particleFrame.getModelMatrix()}, size[index] * 0.5F);
+
+					velocityX[index] += force[X] * forceScale;
+					velocityY[index] += force[Y] * forceScale;
+					velocityZ[index] += force[Z] * forceScale;
+				}
+			}
+
+			/* NOTE: Branchless body so the loop is vectorized. */
+			const auto gravityStep = parameters.gravityStep;
+			const auto dragFactor = parameters.dragFactor;
+
+			for ( size_t index = 0; index < count; ++index )
+			{
+				const auto x = velocityX[index];
+				const auto y = velocityY[index] + gravityStep;
+				const auto z = velocityZ[index];
+
+				/* Quadratic drag: Δv = -v × (factor × |v| × Δt). */
+				const auto dragScale = 1.0F - dragFactor * std::sqrt(x * x + y * y + z * z) * DeltaTime;
+
+				velocityX[index] = x * dragScale;
+				velocityY[index] = y * dragScale;
+				velocityZ[index] = z * dragScale;
+			}
+		}
+
+		/* Lifetime, size and displacement. */
+		const auto sizeDelta = parameters.sizeDelta;
+
+		for ( size_t index = 0; index < count; ++index )
+		{
+			const auto newSize = size[index] + sizeDelta;
+			const auto newLifetime = std::max(lifetime[index] - DeltaTimeMS, 0.0F);
+
+			/* NOTE: A negative size kills the particle. */
+			size[index] = newSize;
+			lifetime[index] = newSize < 0.0F ? 0.0F : newLifetime;
+
+			positionX[index] += velocityX[index] * DeltaTime;
+			positionY[index] += velocityY[index] * DeltaTime;
+			positionZ[index] += velocityZ[index] * DeltaTime;
+		}
+
+		if ( parameters.chaosMagnitude != 0.0F )
+		{
+			const auto magnitude = parameters.chaosMagnitude;
+			auto state = seed;
+
+			for ( size_t index = 0; index < count; ++index )
+			{
+				positionX[index] += nextChaos(state) * magnitude;
+				positionY[index] += nextChaos(state) * magnitude;
+				positionZ[index] += nextChaos(state) * magnitude;
+			}
+		}
+	}
+
+	void
+	ParticleBatch::pack () noexcept
+	{
+		size_t index = 0;
+
+		while ( index < m_liveCount )
+		{
+			if ( m_lifetime[index] > 0.0F )
+			{
+				++index;
+
+				continue;
+			}
+
+			/* NOTE: The last live particle takes the slot, it is checked on the next iteration. */
+			--m_liveCount;
+
+			if ( index != m_liveCount )
+			{
+				this->copyParticle(m_liveCount, index);
+			}
+		}
+	}
+
+	void
+	ParticleBatch::copyParticle (size_t from, size_t to) noexcept
+	{
+		m_positionX[to] = m_positionX[from];
+		m_positionY[to] = m_positionY[from];
+		m_positionZ[to] = m_positionZ[from];
+		m_previousPositionX[to] = m_previousPositionX[from];
+		m_previousPositionY[to] = m_previousPositionY[from];
+		m_previousPositionZ[to] = m_previousPositionZ[from];
+		m_velocityX[to] = m_velocityX[from];
+		m_velocityY[to] = m_velocityY[from];
+		m_velocityZ[to] = m_velocityZ[from];
+		m_size[to] = m_size[from];
+		m_lifetime[to] = m_lifetime[from];
+		m_spawnFrames[to] = m_spawnFrames[from];
+	}
+}
@@ -0,0 +1,291 @@
+/*
+ * src/Physics/ParticleBatch.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Math/CartesianFrame.hpp"
+#include "Math/Matrix.hpp"
+#include "Math/Vector.hpp"
+
+/* Forward declarations. */
+namespace EmEn
+{
+	namespace Base
+	{
+		class ThreadPool;
+	}
+
+	namespace Scenes::Component
+	{
+		class AbstractModifier;
+	}
+}
+
+namespace EmEn::Physics
+{
+	/**
+	 * @brief A view over a contiguous range of particles of a batch.
+	 * @note Every pointer targets the first particle of the range. Positions and velocities are expressed
+	 * in the simulation space of the emitter (world space, or emitter space when the particles are constrained to it).
+	 */
+	struct ParticleSpan
+	{
+		float * positionX{nullptr};
+		float * positionY{nullptr};
+		float * positionZ{nullptr};
+		float * velocityX{nullptr};
+		float * velocityY{nullptr};
+		float * velocityZ{nullptr};
+		float * size{nullptr};
+		float * lifetime{nullptr}; /**< Remaining lifetime in milliseconds. 0 kills the particle at the end of the tick. */
+		size_t count{0};
+	};
+
+	/**
+	 * @brief Parameters shared by every particle of a batch for one simulation tick.
+	 */
+	struct ParticleSimulationParameters
+	{
+		float gravityStep{0.0F};   /**< Gravity velocity added this tick (Y+ is down). */
+		float dragFactor{0.0F};	/**< Drag factor 0.5 × Cd × ρ × S / m. */
+		float inverseMass{0.0F};   /**< Inverse of a particle mass to convert modifier forces. 0 disables forces. */
+		float sizeDelta{0.0F};	 /**< Size variation per tick. A negative size kills the particle. */
+		float chaosMagnitude{0.0F}; /**< Random displacement magnitude per tick. */
+		const Base::Math::Matrix< 4, float > * toWorld{nullptr}; /**< Emitter model matrix when the simulation space is not the world. */
+	};
+
+	/**
+	 * @brief Stores the particles of an emitter as a structure of arrays and simulates them in one pass.
+	 *
+	 * Live particles are always packed at the front of the arrays, so the particle index is also
+	 * the instance index in the renderable instance buffer. Dead particles are swapped with the last
+	 * live one at the end of a tick.
+	 *
+	 * The tick runs chunk by chunk: modifier forces (one loop per modifier), then gravity and drag
+	 * through a branchless kernel over contiguous float streams (vectorized by the compiler), then
+	 * lifetime, size and displacement. Large batches are split over the thread pool.
+	 *
+	 * The position at the start of the tick is kept in its own streams and moved with the
+	 * particle when the batch is packed, so the motion vectors survive the slot reuse.
+	 *
+	 * @note Particles do not rotate during their life, the spawn frame is kept to orient mesh particles.
+	 * @see EmEn::Scenes::Component::ParticlesEmitter
+	 * @since 0.9.53
+	 */
+	class EMEN_API ParticleBatch final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ParticleBatch"};
+
+			/** @brief Number of particles simulated by one thread pool task. */
+			static constexpr size_t ChunkSize{2048};
+
+			/** @brief Number of particles under which the batch is simulated on the calling thread. */
+			static constexpr size_t ParallelThreshold{8192};
+
+			/**
+			 * @brief A function replacing the default forces for a span of particles.
+			 * @note Called once per chunk, possibly from several threads at the same time.
+			 */
+			using SpanFunction = std::function< void (ParticleSpan &) >;
+
+			/**
+			 * @brief Constructs a particle batch.
+			 * @param capacity The maximum number of particles.
+			 */
+			explicit ParticleBatch (size_t capacity) noexcept;
+
+			/**
+			 * @brief Returns the maximum number of particles.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			capacity () const noexcept
+			{
+				return m_positionX.size();
+			}
+
+			/**
+			 * @brief Returns the number of live particles.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			liveCount () const noexcept
+			{
+				return m_liveCount;
+			}
+
+			/**
+			 * @brief Spawns a particle at rest.
+			 * @param frame A reference to the spawn frame in the simulation space.
+			 * @param spreadingRadius The random spreading around the spawn position, along the frame axes.
+			 * @param lifetime The lifetime in milliseconds.
+			 * @param size The initial size.
+			 * @return bool False if the batch is full.
+			 */
+			bool spawn (const Base::Math::CartesianFrame< float > & frame, float spreadingRadius, float lifetime, float size) noexcept;
+
+			/**
+			 * @brief Simulates every live particle for one tick, then packs the survivors.
+			 * @param parameters A reference to the tick parameters.
+			 * @param modifiers A reference to the list of active scene modifiers.
+			 * @param customFunction A reference to a function replacing the default forces. Can be empty.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @param seed A seed for the chaos displacement (typically the engine cycle).
+			 * @return void
+			 */
+			void simulate (const ParticleSimulationParameters & parameters, const std::vector< const Scenes::Component::AbstractModifier * > & modifiers, const SpanFunction & customFunction, Base::ThreadPool * threadPool, uint32_t seed) noexcept;
+
+			/**
+			 * @brief Runs a function over the live particles, chunk by chunk.
+			 * @param function A reference to a function receiving the first particle index and the index past the last one.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			void forEachChunk (const std::function< void (size_t, size_t) > & function, Base::ThreadPool * threadPool) const noexcept;
+
+			/**
+			 * @brief Kills every particle.
+			 * @return void
+			 */
+			void
+			clear () noexcept
+			{
+				m_liveCount = 0;
+			}
+
+			/**
+			 * @brief Returns the position of a particle in the simulation space.
+			 * @param index The particle index.
+			 * @return Base::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			Base::Math::Vector< 3, float >
+			position (size_t index) const noexcept
+			{
+				return {m_positionX[index], m_positionY[index], m_positionZ[index]};
+			}
+
+			/**
+			 * @brief Returns the position of a particle at the start of the last tick, in the simulation space.
+			 * @note It follows the particle when the batch is packed. A particle spawned this tick returns its spawn position.
+			 * @param index The particle index.
+			 * @return Base::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			Base::Math::Vector< 3, float >
+			previousPosition (size_t index) const noexcept
+			{
+				return {m_previousPositionX[index], m_previousPositionY[index], m_previousPositionZ[index]};
+			}
+
+			/**
+			 * @brief Returns the size of a particle.
+			 * @param index The particle index.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float
+			size (size_t index) const noexcept
+			{
+				return m_size[index];
+			}
+
+			/**
+			 * @brief Returns the spawn frame of a particle (orientation only is meaningful).
+			 * @param index The particle index.
+			 * @return const Base::Math::CartesianFrame< float > &
+			 */
+			[[nodiscard]]
+			const Base::Math::CartesianFrame< float > &
+			spawnFrame (size_t index) const noexcept
+			{
+				return m_spawnFrames[index];
+			}
+
+		private:
+
+			/**
+			 * @brief Returns a view over a range of particles.
+			 * @param first The first particle index.
+			 * @param last The index past the last particle.
+			 * @return ParticleSpan
+			 */
+			[[nodiscard]]
+			ParticleSpan span (size_t first, size_t last) noexcept;
+
+			/**
+			 * @brief Simulates a contiguous range of particles.
+			 * @param first The first particle index.
+			 * @param last The index past the last particle.
+			 * @param parameters A reference to the tick parameters.
+			 * @param modifiers A reference to the list of active scene modifiers.
+			 * @param customFunction A reference to a function replacing the default forces. Can be empty.
+			 * @param seed A seed for the chaos displacement.
+			 * @return void
+			 */
+			void simulateRange (size_t first, size_t last, const ParticleSimulationParameters & parameters, const std::vector< const Scenes::Component::AbstractModifier * > & modifiers, const SpanFunction & customFunction, uint32_t seed) noexcept;
+
+			/**
+			 * @brief Moves the dead particles behind the live ones.
+			 * @return void
+			 */
+			void pack () noexcept;
+
+			/**
+			 * @brief Copies a particle over another one.
+			 * @param from The source particle index.
+			 * @param to The destination particle index.
+			 * @return void
+			 */
+			void copyParticle (size_t from, size_t to) noexcept;
+
+			std::vector< float > m_positionX;
+			std::vector< float > m_positionY;
+			std::vector< float > m_positionZ;
+			std::vector< float > m_previousPositionX;
+			std::vector< float > m_previousPositionY;
+			std::vector< float > m_previousPositionZ;
+			std::vector< float > m_velocityX;
+			std::vector< float > m_velocityY;
+			std::vector< float > m_velocityZ;
+			std::vector< float > m_size;
+			std::vector< float > m_lifetime;
+			std::vector< Base::Math::CartesianFrame< float > > m_spawnFrames;
+			size_t m_liveCount{0};
+	};
+}
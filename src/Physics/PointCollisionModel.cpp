@@ -29,6 +29,7 @@
 /* Local inclusions. */
 #include "AABBCollisionModel.hpp"
 #include "CapsuleCollisionModel.hpp"
+#include "ConvexHullCollisionModel.hpp"
 #include "Math/Space3D/Collisions/CapsulePoint.hpp"
 #include "Math/Space3D/Collisions/PointCuboid.hpp"
 #include "Math/Space3D/Collisions/PointSphere.hpp"
@@ -55,6 +56,9 @@ namespace EmEn::Physics
 
 			case CollisionModelType::Capsule:
 				return this->collideWithCapsule(thisWorldFrame, static_cast< const CapsuleCollisionModel & >(other), otherWorldFrame);
+
+			case CollisionModelType::ConvexHull:
+				return this->collideWithConvexHull(thisWorldFrame, static_cast< const ConvexHullCollisionModel & >(other), otherWorldFrame);
 		}
 
 		return {};
@@ -202,4 +206,10 @@ namespace EmEn::Physics
 
 		return results;
 	}
+
+	CollisionDetectionResults
+	PointCollisionModel::collideWithConvexHull (const CartesianFrame< float > & thisWorldFrame, const ConvexHullCollisionModel & other, const CartesianFrame< float > & otherWorldFrame) const noexcept
+	{
+		return other.collideFromOtherSide(otherWorldFrame, *this, thisWorldFrame);
+	}
 }
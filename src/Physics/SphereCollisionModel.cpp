@@ -29,6 +29,7 @@
 /* Local inclusions. */
 #include "AABBCollisionModel.hpp"
 #include "CapsuleCollisionModel.hpp"
+#include "ConvexHullCollisionModel.hpp"
 #include "Math/Space3D/Collisions/CapsuleSphere.hpp"
 #include "Math/Space3D/Collisions/PointSphere.hpp"
 #include "Math/Space3D/Collisions/SamePrimitive.hpp"
@@ -56,6 +57,9 @@ namespace EmEn::Physics
 
 			case CollisionModelType::Capsule:
 				return this->collideWithCapsule(thisWorldFrame, static_cast< const CapsuleCollisionModel & >(other), otherWorldFrame);
+
+			case CollisionModelType::ConvexHull:
+				return this->collideWithConvexHull(thisWorldFrame, static_cast< const ConvexHullCollisionModel & >(other), otherWorldFrame);
 		}
 
 		return {};
@@ -180,4 +184,10 @@ namespace EmEn::Physics
 
 		return results;
 	}
+
+	CollisionDetectionResults
+	SphereCollisionModel::collideWithConvexHull (const CartesianFrame< float > & thisWorldFrame, const ConvexHullCollisionModel & other, const CartesianFrame< float > & otherWorldFrame) const noexcept
+	{
+		return other.collideFromOtherSide(otherWorldFrame, *this, thisWorldFrame);
+	}
 }
@@ -49,10 +49,10 @@ namespace EmEn::Saphir
 	void
 	AbstractShader::setExtensionBehavior (const char * extension, const char * behavior) noexcept
 	{
-		std::stringstream headers;
+		CodeBuffer headers{};
 		headers << Keys::GLSL::Define::Extension << ' ' << extension << " : " << behavior;
 
-		m_headers.emplace_back(headers.str());
+		m_headers.emplace_back(headers.take());
 	}
 
 	bool
@@ -244,7 +244,9 @@ namespace EmEn::Saphir
 	bool
 	AbstractShader::generateSourceCode (Generator::Abstract & generator) noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
+		code.reserve(SourceCodeCapacity);
+
 		std::string topInstructions{};
 		std::string outputInstructions{};
 
@@ -272,7 +274,7 @@ namespace EmEn::Saphir
 			 this->getCode(topInstructions, outputInstructions) <<
 			 "}" "\n";
 
-		m_sourceCode = code.str();
+		m_sourceCode = code.take();
 
 		this->generateHash();
 
@@ -317,7 +319,7 @@ namespace EmEn::Saphir
 	}
 
 	void
-	AbstractShader::generateHeaders (std::stringstream & code) const noexcept
+	AbstractShader::generateHeaders (CodeBuffer & code) const noexcept
 	{
 		/* NOTE: This must be the first line of the source code.
 		 * This is the version and the profile of the current shader. */
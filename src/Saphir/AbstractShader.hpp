@@ -36,6 +36,7 @@
 #include "CodeGeneratorInterface.hpp"
 
 /* Local inclusions for usages. */
+#include "CodeBuffer.hpp"
 #include "Declaration/Function.hpp"
 #include "Declaration/PushConstantBlock.hpp"
 #include "Declaration/Sampler.hpp"
@@ -63,6 +64,9 @@ namespace EmEn::Saphir
 	{
 		public:
 
+			/** @brief The source code capacity reserved before a generation, enough for most shaders. */
+			static constexpr size_t SourceCodeCapacity{16384};
+
 			/**
 			 * @brief Copy constructor.
 			 * @param copy A reference to the copied instance.
@@ -353,15 +357,15 @@ namespace EmEn::Saphir
 
 			/**
 			 * @brief Generates the shader file header.
-			 * @param code A reference to a stream.
+			 * @param code A reference to a code buffer.
 			 * @return void
 			 */
-			void generateHeaders (std::stringstream & code) const noexcept;
+			void generateHeaders (CodeBuffer & code) const noexcept;
 
 			/**
 			 * @brief Generates shader declarations.
 			 * @tparam declaration_t The type of declaration. This should be derived from Declaration::Interface.
-			 * @param code A reference to a stream.
+			 * @param code A reference to a code buffer.
 			 * @param declarations A reference to a list of declaration.
 			 * @param comment A section comment. Default none.
 			 * @return void
@@ -369,7 +373,7 @@ namespace EmEn::Saphir
 			template< typename declaration_t >
 			static
 			void
-			generateDeclarations (std::stringstream & code, const std::vector< declaration_t > & declarations, const char * comment = nullptr) noexcept requires (std::is_base_of_v< Declaration::Interface, declaration_t >)
+			generateDeclarations (CodeBuffer & code, const std::vector< declaration_t > & declarations, const char * comment = nullptr) noexcept requires (std::is_base_of_v< Declaration::Interface, declaration_t >)
 			{
 				if ( declarations.empty() )
 				{
@@ -392,7 +396,7 @@ namespace EmEn::Saphir
 			/**
 			 * @brief Generates shader declarations.
 			 * @tparam declaration_t The type of declaration. This should be derived from Declaration::Interface.
-			 * @param code A reference to a stream.
+			 * @param code A reference to a code buffer.
 			 * @param declarations A reference to a list of declaration.
 			 * @param comment A section comment. Default none.
 			 * @return void
@@ -400,7 +404,7 @@ namespace EmEn::Saphir
 			template< typename declaration_t >
 			static
 			void
-			generateDeclarations (std::stringstream & code, const Base::StaticVector< declaration_t, 4 > & declarations, const char * comment = nullptr) noexcept requires (std::is_base_of_v< Declaration::Interface, declaration_t >)
+			generateDeclarations (CodeBuffer & code, const Base::StaticVector< declaration_t, 4 > & declarations, const char * comment = nullptr) noexcept requires (std::is_base_of_v< Declaration::Interface, declaration_t >)
 			{
 				if ( declarations.empty() )
 				{
@@ -423,13 +427,13 @@ namespace EmEn::Saphir
 			/**
 			 * @brief Called from the child class for generating the source code.
 			 * @param generator A reference to the generator.
-			 * @param code A reference to string.
+			 * @param code A reference to a code buffer.
 			 * @param topInstructions A reference to a string for the main top instructions.
 			 * @param outputInstructions A reference to a string for the main output instructions.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			virtual bool onSourceCodeGeneration (Generator::Abstract & generator, std::stringstream & code, std::string & topInstructions, std::string & outputInstructions) noexcept = 0;
+			virtual bool onSourceCodeGeneration (Generator::Abstract & generator, CodeBuffer & code, std::string & topInstructions, std::string & outputInstructions) noexcept = 0;
 
 			/**
 			 * @brief Called from the child class for generating declaration stats.
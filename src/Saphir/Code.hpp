@@ -27,10 +27,13 @@
 #pragma once
 
 /* STL inclusions. */
+#include <algorithm>
 #include <cstdint>
-#include <sstream>
+#include <string_view>
+#include <utility>
 
 /* Local inclusions for usages. */
+#include "CodeBuffer.hpp"
 #include "CodeGeneratorInterface.hpp"
 #include "Math/Vector.hpp"
 #include "PixelFactory/Color.hpp"
@@ -61,6 +64,9 @@ namespace EmEn::Saphir
 	{
 		public:
 
+			/** @brief Precomputed indentations, a code slices it instead of building its own. */
+			static constexpr std::string_view Indentations{"\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t\t"};
+
 			/** 
 			 * @brief Constructs a code.
 			 * @param generator A reference to the shader generator.
@@ -71,7 +77,8 @@ namespace EmEn::Saphir
 			Code (CodeGeneratorInterface & generator, Location type = Location::Main, size_t depth = 1) noexcept
 				: m_generator{generator},
 				m_type{type},
-				m_indent(depth, '\t')
+				m_indent{Indentations.substr(0, std::min(depth, Indentations.size()))},
+				m_code{CodeBuffer::borrow()}
 			{
 				m_code << m_indent;
 			}
@@ -111,17 +118,19 @@ namespace EmEn::Saphir
 				switch ( m_type )
 				{
 					case Location::Top:
-						m_generator.addTopInstruction(m_code.str());
+						m_generator.addTopInstruction(m_code.view());
 						break;
 
 					case Location::Main:
-						m_generator.addInstruction(m_code.str());
+						m_generator.addInstruction(m_code.view());
 						break;
 
 					case Location::Output:
-						m_generator.addOutputInstruction(m_code.str());
+						m_generator.addOutputInstruction(m_code.view());
 						break;
 				}
+
+				CodeBuffer::recycle(std::move(m_code));
 			}
 
 			/**
@@ -219,7 +228,7 @@ namespace EmEn::Saphir
 
 			CodeGeneratorInterface & m_generator;
 			Location m_type;
-			std::string m_indent;
-			std::stringstream m_code;
+			std::string_view m_indent;
+			CodeBuffer m_code;
 	};
 }
@@ -0,0 +1,81 @@
+/*
+ * src/Saphir/CodeBuffer.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "CodeBuffer.hpp"
+
+/* STL inclusions. */
+#include <vector>
+
+namespace EmEn::Saphir
+{
+	/**
+	 * @brief Returns the released storages of the calling thread.
+	 * @return std::vector< std::string > &
+	 */
+	static
+	std::vector< std::string > &
+	threadStorages () noexcept
+	{
+		/* NOTE: One pool per thread, the generators run on the worker threads without any lock. */
+		static thread_local std::vector< std::string > storages;
+
+		return storages;
+	}
+
+	CodeBuffer
+	CodeBuffer::borrow () noexcept
+	{
+		auto & storages = threadStorages();
+
+		if ( storages.empty() )
+		{
+			CodeBuffer buffer;
+			buffer.reserve(DefaultCapacity);
+
+			return buffer;
+		}
+
+		CodeBuffer buffer{std::move(storages.back())};
+
+		storages.pop_back();
+
+		return buffer;
+	}
+
+	void
+	CodeBuffer::recycle (CodeBuffer && buffer) noexcept
+	{
+		auto & storages = threadStorages();
+
+		if ( storages.size() < MaxPooledStorages && buffer.m_buffer.capacity() > 0 )
+		{
+			storages.emplace_back(std::move(buffer.m_buffer));
+		}
+
+		buffer.m_buffer.clear();
+	}
+}
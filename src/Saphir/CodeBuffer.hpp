@@ -0,0 +1,287 @@
+/*
+ * src/Saphir/CodeBuffer.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace EmEn::Saphir
+{
+	/**
+	 * @brief A string builder for the GLSL code generation.
+	 * @note This replaces std::stringstream in the Saphir generators. Text is appended to a plain
+	 * string, numbers are written with std::to_chars (no locale, no stream state) using the same
+	 * "%g" form as a default stream, so the generated source stays the same. Types only providing
+	 * a std::ostream operator still go through a temporary stream.
+	 * @since 0.9.53
+	 */
+	class EMEN_API CodeBuffer final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"CodeBuffer"};
+
+			/** @brief The capacity of a borrowed storage on first use. */
+			static constexpr size_t DefaultCapacity{1024};
+
+			/** @brief The number of released storages kept per thread. */
+			static constexpr size_t MaxPooledStorages{16};
+
+			/** @brief The significant digits of a floating point number, matching a default std::ostream. */
+			static constexpr int FloatPrecision{6};
+
+			/**
+			 * @brief Constructs an empty code buffer.
+			 */
+			CodeBuffer () noexcept = default;
+
+			/**
+			 * @brief Constructs a code buffer over an existing storage.
+			 * @note The storage is cleared, its capacity is kept.
+			 * @param storage A string to reuse.
+			 */
+			explicit
+			CodeBuffer (std::string && storage) noexcept
+				: m_buffer{std::move(storage)}
+			{
+				m_buffer.clear();
+			}
+
+			/**
+			 * @brief Appends a string.
+			 * @param value A string view.
+			 * @return CodeBuffer &
+			 */
+			CodeBuffer &
+			operator<< (std::string_view value) noexcept
+			{
+				m_buffer.append(value);
+
+				return *this;
+			}
+
+			/**
+			 * @brief Appends a string.
+			 * @param value A reference to a string.
+			 * @return CodeBuffer &
+			 */
+			CodeBuffer &
+			operator<< (const std::string & value) noexcept
+			{
+				m_buffer.append(value);
+
+				return *this;
+			}
+
+			/**
+			 * @brief Appends a C-string.
+			 * @param value A pointer to a C-string. A null pointer writes nothing.
+			 * @return CodeBuffer &
+			 */
+			CodeBuffer &
+			operator<< (const char * value) noexcept
+			{
+				if ( value != nullptr )
+				{
+					m_buffer.append(value);
+				}
+
+				return *this;
+			}
+
+			/**
+			 * @brief Appends a character.
+			 * @param value The character.
+			 * @return CodeBuffer &
+			 */
+			CodeBuffer &
+			operator<< (char value) noexcept
+			{
+				m_buffer.push_back(value);
+
+				return *this;
+			}
+
+			/**
+			 * @brief Appends a value.
+			 * @tparam data_t The type of the value.
+			 * @param value A reference to the value.
+			 * @return CodeBuffer &
+			 */
+			template< typename data_t >
+			CodeBuffer &
+			operator<< (const data_t & value) noexcept
+			{
+				if constexpr ( std::is_same_v< data_t, bool > )
+				{
+					/* NOTE: A default stream writes booleans as numbers. */
+					m_buffer.push_back(value ? '1' : '0');
+				}
+				else if constexpr ( std::is_same_v< data_t, signed char > || std::is_same_v< data_t, unsigned char > )
+				{
+					/* NOTE: A stream writes these as characters, keep it that way. */
+					m_buffer.push_back(static_cast< char >(value));
+				}
+				else if constexpr ( std::integral< data_t > )
+				{
+					char digits[24];
+
+					const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+
+					m_buffer.append(digits, result.ptr);
+				}
+				else if constexpr ( std::floating_point< data_t > )
+				{
+					char digits[32];
+
+					const auto result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::general, FloatPrecision);
+
+					m_buffer.append(digits, result.ptr);
+				}
+				else if constexpr ( std::is_convertible_v< const data_t &, std::string_view > )
+				{
+					m_buffer.append(std::string_view{value});
+				}
+				else
+				{
+					std::ostringstream stream;
+					stream << value;
+
+					m_buffer.append(stream.view());
+				}
+
+				return *this;
+			}
+
+			/**
+			 * @brief Returns a view on the content.
+			 * @return std::string_view
+			 */
+			[[nodiscard]]
+			std::string_view
+			view () const noexcept
+			{
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Returns a copy of the content.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string
+			str () const noexcept
+			{
+				return m_buffer;
+			}
+
+			/**
+			 * @brief Moves the content out of the buffer.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string
+			take () noexcept
+			{
+				return std::move(m_buffer);
+			}
+
+			/**
+			 * @brief Returns the content size in bytes.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			size () const noexcept
+			{
+				return m_buffer.size();
+			}
+
+			/**
+			 * @brief Returns whether the buffer is empty.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			empty () const noexcept
+			{
+				return m_buffer.empty();
+			}
+
+			/**
+			 * @brief Reserves memory for the content.
+			 * @param capacity The capacity in bytes.
+			 * @return void
+			 */
+			void
+			reserve (size_t capacity) noexcept
+			{
+				m_buffer.reserve(capacity);
+			}
+
+			/**
+			 * @brief Clears the content and keeps the memory.
+			 * @return void
+			 */
+			void
+			clear () noexcept
+			{
+				m_buffer.clear();
+			}
+
+			/**
+			 * @brief Returns a code buffer over a storage from the calling thread pool.
+			 * @note Give it back with CodeBuffer::recycle() to reuse its memory.
+			 * @return CodeBuffer
+			 */
+			[[nodiscard]]
+			static CodeBuffer borrow () noexcept;
+
+			/**
+			 * @brief Gives the storage of a code buffer back to the calling thread pool.
+			 * @param buffer A reference to the code buffer. It is left empty.
+			 * @return void
+			 */
+			static void recycle (CodeBuffer && buffer) noexcept;
+
+		private:
+
+			std::string m_buffer;
+	};
+}
@@ -26,65 +26,53 @@
 
 #include "CodeGeneratorInterface.hpp"
 
-/* STL inclusions. */
-#include <sstream>
-
 namespace EmEn::Saphir
 {
 	void
 	CodeGeneratorInterface::addComment (const std::string & comment, size_t depth) noexcept
 	{
-		std::stringstream commentStream;
-		commentStream << std::string(depth, '\t') << "/* " << comment << " */\n";
-
-		m_instructions.emplace_back(commentStream.str());
+		m_instructions.append(depth, '\t');
+		m_instructions.append("/* ");
+		m_instructions.append(comment);
+		m_instructions.append(" */\n");
 	}
 
 	std::string
 	CodeGeneratorInterface::getCode (const std::string & prependTopInstructions, const std::string & prependOutputInstructions) const noexcept
 	{
-		std::stringstream code{};
+		constexpr std::string_view TopHeader{"\t" "/* Preparation instructions */" "\n"};
+		constexpr std::string_view MainHeader{"\t" "/* Main instructions */" "\n"};
+		constexpr std::string_view OutputHeader{"\t" "/* Output instructions */" "\n"};
+
+		std::string code;
+		code.reserve(
+			TopHeader.size() + prependTopInstructions.size() + m_topInstructions.size() + 1 +
+			MainHeader.size() + m_instructions.size() + 1 +
+			OutputHeader.size() + prependOutputInstructions.size() + m_outputInstructions.size()
+		);
 
 		if ( !prependTopInstructions.empty() || !m_topInstructions.empty() )
 		{
-			code <<
-				"\t" "/* Preparation instructions */" "\n" <<
-
-				prependTopInstructions;
-
-			for (  const auto & line : m_topInstructions )
-			{
-				code << line;
-			}
-
-			code << '\n';
+			code.append(TopHeader);
+			code.append(prependTopInstructions);
+			code.append(m_topInstructions);
+			code.push_back('\n');
 		}
 
 		if ( !m_instructions.empty() )
 		{
-			code << "\t" "/* Main instructions */" "\n";
-
-			for (  const auto & line : m_instructions )
-			{
-				code << line;
-			}
-
-			code << '\n';
+			code.append(MainHeader);
+			code.append(m_instructions);
+			code.push_back('\n');
 		}
 
 		if ( !prependOutputInstructions.empty() || !m_outputInstructions.empty() )
 		{
-			code <<
-				"\t" "/* Output instructions */" "\n" <<
-
-				prependOutputInstructions;
-
-			for (  const auto & line : m_outputInstructions )
-			{
-				code << line;
-			}
+			code.append(OutputHeader);
+			code.append(prependOutputInstructions);
+			code.append(m_outputInstructions);
 		}
 
-		return code.str();
+		return code;
 	}
 }
@@ -31,7 +31,7 @@
 
 /* STL inclusions. */
 #include <string>
-#include <vector>
+#include <string_view>
 
 namespace EmEn::Saphir
 {
@@ -75,38 +75,38 @@ namespace EmEn::Saphir
 
 			/**
 			 * @brief Appends a line of instruction to the main() shader method at top-level.
-			 * @param code A string of code execution.
+			 * @param code A view on a string of code execution.
 			 * @return void
 			 */
 			virtual
 			void
-			addTopInstruction (const std::string & code) noexcept
+			addTopInstruction (std::string_view code) noexcept
 			{
-				m_topInstructions.emplace_back(code);
+				m_topInstructions.append(code);
 			}
 
 			/**
 			 * @brief Appends a line of instruction to the main() shader method.
-			 * @param code A reference to a string.
+			 * @param code A view on a string.
 			 * @return void
 			 */
 			virtual
 			void
-			addInstruction (const std::string & code) noexcept
+			addInstruction (std::string_view code) noexcept
 			{
-				m_instructions.emplace_back(code);
+				m_instructions.append(code);
 			}
 
 			/**
 			 * @brief Appends a line of instruction at the bottom of main() shader method.
-			 * @param code A string of code execution.
+			 * @param code A view on a string of code execution.
 			 * @return void
 			 */
 			virtual
 			void
-			addOutputInstruction (const std::string & code) noexcept
+			addOutputInstruction (std::string_view code) noexcept
 			{
-				m_outputInstructions.emplace_back(code);
+				m_outputInstructions.append(code);
 			}
 
 			/**
@@ -135,9 +135,9 @@ namespace EmEn::Saphir
 
 		private:
 
-			/* main() code. */
-			std::vector< std::string > m_topInstructions;
-			std::vector< std::string > m_instructions;
-			std::vector< std::string > m_outputInstructions;
+			/* main() code. NOTE: Instructions are appended in place, one contiguous string per location. */
+			std::string m_topInstructions;
+			std::string m_instructions;
+			std::string m_outputInstructions;
 	};
 }
@@ -29,7 +29,7 @@
 namespace EmEn::Saphir
 {
 	bool
-	ComputeShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, std::stringstream & /*code*/, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
+	ComputeShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, CodeBuffer & /*code*/, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
 	{
 		/* Specific input shader code declarations. */
 
@@ -28,10 +28,10 @@
 
 /* STL inclusions. */
 #include <ranges>
-#include <sstream>
 
 /* Local inclusions. */
 #include "BaseUtility.hpp"
+#include "Saphir/CodeBuffer.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Saphir::Declaration
@@ -219,7 +219,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	AbstractBufferBackedBlock::getLayoutQualifier () const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << GLSL::Layout << " (";
 
@@ -259,6 +259,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << GLSL::Set << " = " << m_set << ", " << GLSL::Binding << " = " << m_binding << ") ";
 
-		return code.str();
+		return code.take();
 	}
 }
@@ -26,10 +26,8 @@
 
 #include "Function.hpp"
 
-/* STL inclusions. */
-#include <sstream>
-
 /* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 #include "String.hpp"
 
 namespace EmEn::Saphir::Declaration
@@ -40,7 +38,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	Function::sourceCode () const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code <<
 			m_returnType << ' ' << m_name << " (" << ( m_parameters.empty() ? GLSL::Void : String::implode(m_parameters, ", ") ) << ")" "\n"
@@ -48,13 +46,13 @@ namespace EmEn::Saphir::Declaration
 			this->getCode() <<
 			"}" "\n";
 
-		return code.str();
+		return code.take();
 	}
 
 	void
 	Function::addInParameter (Key type, Key name, bool isConstant) noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		if ( isConstant )
 		{
@@ -63,17 +61,17 @@ namespace EmEn::Saphir::Declaration
 
 		code << GLSL::In << ' ' << type << ' ' << name;
 
-		m_parameters.emplace_back(code.str());
+		m_parameters.emplace_back(code.take());
 	}
 
 	std::string
 	Function::callCode (const std::string & parameters) const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		code << m_name << '(' << parameters << ')';
 
-		return code.str();
+		return code.take();
 	}
 
 	std::string
@@ -35,6 +35,7 @@
 
 /* Local inclusions for usages. */
 #include "BlobTrait.hpp"
+#include "../CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -126,7 +127,7 @@ namespace EmEn::Saphir::Declaration
 			void
 			addOutParameter (Key type, Key name) noexcept
 			{
-				m_parameters.emplace_back((std::stringstream{} << Keys::GLSL::Out << ' ' << type << ' ' << name).str());
+				m_parameters.emplace_back((CodeBuffer{} << Keys::GLSL::Out << ' ' << type << ' ' << name).take());
 			}
 
 			/**
@@ -137,7 +138,7 @@ namespace EmEn::Saphir::Declaration
 			void
 			addInOutParameter (Key type, Key name) noexcept
 			{
-				m_parameters.emplace_back((std::stringstream{} << Keys::GLSL::InOut << ' ' << type << ' ' << name).str());
+				m_parameters.emplace_back((CodeBuffer{} << Keys::GLSL::InOut << ' ' << type << ' ' << name).take());
 			}
 
 			/**
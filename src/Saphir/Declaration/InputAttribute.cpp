@@ -26,8 +26,8 @@
 
 #include "InputAttribute.hpp"
 
-/* STL inclusions. */
-#include <sstream>
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -151,7 +151,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	InputAttribute::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		code <<
 			GLSL::Layout << " (" << GLSL::Location << " = " << std::to_string(m_location) << ") " <<
@@ -164,7 +164,7 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 
 	bool
@@ -29,10 +29,10 @@
 /* STL inclusions. */
 #include <limits>
 #include <ranges>
-#include <sstream>
 
 /* Local inclusions. */
 #include "OutputBlock.hpp"
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -41,7 +41,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	InputBlock::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* Check if structure are requested. */
 		const auto & structures = this->structureDeclaration();
@@ -81,6 +81,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
@@ -26,8 +26,8 @@
 
 #include "BufferBackedBlock.hpp"
 
-/* STL inclusions. */
-#include <sstream>
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration::Member
 {
@@ -48,7 +48,7 @@ namespace EmEn::Saphir::Declaration::Member
 	std::string
 	BufferBackedBlock::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		if ( m_layout != nullptr )
 		{
@@ -64,6 +64,6 @@ namespace EmEn::Saphir::Declaration::Member
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
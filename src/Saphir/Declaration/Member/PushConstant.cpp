@@ -26,8 +26,8 @@
 
 #include "PushConstant.hpp"
 
-/* STL inclusions. */
-#include <sstream>
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration::Member
 {
@@ -46,7 +46,7 @@ namespace EmEn::Saphir::Declaration::Member
 	std::string
 	PushConstant::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		code << to_cstring(m_type) << ' ' << m_name;
 
@@ -57,6 +57,6 @@ namespace EmEn::Saphir::Declaration::Member
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
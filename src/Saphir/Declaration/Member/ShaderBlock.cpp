@@ -26,8 +26,8 @@
 
 #include "ShaderBlock.hpp"
 
-/* STL inclusions. */
-#include <sstream>
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration::Member
 {
@@ -46,7 +46,7 @@ namespace EmEn::Saphir::Declaration::Member
 	std::string
 	ShaderBlock::sourceCode () const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		if ( m_interpolation != nullptr )
 		{
@@ -62,6 +62,6 @@ namespace EmEn::Saphir::Declaration::Member
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
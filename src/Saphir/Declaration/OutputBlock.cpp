@@ -29,7 +29,9 @@
 /* STL inclusions. */
 #include <limits>
 #include <ranges>
-#include <sstream>
+
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -38,7 +40,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	OutputBlock::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* Check if structure are requested. */
 		const auto & structures = this->structureDeclaration();
@@ -78,6 +80,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
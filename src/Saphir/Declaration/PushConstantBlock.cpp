@@ -28,10 +28,10 @@
 
 /* STL inclusions. */
 #include <ranges>
-#include <sstream>
 
 /* Local inclusions. */
 #include "BaseUtility.hpp"
+#include "Saphir/CodeBuffer.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Saphir::Declaration
@@ -128,7 +128,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	PushConstantBlock::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* Default Std430 */
 		code << GLSL::Layout << " (" << GLSL::PushConstant << ") " << GLSL::Uniform << ' ' << this->name() << "\n" "{" "\n";
@@ -147,6 +147,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
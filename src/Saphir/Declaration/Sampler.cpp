@@ -26,8 +26,8 @@
 
 #include "Sampler.hpp"
 
-/* STL inclusions. */
-#include <sstream>
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -36,7 +36,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	Sampler::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		code <<
 			GLSL::Layout << "(" << GLSL::Set << " = " << m_set << ", " << GLSL::Binding << " = " << m_binding << ") " <<
@@ -55,6 +55,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
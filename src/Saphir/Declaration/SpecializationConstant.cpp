@@ -26,8 +26,8 @@
 
 #include "SpecializationConstant.hpp"
 
-/* STL inclusions. */
-#include <sstream>
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -36,12 +36,12 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	SpecializationConstant::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		code <<
 			GLSL::Layout << "(" << GLSL::ConstantId << " = " << m_constantId << ")" << ' ' <<
 			GLSL::Const << ' ' << m_type << ' ' << m_name << " = " << m_defaultValue << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
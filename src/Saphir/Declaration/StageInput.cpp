@@ -26,10 +26,8 @@
 
 #include "StageInput.hpp"
 
-/* STL inclusions. */
-#include <sstream>
-
 /* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 #include "StageOutput.hpp"
 
 namespace EmEn::Saphir::Declaration
@@ -39,7 +37,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	StageInput::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		code << GLSL::Layout << " (" << GLSL::Location << " = " << m_location << ") ";
 
@@ -61,6 +59,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
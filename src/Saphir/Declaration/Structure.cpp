@@ -28,10 +28,10 @@
 
 /* STL inclusions. */
 #include <ranges>
-#include <sstream>
 
 /* Local inclusions. */
 #include "BaseUtility.hpp"
+#include "Saphir/CodeBuffer.hpp"
 #include "Tracer.hpp"
 
 namespace EmEn::Saphir::Declaration
@@ -61,7 +61,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	Structure::sourceCode () const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << GLSL::Struct << ' ' << m_name << "\n" "{" "\n";
 
@@ -79,6 +79,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
@@ -28,7 +28,9 @@
 
 /* STL inclusions. */
 #include <ranges>
-#include <sstream>
+
+/* Local inclusions. */
+#include "Saphir/CodeBuffer.hpp"
 
 namespace EmEn::Saphir::Declaration
 {
@@ -37,7 +39,7 @@ namespace EmEn::Saphir::Declaration
 	std::string
 	UniformBlock::sourceCode () const noexcept
 	{
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* Check if structure declarations are requested. */
 		const auto & structureDeclarations = this->structureDeclaration();
@@ -87,6 +89,6 @@ namespace EmEn::Saphir::Declaration
 
 		code << ";" "\n";
 
-		return code.str();
+		return code.take();
 	}
 }
@@ -201,7 +201,7 @@ namespace EmEn::Saphir
 	}
 
 	bool
-	FragmentShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, std::stringstream & code, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
+	FragmentShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, CodeBuffer & code, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
 	{
 		/* Specific input shader code declarations. */
 		AbstractShader::generateDeclarations(code, m_stageInputs, "Stage inputs (From previous stage)");
@@ -228,7 +228,7 @@ namespace EmEn::Saphir
 	Function
 	FragmentShader::generateToSRGBColorFunction () noexcept
 	{
-		std::stringstream functionCode;
+		CodeBuffer functionCode;
 
 		/* NOTE: Only convert RGB components, alpha channel is always linear. */
 		functionCode <<
@@ -240,7 +240,7 @@ namespace EmEn::Saphir
 
 		Function function{"toSRGBColor", GLSL::FloatVector4};
 		function.addInParameter(GLSL::FloatVector4, "linearRGB", true);
-		function.addInstruction(functionCode.str());
+		function.addInstruction(functionCode.view());
 
 		return function;
 	}
@@ -248,7 +248,7 @@ namespace EmEn::Saphir
 	Function
 	FragmentShader::generateToLinearColorFunction () noexcept
 	{
-		std::stringstream functionCode;
+		CodeBuffer functionCode;
 
 		/* NOTE: Only convert RGB components, alpha channel is always linear. */
 		functionCode <<
@@ -260,7 +260,7 @@ namespace EmEn::Saphir
 
 		Function function{"toLinearColor", GLSL::FloatVector4};
 		function.addInParameter(GLSL::FloatVector4, "sRGB", true);
-		function.addInstruction(functionCode.str());
+		function.addInstruction(functionCode.view());
 
 		return function;
 	}
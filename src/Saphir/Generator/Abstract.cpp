@@ -26,7 +26,15 @@
 
 #include "Abstract.hpp"
 
+/* STL inclusions. */
+#include <mutex>
+
 /* Local inclusions. */
+#include "Graphics/Geometry/Interface.hpp"
+#include "Graphics/Material/Interface.hpp"
+#include "Graphics/ProgramPreparationQueue.hpp"
+#include "Graphics/RasterizationOptions.hpp"
+#include "Graphics/RenderTarget/Abstract.hpp"
 #include "Graphics/RenderableInstance/Abstract.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Graphics/Types.hpp"
@@ -34,6 +42,7 @@
 #include "Saphir/Code.hpp"
 #include "Tracer.hpp"
 #include "Vulkan/Framebuffer.hpp"
+#include "Vulkan/RenderPass.hpp"
 
 namespace EmEn::Saphir::Generator
 {
@@ -191,6 +200,15 @@ namespace EmEn::Saphir::Generator
 
 				return false;
 			}
+
+			/* NOTE: The specialization constants belong to the pipeline, the shader modules are shared
+			 * between every program generating the same source code (See LightGenerator uber-shaders). */
+			if ( !graphicsPipeline->configureSpecializationConstants(VK_SHADER_STAGE_FRAGMENT_BIT, m_shaderProgram->fragmentSpecializationConstants()) )
+			{
+				Tracer::error(TracerTag, "Unable to configure the graphics pipeline specialization constants !");
+
+				return false;
+			}
 		}
 
 		const auto & vertexBufferFormat = *m_shaderProgram->vertexBufferFormat();
@@ -284,13 +302,112 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
+	void
+	Abstract::addRenderTargetToKey (ProgramKeyBuilder & key) const noexcept
+	{
+		const auto * framebuffer = m_pipelineFramebuffer != nullptr ? m_pipelineFramebuffer : m_renderTarget->framebuffer();
+
+		/* NOTE: The render pass is baked into the pipeline. Its structure is used, not its handle:
+		 * a pipeline can be used with any compatible render pass, and a handle can be reused by a new render pass. */
+		if ( framebuffer != nullptr )
+		{
+			key.add(true);
+
+			framebuffer->renderPass()->visitCompatibilityInputs([&key] (uint64_t input) {
+				key.add(input);
+			});
+		}
+		else
+		{
+			key.add(false);
+		}
+
+		key.add(m_renderTarget->isCubemap());
+	}
+
+	void
+	Abstract::addGeometryToKey (ProgramKeyBuilder & key) const noexcept
+	{
+		if ( this->isRenderableInstanceAvailable() )
+		{
+			/* NOTE: The vertex buffer format is created from the first LOD, see generateShaderProgram(). */
+			if ( const auto * geometry = this->getGeometryInterface(); geometry != nullptr )
+			{
+				key.add(geometry->topology()).add(geometry->flags());
+			}
+			else
+			{
+				key.add(0U).add(0U);
+			}
+
+			if ( const auto * options = m_renderableInstance->renderable()->layerRasterizationOptions(m_layerIndex); options != nullptr )
+			{
+				key.add(true)
+					.add(options->polygonMode())
+					.add(options->cullingMode())
+					.add(options->isTriangleClockwise())
+					.add(options->isDepthBiasEnabled())
+					.add(options->depthBiasConstantFactor())
+					.add(options->depthBiasClamp())
+					.add(options->depthBiasSlopeFactor());
+			}
+			else
+			{
+				key.add(false);
+			}
+
+			key.add(m_renderableInstance->isDepthTestDisabled()).add(m_renderableInstance->isDepthWriteDisabled());
+		}
+		else
+		{
+			key.add(m_topology).add(m_geometryFlags);
+		}
+
+		key.add(m_layerIndex).add(this->flags());
+	}
+
+	void
+	Abstract::addMaterialToKey (ProgramKeyBuilder & key) const noexcept
+	{
+		if ( !this->materialEnabled() )
+		{
+			key.add(false);
+
+			return;
+		}
+
+		key.add(true);
+
+		this->getMaterialInterface()->appendProgramKey(key);
+	}
+
+	bool
+	Abstract::generateShadersCode (const std::string & GLSLVersion, const std::string & GLSLProfile) noexcept
+	{
+		m_shaderProgram = std::make_shared< Program >(this->name(), GLSLVersion, GLSLProfile);
+
+		this->prepareUniformSets(m_shaderProgram->setIndexes());
+
+		return this->onGenerateShadersCode(*m_shaderProgram);
+	}
+
 	bool
 	Abstract::generateShaderProgram (Renderer & renderer, const std::string & GLSLVersion, const std::string & GLSLProfile) noexcept
 	{
 		/* NOTE: Check if we have a cached program with the same configuration.
-		 * This avoids redundant shader generation for identical renderable instances. */
+		 * The key comes from the generator inputs only, so a warm cache skips the whole
+		 * GLSL generation, for identical renderable instances as for distinct renderables
+		 * sharing a geometry format and a material signature. */
 		const auto programCacheKey = this->computeProgramCacheKey();
 
+		/* NOTE: Generations run on the render thread and on the program preparation tasks.
+		 * Only the generations of the same program are serialized, the renderer caches, the
+		 * shader manager and the layout manager have their own locks. Holding the lock across
+		 * the cache lookup makes an identical program requested by two tasks compiled once,
+		 * the second one reuses it. */
+		const auto generationAccess = renderer.programGenerationAccess(programCacheKey);
+		const std::lock_guard< std::recursive_mutex > generationLock{*generationAccess};
+
 		if ( auto cachedProgram = renderer.findCachedProgram(programCacheKey); cachedProgram != nullptr )
 		{
 			bool isCompatible = true;
@@ -383,6 +500,15 @@ namespace EmEn::Saphir::Generator
 			return false;
 		}
 
+		/* NOTE: Warm the shader modules of every stage up at once, the missing ones compile in parallel.
+		 * A preparation task already runs on the thread pool and keeps the sequential path below. */
+		if ( !ProgramPreparationQueue::isPreparationThread() )
+		{
+			const auto shaderList = m_shaderProgram->getShaderList();
+
+			static_cast< void >(renderer.shaderManager().prepareShaderModules(renderer.device(), {shaderList.cbegin(), shaderList.cend()}));
+		}
+
 		/* NOTE: The third step is to check if separate shaders already exist to avoid an extra compilation.
 		 * Retrieve the graphics pipeline for the combination of the current renderable instance layer and the render pass. */
 		if ( !this->createGraphicsPipeline(renderer) )
@@ -392,7 +518,7 @@ namespace EmEn::Saphir::Generator
 		}
 
 		/* NOTE: Cache the program for future reuse by identical renderable instances. */
-		renderer.cacheProgram(programCacheKey, m_shaderProgram);
+		renderer.cacheProgram(programCacheKey, m_shaderProgram, this->classLabel());
 
 		return true;
 	}
@@ -40,6 +40,7 @@
 #include "Graphics/RenderableInstance/Abstract.hpp"
 #include "StaticVector.hpp"
 #include "Saphir/Program.hpp"
+#include "Saphir/ProgramKey.hpp"
 
 namespace EmEn
 {
@@ -478,6 +479,17 @@ namespace EmEn::Saphir::Generator
 			[[nodiscard]]
 			bool generateShaderProgram (Graphics::Renderer & renderer, const std::string & GLSLVersion = DefaultGLSLVersion, const std::string & GLSLProfile = DefaultGLSLProfile) noexcept;
 
+			/**
+			 * @brief Generates the GLSL source code of the shader program only.
+			 * @note No cache lookup, no compilation, no layout and no pipeline. This is used to measure
+			 * and inspect the code generation, the program is available with shaderProgram() afterward.
+			 * @param GLSLVersion The GLSL version in use. Default "460".
+			 * @param GLSLProfile The GLSL profile in use. Default "core".
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool generateShadersCode (const std::string & GLSLVersion = DefaultGLSLVersion, const std::string & GLSLProfile = DefaultGLSLProfile) noexcept;
+
 			/**
 			 * @brief Sets an override framebuffer for pipeline creation.
 			 * @note When set, createGraphicsPipeline() uses this framebuffer's render pass
@@ -511,11 +523,21 @@ namespace EmEn::Saphir::Generator
 
 			/**
 			 * @brief Computes a unique cache key for the shader program configuration.
-			 * @note This allows early lookup before shader generation to avoid redundant work.
-			 * @return size_t The unique hash identifying this program configuration.
+			 * @note The key is derived from the semantic inputs only (material signature, geometry format,
+			 * render pass, generator flags and options), so a cached program is found before any GLSL is
+			 * generated. Two renderables sharing the same inputs share the same program.
+			 * @return ProgramKey The 128-bit key identifying this program configuration.
+			 */
+			[[nodiscard]]
+			virtual ProgramKey computeProgramCacheKey () const noexcept = 0;
+
+			/**
+			 * @brief Returns the class label of the generator.
+			 * @note The program name can be customized, this label identifies the generator itself.
+			 * @return const char *
 			 */
 			[[nodiscard]]
-			virtual size_t computeProgramCacheKey () const noexcept = 0;
+			virtual const char * classLabel () const noexcept = 0;
 
 		protected:
 
@@ -600,6 +622,30 @@ namespace EmEn::Saphir::Generator
 
 			}
 
+			/**
+			 * @brief Adds the render target inputs to a program key.
+			 * @note The render pass structure (from the pipeline framebuffer override when set) through RenderPass::visitCompatibilityInputs(), and the cubemap state.
+			 * @param key A reference to the key builder.
+			 * @return void
+			 */
+			void addRenderTargetToKey (ProgramKeyBuilder & key) const noexcept;
+
+			/**
+			 * @brief Adds the geometry inputs to a program key.
+			 * @note The topology and the geometry flags, which give the vertex buffer format, the layer
+			 * rasterization options, the layer index and the generator flags.
+			 * @param key A reference to the key builder.
+			 * @return void
+			 */
+			void addGeometryToKey (ProgramKeyBuilder & key) const noexcept;
+
+			/**
+			 * @brief Adds the material signature to a program key, when a material is used.
+			 * @param key A reference to the key builder.
+			 * @return void
+			 */
+			void addMaterialToKey (ProgramKeyBuilder & key) const noexcept;
+
 			/**
 			 * @brief Generates the fall-back vertex shader stage of the graphics pipeline.
 			 * @param program A reference to the program being constructed.
@@ -28,7 +28,6 @@
 
 /* Local inclusions. */
 #include "Graphics/RenderTarget/Abstract.hpp"
-#include "Hash/FNV1a.hpp"
 #include "Saphir/Code.hpp"
 #include "Vulkan/Framebuffer.hpp"
 #include "Vulkan/RenderPass.hpp"
@@ -251,33 +250,17 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
-	size_t
+	ProgramKey
 	GizmoRendering::computeProgramCacheKey () const noexcept
 	{
-		const auto hashCombine = [] (size_t & seed, size_t value) noexcept {
-			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		};
+		ProgramKeyBuilder key{ClassId};
 
-		size_t hash = Hash::FNV1a(ClassId);
+		/* 1. Render pass structure and render target type. */
+		this->addRenderTargetToKey(key);
 
-		/* 1. Render pass handle (critical for pipeline compatibility). */
-		{
-			const auto * fb = this->pipelineFramebuffer();
-
-			if ( fb == nullptr )
-			{
-				fb = this->renderTarget()->framebuffer();
-			}
-
-			if ( fb != nullptr )
-			{
-				hashCombine(hash, reinterpret_cast< size_t >(fb->renderPass()->handle()));
-			}
-		}
-
-		/* 2. Render target type. */
-		hashCombine(hash, static_cast< size_t >(this->renderTarget()->isCubemap()));
+		/* 2. Topology and geometry flags. */
+		this->addGeometryToKey(key);
 
-		return hash;
+		return key.key();
 	}
 }
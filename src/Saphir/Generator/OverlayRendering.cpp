@@ -28,7 +28,6 @@
 
 /* Local inclusions. */
 #include "Graphics/RenderTarget/Abstract.hpp"
-#include "Hash/FNV1a.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Overlay/Manager.hpp"
 #include "Saphir/Code.hpp"
@@ -247,41 +246,20 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
-	size_t
+	ProgramKey
 	OverlayRendering::computeProgramCacheKey () const noexcept
 	{
-		/* NOTE: Helper function to combine hash values (boost::hash_combine style). */
-		const auto hashCombine = [] (size_t & seed, size_t value) noexcept {
-			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		};
+		ProgramKeyBuilder key{ClassId};
 
-		size_t hash = Hash::FNV1a(ClassId);
+		/* 1. Render pass structure (from the pipeline framebuffer override when set) and render target type. */
+		this->addRenderTargetToKey(key);
 
-		/* 1. Render pass handle (critical for pipeline compatibility).
-		 * Use the pipeline framebuffer override if set, otherwise the render target's. */
-		{
-			const auto * fb = this->pipelineFramebuffer();
-
-			if ( fb == nullptr )
-			{
-				fb = this->renderTarget()->framebuffer();
-			}
-
-			if ( fb != nullptr )
-			{
-				hashCombine(hash, reinterpret_cast< size_t >(fb->renderPass()->handle()));
-			}
-		}
-
-		/* 2. Render target type (cubemap vs single layer). */
-		hashCombine(hash, static_cast< size_t >(this->renderTarget()->isCubemap()));
-
-		/* 3. Premultiplied alpha mode. */
-		hashCombine(hash, static_cast< size_t >(m_premultipliedAlpha));
+		/* 2. Topology and geometry flags. */
+		this->addGeometryToKey(key);
 
-		/* 4. BGRA source format. */
-		hashCombine(hash, static_cast< size_t >(m_isBGRASurface));
+		/* 3. Premultiplied alpha mode and BGRA source format. */
+		key.add(m_premultipliedAlpha).add(m_isBGRASurface);
 
-		return hash;
+		return key.key();
 	}
 }
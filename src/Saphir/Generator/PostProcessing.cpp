@@ -31,7 +31,6 @@
 #include "Graphics/PostProcessor.hpp"
 #include "Graphics/RenderTarget/Abstract.hpp"
 #include "Graphics/Renderer.hpp"
-#include "Hash/FNV1a.hpp"
 #include "SourceCodeParser.hpp"
 #include "Saphir/Code.hpp"
 #include "Vulkan/Framebuffer.hpp"
@@ -332,41 +331,28 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
-	size_t
+	ProgramKey
 	PostProcessing::computeProgramCacheKey () const noexcept
 	{
-		const auto hashCombine = [] (size_t & seed, size_t value) noexcept {
-			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		};
+		ProgramKeyBuilder key{ClassId};
 
-		size_t hash = Hash::FNV1a(ClassId);
+		/* Render pass structure (from the pipeline framebuffer override when set, see RenderPass::visitCompatibilityInputs()) and render target type. */
+		this->addRenderTargetToKey(key);
 
-		/* Render pass handle (critical for pipeline compatibility). */
-		{
-			const auto * fb = this->pipelineFramebuffer();
-
-			if ( fb == nullptr )
-			{
-				fb = this->renderTarget()->framebuffer();
-			}
-
-			if ( fb != nullptr )
-			{
-				hashCombine(hash, reinterpret_cast< size_t >(fb->renderPass()->handle()));
-			}
-		}
+		/* Topology and geometry flags of the fullscreen geometry. */
+		this->addGeometryToKey(key);
 
-		/* Include each effect instance's identity in the hash.
-		 * Using the object address guarantees uniqueness: each call to setEffectsList()
-		 * creates new shared_ptr instances, so different parameter sets always produce
-		 * different cache keys — even when the effect types are identical. */
-		hashCombine(hash, m_effectsList.size());
+		/* NOTE: Each effect instance is keyed by its pointer, not by its parameters.
+		 * The effects write their parameters into the generated code and expose no descriptor,
+		 * so the object address stays the input: each call to setEffectsList() creates new
+		 * shared_ptr instances, so different parameter sets always produce different keys. */
+		key.add(m_effectsList.size());
 
 		for ( const auto & effect : m_effectsList )
 		{
-			hashCombine(hash, reinterpret_cast< size_t >(effect.get()));
+			key.add(static_cast< const void * >(effect.get()));
 		}
 
-		return hash;
+		return key.key();
 	}
 }
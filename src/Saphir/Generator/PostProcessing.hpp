@@ -56,9 +56,17 @@ namespace EmEn::Saphir::Generator
 
 			}
 
+			/** @copydoc EmEn::Saphir::Generator::Abstract::classLabel() const */
+			[[nodiscard]]
+			const char *
+			classLabel () const noexcept override
+			{
+				return ClassId;
+			}
+
 			/** @copydoc EmEn::Saphir::Generator::Abstract::computeProgramCacheKey() */
 			[[nodiscard]]
-			size_t computeProgramCacheKey () const noexcept override;
+			ProgramKey computeProgramCacheKey () const noexcept override;
 
 			/**
 			 * @brief Sets the list of framebuffer effects for shader generation.
@@ -31,7 +31,6 @@
 #include "Graphics/Material/Interface.hpp"
 #include "Graphics/RenderTarget/Abstract.hpp"
 #include "Graphics/Renderer.hpp"
-#include "Hash/FNV1a.hpp"
 #include "SourceCodeParser.hpp"
 #include "Saphir/Code.hpp"
 #include "Scenes/Scene.hpp"
@@ -785,54 +784,23 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
-	size_t
+	ProgramKey
 	SceneRendering::computeProgramCacheKey () const noexcept
 	{
-		/* NOTE: Helper function to combine hash values (boost::hash_combine style). */
-		const auto hashCombine = [] (size_t & seed, size_t value) noexcept {
-			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		};
+		ProgramKeyBuilder key{ClassId};
 
-		size_t hash = 0;
+		/* 1. Render pass structure and render target type (cubemap vs single layer). */
+		this->addRenderTargetToKey(key);
 
-		/* 1. Render pass handle (critical for pipeline compatibility). */
-		if ( const auto * framebuffer = this->renderTarget()->framebuffer(); framebuffer != nullptr )
-		{
-			hashCombine(hash, reinterpret_cast< size_t >(framebuffer->renderPass()->handle()));
-		}
-
-		/* 2. Render target type (cubemap vs single layer). */
-		hashCombine(hash, static_cast< size_t >(this->renderTarget()->isCubemap()));
-
-		/* 3. Renderable identity (geometry + material combination via resource name). */
-		if ( this->isRenderableInstanceAvailable() )
-		{
-			const auto * renderable = this->getRenderable();
-
-			if ( renderable != nullptr )
-			{
-				hashCombine(hash, Hash::FNV1a(renderable->name()));
-			}
-		}
-
-		/* 4. Layer index. */
-		hashCombine(hash, static_cast< size_t >(this->layerIndex()));
+		/* 2. Geometry format, layer rasterization and generator flags (instancing, lighting, facing camera, etc.). */
+		this->addGeometryToKey(key);
 
-		/* 5. Render pass type. */
-		hashCombine(hash, static_cast< size_t >(m_renderPassType));
+		/* 3. Render pass type, it carries the light type of the light passes. */
+		key.add(m_renderPassType);
 
-		/* 6. Generator flags (instancing, lighting, facing camera, etc.). */
-		hashCombine(hash, static_cast< size_t >(this->flags()));
-
-		/* 7. Material layout signature to separate incompatible pipelines (e.g. Standard Refl/Refract). */
-		if ( this->materialEnabled() )
-		{
-			if ( const auto & layout = this->getMaterialInterface()->descriptorSetLayout(); layout != nullptr )
-			{
-				hashCombine(hash, layout->getHash());
-			}
-		}
+		/* 4. Material signature (class, flags, components, options and layout). */
+		this->addMaterialToKey(key);
 
-		return hash;
+		return key.key();
 	}
 }
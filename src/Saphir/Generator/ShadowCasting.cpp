@@ -30,7 +30,6 @@
 #include "Graphics/Material/Interface.hpp"
 #include "Graphics/RenderTarget/Abstract.hpp"
 #include "Graphics/Renderer.hpp"
-#include "Hash/FNV1a.hpp"
 #include "SourceCodeParser.hpp"
 #include "Saphir/Code.hpp"
 #include "SkinningLayoutHelper.hpp"
@@ -391,55 +390,31 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
-	size_t
+	ProgramKey
 	ShadowCasting::computeProgramCacheKey () const noexcept
 	{
-		/* NOTE: Helper function to combine hash values (boost::hash_combine style). */
-		const auto hashCombine = [] (size_t & seed, size_t value) noexcept {
-			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		};
+		ProgramKeyBuilder key{ClassId};
 
-		size_t hash = Hash::FNV1a(ClassId);
+		/* 1. Render pass structure and render target type (cubemap vs single layer vs CSM). */
+		this->addRenderTargetToKey(key);
 
-		/* 1. Render pass handle (critical for pipeline compatibility). */
-		if ( const auto * framebuffer = this->renderTarget()->framebuffer(); framebuffer != nullptr )
-		{
-			hashCombine(hash, reinterpret_cast< size_t >(framebuffer->renderPass()->handle()));
-		}
+		key.add(this->renderTarget()->isCascadedShadowMap());
 
-		/* 2. Render target type (cubemap vs single layer vs CSM). */
-		hashCombine(hash, static_cast< size_t >(this->renderTarget()->isCubemap()));
-		hashCombine(hash, static_cast< size_t >(this->renderTarget()->isCascadedShadowMap()));
+		/* 2. Geometry format, layer rasterization and generator flags (instancing, facing camera). */
+		this->addGeometryToKey(key);
 
-		/* 3. Renderable identity (geometry combination via resource name). */
-		if ( this->isRenderableInstanceAvailable() )
+		/* 3. Alpha-tested shadows state, the material only matters in that case. */
+		if ( this->needsAlphaTestedShadows() )
 		{
-			const auto * renderable = this->getRenderable();
+			key.add(true);
 
-			if ( renderable != nullptr )
-			{
-				hashCombine(hash, Hash::FNV1a(renderable->name()));
-			}
+			this->addMaterialToKey(key);
 		}
-
-		/* 4. Layer index. */
-		hashCombine(hash, static_cast< size_t >(this->layerIndex()));
-
-		/* 5. Generator flags (instancing, facing camera). */
-		hashCombine(hash, static_cast< size_t >(this->flags()));
-
-		/* 6. Alpha-tested shadows state and material layout. */
-		if ( this->needsAlphaTestedShadows() )
+		else
 		{
-			hashCombine(hash, 1ULL);
-
-			/* Include material layout signature for alpha-tested shadows. */
-			if ( const auto & layout = this->getMaterialInterface()->descriptorSetLayout(); layout != nullptr )
-			{
-				hashCombine(hash, layout->getHash());
-			}
+			key.add(false);
 		}
 
-		return hash;
+		return key.key();
 	}
 }
@@ -28,7 +28,6 @@
 
 /* Local inclusions. */
 #include "Graphics/RenderTarget/Abstract.hpp"
-#include "Hash/FNV1a.hpp"
 #include "SourceCodeParser.hpp"
 #include "Saphir/Code.hpp"
 #include "Vulkan/Framebuffer.hpp"
@@ -181,7 +180,7 @@ namespace EmEn::Saphir::Generator
 
 		if ( this->isFlagEnabled(IsInstancingEnabled) )
 		{
-			modelViewProjectionMatrix = (std::stringstream{} << ShaderVariable::ModelViewProjectionMatrix << "[index]").str();
+			modelViewProjectionMatrix = (CodeBuffer{} << ShaderVariable::ModelViewProjectionMatrix << "[index]").take();
 		}
 		else
 		{
@@ -320,42 +319,17 @@ namespace EmEn::Saphir::Generator
 		return true;
 	}
 
-	size_t
+	ProgramKey
 	TBNSpaceRendering::computeProgramCacheKey () const noexcept
 	{
-		/* NOTE: Helper function to combine hash values (boost::hash_combine style). */
-		const auto hashCombine = [] (size_t & seed, size_t value) noexcept {
-			seed ^= value + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-		};
+		ProgramKeyBuilder key{ClassId};
 
-		size_t hash = Hash::FNV1a(ClassId);
+		/* 1. Render pass structure and render target type (cubemap vs single layer). */
+		this->addRenderTargetToKey(key);
 
-		/* 1. Render pass handle (critical for pipeline compatibility). */
-		if ( const auto * framebuffer = this->renderTarget()->framebuffer(); framebuffer != nullptr )
-		{
-			hashCombine(hash, reinterpret_cast< size_t >(framebuffer->renderPass()->handle()));
-		}
-
-		/* 2. Render target type (cubemap vs single layer). */
-		hashCombine(hash, static_cast< size_t >(this->renderTarget()->isCubemap()));
-
-		/* 3. Renderable identity (geometry combination via resource name). */
-		if ( this->isRenderableInstanceAvailable() )
-		{
-			const auto * renderable = this->getRenderable();
-
-			if ( renderable != nullptr )
-			{
-				hashCombine(hash, Hash::FNV1a(renderable->name()));
-			}
-		}
-
-		/* 4. Layer index. */
-		hashCombine(hash, static_cast< size_t >(this->layerIndex()));
-
-		/* 5. Generator flags (instancing, facing camera). */
-		hashCombine(hash, static_cast< size_t >(this->flags()));
+		/* 2. Geometry format, layer rasterization and generator flags (instancing, facing camera). */
+		this->addGeometryToKey(key);
 
-		return hash;
+		return key.key();
 	}
 }
@@ -236,7 +236,7 @@ namespace EmEn::Saphir
 	}
 
 	bool
-	GeometryShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, std::stringstream & code, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
+	GeometryShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, CodeBuffer & code, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
 	{
 		code <<
 			"/* Input primitive */" "\n" <<
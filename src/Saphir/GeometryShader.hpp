@@ -198,7 +198,7 @@ namespace EmEn::Saphir
 
 			/** @copydoc EmEn::Saphir::AbstractShader::onSourceCodeGeneration() */
 			[[nodiscard]]
-			bool onSourceCodeGeneration (Generator::Abstract & generator, std::stringstream & code, std::string & topInstructions, std::string & outputInstructions) noexcept override;
+			bool onSourceCodeGeneration (Generator::Abstract & generator, CodeBuffer & code, std::string & topInstructions, std::string & outputInstructions) noexcept override;
 
 			/** @copydoc EmEn::Saphir::AbstractShader::onGetDeclarationStats() */
 			void onGetDeclarationStats (std::stringstream & output) const noexcept override;
@@ -30,6 +30,7 @@
 #include <cstdint>
 #include <sstream>
 #include <string>
+#include <string_view>
 
 namespace EmEn::Saphir
 {
@@ -653,6 +654,14 @@ namespace EmEn::Saphir
 			constexpr auto UseShadow{"scUseShadow"};
 			/** @brief Specialization constant ID for shadow mapping (constant_id = 0). */
 			constexpr uint32_t UseShadowId{0};
+			/** @brief Specialization constant name for the PCF switch of the 2D shadow maps. */
+			constexpr auto UsePCF{"scUsePCF"};
+			/** @brief Specialization constant ID for the PCF switch (constant_id = 1). */
+			constexpr uint32_t UsePCFId{1};
+			/** @brief Specialization constant name for the PCF kernel half-size of the 2D shadow maps. */
+			constexpr auto PCFSample{"scPCFSample"};
+			/** @brief Specialization constant ID for the PCF kernel half-size (constant_id = 2). */
+			constexpr uint32_t PCFSampleId{2};
 		}
 
 		/** Vertex attributes naming convention. */
@@ -933,6 +942,27 @@ namespace EmEn::Saphir
 		}
 	}
 
+	/**
+	 * @brief Returns the "blockName.componentName" access string.
+	 * @note The helpers below are called for every generated instruction, this builds the string in a single allocation.
+	 * @param blockName The block name.
+	 * @param componentName The component name.
+	 * @return std::string
+	 */
+	[[nodiscard]]
+	inline
+	std::string
+	BlockMember (std::string_view blockName, std::string_view componentName) noexcept
+	{
+		std::string output;
+		output.reserve(blockName.size() + 1 + componentName.size());
+		output.append(blockName);
+		output.push_back('.');
+		output.append(componentName);
+
+		return output;
+	}
+
 	/**
 	* @brief Returns a variable from the current matrix push constant.
 	* @param componentName The push constant component name. See Keys::PushConstant::Component.
@@ -943,11 +973,7 @@ namespace EmEn::Saphir
 	std::string
 	MatrixPC (const char * componentName) noexcept
 	{
-		std::stringstream output;
-
-		output << Keys::PushConstant::Matrices << '.' << componentName;
-
-		return output.str();
+		return BlockMember(Keys::PushConstant::Matrices, componentName);
 	}
 
 	/**
@@ -960,11 +986,7 @@ namespace EmEn::Saphir
 	std::string
 	OverlayPC (const char * componentName) noexcept
 	{
-		std::stringstream output;
-
-		output << Keys::PushConstant::Overlay << '.' << componentName;
-
-		return output.str();
+		return BlockMember(Keys::PushConstant::Overlay, componentName);
 	}
 
 	/**
@@ -977,11 +999,7 @@ namespace EmEn::Saphir
 	std::string
 	PostProcessingPC (const char * componentName) noexcept
 	{
-		std::stringstream output;
-
-		output << Keys::PushConstant::PostProcessing << '.' << componentName;
-
-		return output.str();
+		return BlockMember(Keys::PushConstant::PostProcessing, componentName);
 	}
 
 	/**
@@ -995,18 +1013,24 @@ namespace EmEn::Saphir
 	std::string
 	ViewUB (const char * componentName, bool isCubemap) noexcept
 	{
-		std::stringstream output;
-
-		if ( isCubemap )
+		if ( !isCubemap )
 		{
-			output << Keys::UniformBlock::View << ".instance[" << Keys::GLSL::Vertex::In::ViewIndex << ']' << '.' << componentName;
-		}
-		else
-		{
-			output << Keys::UniformBlock::View << '.' << componentName;
+			return BlockMember(Keys::UniformBlock::View, componentName);
 		}
 
-		return output.str();
+		const std::string_view blockName{Keys::UniformBlock::View};
+		const std::string_view indexName{Keys::GLSL::Vertex::In::ViewIndex};
+		const std::string_view component{componentName};
+
+		std::string output;
+		output.reserve(blockName.size() + indexName.size() + component.size() + 12);
+		output.append(blockName);
+		output.append(".instance[");
+		output.append(indexName);
+		output.append("].");
+		output.append(component);
+
+		return output;
 	}
 
 	/**
@@ -1022,11 +1046,13 @@ namespace EmEn::Saphir
 	std::string
 	CubeViewUB (const char * memberName, const char * indexVariableName, const char * componentName) noexcept
 	{
-		std::stringstream output;
-
-		output << Keys::UniformBlock::View << '.' << memberName << '[' << indexVariableName << ']' << '.' << componentName;
+		std::string output{BlockMember(Keys::UniformBlock::View, memberName)};
+		output.push_back('[');
+		output.append(indexVariableName);
+		output.append("].");
+		output.append(componentName);
 
-		return output.str();
+		return output;
 	}
 
 	/**
@@ -1039,11 +1065,7 @@ namespace EmEn::Saphir
 	std::string
 	MaterialUB (const char * componentName) noexcept
 	{
-		std::stringstream output;
-
-		output << Keys::UniformBlock::Material << '.' << componentName;
-
-		return output.str();
+		return BlockMember(Keys::UniformBlock::Material, componentName);
 	}
 
 	/**
@@ -1056,10 +1078,6 @@ namespace EmEn::Saphir
 	std::string
 	LightUB (const char * componentName) noexcept
 	{
-		std::stringstream output;
-
-		output << Keys::UniformBlock::Light << '.' << componentName;
-
-		return output.str();
+		return BlockMember(Keys::UniformBlock::Light, componentName);
 	}
 }
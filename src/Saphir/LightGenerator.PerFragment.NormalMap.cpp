@@ -298,6 +298,13 @@ namespace EmEn::Saphir
 		{
 			fragmentShader.addComment("Compute the shadow influence over the light factor.");
 
+			const bool shadowSpecialized = this->isShadowSpecialized();
+
+			if ( shadowSpecialized )
+			{
+				Code{fragmentShader} << "if ( " << Keys::SpecializationConstant::UseShadow << " )" << Line::End << '{';
+			}
+
 			switch ( lightType )
 			{
 				case LightType::Directional :
@@ -315,13 +322,9 @@ namespace EmEn::Saphir
 							LightUB(UniformBlock::Component::CascadeCount)
 						) << Line::Blank;
 					}
-					else if ( m_PCFEnabled )
-					{
-						Code{fragmentShader} << this->generate2DShadowMapPCFCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::Blank;
-					}
 					else
 					{
-						Code{fragmentShader} << this->generate2DShadowMapCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::Blank;
+						Code{fragmentShader} << this->generate2DShadowMapResolutionCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::Blank;
 					}
 					break;
 
@@ -340,18 +343,16 @@ namespace EmEn::Saphir
 					break;
 
 				case LightType::Spot :
-					if ( m_PCFEnabled )
-					{
-						Code{fragmentShader} << this->generate2DShadowMapPCFCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
-					}
-					else
-					{
-						Code{fragmentShader} << this->generate2DShadowMapCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
-					}
+					Code{fragmentShader} << this->generate2DShadowMapResolutionCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
 					break;
 			}
 
 			Code{fragmentShader} << LightFactor << " *= shadowFactor;" << Line::End;
+
+			if ( shadowSpecialized )
+			{
+				Code{fragmentShader} << '}';
+			}
 		}
 
 		/* NOTE: Color projection. Default vec3(1.0) is a no-op on multiply.
@@ -305,9 +305,18 @@ namespace EmEn::Saphir
 		{
 			fragmentShader.addComment("Compute the shadow influence over the light factor.");
 
-			Code{fragmentShader} <<
-				"if ( diffuseFactor > 0.0 )" << Line::End <<
-				'{' << Line::End;
+			if ( this->isShadowSpecialized() )
+			{
+				Code{fragmentShader} <<
+					"if ( " << Keys::SpecializationConstant::UseShadow << " && diffuseFactor > 0.0 )" << Line::End <<
+					'{' << Line::End;
+			}
+			else
+			{
+				Code{fragmentShader} <<
+					"if ( diffuseFactor > 0.0 )" << Line::End <<
+					'{' << Line::End;
+			}
 
 			switch ( lightType )
 			{
@@ -326,13 +335,9 @@ namespace EmEn::Saphir
 							LightUB(UniformBlock::Component::CascadeCount)
 						) << Line::End;
 					}
-					else if ( m_PCFEnabled )
-					{
-						Code{fragmentShader} << '\t' << this->generate2DShadowMapPCFCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
-					}
 					else
 					{
-						Code{fragmentShader} << '\t' << this->generate2DShadowMapCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
+						Code{fragmentShader} << '\t' << this->generate2DShadowMapResolutionCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
 					}
 					break;
 
@@ -351,14 +356,7 @@ namespace EmEn::Saphir
 					break;
 
 				case LightType::Spot :
-					if ( m_PCFEnabled )
-					{
-						Code{fragmentShader} << '\t' << this->generate2DShadowMapPCFCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
-					}
-					else
-					{
-						Code{fragmentShader} << '\t' << this->generate2DShadowMapCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
-					}
+					Code{fragmentShader} << '\t' << this->generate2DShadowMapResolutionCode(Uniform::ShadowMapSampler, ShaderVariable::PositionLightSpace) << Line::End;
 					break;
 			}
 
@@ -124,41 +124,27 @@ namespace EmEn::Saphir
 	}
 
 	std::string
-	LightGenerator::generate2DShadowMapCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept
+	LightGenerator::generate2DShadowMapSamplingCode (const std::string & shadowMap, const std::string & fragmentPosition) noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		/* NOTE: Skip shadow calculation if outside the shadow map's valid depth range.
 		 * In clip space, z is in [0, w] range (Vulkan depth [0,1]).
 		 * z < 0 means before the near plane, z > w means beyond the far plane.
 		 * In both cases, the fragment is not covered by the shadow map, so no shadow. */
-
 		code <<
-			"/* Shadow map 2D resolution. */" "\n\n"
-
-			"float shadowFactor = 1.0;" "\n\n"
-
 			"if ( " << fragmentPosition << ".z >= 0.0 && " << fragmentPosition << ".z <= " << fragmentPosition << ".w )" "\n"
 			"{" "\n"
 			"shadowFactor = textureProj(" << shadowMap << ", " << fragmentPosition << ");" "\n\n"
 			"}" "\n\n";
 
-		if ( m_discardUnlitFragment )
-		{
-			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
-		}
-
-		return code.str();
+		return code.take();
 	}
 
 	std::string
-	LightGenerator::generate2DShadowMapPCFCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept
+	LightGenerator::generate2DShadowMapPCFSamplingCode (const std::string & shadowMap, const std::string & fragmentPosition, const std::string & kernelSize) const noexcept
 	{
-		std::stringstream code{};
-
-		code << "/* Shadow map 2D resolution (PCF). */" "\n\n";
-
-		code << "float shadowFactor = 1.0;" "\n\n";
+		CodeBuffer code{};
 
 		/* NOTE: Skip shadow calculation if outside the shadow map's valid depth range.
 		 * In clip space, z is in [0, w] range (Vulkan depth [0,1]).
@@ -176,7 +162,7 @@ namespace EmEn::Saphir
 			case PCFMethod::Grid :
 			{
 				code << 
-					GLSL::ConstInteger << " offset = " << m_PCFSample << ";" "\n\n"
+					GLSL::ConstInteger << " offset = " << kernelSize << ";" "\n\n"
 
 					"shadowFactor = 0.0;" "\n"
 					"for ( " << GLSL::Integer << " idy = -offset; idy <= offset; idy++ )" "\n"
@@ -195,15 +181,13 @@ namespace EmEn::Saphir
 			{
 				/* Vogel disk sampling with per-fragment rotation to break up patterns.
 				 * The golden angle (2.399963 rad) ensures optimal sample distribution. */
-				const auto sampleCount = (2 * m_PCFSample + 1) * (2 * m_PCFSample + 1);
-
 				code <<
 					"/* Vogel disk PCF with per-fragment rotation. */" "\n"
 					"const float goldenAngle = 2.399963;" "\n"
 					"const float rotationAngle = fract(sin(dot(gl_FragCoord.xy, vec2(12.9898, 78.233))) * 43758.5453) * 6.283185;" "\n"
 					"const float cosRot = cos(rotationAngle);" "\n"
 					"const float sinRot = sin(rotationAngle);" "\n"
-					"const int sampleCount = " << sampleCount << ";" "\n\n"
+					"const int sampleCount = (2 * " << kernelSize << " + 1) * (2 * " << kernelSize << " + 1);" "\n\n"
 
 					"shadowFactor = 0.0;" "\n"
 					"for ( int i = 0; i < sampleCount; i++ )" "\n"
@@ -262,13 +246,12 @@ namespace EmEn::Saphir
 				 * Each textureGather returns a 2x2 quad of comparison results.
 				 * NOTE: textureGather does NOT perform perspective division, so we must do it manually.
 				 * NOTE: filterRadius is already in UV space (1/resolution), so we use it directly
-				 * without multiplying by texelSize. The 2.0 factor accounts for the 2x2 texel block. */
-				const auto gatherCount = m_PCFSample + 1; /* Number of gather calls per axis */
-
+				 * without multiplying by texelSize. The 2.0 factor accounts for the 2x2 texel block.
+				 * The gather offset is the number of gather calls per axis. */
 				code <<
 					"/* Optimized PCF using textureGather (4 samples per fetch). */" "\n"
 					"const vec3 projCoords = " << fragmentPosition << ".xyz / " << fragmentPosition << ".w;" "\n"
-					"const int gatherOffset = " << gatherCount << ";" "\n\n"
+					"const int gatherOffset = " << kernelSize << " + 1;" "\n\n"
 
 					"shadowFactor = 0.0;" "\n"
 					"float totalWeight = 0.0;" "\n"
@@ -290,18 +273,98 @@ namespace EmEn::Saphir
 		/* Close the depth range check block. */
 		code << "}" "\n\n";
 
+		return code.take();
+	}
+
+	std::string
+	LightGenerator::generate2DShadowMapCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept
+	{
+		CodeBuffer code{};
+
+		code <<
+			"/* Shadow map 2D resolution. */" "\n\n"
+
+			"float shadowFactor = 1.0;" "\n\n" <<
+
+			LightGenerator::generate2DShadowMapSamplingCode(shadowMap, fragmentPosition);
+
+		if ( m_discardUnlitFragment )
+		{
+			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
+		}
+
+		return code.take();
+	}
+
+	std::string
+	LightGenerator::generate2DShadowMapPCFCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept
+	{
+		CodeBuffer code{};
+
+		code <<
+			"/* Shadow map 2D resolution (PCF). */" "\n\n"
+
+			"float shadowFactor = 1.0;" "\n\n" <<
+
+			this->generate2DShadowMapPCFSamplingCode(shadowMap, fragmentPosition, std::to_string(m_PCFSample));
+
+		if ( m_discardUnlitFragment )
+		{
+			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
+		}
+
+		return code.take();
+	}
+
+	std::string
+	LightGenerator::generate2DShadowMapSpecializedCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept
+	{
+		CodeBuffer code{};
+
+		/* NOTE: The PCF switch and the kernel size come from the pipeline specialization,
+		 * the driver folds the unused branch at pipeline creation. */
+		code <<
+			"/* Shadow map 2D resolution (specialized). */" "\n\n"
+
+			"float shadowFactor = 1.0;" "\n\n"
+
+			"if ( " << Keys::SpecializationConstant::UsePCF << " )" "\n"
+			"{" "\n" <<
+			this->generate2DShadowMapPCFSamplingCode(shadowMap, fragmentPosition, Keys::SpecializationConstant::PCFSample) <<
+			"}" "\n"
+			"else" "\n"
+			"{" "\n" <<
+			LightGenerator::generate2DShadowMapSamplingCode(shadowMap, fragmentPosition) <<
+			"}" "\n\n";
+
 		if ( m_discardUnlitFragment )
 		{
 			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
 		}
 
-		return code.str();
+		return code.take();
+	}
+
+	std::string
+	LightGenerator::generate2DShadowMapResolutionCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept
+	{
+		if ( this->isShadowSpecialized() )
+		{
+			return this->generate2DShadowMapSpecializedCode(shadowMap, fragmentPosition);
+		}
+
+		if ( m_PCFEnabled )
+		{
+			return this->generate2DShadowMapPCFCode(shadowMap, fragmentPosition);
+		}
+
+		return this->generate2DShadowMapCode(shadowMap, fragmentPosition);
 	}
 
 	std::string
 	LightGenerator::generate3DShadowMapCode (const std::string & shadowMap, const std::string & directionWorldSpace, const std::string & nearFar) const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		/* Use max(bias, 0.005) to ensure minimum bias even if UBO value is 0. */
 		code <<
@@ -324,13 +387,13 @@ namespace EmEn::Saphir
 			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
 		}
 
-		return code.str();
+		return code.take();
 	}
 
 	std::string
 	LightGenerator::generate3DShadowMapPCFCode (const std::string & shadowMap, const std::string & directionWorldSpace, const std::string & nearFar) const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code <<
 			"/* Shadow map 3D (cubemap) resolution (PCF). */" "\n\n"
@@ -488,13 +551,13 @@ namespace EmEn::Saphir
 			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
 		}
 
-		return code.str();
+		return code.take();
 	}
 
 	std::string
 	LightGenerator::generateCSMShadowMapCode (const std::string & shadowMapArray, const std::string & fragmentPositionWorldSpace, const std::string & fragmentPositionViewSpace, const std::string & cascadeMatrices, const std::string & splitDistances, const std::string & cascadeCount) const noexcept
 	{
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << "/* Cascaded Shadow Map resolution. */" "\n\n";
 
@@ -574,6 +637,6 @@ namespace EmEn::Saphir
 			code << "if ( shadowFactor <= 0.0 ) { discard; }" "\n\n";
 		}
 
-		return code.str();
+		return code.take();
 	}
 }
@@ -30,6 +30,7 @@
 #include "Code.hpp"
 #include "Declaration/Function.hpp"
 #include "Declaration/Sampler.hpp"
+#include "Declaration/SpecializationConstant.hpp"
 #include "Generator/Abstract.hpp"
 #include "Graphics/BindlessTextureManager.hpp"
 #include "Tracer.hpp"
@@ -264,10 +265,10 @@ namespace EmEn::Saphir
 	std::string
 	LightGenerator::variable (const char * componentName) noexcept
 	{
-		std::stringstream output;
+		CodeBuffer output;
 		output << ShaderVariable::Light << '.' << componentName;
 
-		return output.str();
+		return output.take();
 	}
 
 	Declaration::UniformBlock
@@ -489,6 +490,12 @@ namespace EmEn::Saphir
 				return false;
 		}
 
+		/* NOTE: In uber-shader mode, the shadow map code is always generated and switched at pipeline creation. */
+		if ( this->isShadowSpecialized() )
+		{
+			enableShadowMap = true;
+		}
+
 		/* CSM uses a specialized uniform block. */
 		const bool useCSM = renderPassUsesCSM(m_renderPassType);
 
@@ -628,6 +635,36 @@ namespace EmEn::Saphir
 				return false;
 		}
 
+		/* NOTE: In uber-shader mode, the plain and the shadow map light passes generate the same code.
+		 * The shadow code is guarded by the specialization constant 'scUseShadow', the program only
+		 * keeps the value the pipeline will be specialized with. The 2D PCF switch and kernel size
+		 * follow the same path, so a change of the PCF settings reuses the compiled shader modules.
+		 * The PCF method stays in the source, each one is a different sampling algorithm. */
+		if ( this->isShadowSpecialized() )
+		{
+			if ( !fragmentShader.declare(Declaration::SpecializationConstant{GLSL::Boolean, Keys::SpecializationConstant::UseShadow, Keys::SpecializationConstant::UseShadowId, "true"}) )
+			{
+				return false;
+			}
+
+			if ( !fragmentShader.declare(Declaration::SpecializationConstant{GLSL::Boolean, Keys::SpecializationConstant::UsePCF, Keys::SpecializationConstant::UsePCFId, "false"}) )
+			{
+				return false;
+			}
+
+			if ( !fragmentShader.declare(Declaration::SpecializationConstant{GLSL::Integer, Keys::SpecializationConstant::PCFSample, Keys::SpecializationConstant::PCFSampleId, "1"}) )
+			{
+				return false;
+			}
+
+			const auto program = generator.shaderProgram();
+			program->setFragmentSpecializationConstant(Keys::SpecializationConstant::UseShadowId, enableShadowMap);
+			program->setFragmentSpecializationConstant(Keys::SpecializationConstant::UsePCFId, m_PCFEnabled);
+			program->setFragmentSpecializationConstant(Keys::SpecializationConstant::PCFSampleId, m_PCFSample);
+
+			enableShadowMap = true;
+		}
+
 		/* CSM uses a specialized uniform block. */
 		const bool useCSM = renderPassUsesCSM(m_renderPassType);
 
@@ -711,7 +748,7 @@ namespace EmEn::Saphir
 			 * scale. It used to be a hard-coded 0.05 ("5% of the albedo"), which was a purely
 			 * artistic factor and made the ambient term incomparable with a light in candela.
 			 * In PBR mode, use albedo instead of diffuse. */
-			surfaceColor = (std::stringstream{} << "(" << iblBaseColor << " * 0.3183098862)").str();
+			surfaceColor = (CodeBuffer{} << "(" << iblBaseColor << " * 0.3183098862)").take();
 		}
 		else
 		{
@@ -729,7 +766,7 @@ namespace EmEn::Saphir
 				return;
 			}
 
-			intensity = (std::stringstream{} << "(" << this->ambientLightIntensity() << " * random(gl_FragCoord.xy))").str();
+			intensity = (CodeBuffer{} << "(" << this->ambientLightIntensity() << " * random(gl_FragCoord.xy))").take();
 		}
 		else
 		{
@@ -800,42 +837,42 @@ namespace EmEn::Saphir
 			 * reflectionIntensity()/refractionIntensity(): a normalized cubemap source gets the
 			 * environment luminance, a render-target source (probe/mirror) is already an
 			 * absolute luminance and only takes the artistic weight. */
-			const auto code = (std::stringstream{} <<
+			const auto code = (CodeBuffer{} <<
 				"/* PBR Glass IBL - Fresnel-Schlick approximation. */" "\n"
 				"const float NdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
 				"const float fresnelFactor = 0.04 + (1.0 - 0.04) * pow(1.0 - NdotV, 5.0);" "\n"
 				"const vec3 reflectedColor = " << m_surfaceReflectionColor << ".rgb * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";" "\n"
-				"vec3 refractedColor = " << m_surfaceRefractionColor << ".rgb * " << m_surfaceRefractionAmount << " * " << this->refractionIntensity() << ";" "\n").str();
+				"vec3 refractedColor = " << m_surfaceRefractionColor << ".rgb * " << m_surfaceRefractionAmount << " * " << this->refractionIntensity() << ";" "\n").take();
 
 			Code{fragmentShader, Location::Output} << code;
 
 			/* Transmission with refraction - apply Beer's law absorption to refracted color. */
 			if ( m_useTransmission )
 			{
-				const auto transmissionCode = (std::stringstream{} <<
+				const auto transmissionCode = (CodeBuffer{} <<
 					"/* Beer's law absorption for colored glass transmission. */" "\n"
 					"const vec3 beerAbsorption = exp(log(max(" << m_surfaceAttenuationColor << ".rgb, vec3(0.001))) / max(" << m_surfaceAttenuationDistance << ", 0.0001) * " << m_surfaceThicknessFactor << ");" "\n"
-					"refractedColor *= beerAbsorption * " << m_surfaceTransmissionFactor << " + (1.0 - " << m_surfaceTransmissionFactor << ");").str();
+					"refractedColor *= beerAbsorption * " << m_surfaceTransmissionFactor << " + (1.0 - " << m_surfaceTransmissionFactor << ");").take();
 				Code{fragmentShader, Location::Output} << transmissionCode;
 			}
 
 			{
-				const auto blendCode = (std::stringstream{} <<
+				const auto blendCode = (CodeBuffer{} <<
 					"/* Blend reflection and refraction based on Fresnel, modulated by IBL intensity. */" "\n" <<
-					m_fragmentColor << ".rgb += mix(refractedColor, reflectedColor, fresnelFactor);").str();
+					m_fragmentColor << ".rgb += mix(refractedColor, reflectedColor, fresnelFactor);").take();
 				Code{fragmentShader, Location::Output} << blendCode;
 			}
 
 			/* Clear coat IBL - energy conservation + coat reflection (HQ). */
 			if ( m_useClearCoat )
 			{
-				const auto ccCode = (std::stringstream{} <<
+				const auto ccCode = (CodeBuffer{} <<
 					"/* Clear coat IBL - energy conservation + coat reflection. */" "\n"
 					"const float ccFactor = " << m_surfaceClearCoatFactor << ";" "\n"
 					"const float ccNdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
 					"const vec3 ccFresnel = vec3(0.04) + (vec3(1.0) - vec3(0.04)) * pow(1.0 - ccNdotV, 5.0);" "\n" <<
 					m_fragmentColor << ".rgb *= (vec3(1.0) - ccFactor * ccFresnel);" "\n" <<
-					m_fragmentColor << ".rgb += reflectedColor * ccFactor * ccFresnel;").str();
+					m_fragmentColor << ".rgb += reflectedColor * ccFactor * ccFresnel;").take();
 				Code{fragmentShader, Location::Output} << ccCode;
 			}
 		}
@@ -862,7 +899,7 @@ namespace EmEn::Saphir
 				? std::string{}
 				: " * " + iblIntensity;
 
-			const auto code = (std::stringstream{} <<
+			const auto code = (CodeBuffer{} <<
 				"/* PBR Reflection + Transmission - energy-conserving Fresnel blend. */" "\n"
 				"const float NdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n" <<
 				(m_useMaterialIOR
@@ -882,20 +919,20 @@ namespace EmEn::Saphir
 				"const vec3 transmittedLight = " << m_surfaceTransmissionColor << " * transAbsorption;" "\n"
 				"/* F = reflection, (1-F)*transmissionFactor = transmission. */" "\n" <<
 				m_fragmentColor << ".rgb += reflectedColor * fresnelDielectric;" "\n" <<
-				m_fragmentColor << ".rgb += transmittedLight * " << m_surfaceTransmissionFactor << " * (1.0 - fresnelDielectric)" << transmissionScale << ";").str();
+				m_fragmentColor << ".rgb += transmittedLight * " << m_surfaceTransmissionFactor << " * (1.0 - fresnelDielectric)" << transmissionScale << ";").take();
 
 			Code{fragmentShader, Location::Output} << code;
 
 			/* Clear coat IBL on transmissive glass. */
 			if ( m_useClearCoat )
 			{
-				const auto ccCode = (std::stringstream{} <<
+				const auto ccCode = (CodeBuffer{} <<
 					"/* Clear coat IBL - energy conservation + coat reflection. */" "\n"
 					"const float ccFactor = " << m_surfaceClearCoatFactor << ";" "\n"
 					"const float ccNdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
 					"const vec3 ccFresnel = vec3(0.04) + (vec3(1.0) - vec3(0.04)) * pow(1.0 - ccNdotV, 5.0);" "\n" <<
 					m_fragmentColor << ".rgb *= (vec3(1.0) - ccFactor * ccFresnel);" "\n" <<
-					m_fragmentColor << ".rgb += reflectedColor * ccFactor * ccFresnel;").str();
+					m_fragmentColor << ".rgb += reflectedColor * ccFactor * ccFresnel;").take();
 				Code{fragmentShader, Location::Output} << ccCode;
 			}
 		}
@@ -917,25 +954,25 @@ namespace EmEn::Saphir
 			std::string iblF0Computation;
 			if ( m_useMaterialIOR && m_useKHRSpecular )
 			{
-				iblF0Computation = (std::stringstream{} <<
+				iblF0Computation = (CodeBuffer{} <<
 					"const float iblDielectricF0 = pow((" << m_surfaceMaterialIOR << " - 1.0) / (" << m_surfaceMaterialIOR << " + 1.0), 2.0);" "\n"
-					"const vec3 iblF0 = mix(min(vec3(iblDielectricF0) * " << m_surfaceKHRSpecularColor << ".rgb * " << m_surfaceKHRSpecularFactor << ", vec3(1.0)), " << albedo << ", " << metalness << ");").str();
+					"const vec3 iblF0 = mix(min(vec3(iblDielectricF0) * " << m_surfaceKHRSpecularColor << ".rgb * " << m_surfaceKHRSpecularFactor << ", vec3(1.0)), " << albedo << ", " << metalness << ");").take();
 			}
 			else if ( m_useMaterialIOR )
 			{
-				iblF0Computation = (std::stringstream{} <<
+				iblF0Computation = (CodeBuffer{} <<
 					"const float iblDielectricF0 = pow((" << m_surfaceMaterialIOR << " - 1.0) / (" << m_surfaceMaterialIOR << " + 1.0), 2.0);" "\n"
-					"const vec3 iblF0 = mix(vec3(iblDielectricF0), " << albedo << ", " << metalness << ");").str();
+					"const vec3 iblF0 = mix(vec3(iblDielectricF0), " << albedo << ", " << metalness << ");").take();
 			}
 			else
 			{
-				iblF0Computation = (std::stringstream{} <<
-					"const vec3 iblF0 = mix(vec3(0.5), " << albedo << ", " << metalness << ");").str();
+				iblF0Computation = (CodeBuffer{} <<
+					"const vec3 iblF0 = mix(vec3(0.5), " << albedo << ", " << metalness << ");").take();
 			}
 
 			if ( m_useIridescence )
 			{
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* PBR IBL - Fresnel-Schlick with iridescence. */" "\n" <<
 					iblF0Computation << "\n"
 					"const float NdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
@@ -945,7 +982,7 @@ namespace EmEn::Saphir
 					"const vec3 fresnelIBL = mix(fresnelIBL_base, fresnelIBL_iridescence, " << m_surfaceIridescenceFactor << ");" "\n"
 					"const vec3 reflectedColor = " << m_surfaceReflectionColor << ".rgb * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";" "\n"
 					"/* IBL contribution modulated by Fresnel and IBL intensity. */" "\n" <<
-					m_fragmentColor << ".rgb += reflectedColor * fresnelIBL;").str();
+					m_fragmentColor << ".rgb += reflectedColor * fresnelIBL;").take();
 
 				Code{fragmentShader, Location::Output} << code;
 
@@ -953,9 +990,9 @@ namespace EmEn::Saphir
 				 * the Lambertian lobe of the dielectric part. */
 				if ( useIBL )
 				{
-					const auto diffuseCode = (std::stringstream{} <<
+					const auto diffuseCode = (CodeBuffer{} <<
 						"/* IBL diffuse irradiance (iridescence: energy left by the Fresnel). */" "\n" <<
-						m_fragmentColor << ".rgb += " << albedo << " * (1.0 - " << metalness << ") * (vec3(1.0) - fresnelIBL) * iblIrradiance * " << iblIntensity << aoFactor << ";").str();
+						m_fragmentColor << ".rgb += " << albedo << " * (1.0 - " << metalness << ") * (vec3(1.0) - fresnelIBL) * iblIrradiance * " << iblIntensity << aoFactor << ";").take();
 					Code{fragmentShader, Location::Output} << diffuseCode;
 				}
 			}
@@ -967,7 +1004,7 @@ namespace EmEn::Saphir
 				 * diffuse lobe takes what the specular did not (energy conservation). */
 				const auto roughness = m_surfaceRoughness.empty() ? "0.5" : m_surfaceRoughness;
 
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* PBR IBL - split-sum + multi-scatter energy compensation. */" "\n" <<
 					iblF0Computation << "\n"
 					"const float NdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
@@ -979,20 +1016,20 @@ namespace EmEn::Saphir
 					"const vec3 iblFmsEms = iblEms * iblFssEss * iblFavg / (vec3(1.0) - iblFavg * iblEms);" "\n"
 					"const vec3 iblKD = " << albedo << " * (1.0 - " << metalness << ") * max(vec3(1.0) - iblFssEss - iblFmsEms, vec3(0.0));" "\n" <<
 					m_fragmentColor << ".rgb += iblFssEss * reflectedColor;" "\n" <<
-					m_fragmentColor << ".rgb += (iblFmsEms + iblKD" << aoFactor << ") * iblIrradiance * " << iblIntensity << ";").str();
+					m_fragmentColor << ".rgb += (iblFmsEms + iblKD" << aoFactor << ") * iblIrradiance * " << iblIntensity << ";").take();
 
 				Code{fragmentShader, Location::Output} << code;
 			}
 			else
 			{
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* PBR IBL - Fresnel-Schlick with proper F0 for metals. */" "\n" <<
 					iblF0Computation << "\n"
 					"const float NdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
 					"const vec3 fresnelIBL = iblF0 + (1.0 - iblF0) * pow(1.0 - NdotV, 5.0);" "\n"
 					"const vec3 reflectedColor = " << m_surfaceReflectionColor << ".rgb * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";" "\n"
 					"/* IBL contribution modulated by Fresnel and IBL intensity. */" "\n" <<
-					m_fragmentColor << ".rgb += reflectedColor * fresnelIBL;").str();
+					m_fragmentColor << ".rgb += reflectedColor * fresnelIBL;").take();
 
 				Code{fragmentShader, Location::Output} << code;
 			}
@@ -1000,13 +1037,13 @@ namespace EmEn::Saphir
 			/* Clear coat IBL - energy conservation + coat reflection (HQ). */
 			if ( m_useClearCoat )
 			{
-				const auto ccCode = (std::stringstream{} <<
+				const auto ccCode = (CodeBuffer{} <<
 					"/* Clear coat IBL - energy conservation + coat reflection. */" "\n"
 					"const float ccFactor = " << m_surfaceClearCoatFactor << ";" "\n"
 					"const float ccNdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
 					"const vec3 ccFresnel = vec3(0.04) + (vec3(1.0) - vec3(0.04)) * pow(1.0 - ccNdotV, 5.0);" "\n" <<
 					m_fragmentColor << ".rgb *= (vec3(1.0) - ccFactor * ccFresnel);" "\n" <<
-					m_fragmentColor << ".rgb += reflectedColor * ccFactor * ccFresnel;").str();
+					m_fragmentColor << ".rgb += reflectedColor * ccFactor * ccFresnel;").take();
 				Code{fragmentShader, Location::Output} << ccCode;
 			}
 		}
@@ -1027,45 +1064,45 @@ namespace EmEn::Saphir
 			std::string lqF0Code;
 			if ( m_useMaterialIOR && m_useKHRSpecular )
 			{
-				lqF0Code = (std::stringstream{} <<
+				lqF0Code = (CodeBuffer{} <<
 					"const float lqDielectricF0 = pow((" << m_surfaceMaterialIOR << " - 1.0) / (" << m_surfaceMaterialIOR << " + 1.0), 2.0);" "\n"
-					"const vec3 lqF0 = mix(min(vec3(lqDielectricF0) * " << m_surfaceKHRSpecularColor << ".rgb * " << m_surfaceKHRSpecularFactor << ", vec3(1.0)), " << albedo << ", " << metalness << ");").str();
+					"const vec3 lqF0 = mix(min(vec3(lqDielectricF0) * " << m_surfaceKHRSpecularColor << ".rgb * " << m_surfaceKHRSpecularFactor << ", vec3(1.0)), " << albedo << ", " << metalness << ");").take();
 			}
 			else if ( m_useMaterialIOR )
 			{
-				lqF0Code = (std::stringstream{} <<
+				lqF0Code = (CodeBuffer{} <<
 					"const float lqDielectricF0 = pow((" << m_surfaceMaterialIOR << " - 1.0) / (" << m_surfaceMaterialIOR << " + 1.0), 2.0);" "\n"
-					"const vec3 lqF0 = mix(vec3(lqDielectricF0), " << albedo << ", " << metalness << ");").str();
+					"const vec3 lqF0 = mix(vec3(lqDielectricF0), " << albedo << ", " << metalness << ");").take();
 			}
 			else
 			{
-				lqF0Code = (std::stringstream{} <<
-					"const vec3 lqF0 = mix(vec3(" << LowQualityDielectricF0 << "), " << albedo << ", " << metalness << ");").str();
+				lqF0Code = (CodeBuffer{} <<
+					"const vec3 lqF0 = mix(vec3(" << LowQualityDielectricF0 << "), " << albedo << ", " << metalness << ");").take();
 			}
 
-			const auto code = (std::stringstream{} <<
+			const auto code = (CodeBuffer{} <<
 				"/* Low-quality PBR IBL - F0 approximation without Fresnel. */" "\n" <<
 				lqF0Code << "\n" <<
-				m_fragmentColor << ".rgb += " << m_surfaceReflectionColor << ".rgb * lqF0 * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";").str();
+				m_fragmentColor << ".rgb += " << m_surfaceReflectionColor << ".rgb * lqF0 * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";").take();
 			Code{fragmentShader, Location::Output} << code;
 
 			/* Diffuse irradiance (LQ: plain energy split, no LUT). */
 			if ( useIBL )
 			{
-				const auto diffuseCode = (std::stringstream{} <<
+				const auto diffuseCode = (CodeBuffer{} <<
 					"/* IBL diffuse irradiance (LQ). */" "\n" <<
-					m_fragmentColor << ".rgb += " << albedo << " * (1.0 - " << metalness << ") * (vec3(1.0) - lqF0) * iblIrradiance * " << iblIntensity << aoFactor << ";").str();
+					m_fragmentColor << ".rgb += " << albedo << " * (1.0 - " << metalness << ") * (vec3(1.0) - lqF0) * iblIrradiance * " << iblIntensity << aoFactor << ";").take();
 				Code{fragmentShader, Location::Output} << diffuseCode;
 			}
 
 			/* Clear coat IBL - simplified constant attenuation (LQ, no reflectionNormal available). */
 			if ( m_useClearCoat )
 			{
-				const auto ccCode = (std::stringstream{} <<
+				const auto ccCode = (CodeBuffer{} <<
 					"/* Clear coat IBL - simplified constant attenuation (LQ). */" "\n"
 					"const float ccFactor = " << m_surfaceClearCoatFactor << ";" "\n" <<
 					m_fragmentColor << ".rgb *= (1.0 - ccFactor * 0.04);" "\n" <<
-					m_fragmentColor << ".rgb += " << m_surfaceReflectionColor << ".rgb * ccFactor * 0.04 * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";").str();
+					m_fragmentColor << ".rgb += " << m_surfaceReflectionColor << ".rgb * ccFactor * 0.04 * " << m_surfaceReflectionAmount << " * " << this->reflectionIntensity() << ";").take();
 				Code{fragmentShader, Location::Output} << ccCode;
 			}
 		}
@@ -1077,12 +1114,12 @@ namespace EmEn::Saphir
 			 * normalized cubemap source, artistic weight alone for a render-target source. */
 			if ( m_useTransmission )
 			{
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* PBR refraction with Beer's law absorption. */" "\n"
 					"const vec3 beerAbsorption = exp(log(max(" << m_surfaceAttenuationColor << ".rgb, vec3(0.001))) / max(" << m_surfaceAttenuationDistance << ", 0.0001) * " << m_surfaceThicknessFactor << ");" "\n"
 					"vec3 refrRefractedColor = " << m_surfaceRefractionColor << ".rgb * " << m_surfaceRefractionAmount << " * 0.96;" "\n"
 					"refrRefractedColor *= beerAbsorption * " << m_surfaceTransmissionFactor << " + (1.0 - " << m_surfaceTransmissionFactor << ");" "\n" <<
-					m_fragmentColor << ".rgb += refrRefractedColor * " << this->refractionIntensity() << ";").str();
+					m_fragmentColor << ".rgb += refrRefractedColor * " << this->refractionIntensity() << ";").take();
 				Code{fragmentShader} << code;
 			}
 			else
@@ -1095,12 +1132,12 @@ namespace EmEn::Saphir
 			/* NOTE: Non-PBR Glass - legacy behavior.
 			 * The fresnelFactor variable is already declared by the material (StandardResource).
 			 * We just use it here to blend reflection and refraction in the ambient pass. */
-			const auto code = (std::stringstream{} <<
+			const auto code = (CodeBuffer{} <<
 				"/* Glass ambient pass - uses fresnelFactor from material. */" "\n"
 				"const vec3 ambientReflectedColor = " << m_surfaceReflectionColor << ".rgb * " << m_surfaceReflectionAmount << ";" "\n"
 				"const vec3 ambientRefractedColor = " << m_surfaceRefractionColor << ".rgb * " << m_surfaceRefractionAmount << ";" "\n"
 				"/* Blend reflection and refraction based on Fresnel, with subtle tint from albedo. */" "\n" <<
-				m_fragmentColor << ".rgb += mix(ambientRefractedColor, ambientReflectedColor, fresnelFactor) * " << surfaceColor << ".rgb;").str();
+				m_fragmentColor << ".rgb += mix(ambientRefractedColor, ambientReflectedColor, fresnelFactor) * " << surfaceColor << ".rgb;").take();
 
 			Code{fragmentShader, Location::Output} << code;
 		}
@@ -1199,18 +1236,18 @@ namespace EmEn::Saphir
 
 			if ( m_useSubsurfaceThicknessMap )
 			{
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* SSS ambient - scattered light fills shadow areas (with thickness map). */" "\n"
 					"const vec3 sssAmbient = " << m_surfaceSubsurfaceColor << ".rgb * " << m_surfaceSubsurfaceIntensity << " * (1.0 - " << m_surfaceSubsurfaceThickness << ");" "\n" <<
-					m_fragmentColor << ".rgb += sssAmbient * " << albedo << ";").str();
+					m_fragmentColor << ".rgb += sssAmbient * " << albedo << ";").take();
 				Code{fragmentShader} << code;
 			}
 			else
 			{
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* SSS ambient - scattered light fills shadow areas. */" "\n"
 					"const vec3 sssAmbient = " << m_surfaceSubsurfaceColor << ".rgb * " << m_surfaceSubsurfaceIntensity << " * 0.5;" "\n" <<
-					m_fragmentColor << ".rgb += sssAmbient * " << albedo << ";").str();
+					m_fragmentColor << ".rgb += sssAmbient * " << albedo << ";").take();
 				Code{fragmentShader} << code;
 			}
 		}
@@ -1220,13 +1257,13 @@ namespace EmEn::Saphir
 		{
 			const auto albedo = m_surfaceAlbedo.empty() ? "vec3(1.0)" : m_surfaceAlbedo + ".rgb";
 
-			const auto code = (std::stringstream{} <<
+			const auto code = (CodeBuffer{} <<
 				"/* Sheen ambient contribution. */" "\n"
 				"const vec3 sheenAmbientColor = " << m_surfaceSheenColor << ".rgb;" "\n"
 				"const float sheenAmbientRoughness = " << m_surfaceSheenRoughness << ";" "\n"
 				"const float sheenAmbientDFG = 0.157 * sheenAmbientRoughness + 0.04;" "\n"
 				"const float sheenAmbientScaling = 1.0 - max(max(sheenAmbientColor.r, sheenAmbientColor.g), sheenAmbientColor.b) * sheenAmbientDFG;" "\n" <<
-				m_fragmentColor << ".rgb = " << m_fragmentColor << ".rgb * sheenAmbientScaling + sheenAmbientColor * " << albedo << " * 0.1;").str();
+				m_fragmentColor << ".rgb = " << m_fragmentColor << ".rgb * sheenAmbientScaling + sheenAmbientColor * " << albedo << " * 0.1;").take();
 			Code{fragmentShader} << code;
 		}
 
@@ -1248,7 +1285,7 @@ namespace EmEn::Saphir
 				/* High-quality: use reflectionNormal and reflectionI for proper Fresnel gating.
 				 * NOTE: transmissionDir, transmissionLod, and SurfaceTransmissionColor are already
 				 * declared by generateBindlessTransmissionFragmentShader() in PBRResource. */
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* Thin-surface transmission - Beer's law + Fresnel gate. */" "\n"
 					"vec3 transmittedLight = " << m_surfaceTransmissionColor << ";" "\n"
 					"/* Beer's law absorption. */" "\n"
@@ -1257,19 +1294,19 @@ namespace EmEn::Saphir
 					"/* Fresnel gate: reflected light can't be transmitted. */" "\n"
 					"const float transNdotV = max(dot(reflectionNormal, -reflectionI), 0.0);" "\n"
 					"const float fresnelT = 0.04 + 0.96 * pow(1.0 - transNdotV, 5.0);" "\n" <<
-					m_fragmentColor << ".rgb += transmittedLight * " << m_surfaceTransmissionFactor << " * (1.0 - fresnelT) * " << iblIntensity << ";").str();
+					m_fragmentColor << ".rgb += transmittedLight * " << m_surfaceTransmissionFactor << " * (1.0 - fresnelT) * " << iblIntensity << ";").take();
 				Code{fragmentShader} << code;
 			}
 			else
 			{
 				/* Low-quality: no Fresnel gating, simpler approximation.
 				 * NOTE: SurfaceTransmissionColor is already declared by PBRResource. */
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"/* Thin-surface transmission (LQ) - Beer's law absorption. */" "\n"
 					"vec3 transmittedLight = " << m_surfaceTransmissionColor << ";" "\n"
 					"const vec3 transAbsorption = exp(log(max(" << m_surfaceAttenuationColor << ".rgb, vec3(0.001))) / max(" << m_surfaceAttenuationDistance << ", 0.0001) * " << m_surfaceThicknessFactor << ");" "\n"
 					"transmittedLight *= transAbsorption;" "\n" <<
-					m_fragmentColor << ".rgb += transmittedLight * " << m_surfaceTransmissionFactor << " * 0.96 * " << iblIntensity << ";").str();
+					m_fragmentColor << ".rgb += transmittedLight * " << m_surfaceTransmissionFactor << " * 0.96 * " << iblIntensity << ";").take();
 				Code{fragmentShader} << code;
 			}
 		}
@@ -1309,7 +1346,7 @@ namespace EmEn::Saphir
 		 * own luminance and read as "flashy".
 		 * NOTE: deliberately NOT folded into finaleDiffuseFactor — that expression is also used as
 		 * a raw geometric N.L term inside the PBR low-quality specular pow() below. */
-		const auto diffuseIlluminance = (std::stringstream{} << '(' << this->lightIntensity() << " * 0.3183098862)").str();
+		const auto diffuseIlluminance = (CodeBuffer{} << '(' << this->lightIntensity() << " * 0.3183098862)").take();
 
 		Code{fragmentShader} << m_fragmentColor << ".rgb += " << surfaceColor << ".rgb * (" << this->lightColor() << ".rgb * projectionColor * " << diffuseIlluminance << " * " << finaleDiffuseFactor << ");";
 
@@ -1324,11 +1361,11 @@ namespace EmEn::Saphir
 				 * Schlick approximation: F = F0 + (1 - F0) * pow(1 - cosTheta, 5)
 				 * F0 for glass is approximately 0.04, for water ~0.02, for diamond ~0.17.
 				 * We compute F0 from IOR: F0 = ((n1-n2)/(n1+n2))^2 where n1=1 (air). */
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"const vec3 reflected = mix(" << surfaceColor << ", " << m_surfaceReflectionColor << ", " << m_surfaceReflectionAmount << ").rgb;" "\n"
 					"const vec3 refracted = mix(" << surfaceColor << ", " << m_surfaceRefractionColor << ", " << m_surfaceRefractionAmount << ").rgb;" "\n\n" <<
 
-					m_fragmentColor << ".rgb += mix(refracted, reflected, fresnelFactor) * (" << this->lightColor() << ".rgb * projectionColor * " << diffuseIlluminance << " * " << finaleDiffuseFactor << ");").str();
+					m_fragmentColor << ".rgb += mix(refracted, reflected, fresnelFactor) * (" << this->lightColor() << ".rgb * projectionColor * " << diffuseIlluminance << " * " << finaleDiffuseFactor << ");").take();
 
 				Code{fragmentShader, Location::Output} << code;
 			}
@@ -1354,11 +1391,11 @@ namespace EmEn::Saphir
 				 * Schlick approximation: F = F0 + (1 - F0) * pow(1 - cosTheta, 5)
 				 * F0 for glass is approximately 0.04, for water ~0.02, for diamond ~0.17.
 				 * We compute F0 from IOR: F0 = ((n1-n2)/(n1+n2))^2 where n1=1 (air). */
-				const auto code = (std::stringstream{} <<
+				const auto code = (CodeBuffer{} <<
 					"const vec3 reflectedSpecular = mix(" << m_surfaceSpecularColor << ", " << m_surfaceReflectionColor << ", " << m_surfaceReflectionAmount << ").rgb;" "\n"
 					"const vec3 refractedSpecular = mix(" << m_surfaceSpecularColor << ", " << m_surfaceRefractionColor << ", " << m_surfaceRefractionAmount << ").rgb;" "\n\n" <<
 
-					m_fragmentColor << ".rgb += mix(refractedSpecular, reflectedSpecular, fresnelFactor) * (" << this->lightIntensity() << " * " << finaleSpecularFactor << ");").str();
+					m_fragmentColor << ".rgb += mix(refractedSpecular, reflectedSpecular, fresnelFactor) * (" << this->lightIntensity() << " * " << finaleSpecularFactor << ");").take();
 
 				Code{fragmentShader, Location::Output} << code;
 			}
@@ -1383,12 +1420,12 @@ namespace EmEn::Saphir
 		{
 			const auto albedo = m_surfaceAlbedo.empty() ? "vec3(1.0)" : m_surfaceAlbedo + ".rgb";
 			const auto metalness = m_surfaceMetalness.empty() ? "0.0" : m_surfaceMetalness;
-			const auto code = (std::stringstream{} <<
+			const auto code = (CodeBuffer{} <<
 				"/* PBR low-quality specular - F0 approximation. */" "\n"
 				"const float lqShininess = pow(1.0 - " << m_surfaceRoughness << ", 2.0) * 64.0 + 1.0;" "\n"
 				"const vec3 lqSpecF0 = mix(vec3(1.00), " << albedo << ", " << metalness << ");" "\n"
 				"const float lqSpecPower = pow(max(" << finaleDiffuseFactor << ", 0.0), lqShininess);" "\n" <<
-				m_fragmentColor << ".rgb += lqSpecF0 * " << this->lightColor() << ".rgb * projectionColor * " << this->lightIntensity() << " * lqSpecPower;").str();
+				m_fragmentColor << ".rgb += lqSpecF0 * " << this->lightColor() << ".rgb * projectionColor * " << this->lightIntensity() << " * lqSpecPower;").take();
 
 			Code{fragmentShader, Location::Output} << code;
 		}
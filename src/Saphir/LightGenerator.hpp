@@ -128,7 +128,8 @@ namespace EmEn::Saphir
 				m_PCFMethod{stringToPCFMethod(settings.getOrSetDefault< std::string >(GraphicsShadowMappingPCFMethodKey, DefaultGraphicsShadowMappingPCFMethod))},
 				m_fragmentColor{fragmentColor},
 				m_highQualityEnabled{highQualityEnabled},
-				m_PCFEnabled{settings.getOrSetDefault< bool >(GraphicsShadowMappingEnablePCFKey, DefaultGraphicsShadowMappingEnablePCF)}
+				m_PCFEnabled{settings.getOrSetDefault< bool >(GraphicsShadowMappingEnablePCFKey, DefaultGraphicsShadowMappingEnablePCF)},
+				m_uberShadersEnabled{settings.getOrSetDefault< bool >(EnableUberShadersKey, DefaultEnableUberShaders)}
 			{
 
 			}
@@ -144,6 +145,20 @@ namespace EmEn::Saphir
 				return m_renderPassType == Graphics::RenderPassType::AmbientPass;
 			}
 
+			/**
+			 * @brief Returns whether the shadow mapping of this light pass is switched by the specialization constant 'scUseShadow'.
+			 * @note In this uber-shader mode, the light pass with and without shadow map generates the same source code,
+			 * so both programs share the same shader modules and only differ by the pipeline specialization.
+			 * The 2D PCF switch and kernel size are specialized the same way ('scUsePCF', 'scPCFSample').
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isShadowSpecialized () const noexcept
+			{
+				return m_uberShadersEnabled && Graphics::renderPassSupportsShadowSpecialization(m_renderPassType);
+			}
+
 			/**
 			 * @brief Declares the variable used by the fragment shader to get the surface ambient color.
 			 * @param colorVariableName A reference to a string for GLSL variable holding the surface ambient color.
@@ -918,6 +933,44 @@ namespace EmEn::Saphir
 			[[nodiscard]]
 			std::string generate2DShadowMapPCFCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept;
 
+			/**
+			 * @brief Generates the 2D shadow map resolution code with the PCF switch and the kernel size left to the specialization constants 'scUsePCF' and 'scPCFSample'.
+			 * @note The PCF method stays a source choice, each method being a different algorithm.
+			 * @param shadowMap A reference to the shadow map sampler name.
+			 * @param fragmentPosition A reference to the fragment position in light space.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string generate2DShadowMapSpecializedCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept;
+
+			/**
+			 * @brief Generates the 2D shadow map resolution code according to the PCF settings and the uber-shader mode.
+			 * @param shadowMap A reference to the shadow map sampler name.
+			 * @param fragmentPosition A reference to the fragment position in light space.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string generate2DShadowMapResolutionCode (const std::string & shadowMap, const std::string & fragmentPosition) const noexcept;
+
+			/**
+			 * @brief Generates the single sample of a 2D shadow map into the declared 'shadowFactor'.
+			 * @param shadowMap A reference to the shadow map sampler name.
+			 * @param fragmentPosition A reference to the fragment position in light space.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			static std::string generate2DShadowMapSamplingCode (const std::string & shadowMap, const std::string & fragmentPosition) noexcept;
+
+			/**
+			 * @brief Generates the PCF sampling of a 2D shadow map into the declared 'shadowFactor'.
+			 * @param shadowMap A reference to the shadow map sampler name.
+			 * @param fragmentPosition A reference to the fragment position in light space.
+			 * @param kernelSize A reference to the GLSL expression of the kernel half-size, a literal or a specialization constant.
+			 * @return std::string
+			 */
+			[[nodiscard]]
+			std::string generate2DShadowMapPCFSamplingCode (const std::string & shadowMap, const std::string & fragmentPosition, const std::string & kernelSize) const noexcept;
+
 			/**
 			 * @brief
 			 * @param shadowMap
@@ -1126,6 +1179,7 @@ namespace EmEn::Saphir
 			bool m_useReflectivityMap{false};
 			bool m_highQualityEnabled{false};
 			bool m_PCFEnabled{false};
+			bool m_uberShadersEnabled{false};
 			/**
 			 * @brief Returns the IBL weight expression, scaled by the environment luminance.
 			 * @note The environment cubemap is a normalized [0,1] source (the image pipeline has no
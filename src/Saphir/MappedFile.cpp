@@ -0,0 +1,163 @@
+/*
+ * src/Saphir/MappedFile.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "MappedFile.hpp"
+
+/* Project configuration. */
+#include "emeraude_platform.hpp"
+
+/* Third-party inclusions. */
+#if IS_WINDOWS
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+
+namespace EmEn::Saphir
+{
+	bool
+	MappedFile::map (const std::filesystem::path & filepath) noexcept
+	{
+		this->unmap();
+
+#if IS_WINDOWS
+		/* NOTE: Other handles may keep appending to or replace the file while it is mapped. */
+		const auto fileHandle = CreateFileW(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+		if ( fileHandle == INVALID_HANDLE_VALUE )
+		{
+			TraceError{ClassId} << "Unable to open the file " << filepath << " !";
+
+			return false;
+		}
+
+		LARGE_INTEGER fileSize{};
+
+		if ( GetFileSizeEx(fileHandle, &fileSize) == 0 || fileSize.QuadPart <= 0 )
+		{
+			TraceError{ClassId} << "The file " << filepath << " is empty or unreadable !";
+
+			CloseHandle(fileHandle);
+
+			return false;
+		}
+
+		const auto mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		/* NOTE: The mapping keeps its own reference on the file. */
+		CloseHandle(fileHandle);
+
+		if ( mappingHandle == nullptr )
+		{
+			TraceError{ClassId} << "Unable to create a mapping of the file " << filepath << " !";
+
+			return false;
+		}
+
+		const auto * data = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+
+		if ( data == nullptr )
+		{
+			TraceError{ClassId} << "Unable to map the file " << filepath << " !";
+
+			CloseHandle(mappingHandle);
+
+			return false;
+		}
+
+		m_data = static_cast< const std::byte * >(data);
+		m_size = static_cast< size_t >(fileSize.QuadPart);
+		m_mappingHandle = mappingHandle;
+#else
+		const auto fileDescriptor = ::open(filepath.c_str(), O_RDONLY);
+
+		if ( fileDescriptor < 0 )
+		{
+			TraceError{ClassId} << "Unable to open the file " << filepath << " !";
+
+			return false;
+		}
+
+		struct stat fileStatus{};
+
+		if ( ::fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size <= 0 )
+		{
+			TraceError{ClassId} << "The file " << filepath << " is empty or unreadable !";
+
+			::close(fileDescriptor);
+
+			return false;
+		}
+
+		auto * data = ::mmap(nullptr, static_cast< size_t >(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+		/* NOTE: The mapping keeps its own reference on the file. */
+		::close(fileDescriptor);
+
+		if ( data == MAP_FAILED )
+		{
+			TraceError{ClassId} << "Unable to map the file " << filepath << " !";
+
+			return false;
+		}
+
+		m_data = static_cast< const std::byte * >(data);
+		m_size = static_cast< size_t >(fileStatus.st_size);
+#endif
+
+		return true;
+	}
+
+	void
+	MappedFile::unmap () noexcept
+	{
+		if ( m_data == nullptr )
+		{
+			return;
+		}
+
+#if IS_WINDOWS
+		UnmapViewOfFile(m_data);
+		CloseHandle(m_mappingHandle);
+#else
+		::munmap(const_cast< std::byte * >(m_data), m_size);
+#endif
+
+		m_data = nullptr;
+		m_size = 0;
+		m_mappingHandle = nullptr;
+	}
+}
@@ -0,0 +1,145 @@
+/*
+ * src/Saphir/MappedFile.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace EmEn::Saphir
+{
+	/**
+	 * @brief A read-only memory mapping of a whole file.
+	 * @note The pages are loaded by the system on first access, opening a large file costs nothing
+	 * until it is read. The mapping can be read from any thread.
+	 * @since 0.9.53
+	 */
+	class EMEN_API MappedFile final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"MappedFile"};
+
+			/**
+			 * @brief Constructs an unmapped file.
+			 */
+			MappedFile () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MappedFile (const MappedFile & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			MappedFile (MappedFile && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MappedFile &
+			 */
+			MappedFile & operator= (const MappedFile & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return MappedFile &
+			 */
+			MappedFile & operator= (MappedFile && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the mapped file.
+			 */
+			~MappedFile ()
+			{
+				this->unmap();
+			}
+
+			/**
+			 * @brief Maps a file in memory, replacing the previous mapping.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			bool map (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Releases the mapping.
+			 * @return void
+			 */
+			void unmap () noexcept;
+
+			/**
+			 * @brief Returns whether a file is mapped.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isMapped () const noexcept
+			{
+				return m_data != nullptr;
+			}
+
+			/**
+			 * @brief Returns the mapped bytes.
+			 * @return const std::byte *
+			 */
+			[[nodiscard]]
+			const std::byte *
+			data () const noexcept
+			{
+				return m_data;
+			}
+
+			/**
+			 * @brief Returns the number of mapped bytes.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			size () const noexcept
+			{
+				return m_size;
+			}
+
+		private:
+
+			const std::byte * m_data{nullptr};
+			size_t m_size{0};
+			/* NOTE: The file mapping object handle on Windows, unused elsewhere. */
+			void * m_mappingHandle{nullptr};
+	};
+}
@@ -439,18 +439,32 @@ namespace EmEn::Saphir
 			void
 			setFragmentSpecializationConstant (uint32_t constantId, bool value) noexcept
 			{
-				m_fragmentSpecConstantsBool.emplace(constantId, value);
+				/* NOTE: A GLSL boolean specialization constant is a 32-bit VkBool32. */
+				m_fragmentSpecConstants.emplace(constantId, value ? 1U : 0U);
 			}
 
 			/**
-			 * @brief Returns the fragment shader boolean specialization constants.
-			 * @return const std::map< uint32_t, bool > &
+			 * @brief Sets an integer specialization constant for the fragment shader.
+			 * @note Must be called before shader compilation (createGraphicsPipeline).
+			 * @param constantId The constant ID as declared in the shader (layout(constant_id = X)).
+			 * @param value The 32-bit value for the constant.
+			 * @return void
+			 */
+			void
+			setFragmentSpecializationConstant (uint32_t constantId, uint32_t value) noexcept
+			{
+				m_fragmentSpecConstants.emplace(constantId, value);
+			}
+
+			/**
+			 * @brief Returns the fragment shader specialization constants as 32-bit values.
+			 * @return const std::map< uint32_t, uint32_t > &
 			 */
 			[[nodiscard]]
-			const std::map< uint32_t, bool > &
-			fragmentSpecializationConstantsBool () const noexcept
+			const std::map< uint32_t, uint32_t > &
+			fragmentSpecializationConstants () const noexcept
 			{
-				return m_fragmentSpecConstantsBool;
+				return m_fragmentSpecConstants;
 			}
 
 			/**
@@ -461,7 +475,7 @@ namespace EmEn::Saphir
 			bool
 			hasSpecializationConstants () const noexcept
 			{
-				return !m_fragmentSpecConstantsBool.empty();
+				return !m_fragmentSpecConstants.empty();
 			}
 
 		private:
@@ -477,6 +491,6 @@ namespace EmEn::Saphir
 			std::shared_ptr< Graphics::VertexBufferFormat > m_vertexBufferFormat;
 			std::shared_ptr< Vulkan::PipelineLayout > m_pipelineLayout;
 			std::shared_ptr< Vulkan::GraphicsPipeline > m_graphicsPipeline;
-			std::map< uint32_t, bool > m_fragmentSpecConstantsBool; // FIXME: Use a cheaper structure here.
+			std::map< uint32_t, uint32_t > m_fragmentSpecConstants; // FIXME: Use a cheaper structure here.
 	};
 }
@@ -0,0 +1,271 @@
+/*
+ * src/Saphir/ProgramKey.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace EmEn::Saphir
+{
+	/**
+	 * @brief A 128-bit key identifying a program by what it is made of.
+	 * @note The key is built from the semantic inputs of a generator (material signature, geometry format,
+	 * render pass type, generator flags, pass options), never from the generated GLSL, so a cached program
+	 * is found before any source code is written.
+	 * @since 0.9.53
+	 */
+	struct ProgramKey final
+	{
+		uint64_t high{0};
+		uint64_t low{0};
+
+		/**
+		 * @brief Returns whether the key was computed.
+		 * @return bool
+		 */
+		[[nodiscard]]
+		bool
+		isValid () const noexcept
+		{
+			return high != 0 || low != 0;
+		}
+
+		/**
+		 * @brief Folds the key to a single word for hashed containers.
+		 * @return size_t
+		 */
+		[[nodiscard]]
+		size_t
+		hash () const noexcept
+		{
+			return static_cast< size_t >(high ^ (low * 0x9E3779B97F4A7C15ULL));
+		}
+
+		/**
+		 * @brief Compares two keys.
+		 * @param other A reference to another key.
+		 * @return bool
+		 */
+		[[nodiscard]]
+		bool operator== (const ProgramKey & other) const noexcept = default;
+	};
+
+	/**
+	 * @brief Accumulates the semantic inputs of a program into a ProgramKey.
+	 * @note Two independent 64-bit lanes are mixed with different multipliers and finalized
+	 * together. This is not a cryptographic hash, but with 128 bits an accidental collision
+	 * between two program configurations is not a practical concern.
+	 * @since 0.9.53
+	 */
+	class ProgramKeyBuilder final
+	{
+		public:
+
+			/**
+			 * @brief Constructs a key builder.
+			 * @param domain The name of what produces the program, usually the generator class identifier.
+			 */
+			explicit
+			ProgramKeyBuilder (std::string_view domain) noexcept
+			{
+				this->add(domain);
+			}
+
+			/**
+			 * @brief Adds a string input.
+			 * @note The length is mixed first, so consecutive strings cannot shift into each other.
+			 * @param value A string view.
+			 * @return ProgramKeyBuilder &
+			 */
+			ProgramKeyBuilder &
+			add (std::string_view value) noexcept
+			{
+				this->mix(value.size());
+
+				size_t offset = 0;
+
+				for ( ; offset + sizeof(uint64_t) <= value.size(); offset += sizeof(uint64_t) )
+				{
+					uint64_t word = 0;
+
+					std::memcpy(&word, value.data() + offset, sizeof(uint64_t));
+
+					this->mix(word);
+				}
+
+				if ( offset < value.size() )
+				{
+					uint64_t word = 0;
+
+					std::memcpy(&word, value.data() + offset, value.size() - offset);
+
+					this->mix(word);
+				}
+
+				return *this;
+			}
+
+			/**
+			 * @brief Adds a C-string input.
+			 * @param value A pointer to a C-string. A null pointer is added as an empty string.
+			 * @return ProgramKeyBuilder &
+			 */
+			ProgramKeyBuilder &
+			add (const char * value) noexcept
+			{
+				return this->add(value != nullptr ? std::string_view{value} : std::string_view{});
+			}
+
+			/**
+			 * @brief Adds a boolean, an integral or an enumeration input.
+			 * @tparam value_t The type of the value.
+			 * @param value The value.
+			 * @return ProgramKeyBuilder &
+			 */
+			template< typename value_t >
+			requires std::integral< value_t > || std::is_enum_v< value_t >
+			ProgramKeyBuilder &
+			add (value_t value) noexcept
+			{
+				if constexpr ( std::is_enum_v< value_t > )
+				{
+					this->mix(static_cast< uint64_t >(static_cast< std::underlying_type_t< value_t > >(value)));
+				}
+				else
+				{
+					this->mix(static_cast< uint64_t >(value));
+				}
+
+				return *this;
+			}
+
+			/**
+			 * @brief Adds a floating point input, compared by its bit pattern.
+			 * @param value The value.
+			 * @return ProgramKeyBuilder &
+			 */
+			ProgramKeyBuilder &
+			add (float value) noexcept
+			{
+				this->mix(std::bit_cast< uint32_t >(value));
+
+				return *this;
+			}
+
+			/**
+			 * @brief Adds a pointer input, for objects whose identity is part of the program (post-processing effect instances).
+			 * @param pointer A pointer.
+			 * @return ProgramKeyBuilder &
+			 */
+			ProgramKeyBuilder &
+			add (const void * pointer) noexcept
+			{
+				this->mix(static_cast< uint64_t >(reinterpret_cast< uintptr_t >(pointer)));
+
+				return *this;
+			}
+
+			/**
+			 * @brief Finalizes the key.
+			 * @return ProgramKey
+			 */
+			[[nodiscard]]
+			ProgramKey
+			key () const noexcept
+			{
+				const auto high = finalize(m_high ^ std::rotl(m_low, 29) ^ m_count);
+				const auto low = finalize(m_low ^ std::rotl(m_high, 41) ^ (m_count * 0xC2B2AE3D27D4EB4FULL));
+
+				/* NOTE: Zero is kept for an invalid key. */
+				if ( high == 0 && low == 0 )
+				{
+					return {1, 0};
+				}
+
+				return {high, low};
+			}
+
+		private:
+
+			/**
+			 * @brief Mixes a word into both lanes.
+			 * @param word The word.
+			 * @return void
+			 */
+			void
+			mix (uint64_t word) noexcept
+			{
+				m_high = std::rotl((m_high ^ word) * 0x9E3779B97F4A7C15ULL, 31);
+				m_low = std::rotl((m_low + word) * 0xBF58476D1CE4E5B9ULL, 27) ^ (m_low >> 33);
+				m_count++;
+			}
+
+			/**
+			 * @brief The splitmix64 finalizer.
+			 * @param value The value.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static
+			uint64_t
+			finalize (uint64_t value) noexcept
+			{
+				value ^= value >> 30;
+				value *= 0xBF58476D1CE4E5B9ULL;
+				value ^= value >> 27;
+				value *= 0x94D049BB133111EBULL;
+				value ^= value >> 31;
+
+				return value;
+			}
+
+			uint64_t m_high{0x6A09E667F3BCC908ULL};
+			uint64_t m_low{0xBB67AE8584CAA73BULL};
+			uint64_t m_count{0};
+	};
+}
+
+template<>
+struct std::hash< EmEn::Saphir::ProgramKey >
+{
+	[[nodiscard]]
+	size_t
+	operator() (const EmEn::Saphir::ProgramKey & key) const noexcept
+	{
+		return key.hash();
+	}
+};
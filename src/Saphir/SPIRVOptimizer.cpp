@@ -0,0 +1,197 @@
+/*
+ * src/Saphir/SPIRVOptimizer.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "SPIRVOptimizer.hpp"
+
+/* STL inclusions. */
+#include <functional>
+
+/* Third-party inclusions. */
+#include <spirv-tools/libspirv.hpp>
+#include <spirv-tools/optimizer.hpp>
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+
+namespace EmEn::Saphir
+{
+	using namespace Base;
+
+	const char *
+	to_cstring (SPIRVOptimizationLevel level) noexcept
+	{
+		switch ( level )
+		{
+			case SPIRVOptimizationLevel::Performance :
+				return "Performance";
+
+			case SPIRVOptimizationLevel::Size :
+				return "Size";
+
+			case SPIRVOptimizationLevel::None :
+			default:
+				return "None";
+		}
+	}
+
+	SPIRVOptimizationLevel
+	to_SPIRVOptimizationLevel (std::string_view value) noexcept
+	{
+		if ( value == "Performance" )
+		{
+			return SPIRVOptimizationLevel::Performance;
+		}
+
+		if ( value == "Size" )
+		{
+			return SPIRVOptimizationLevel::Size;
+		}
+
+		return SPIRVOptimizationLevel::None;
+	}
+
+	/**
+	 * @brief Returns a message consumer forwarding the SPIRV-Tools errors to the tracer.
+	 * @param shaderIdentifier A reference to a string.
+	 * @return spvtools::MessageConsumer
+	 */
+	[[nodiscard]]
+	static
+	spvtools::MessageConsumer
+	messageConsumer (const std::string & shaderIdentifier) noexcept
+	{
+		return [&shaderIdentifier] (spv_message_level_t level, const char * /*source*/, const spv_position_t & position, const char * message) {
+			if ( level <= SPV_MSG_ERROR )
+			{
+				TraceError{SPIRVOptimizer::ClassId} << "Shader '" << shaderIdentifier << "' @" << position.index << " : " << message;
+			}
+			else if ( level == SPV_MSG_WARNING )
+			{
+				TraceWarning{SPIRVOptimizer::ClassId} << "Shader '" << shaderIdentifier << "' @" << position.index << " : " << message;
+			}
+		};
+	}
+
+	void
+	SPIRVOptimizer::configure (SPIRVOptimizationLevel level, bool stripDebugInfo, bool vulkan12Target) noexcept
+	{
+		m_level = level;
+		m_stripDebugInfo = stripDebugInfo;
+		m_vulkan12Target = vulkan12Target;
+	}
+
+	uint64_t
+	SPIRVOptimizer::stamp () const noexcept
+	{
+		if ( !this->isEnabled() )
+		{
+			return 0;
+		}
+
+		std::string stamp{"spirv-opt/"};
+		stamp += to_cstring(m_level);
+		stamp += m_stripDebugInfo ? "/strip/" : "/keep/";
+		stamp += spvSoftwareVersionString();
+
+		return std::hash< std::string >{}(stamp);
+	}
+
+	bool
+	SPIRVOptimizer::optimize (const std::string & shaderIdentifier, std::vector< uint32_t > & binaryCode) noexcept
+	{
+		if ( !this->isEnabled() || binaryCode.empty() )
+		{
+			return false;
+		}
+
+		const auto targetEnvironment = m_vulkan12Target ? SPV_ENV_VULKAN_1_2 : SPV_ENV_VULKAN_1_3;
+
+		spvtools::Optimizer optimizer{targetEnvironment};
+		optimizer.SetMessageConsumer(messageConsumer(shaderIdentifier));
+
+		switch ( m_level )
+		{
+			case SPIRVOptimizationLevel::Performance :
+				optimizer.RegisterPerformancePasses();
+				break;
+
+			case SPIRVOptimizationLevel::Size :
+				optimizer.RegisterSizePasses();
+				break;
+
+			case SPIRVOptimizationLevel::None :
+				break;
+		}
+
+		if ( m_stripDebugInfo )
+		{
+			optimizer.RegisterPass(spvtools::CreateStripDebugInfoPass());
+			optimizer.RegisterPass(spvtools::CreateStripNonSemanticInfoPass());
+		}
+
+		/* NOTE: The validation runs once on the output below, not on the input. */
+		spvtools::OptimizerOptions options;
+		options.set_run_validator(false);
+
+		std::vector< uint32_t > optimizedCode;
+
+		if ( !optimizer.Run(binaryCode.data(), binaryCode.size(), &optimizedCode, options) || optimizedCode.empty() )
+		{
+			TraceWarning{ClassId} << "Unable to optimize the shader '" << shaderIdentifier << "', the binary is kept unoptimized.";
+
+			m_failureCount.fetch_add(1, std::memory_order_relaxed);
+
+			return false;
+		}
+
+		if ( !this->validate(shaderIdentifier, optimizedCode) )
+		{
+			TraceWarning{ClassId} << "The optimized shader '" << shaderIdentifier << "' is not valid, the binary is kept unoptimized.";
+
+			m_failureCount.fetch_add(1, std::memory_order_relaxed);
+
+			return false;
+		}
+
+		m_optimizedCount.fetch_add(1, std::memory_order_relaxed);
+		m_inputBytes.fetch_add(binaryCode.size() * sizeof(uint32_t), std::memory_order_relaxed);
+		m_outputBytes.fetch_add(optimizedCode.size() * sizeof(uint32_t), std::memory_order_relaxed);
+
+		binaryCode = std::move(optimizedCode);
+
+		return true;
+	}
+
+	bool
+	SPIRVOptimizer::validate (const std::string & shaderIdentifier, const std::vector< uint32_t > & binaryCode) const noexcept
+	{
+		spvtools::SpirvTools tools{m_vulkan12Target ? SPV_ENV_VULKAN_1_2 : SPV_ENV_VULKAN_1_3};
+		tools.SetMessageConsumer(messageConsumer(shaderIdentifier));
+
+		return tools.Validate(binaryCode);
+	}
+}
@@ -0,0 +1,209 @@
+/*
+ * src/Saphir/SPIRVOptimizer.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace EmEn::Saphir
+{
+	/** @brief The SPIR-V optimization levels. */
+	enum class SPIRVOptimizationLevel : uint8_t
+	{
+		/** @brief The binary is kept as glslang produced it. */
+		None,
+		/** @brief Dead code elimination, inlining, constant folding and the other performance passes. */
+		Performance,
+		/** @brief The passes reducing the binary size. */
+		Size
+	};
+
+	/**
+	 * @brief Returns a C-string version of the optimization level.
+	 * @param level The optimization level.
+	 * @return const char *
+	 */
+	[[nodiscard]]
+	EMEN_API
+	const char * to_cstring (SPIRVOptimizationLevel level) noexcept;
+
+	/**
+	 * @brief Returns the optimization level from a string, "None" for an unknown value.
+	 * @param value A reference to a string.
+	 * @return SPIRVOptimizationLevel
+	 */
+	[[nodiscard]]
+	EMEN_API
+	SPIRVOptimizationLevel to_SPIRVOptimizationLevel (std::string_view value) noexcept;
+
+	/**
+	 * @brief The SPIR-V optimization stage, between the glslang compilation and the shader caches.
+	 *
+	 * The binary runs through the SPIRV-Tools optimizer passes of the configured level, then
+	 * optionally through the strip passes (debug names, non-semantic instructions). The result is
+	 * checked by the SPIR-V validator (spirv-val) before replacing the input, a binary failing
+	 * either step is kept unoptimized.
+	 *
+	 * The stamp of the configuration is mixed into the cache keys, so the binaries of another level
+	 * are never returned. The sizes before and after are accumulated for the statistics.
+	 *
+	 * @note SPIRV-Tools stays out of this header. Every call creates its own optimizer, so a single
+	 * instance is used from any compiling thread.
+	 * @since 0.9.53
+	 */
+	class EMEN_API SPIRVOptimizer final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"SPIRVOptimizer"};
+
+			/**
+			 * @brief Constructs a disabled SPIR-V optimizer.
+			 */
+			SPIRVOptimizer () noexcept = default;
+
+			/**
+			 * @brief Configures the optimizer.
+			 * @note Must be called before the first compilation.
+			 * @param level The optimization level.
+			 * @param stripDebugInfo Removes the debug names and the non-semantic instructions.
+			 * @param vulkan12Target Targets Vulkan 1.2 (SPIR-V 1.5) instead of Vulkan 1.3 (SPIR-V 1.6).
+			 * @return void
+			 */
+			void configure (SPIRVOptimizationLevel level, bool stripDebugInfo, bool vulkan12Target) noexcept;
+
+			/**
+			 * @brief Returns whether the optimizer modifies the binaries.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isEnabled () const noexcept
+			{
+				return m_level != SPIRVOptimizationLevel::None || m_stripDebugInfo;
+			}
+
+			/**
+			 * @brief Returns the optimization level.
+			 * @return SPIRVOptimizationLevel
+			 */
+			[[nodiscard]]
+			SPIRVOptimizationLevel
+			level () const noexcept
+			{
+				return m_level;
+			}
+
+			/**
+			 * @brief Returns the stamp of the configuration, 0 when the optimizer is disabled.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t stamp () const noexcept;
+
+			/**
+			 * @brief Optimizes a SPIR-V binary in place.
+			 * @note The binary is left untouched if the optimization or the validation fails.
+			 * @param shaderIdentifier A reference to a string for the logs.
+			 * @param binaryCode A reference to the binary data vector.
+			 * @return bool True if the binary was optimized.
+			 */
+			bool optimize (const std::string & shaderIdentifier, std::vector< uint32_t > & binaryCode) noexcept;
+
+			/**
+			 * @brief Validates a SPIR-V binary like spirv-val does.
+			 * @param shaderIdentifier A reference to a string for the logs.
+			 * @param binaryCode A reference to the binary data vector.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool validate (const std::string & shaderIdentifier, const std::vector< uint32_t > & binaryCode) const noexcept;
+
+			/**
+			 * @brief Returns the number of optimized binaries.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			optimizedCount () const noexcept
+			{
+				return m_optimizedCount.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the number of binaries kept unoptimized after a failure.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			failureCount () const noexcept
+			{
+				return m_failureCount.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the total size of the optimized binaries before the optimization.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			inputBytes () const noexcept
+			{
+				return m_inputBytes.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the total size of the optimized binaries after the optimization.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			outputBytes () const noexcept
+			{
+				return m_outputBytes.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			std::atomic< uint64_t > m_optimizedCount{0};
+			std::atomic< uint64_t > m_failureCount{0};
+			std::atomic< uint64_t > m_inputBytes{0};
+			std::atomic< uint64_t > m_outputBytes{0};
+			SPIRVOptimizationLevel m_level{SPIRVOptimizationLevel::None};
+			bool m_stripDebugInfo{false};
+			bool m_vulkan12Target{false};
+	};
+}
@@ -0,0 +1,282 @@
+/*
+ * src/Saphir/ShaderArchive.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "ShaderArchive.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <system_error>
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+
+namespace EmEn::Saphir
+{
+	bool
+	ShaderArchive::open (const std::filesystem::path & filepath) noexcept
+	{
+		this->close();
+
+		if ( !m_file.map(filepath) )
+		{
+			return false;
+		}
+
+		const auto * data = m_file.data();
+		const auto size = m_file.size();
+
+		if ( size < sizeof(Header) )
+		{
+			TraceError{ClassId} << "The shader archive " << filepath << " is truncated !";
+
+			this->close();
+
+			return false;
+		}
+
+		Header header{};
+		std::memcpy(&header, data, sizeof(Header));
+
+		if ( header.magic != Magic || header.version != Version )
+		{
+			TraceError{ClassId} << "The file " << filepath << " is not a shader archive or has an unsupported version !";
+
+			this->close();
+
+			return false;
+		}
+
+		if ( header.hashProbe != ShaderArchive::hashProbe() )
+		{
+			TraceWarning{ClassId} << "The shader archive " << filepath << " was baked with another shader hash function, ignoring it.";
+
+			this->close();
+
+			return false;
+		}
+
+		const auto indexSize = static_cast< size_t >(header.entryCount) * sizeof(IndexEntry);
+
+		if ( size < sizeof(Header) + indexSize || ShaderArchive::checksum(data + sizeof(Header), indexSize) != header.indexChecksum )
+		{
+			TraceError{ClassId} << "The index of the shader archive " << filepath << " is corrupted !";
+
+			this->close();
+
+			return false;
+		}
+
+		/* NOTE: The index is 8-byte aligned in the file and the mapping is page aligned. */
+		const auto * index = reinterpret_cast< const IndexEntry * >(data + sizeof(Header));
+
+		for ( uint32_t entryIndex = 0; entryIndex < header.entryCount; ++entryIndex )
+		{
+			const auto & entry = index[entryIndex];
+
+			const auto isSorted = entryIndex == 0 || index[entryIndex - 1].hash < entry.hash;
+			const auto isInside = entry.offset % sizeof(uint32_t) == 0 && entry.offset <= size && entry.wordCount <= (size - entry.offset) / sizeof(uint32_t);
+
+			if ( !isSorted || !isInside || entry.wordCount == 0 )
+			{
+				TraceError{ClassId} << "The entry #" << entryIndex << " of the shader archive " << filepath << " is invalid !";
+
+				this->close();
+
+				return false;
+			}
+		}
+
+		m_index = index;
+		m_entryCount = header.entryCount;
+
+		TraceSuccess{ClassId} << "Shader archive " << filepath << " opened (" << m_entryCount << " shaders).";
+
+		return true;
+	}
+
+	void
+	ShaderArchive::close () noexcept
+	{
+		m_file.unmap();
+
+		m_index = nullptr;
+		m_entryCount = 0;
+	}
+
+	bool
+	ShaderArchive::find (size_t shaderHash, ShaderType shaderType, ShaderBinary & binaryCode) const noexcept
+	{
+		if ( m_index == nullptr )
+		{
+			return false;
+		}
+
+		const auto * indexEnd = m_index + m_entryCount;
+		const auto * entryIt = std::lower_bound(m_index, indexEnd, static_cast< uint64_t >(shaderHash), [] (const IndexEntry & entry, uint64_t hash) {
+			return entry.hash < hash;
+		});
+
+		if ( entryIt == indexEnd || entryIt->hash != shaderHash || entryIt->type != static_cast< uint32_t >(shaderType) )
+		{
+			return false;
+		}
+
+		const auto * binaryData = m_file.data() + entryIt->offset;
+		const auto binarySize = entryIt->wordCount * sizeof(uint32_t);
+
+		if ( ShaderArchive::checksum(binaryData, binarySize) != entryIt->binaryChecksum )
+		{
+			TraceError{ClassId} << "The binary of the shader #" << shaderHash << " is corrupted in the archive !";
+
+			return false;
+		}
+
+		binaryCode.resize(entryIt->wordCount);
+
+		std::memcpy(binaryCode.data(), binaryData, binarySize);
+
+		return true;
+	}
+
+	bool
+	ShaderArchive::write (const std::filesystem::path & filepath, std::vector< Entry > entries) noexcept
+	{
+		std::ranges::sort(entries, [] (const Entry & entryA, const Entry & entryB) {
+			return entryA.hash < entryB.hash;
+		});
+
+		const auto duplicates = std::ranges::unique(entries, [] (const Entry & entryA, const Entry & entryB) {
+			return entryA.hash == entryB.hash;
+		});
+
+		entries.erase(duplicates.begin(), duplicates.end());
+
+		std::erase_if(entries, [] (const Entry & entry) {
+			return entry.binaryCode.empty();
+		});
+
+		/* Build the index, the binaries follow it in the same order. */
+		std::vector< IndexEntry > index;
+		index.reserve(entries.size());
+
+		auto offset = static_cast< uint64_t >(sizeof(Header) + entries.size() * sizeof(IndexEntry));
+
+		for ( const auto & entry : entries )
+		{
+			const auto binarySize = entry.binaryCode.size() * sizeof(uint32_t);
+
+			index.emplace_back(IndexEntry{
+				.hash = static_cast< uint64_t >(entry.hash),
+				.offset = offset,
+				.wordCount = static_cast< uint32_t >(entry.binaryCode.size()),
+				.type = static_cast< uint32_t >(entry.type),
+				.binaryChecksum = ShaderArchive::checksum(reinterpret_cast< const std::byte * >(entry.binaryCode.data()), binarySize)
+			});
+
+			offset += binarySize;
+		}
+
+		const auto * indexBytes = reinterpret_cast< const std::byte * >(index.data());
+		const auto indexSize = index.size() * sizeof(IndexEntry);
+
+		const Header header{
+			.magic = Magic,
+			.version = Version,
+			.hashProbe = ShaderArchive::hashProbe(),
+			.entryCount = static_cast< uint32_t >(index.size()),
+			.reserved = 0,
+			.indexChecksum = ShaderArchive::checksum(indexBytes, indexSize)
+		};
+
+		auto temporaryFilepath = filepath;
+		temporaryFilepath += ".tmp";
+
+		{
+			std::ofstream file{temporaryFilepath, std::ios::binary | std::ios::trunc};
+
+			if ( !file.is_open() )
+			{
+				TraceError{ClassId} << "Unable to write the shader archive " << temporaryFilepath << " !";
+
+				return false;
+			}
+
+			file.write(reinterpret_cast< const char * >(&header), sizeof(Header));
+			file.write(reinterpret_cast< const char * >(indexBytes), static_cast< std::streamsize >(indexSize));
+
+			for ( const auto & entry : entries )
+			{
+				file.write(reinterpret_cast< const char * >(entry.binaryCode.data()), static_cast< std::streamsize >(entry.binaryCode.size() * sizeof(uint32_t)));
+			}
+
+			if ( !file.good() )
+			{
+				TraceError{ClassId} << "An error occurred while writing the shader archive " << temporaryFilepath << " !";
+
+				return false;
+			}
+		}
+
+		std::error_code errorCode;
+		std::filesystem::rename(temporaryFilepath, filepath, errorCode);
+
+		if ( errorCode )
+		{
+			TraceError{ClassId} << "Unable to rename the shader archive to " << filepath << " : " << errorCode.message();
+
+			return false;
+		}
+
+		TraceSuccess{ClassId} << "Shader archive " << filepath << " written (" << entries.size() << " shaders, " << offset << " bytes).";
+
+		return true;
+	}
+
+	uint64_t
+	ShaderArchive::hashProbe () noexcept
+	{
+		return static_cast< uint64_t >(std::hash< std::string >{}("Emeraude-Engine shader archive hash probe"));
+	}
+
+	uint64_t
+	ShaderArchive::checksum (const std::byte * data, size_t size) noexcept
+	{
+		uint64_t hash = 0xCBF29CE484222325ULL;
+
+		for ( size_t index = 0; index < size; ++index )
+		{
+			hash ^= static_cast< uint64_t >(data[index]);
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+}
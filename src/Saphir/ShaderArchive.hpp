@@ -0,0 +1,194 @@
+/*
+ * src/Saphir/ShaderArchive.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "MappedFile.hpp"
+#include "Types.hpp"
+
+namespace EmEn::Saphir
+{
+	/**
+	 * @brief A packed archive of pre-compiled SPIR-V shaders, memory-mapped and indexed by shader hash.
+	 *
+	 * Layout: a header, an index sorted by shader hash, then the SPIR-V binaries aligned on 32 bits.
+	 * A lookup is a binary search in the mapped index, only the pages of the found binary are read.
+	 * Each index entry holds the checksum of its binary, checked on lookup, a corrupted binary is
+	 * reported as missing and the shader is compiled at runtime.
+	 *
+	 * @note The shader hash is the one of AbstractShader::hash() (std::hash of the generated source
+	 * code), so an archive is only valid for the standard library it was baked with. The header
+	 * records a probe hash to reject an archive baked by another one.
+	 * @note Read-only once opened, lookups can run from any thread.
+	 * @since 0.9.53
+	 */
+	class EMEN_API ShaderArchive final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ShaderArchive"};
+
+			/** @brief The default archive file name. */
+			static constexpr auto DefaultFilename{"shaders.spva"};
+
+			/** @brief The data store directory where a shipped archive is looked for. */
+			static constexpr auto DataStoreDirectory{"data-stores/Shaders"};
+
+			/** @brief A shader to write in an archive. */
+			struct Entry
+			{
+				size_t hash{0};
+				ShaderType type{ShaderType::Undefined};
+				ShaderBinary binaryCode;
+			};
+
+			/**
+			 * @brief Constructs a closed shader archive.
+			 */
+			ShaderArchive () noexcept = default;
+
+			/**
+			 * @brief Opens an archive and validates its header and index.
+			 * @param filepath A reference to a filesystem path.
+			 * @return bool
+			 */
+			bool open (const std::filesystem::path & filepath) noexcept;
+
+			/**
+			 * @brief Closes the archive.
+			 * @return void
+			 */
+			void close () noexcept;
+
+			/**
+			 * @brief Returns whether an archive is opened.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isOpen () const noexcept
+			{
+				return m_file.isMapped();
+			}
+
+			/**
+			 * @brief Returns the number of shaders in the archive.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			entryCount () const noexcept
+			{
+				return m_entryCount;
+			}
+
+			/**
+			 * @brief Copies the binary of a shader from the archive.
+			 * @param shaderHash The shader hash.
+			 * @param shaderType The shader type, checked against the archived one.
+			 * @param binaryCode A reference to the binary data vector to complete.
+			 * @return bool False if the shader is not in the archive or its binary is corrupted.
+			 */
+			[[nodiscard]]
+			bool find (size_t shaderHash, ShaderType shaderType, ShaderBinary & binaryCode) const noexcept;
+
+			/**
+			 * @brief Writes an archive.
+			 * @note The file is written next to the destination then renamed, a reader never sees a partial archive.
+			 * @param filepath A reference to a filesystem path.
+			 * @param entries A list of shaders. Duplicated hashes are written once.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			static bool write (const std::filesystem::path & filepath, std::vector< Entry > entries) noexcept;
+
+		private:
+
+			/**
+			 * @brief The archive header.
+			 */
+			struct Header
+			{
+				uint32_t magic{0};
+				uint32_t version{0};
+				uint64_t hashProbe{0};
+				uint32_t entryCount{0};
+				uint32_t reserved{0};
+				uint64_t indexChecksum{0};
+			};
+
+			/**
+			 * @brief An index entry.
+			 */
+			struct IndexEntry
+			{
+				uint64_t hash{0};
+				uint64_t offset{0};
+				uint32_t wordCount{0};
+				uint32_t type{0};
+				uint64_t binaryChecksum{0};
+			};
+
+			/** @brief Magic number of a shader archive ("EMSA"). */
+			static constexpr uint32_t Magic{0x41534D45};
+
+			/** @brief Version of the archive layout. */
+			static constexpr uint32_t Version{2};
+
+			/**
+			 * @brief Returns the hash of a fixed string with the shader hash function.
+			 * @note Differs between standard libraries, see the class note.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t hashProbe () noexcept;
+
+			/**
+			 * @brief Returns the FNV-1a checksum of a memory block.
+			 * @param data A pointer to the data.
+			 * @param size The number of bytes.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t checksum (const std::byte * data, size_t size) noexcept;
+
+			MappedFile m_file;
+			const IndexEntry * m_index{nullptr};
+			size_t m_entryCount{0};
+	};
+}
@@ -0,0 +1,601 @@
+/*
+ * src/Saphir/ShaderCacheStore.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "ShaderCacheStore.hpp"
+
+/* STL inclusions. */
+#include <cstring>
+#include <functional>
+#include <string>
+#include <system_error>
+
+/* Local inclusions. */
+#include "ThreadPool.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Saphir
+{
+	using namespace Base;
+
+	bool
+	ShaderCacheStore::open (const std::filesystem::path & filepath, uint64_t stamp) noexcept
+	{
+		this->close();
+
+		const std::lock_guard< std::mutex > writeLock{m_writeAccess};
+		const std::lock_guard< std::shared_mutex > indexLock{m_indexAccess};
+
+		m_filepath = filepath;
+		m_stamp = stamp;
+		m_deadBytes = 0;
+
+		{
+			const std::lock_guard< std::mutex > deadLock{m_deadRecordsAccess};
+
+			m_deadRecords.clear();
+		}
+
+		std::error_code errorCode;
+		const auto fileSize = std::filesystem::exists(filepath, errorCode) ? std::filesystem::file_size(filepath, errorCode) : 0;
+
+		auto isValid = false;
+		auto appendEnabled = true;
+
+		if ( !errorCode && fileSize >= sizeof(FileHeader) && m_file.map(filepath) )
+		{
+			FileHeader header{};
+			std::memcpy(&header, m_file.data(), sizeof(FileHeader));
+
+			if ( header.magic == Magic && header.version == Version && header.hashProbe == ShaderCacheStore::hashProbe() )
+			{
+				isValid = true;
+
+				const auto validSize = this->indexRecords();
+
+				m_fileSize = validSize;
+
+				/* NOTE: An interrupted append leaves a partial record at the end, new records must not follow it. */
+				if ( validSize < m_file.size() )
+				{
+					TraceWarning{ClassId} << "The shader cache " << filepath << " ends with " << (m_file.size() - validSize) << " unreadable bytes, cutting them.";
+
+					std::filesystem::resize_file(filepath, validSize, errorCode);
+
+					if ( errorCode )
+					{
+						TraceWarning{ClassId} << "Unable to cut the shader cache (" << errorCode.message() << "), appends are disabled until the next compaction.";
+
+						m_deadBytes += m_file.size() - validSize;
+
+						appendEnabled = false;
+					}
+				}
+			}
+			else
+			{
+				TraceWarning{ClassId} << "The shader cache " << filepath << " comes from another engine version, resetting it.";
+			}
+		}
+
+		if ( !isValid )
+		{
+			m_file.unmap();
+			m_index.clear();
+			m_deadBytes = 0;
+
+			if ( !this->resetFile() )
+			{
+				TraceError{ClassId} << "Unable to create the shader cache " << filepath << " !";
+
+				return false;
+			}
+
+			m_fileSize = sizeof(FileHeader);
+		}
+
+		if ( appendEnabled && !this->openStream() )
+		{
+			TraceWarning{ClassId} << "Unable to open the shader cache " << filepath << " for writing, new shaders will not be cached.";
+		}
+
+		m_isOpen.store(true, std::memory_order_release);
+
+		TraceInfo{ClassId} << "Shader cache " << filepath << " opened (" << m_index.size() << " shaders, " << m_deadBytes.load() << " dead bytes).";
+
+		return true;
+	}
+
+	void
+	ShaderCacheStore::close () noexcept
+	{
+		{
+			std::unique_lock< std::mutex > lock{m_compactionAccess};
+
+			m_compactionDone.wait(lock, [this] {
+				return !m_compactionRunning;
+			});
+		}
+
+		const std::lock_guard< std::mutex > writeLock{m_writeAccess};
+		const std::lock_guard< std::shared_mutex > indexLock{m_indexAccess};
+
+		m_isOpen.store(false, std::memory_order_release);
+
+		m_stream.close();
+		m_file.unmap();
+		m_index.clear();
+		m_fileSize = 0;
+		m_appendEnabled = false;
+
+		const std::lock_guard< std::mutex > deadLock{m_deadRecordsAccess};
+
+		m_deadRecords.clear();
+	}
+
+	bool
+	ShaderCacheStore::find (size_t shaderHash, ShaderType shaderType, ShaderBinary & binaryCode) const noexcept
+	{
+		const std::shared_lock< std::shared_mutex > lock{m_indexAccess};
+
+		const auto locationIt = m_index.find(shaderHash);
+
+		if ( locationIt == m_index.cend() || locationIt->second.type != shaderType )
+		{
+			return false;
+		}
+
+		const auto & location = locationIt->second;
+
+		if ( this->isDeadRecord(location.offset) )
+		{
+			return false;
+		}
+
+		const auto * record = m_file.data() + location.offset;
+
+		RecordHeader header{};
+		std::memcpy(&header, record, sizeof(RecordHeader));
+
+		/* NOTE: Records are 32-bit aligned in the file and the mapping is page aligned. */
+		const auto * words = reinterpret_cast< const uint32_t * >(record + sizeof(RecordHeader));
+
+		if ( ShaderCacheStore::checksum(words, location.wordCount) != header.checksum )
+		{
+			/* NOTE: Concurrent lookups may both see the corruption, only one counts it. */
+			if ( this->markDeadRecord(location) )
+			{
+				TraceError{ClassId} << "The cached binary of shader #" << shaderHash << " is corrupted, it will be compiled again !";
+			}
+
+			return false;
+		}
+
+		binaryCode.assign(words, words + location.wordCount);
+
+		return true;
+	}
+
+	bool
+	ShaderCacheStore::append (size_t shaderHash, ShaderType shaderType, const ShaderBinary & binaryCode) noexcept
+	{
+		if ( binaryCode.empty() )
+		{
+			return false;
+		}
+
+		const std::lock_guard< std::mutex > writeLock{m_writeAccess};
+
+		if ( !m_appendEnabled )
+		{
+			return false;
+		}
+
+		const auto offset = m_fileSize.load();
+		const auto wordCount = static_cast< uint32_t >(binaryCode.size());
+		const auto bytes = this->writeRecord(m_stream, shaderHash, shaderType, binaryCode.data(), wordCount);
+
+		m_stream.flush();
+
+		if ( bytes == 0 || !m_stream.good() )
+		{
+			TraceError{ClassId} << "Unable to append the shader #" << shaderHash << " to the cache " << m_filepath << " !";
+
+			m_stream.clear();
+
+			return false;
+		}
+
+		m_fileSize += bytes;
+
+		const std::lock_guard< std::shared_mutex > indexLock{m_indexAccess};
+
+		/* NOTE: The flushed record is read back through a new mapping, the binary is not kept in memory. */
+		if ( !m_file.map(m_filepath) )
+		{
+			TraceWarning{ClassId} << "Unable to map the shader cache " << m_filepath << " again, cached shaders are available at the next run only.";
+
+			m_index.clear();
+
+			return true;
+		}
+
+		const Location location{offset, wordCount, shaderType};
+
+		if ( const auto [locationIt, inserted] = m_index.try_emplace(shaderHash, location); !inserted )
+		{
+			/* NOTE: A replaced record stays in the file until the next compaction. */
+			this->markDeadRecord(locationIt->second);
+
+			locationIt->second = location;
+		}
+
+		return true;
+	}
+
+	bool
+	ShaderCacheStore::clear () noexcept
+	{
+		const std::lock_guard< std::mutex > writeLock{m_writeAccess};
+		const std::lock_guard< std::shared_mutex > indexLock{m_indexAccess};
+
+		if ( !m_isOpen.load(std::memory_order_acquire) )
+		{
+			return false;
+		}
+
+		m_stream.close();
+		m_file.unmap();
+		m_index.clear();
+		m_deadBytes = 0;
+
+		{
+			const std::lock_guard< std::mutex > deadLock{m_deadRecordsAccess};
+
+			m_deadRecords.clear();
+		}
+
+		if ( !this->resetFile() )
+		{
+			TraceError{ClassId} << "Unable to reset the shader cache " << m_filepath << " !";
+
+			m_appendEnabled = false;
+
+			return false;
+		}
+
+		m_fileSize = sizeof(FileHeader);
+
+		return this->openStream();
+	}
+
+	bool
+	ShaderCacheStore::needsCompaction () const noexcept
+	{
+		const auto deadBytes = m_deadBytes.load();
+
+		return deadBytes >= CompactionMinimumBytes && deadBytes * 4 >= m_fileSize.load();
+	}
+
+	bool
+	ShaderCacheStore::compact () noexcept
+	{
+		const std::lock_guard< std::mutex > writeLock{m_writeAccess};
+
+		if ( !m_isOpen.load(std::memory_order_acquire) )
+		{
+			return false;
+		}
+
+		auto temporaryFilepath = m_filepath;
+		temporaryFilepath += ".compact";
+
+		std::unordered_map< uint64_t, Location > compactedIndex;
+		uint64_t fileSize = sizeof(FileHeader);
+
+		{
+			std::ofstream stream{temporaryFilepath, std::ios::binary | std::ios::trunc};
+
+			if ( !stream.is_open() )
+			{
+				TraceError{ClassId} << "Unable to write " << temporaryFilepath << " to compact the shader cache !";
+
+				return false;
+			}
+
+			const FileHeader header{Magic, Version, ShaderCacheStore::hashProbe()};
+
+			stream.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+
+			/* NOTE: Lookups keep running on the mapping, only appends wait. */
+			const std::shared_lock< std::shared_mutex > indexLock{m_indexAccess};
+
+			compactedIndex.reserve(m_index.size());
+
+			/* NOTE: Every record, appended during this run or not, is read from the mapping. */
+			for ( const auto & [hash, location] : m_index )
+			{
+				if ( this->isDeadRecord(location.offset) )
+				{
+					continue;
+				}
+
+				const auto * record = m_file.data() + location.offset;
+
+				RecordHeader recordHeader{};
+				std::memcpy(&recordHeader, record, sizeof(RecordHeader));
+
+				const auto * words = reinterpret_cast< const uint32_t * >(record + sizeof(RecordHeader));
+
+				if ( ShaderCacheStore::checksum(words, location.wordCount) != recordHeader.checksum )
+				{
+					continue;
+				}
+
+				const auto recordSize = sizeof(RecordHeader) + location.wordCount * sizeof(uint32_t);
+
+				stream.write(reinterpret_cast< const char * >(record), static_cast< std::streamsize >(recordSize));
+
+				compactedIndex.emplace(hash, Location{fileSize, location.wordCount, location.type});
+
+				fileSize += recordSize;
+			}
+
+			if ( !stream.good() )
+			{
+				TraceError{ClassId} << "An error occurred while writing " << temporaryFilepath << " !";
+
+				stream.close();
+
+				std::error_code errorCode;
+				std::filesystem::remove(temporaryFilepath, errorCode);
+
+				return false;
+			}
+		}
+
+		const auto appendEnabled = m_appendEnabled;
+		const auto recordCount = compactedIndex.size();
+
+		/* NOTE: Lookups wait during the swap, a mapped file cannot be replaced on every platform. */
+		const std::lock_guard< std::shared_mutex > indexLock{m_indexAccess};
+
+		m_stream.close();
+		m_file.unmap();
+
+		std::error_code errorCode;
+		std::filesystem::rename(temporaryFilepath, m_filepath, errorCode);
+
+		if ( errorCode )
+		{
+			TraceWarning{ClassId} << "Unable to replace the shader cache " << m_filepath << " (" << errorCode.message() << "), the compaction is postponed.";
+
+			std::filesystem::remove(temporaryFilepath, errorCode);
+
+			if ( !m_file.map(m_filepath) )
+			{
+				m_index.clear();
+			}
+
+			if ( appendEnabled )
+			{
+				this->openStream();
+			}
+
+			return false;
+		}
+
+		this->openStream();
+
+		if ( m_file.map(m_filepath) )
+		{
+			m_index = std::move(compactedIndex);
+		}
+		else
+		{
+			TraceWarning{ClassId} << "Unable to map the compacted shader cache " << m_filepath << ", cached shaders are available at the next run only.";
+
+			m_index.clear();
+		}
+
+		{
+			const std::lock_guard< std::mutex > deadLock{m_deadRecordsAccess};
+
+			m_deadRecords.clear();
+		}
+
+		const auto previousSize = m_fileSize.exchange(fileSize);
+
+		m_deadBytes = 0;
+
+		TraceSuccess{ClassId} << "Shader cache compacted from " << previousSize << " to " << fileSize << " bytes (" << recordCount << " shaders).";
+
+		return true;
+	}
+
+	void
+	ShaderCacheStore::compactInBackground (ThreadPool & threadPool) noexcept
+	{
+		{
+			const std::lock_guard< std::mutex > lock{m_compactionAccess};
+
+			if ( m_compactionRunning )
+			{
+				return;
+			}
+
+			m_compactionRunning = true;
+		}
+
+		threadPool.enqueue([this] {
+			this->compact();
+
+			/* NOTE: Notify under the lock, close() may destroy the store right after. */
+			const std::lock_guard< std::mutex > lock{m_compactionAccess};
+
+			m_compactionRunning = false;
+
+			m_compactionDone.notify_all();
+		});
+	}
+
+	bool
+	ShaderCacheStore::resetFile () noexcept
+	{
+		std::ofstream file{m_filepath, std::ios::binary | std::ios::trunc};
+
+		if ( !file.is_open() )
+		{
+			return false;
+		}
+
+		const FileHeader header{Magic, Version, ShaderCacheStore::hashProbe()};
+
+		file.write(reinterpret_cast< const char * >(&header), sizeof(FileHeader));
+
+		return file.good();
+	}
+
+	uint64_t
+	ShaderCacheStore::indexRecords () noexcept
+	{
+		const auto * data = m_file.data();
+		const auto size = static_cast< uint64_t >(m_file.size());
+
+		uint64_t offset = sizeof(FileHeader);
+
+		while ( size - offset >= sizeof(RecordHeader) )
+		{
+			RecordHeader header{};
+			std::memcpy(&header, data + offset, sizeof(RecordHeader));
+
+			const auto payloadSize = static_cast< uint64_t >(header.wordCount) * sizeof(uint32_t);
+
+			if ( header.marker != RecordMarker || header.wordCount == 0 || payloadSize > size - offset - sizeof(RecordHeader) )
+			{
+				break;
+			}
+
+			const auto recordSize = sizeof(RecordHeader) + payloadSize;
+
+			if ( header.stamp != m_stamp )
+			{
+				/* NOTE: Compiled by another compiler version. */
+				m_deadBytes += recordSize;
+			}
+			else
+			{
+				const Location location{offset, header.wordCount, static_cast< ShaderType >(header.type)};
+
+				if ( const auto [locationIt, inserted] = m_index.try_emplace(header.hash, location); !inserted )
+				{
+					/* NOTE: The last record of a shader wins. */
+					m_deadBytes += sizeof(RecordHeader) + locationIt->second.wordCount * sizeof(uint32_t);
+
+					locationIt->second = location;
+				}
+			}
+
+			offset += recordSize;
+		}
+
+		return offset;
+	}
+
+	bool
+	ShaderCacheStore::openStream () noexcept
+	{
+		m_stream.open(m_filepath, std::ios::binary | std::ios::app);
+
+		m_appendEnabled = m_stream.is_open();
+
+		return m_appendEnabled;
+	}
+
+	uint64_t
+	ShaderCacheStore::writeRecord (std::ofstream & stream, uint64_t shaderHash, ShaderType shaderType, const uint32_t * binaryCode, uint32_t wordCount) const noexcept
+	{
+		const RecordHeader header{
+			.marker = RecordMarker,
+			.type = static_cast< uint32_t >(shaderType),
+			.hash = shaderHash,
+			.stamp = m_stamp,
+			.checksum = ShaderCacheStore::checksum(binaryCode, wordCount),
+			.wordCount = wordCount,
+			.reserved = 0
+		};
+
+		const auto payloadSize = static_cast< uint64_t >(wordCount) * sizeof(uint32_t);
+
+		stream.write(reinterpret_cast< const char * >(&header), sizeof(RecordHeader));
+		stream.write(reinterpret_cast< const char * >(binaryCode), static_cast< std::streamsize >(payloadSize));
+
+		return stream.good() ? sizeof(RecordHeader) + payloadSize : 0;
+	}
+
+	bool
+	ShaderCacheStore::isDeadRecord (uint64_t offset) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_deadRecordsAccess};
+
+		return m_deadRecords.contains(offset);
+	}
+
+	bool
+	ShaderCacheStore::markDeadRecord (const Location & location) const noexcept
+	{
+		const std::lock_guard< std::mutex > lock{m_deadRecordsAccess};
+
+		if ( !m_deadRecords.insert(location.offset).second )
+		{
+			return false;
+		}
+
+		m_deadBytes += sizeof(RecordHeader) + location.wordCount * sizeof(uint32_t);
+
+		return true;
+	}
+
+	uint64_t
+	ShaderCacheStore::hashProbe () noexcept
+	{
+		return static_cast< uint64_t >(std::hash< std::string >{}("Emeraude-Engine shader cache hash probe"));
+	}
+
+	uint64_t
+	ShaderCacheStore::checksum (const uint32_t * words, size_t wordCount) noexcept
+	{
+		uint64_t hash = 0xCBF29CE484222325ULL;
+
+		for ( size_t index = 0; index < wordCount; ++index )
+		{
+			hash ^= static_cast< uint64_t >(words[index]);
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+}
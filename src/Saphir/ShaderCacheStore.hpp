@@ -0,0 +1,309 @@
+/*
+ * src/Saphir/ShaderCacheStore.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* Project configuration. */
+#include "emeraude_export.hpp"
+
+/* STL inclusions. */
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <unordered_set>
+
+/* Local inclusions for usages. */
+#include "MappedFile.hpp"
+#include "Types.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Base
+{
+	class ThreadPool;
+}
+
+namespace EmEn::Saphir
+{
+	/**
+	 * @brief The on-disk cache of compiled shaders, a single append-only file indexed in memory.
+	 *
+	 * Layout: a file header, then records of a record header followed by the SPIR-V words.
+	 * Opening maps the file and walks the record headers once to fill a hash table, no directory
+	 * is scanned and no file is opened per shader. A lookup is a hash table access and a copy out
+	 * of the mapping after the record checksum is verified.
+	 *
+	 * New binaries are appended at the end of the file which is mapped again, no copy of them stays
+	 * in memory. Records compiled by another compiler version (see the stamp), replaced or corrupted
+	 * ones are dead weight, counted once each, the file is rewritten with the live records only when
+	 * they pass a threshold, at startup or as soon as an append or a lookup crosses it.
+	 *
+	 * @note Lookups, appends and the background compaction can run from any thread.
+	 * @since 0.9.53
+	 */
+	class EMEN_API ShaderCacheStore final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ShaderCacheStore"};
+
+			/** @brief The default cache file name. */
+			static constexpr auto DefaultFilename{"shader-binaries.cache"};
+
+			/** @brief The dead bytes under which the file is never compacted. */
+			static constexpr uint64_t CompactionMinimumBytes{1024 * 1024};
+
+			/**
+			 * @brief Constructs a closed cache store.
+			 */
+			ShaderCacheStore () noexcept = default;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ShaderCacheStore (const ShaderCacheStore & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			ShaderCacheStore (ShaderCacheStore && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ShaderCacheStore &
+			 */
+			ShaderCacheStore & operator= (const ShaderCacheStore & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return ShaderCacheStore &
+			 */
+			ShaderCacheStore & operator= (ShaderCacheStore && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the cache store.
+			 */
+			~ShaderCacheStore ()
+			{
+				this->close();
+			}
+
+			/**
+			 * @brief Opens the cache file, creating it if needed, and indexes its records.
+			 * @note An unreadable file or one from another format version is reset.
+			 * @param filepath A reference to a filesystem path.
+			 * @param stamp The compiler stamp. Records with another stamp are ignored.
+			 * @return bool
+			 */
+			bool open (const std::filesystem::path & filepath, uint64_t stamp) noexcept;
+
+			/**
+			 * @brief Closes the cache file, waiting for a running compaction.
+			 * @return void
+			 */
+			void close () noexcept;
+
+			/**
+			 * @brief Returns whether the cache file is opened.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isOpen () const noexcept
+			{
+				return m_isOpen.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Copies the binary of a shader from the cache.
+			 * @param shaderHash The shader hash.
+			 * @param shaderType The shader type, checked against the cached one.
+			 * @param binaryCode A reference to the binary data vector to complete.
+			 * @return bool False if the shader is not cached or its record is corrupted.
+			 */
+			[[nodiscard]]
+			bool find (size_t shaderHash, ShaderType shaderType, ShaderBinary & binaryCode) const noexcept;
+
+			/**
+			 * @brief Appends the binary of a shader to the cache.
+			 * @param shaderHash The shader hash.
+			 * @param shaderType The shader type.
+			 * @param binaryCode A reference to the binary data vector.
+			 * @return bool
+			 */
+			bool append (size_t shaderHash, ShaderType shaderType, const ShaderBinary & binaryCode) noexcept;
+
+			/**
+			 * @brief Removes every record from the cache.
+			 * @return bool
+			 */
+			bool clear () noexcept;
+
+			/**
+			 * @brief Returns whether enough dead records accumulated to rewrite the file.
+			 * @note At least CompactionMinimumBytes and a quarter of the file.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool needsCompaction () const noexcept;
+
+			/**
+			 * @brief Rewrites the file with the live records only.
+			 * @note Appends wait for the end of the compaction, lookups only wait for the file swap.
+			 * @return bool
+			 */
+			bool compact () noexcept;
+
+			/**
+			 * @brief Runs the compaction on a thread pool task.
+			 * @param threadPool A reference to the thread pool.
+			 * @return void
+			 */
+			void compactInBackground (Base::ThreadPool & threadPool) noexcept;
+
+		private:
+
+			/** @brief The file header. */
+			struct FileHeader
+			{
+				uint32_t magic;
+				uint32_t version;
+				uint64_t hashProbe;
+			};
+
+			/** @brief The header in front of each record, followed by the SPIR-V words. */
+			struct RecordHeader
+			{
+				uint32_t marker;
+				uint32_t type;
+				uint64_t hash;
+				uint64_t stamp;
+				uint64_t checksum;
+				uint32_t wordCount;
+				uint32_t reserved;
+			};
+
+			/** @brief The location of a record in the mapped file. */
+			struct Location
+			{
+				uint64_t offset;
+				uint32_t wordCount;
+				ShaderType type;
+			};
+
+			static constexpr uint32_t Magic{0x43534D45}; /* "EMSC" */
+			static constexpr uint32_t Version{1};
+			static constexpr uint32_t RecordMarker{0x44434552}; /* "RECD" */
+
+			/**
+			 * @brief Writes an empty cache file.
+			 * @return bool
+			 */
+			bool resetFile () noexcept;
+
+			/**
+			 * @brief Indexes the records of the mapped file.
+			 * @return uint64_t The size of the valid part of the file.
+			 */
+			uint64_t indexRecords () noexcept;
+
+			/**
+			 * @brief Opens the append stream at the end of the file.
+			 * @return bool
+			 */
+			bool openStream () noexcept;
+
+			/**
+			 * @brief Writes a record to a stream.
+			 * @param stream A reference to the output stream.
+			 * @param shaderHash The shader hash.
+			 * @param shaderType The shader type.
+			 * @param binaryCode A pointer to the SPIR-V words.
+			 * @param wordCount The number of words.
+			 * @return uint64_t The number of bytes written.
+			 */
+			uint64_t writeRecord (std::ofstream & stream, uint64_t shaderHash, ShaderType shaderType, const uint32_t * binaryCode, uint32_t wordCount) const noexcept;
+
+			/**
+			 * @brief Returns whether a record was already marked dead.
+			 * @param offset The record offset in the file.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isDeadRecord (uint64_t offset) const noexcept;
+
+			/**
+			 * @brief Marks a record dead and counts its bytes, once per record.
+			 * @param location A reference to the record location.
+			 * @return bool False if the record was already dead.
+			 */
+			bool markDeadRecord (const Location & location) const noexcept;
+
+			/**
+			 * @brief Returns a value depending on the std::hash implementation.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t hashProbe () noexcept;
+
+			/**
+			 * @brief Returns the FNV-1a checksum of SPIR-V words, one word at a time.
+			 * @param words A pointer to the words.
+			 * @param wordCount The number of words.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t checksum (const uint32_t * words, size_t wordCount) noexcept;
+
+			std::filesystem::path m_filepath;
+			MappedFile m_file;
+			std::ofstream m_stream;
+			std::unordered_map< uint64_t, Location > m_index;
+			mutable std::unordered_set< uint64_t > m_deadRecords;
+			mutable std::shared_mutex m_indexAccess;
+			mutable std::mutex m_deadRecordsAccess;
+			std::mutex m_writeAccess;
+			std::mutex m_compactionAccess;
+			std::condition_variable m_compactionDone;
+			mutable std::atomic< uint64_t > m_deadBytes{0};
+			std::atomic< uint64_t > m_fileSize{0};
+			uint64_t m_stamp{0};
+			std::atomic< bool > m_isOpen{false};
+			bool m_compactionRunning{false};
+			bool m_appendEnabled{false};
+	};
+}
@@ -32,8 +32,11 @@
 /* STL inclusions. */
 #include <algorithm>
 #include <charconv>
+#include <atomic>
 #include <ranges>
+#include <sstream>
 #include <string>
+#include <unordered_map>
 
 /* Third-party inclusions. */
 #include <glslang/SPIRV/GlslangToSpv.h>
@@ -50,6 +53,7 @@
 #include "PrimaryServices.hpp"
 #include "SettingKeys.hpp"
 #include "Settings.hpp"
+#include "ThreadPool.hpp"
 #include "Vulkan/ShaderModule.hpp"
 
 namespace EmEn::Saphir
@@ -64,7 +68,6 @@ namespace EmEn::Saphir
 	struct ShaderManager::GLSLangContext
 	{
 		TBuiltInResource builtInResource{};
-		DirStackFileIncluder includer;
 		EProfile profile{ECoreProfile}; // ENoProfile
 		int defaultVersion{100};
 		EShMessages messageFilter{static_cast< EShMessages >(EShMsgDefault | EShMsgSpvRules | EShMsgVulkanRules | EShMsgDebugInfo)};
@@ -121,6 +124,22 @@ namespace EmEn::Saphir
 		}
 	}
 
+	/**
+	 * @brief Returns a stamp of the compiler and its targets, a cached binary from another one is ignored.
+	 * @return uint64_t
+	 */
+	[[nodiscard]]
+	static
+	uint64_t
+	compilerStamp () noexcept
+	{
+		std::string stamp{glslang::GetGlslVersionString()};
+		stamp += IsMacOS ? "/vulkan-1.2/spv-1.5/" : "/vulkan-1.3/spv-1.6/";
+		stamp += std::to_string(glslang::GetSpirvGeneratorVersion());
+
+		return std::hash< std::string >{}(stamp);
+	}
+
 	bool
 	ShaderManager::onInitialize () noexcept
 	{
@@ -135,6 +154,24 @@ namespace EmEn::Saphir
 			m_showSourceCode = settings.getOrSetDefault< bool >(ShowSourceCodeKey, DefaultShowSourceCode);
 			m_sourceCodeCacheEnabled = settings.getOrSetDefault< bool >(SourceCodeCacheEnabledKey, DefaultSourceCodeCacheEnabled);
 			m_binaryCacheEnabled = settings.getOrSetDefault< bool >(BinaryCacheEnabledKey, DefaultBinaryCacheEnabled);
+			m_shaderArchiveEnabled = settings.getOrSetDefault< bool >(ShaderArchiveEnabledKey, DefaultShaderArchiveEnabled);
+
+			m_spirvOptimizer.configure(
+				to_SPIRVOptimizationLevel(settings.getOrSetDefault< std::string >(ShaderOptimizationLevelKey, DefaultShaderOptimizationLevel)),
+				settings.getOrSetDefault< bool >(ShaderStripDebugInfoKey, DefaultShaderStripDebugInfo),
+				IsMacOS
+			);
+		}
+
+		/* Pre-baked shader archive shipped with the application data. */
+		if ( m_shaderArchiveEnabled )
+		{
+			const auto archiveFilepath = m_primaryServices.fileSystem().getFilepathFromDataDirectories(ShaderArchive::DataStoreDirectory, ShaderArchive::DefaultFilename);
+
+			if ( !archiveFilepath.empty() && !m_shaderArchive.open(archiveFilepath) )
+			{
+				TraceWarning{ClassId} << "Unable to use the shader archive " << archiveFilepath << ", every shader will be compiled at runtime.";
+			}
 		}
 
 		/* Shader source cache directory. */
@@ -147,14 +184,12 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		/* Shader binaries cache directory. */
-		m_shadersBinariesDirectory = m_primaryServices.fileSystem().cacheDirectory(ShaderBinariesDirectoryName);
-
-		if ( !IO::createDirectory(m_shadersBinariesDirectory) )
+		/* Shader binaries cache file. */
+		if ( m_binaryCacheEnabled && !m_shaderCacheStore.open(m_primaryServices.fileSystem().cacheDirectory(ShaderCacheStore::DefaultFilename), compilerStamp()) )
 		{
-			TraceError{ClassId} << "Unable to create '" << m_shadersBinariesDirectory << "' directory !";
+			TraceWarning{ClassId} << "Unable to open the shader binary cache, it is disabled for this run.";
 
-			return false;
+			m_binaryCacheEnabled = false;
 		}
 
 		/* Checks shader cache. */
@@ -164,12 +199,13 @@ namespace EmEn::Saphir
 		}
 		else
 		{
-			this->readCache();
+			this->compactBinaryCacheIfNeeded();
 		}
 
 		if ( m_showInformation )
 		{
 			TraceInfo{ClassId} << "GLSLang GLSL version supported : " << glslang::GetGlslVersionString();
+			TraceInfo{ClassId} << "SPIR-V optimization level : " << to_cstring(m_spirvOptimizer.level()) << (m_spirvOptimizer.isEnabled() && m_spirvOptimizer.level() == SPIRVOptimizationLevel::None ? " (strip only)" : "");
 		}
 
 		if ( !glslang::InitializeProcess() )
@@ -275,8 +311,6 @@ namespace EmEn::Saphir
 		builtInResource.limits.generalVariableIndexing = true;
 		builtInResource.limits.generalConstantMatrixVectorIndexing = true;
 
-		//m_glslang->includer.pushExternalLocalDirectory("");
-
 		return true;
 	}
 
@@ -285,9 +319,21 @@ namespace EmEn::Saphir
 	{
 		glslang::FinalizeProcess();
 
-		m_cachedShaderBinaries.clear();
-		m_cachedShaderSourceCodes.clear();
-		m_shaderModules.clear();
+		if ( const auto optimizedCount = m_spirvOptimizer.optimizedCount(); optimizedCount > 0 )
+		{
+			TraceInfo{ClassId} <<
+				"SPIR-V optimizer statistics : " << optimizedCount << " binaries optimized (" << m_spirvOptimizer.failureCount() << " kept unoptimized), "
+				<< m_spirvOptimizer.inputBytes() << " bytes reduced to " << m_spirvOptimizer.outputBytes() << " bytes.";
+		}
+
+		m_shaderArchive.close();
+		m_shaderCacheStore.close();
+
+		{
+			const std::lock_guard< std::shared_mutex > lock{m_shaderModulesAccess};
+
+			m_shaderModules.clear();
+		}
 
 		return true;
 	}
@@ -309,6 +355,8 @@ namespace EmEn::Saphir
 			return false;
 		}
 
+		const std::lock_guard< std::mutex > lock{m_sourceCodeCacheAccess};
+
 		if ( !shader.writeSourceCode(cacheFilepath) )
 		{
 			TraceError{ClassId} << "Unable to write the source cache file '" << cacheFilepath << "' for shader '" << shader.name() << "' !";
@@ -319,31 +367,32 @@ namespace EmEn::Saphir
 		return true;
 	}
 
-	bool
-	ShaderManager::cacheShaderBinary (const AbstractShader & shader, const std::vector< uint32_t > & binaryCode) const noexcept
+	size_t
+	ShaderManager::binaryKey (size_t sourceHash) const noexcept
 	{
-		if ( !m_binaryCacheEnabled )
+		const auto optimizerStamp = m_spirvOptimizer.stamp();
+
+		if ( optimizerStamp == 0 )
 		{
-			return true;
+			return sourceHash;
 		}
 
-		const auto cacheFilepath = this->generateShaderBinaryCacheFilepath(shader);
+		return sourceHash ^ (optimizerStamp + 0x9e3779b97f4a7c15ULL + (sourceHash << 6) + (sourceHash >> 2));
+	}
 
-		if ( cacheFilepath.empty() )
+	bool
+	ShaderManager::cacheShaderBinary (const AbstractShader & shader, const std::vector< uint32_t > & binaryCode) noexcept
+	{
+		if ( !m_binaryCacheEnabled )
 		{
-			TraceError{ClassId} << "Unable to get a proper binary cache path for shader '" << shader.name() << "' !";
-
-			return false;
+			return true;
 		}
 
-		if ( !IO::filePutContents(cacheFilepath, binaryCode) )
-		{
-			TraceError{ClassId} << "Unable to write the shader binary code to file '" << cacheFilepath << "' for shader '" << shader.name() << "' !";
+		const auto success = m_shaderCacheStore.append(this->binaryKey(shader.hash()), shader.type(), binaryCode);
 
-			return false;
-		}
+		this->compactBinaryCacheIfNeeded();
 
-		return true;
+		return success;
 	}
 
 	bool
@@ -354,28 +403,29 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		const auto binaryIt = m_cachedShaderBinaries.find(shader.hash());
-
-		if ( binaryIt == m_cachedShaderBinaries.cend() )
+		if ( m_shaderCacheStore.find(this->binaryKey(shader.hash()), shader.type(), binaryCode) )
 		{
-			return false;
+			return true;
 		}
 
-		if ( !IO::fileGetContents(binaryIt->second, binaryCode) )
-		{
-			TraceError{ClassId} << "Unable to read the shader binary code from file '" << binaryIt->second << "' !";
+		/* NOTE: A miss may come from a corrupted record. */
+		this->compactBinaryCacheIfNeeded();
 
-			return false;
-		}
+		return false;
+	}
 
-		if ( binaryCode.empty() )
+	void
+	ShaderManager::compactBinaryCacheIfNeeded () noexcept
+	{
+		if ( !m_shaderCacheStore.needsCompaction() )
 		{
-			TraceError{ClassId} << "The shader binary code from file '" << binaryIt->second << "' is empty !";
-
-			return false;
+			return;
 		}
 
-		return true;
+		if ( const auto threadPool = m_primaryServices.threadPool(); threadPool != nullptr )
+		{
+			m_shaderCacheStore.compactInBackground(*threadPool);
+		}
 	}
 
 	std::shared_ptr< ShaderModule >
@@ -399,15 +449,67 @@ namespace EmEn::Saphir
 			return {};
 		}
 
-		const auto shaderHash = shader.hash();
-
 		/* Checks in a loaded shader list with the hash. */
+		if ( auto shaderModule = this->findShaderModule(shader.hash()); shaderModule != nullptr )
+		{
+			return shaderModule;
+		}
+
+		std::vector< uint32_t > binaryCode;
+
+		if ( !this->getBinaryCode(shader, binaryCode) )
+		{
+			return {};
+		}
+
+		return this->createShaderModule(device, shader, std::move(binaryCode));
+	}
+
+	std::shared_ptr< ShaderModule >
+	ShaderManager::findShaderModule (size_t shaderHash) const noexcept
+	{
+		const std::shared_lock< std::shared_mutex > lock{m_shaderModulesAccess};
+
 		if ( const auto shaderIt = m_shaderModules.find(shaderHash); shaderIt != m_shaderModules.cend() )
 		{
 			return shaderIt->second;
 		}
 
-		std::vector< uint32_t > binaryCode;
+		return {};
+	}
+
+	std::shared_ptr< ShaderModule >
+	ShaderManager::createShaderModule (const std::shared_ptr< Device > & device, const AbstractShader & shader, std::vector< uint32_t > binaryCode) noexcept
+	{
+		auto shaderModule = std::make_shared< ShaderModule >(device, ShaderManager::vkShaderType(shader.type()), std::move(binaryCode));
+		shaderModule->setIdentifier(ClassId, shader.name(), "ShaderModule");
+
+		if ( !shaderModule->createOnHardware() )
+		{
+			Tracer::error(ClassId, "Unable to create a shader module !");
+
+			return {};
+		}
+
+		/* Save a copy into loaded shaders with the associated vulkan shader module.
+		 * NOTE: Two threads may have compiled the same shader, the first one registered wins. */
+		const std::lock_guard< std::shared_mutex > lock{m_shaderModulesAccess};
+
+		const auto [newShader, success] = m_shaderModules.emplace(shader.hash(), shaderModule);
+
+		return newShader->second;
+	}
+
+	bool
+	ShaderManager::getBinaryCode (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept
+	{
+		/* Checks in the pre-baked archive first, it is read-only and shared by every thread. */
+		if ( m_shaderArchive.find(this->binaryKey(shader.hash()), shader.type(), binaryCode) )
+		{
+			TraceSuccess{ClassId} << "The shader '" << shader.name() << "' (" << binaryCode.size() * sizeof(uint32_t) << " bytes) loaded from the shader archive !";
+
+			return true;
+		}
 
 		/* Checks in cached binaries to prevent a compilation. */
 		if ( this->checkBinaryFromCache(shader, binaryCode) )
@@ -415,43 +517,183 @@ namespace EmEn::Saphir
 			const auto bytes = binaryCode.size() * sizeof(uint32_t);
 
 			TraceSuccess{ClassId} << "The shader '" << shader.name() << "' (" << bytes << " bytes) loaded from binary cache !";
+
+			return true;
 		}
+
 		/* If not, we compile it. */
-		else
+
+		/* Write the source code to the cache. */
+		if ( !this->cacheShaderSourceCode(shader) )
+		{
+			TraceWarning{ClassId} << "Unable to write the source code of shader '" << shader.name() << "' to the cache !";
+		}
+
+		if ( !this->compile(shader, binaryCode) )
+		{
+			TraceError{ClassId} << "Unable to compile shader '" << shader.name() << "' !";
+
+			return false;
+		}
+
+		if ( !this->cacheShaderBinary(shader, binaryCode) )
+		{
+			TraceWarning{ClassId} << "Unable to write the binary code of shader '" << shader.name() << "' to the cache !";
+		}
+
+		return true;
+	}
+
+	bool
+	ShaderManager::compileGeneratedShaders (const std::vector< const AbstractShader * > & shaders, std::vector< std::vector< uint32_t > > & binaries, ThreadPool * threadPool) noexcept
+	{
+		if ( !this->usable() )
+		{
+			Tracer::error(ClassId, "The shader manager is not initialized !");
+
+			return false;
+		}
+
+		binaries.clear();
+		binaries.resize(shaders.size());
+
+		/* NOTE: Identical shaders in the batch are compiled once, the others copy the binary. */
+		std::vector< uint32_t > sourceIndexes(shaders.size());
+		std::vector< uint32_t > uniqueIndexes;
+
 		{
-			/* Write the source code to the cache. */
-			if ( !this->cacheShaderSourceCode(shader) )
+			std::unordered_map< size_t, uint32_t > firstIndexes;
+
+			for ( uint32_t index = 0; index < shaders.size(); ++index )
 			{
-				TraceWarning{ClassId} << "Unable to write the source code of shader '" << shader.name() << "' to the cache !";
+				const auto * shader = shaders[index];
+
+				if ( shader == nullptr || !shader->isGenerated() )
+				{
+					TraceError{ClassId} << "The shader #" << index << " of the batch is not generated !";
+
+					return false;
+				}
+
+				const auto [firstIt, isNew] = firstIndexes.emplace(shader->hash(), index);
+
+				sourceIndexes[index] = firstIt->second;
+
+				if ( isNew )
+				{
+					uniqueIndexes.emplace_back(index);
+				}
 			}
+		}
 
-			if ( !this->compile(shader, binaryCode) )
+		/* NOTE: One byte per shader, std::vector< bool > packs bits which are not safe to write concurrently. */
+		std::vector< uint8_t > results(uniqueIndexes.size(), 0);
+
+		const auto compileShader = [&] (uint32_t uniqueIndex) {
+			const auto index = uniqueIndexes[uniqueIndex];
+
+			results[uniqueIndex] = this->getBinaryCode(*shaders[index], binaries[index]) ? 1 : 0;
+		};
+
+		if ( threadPool != nullptr && uniqueIndexes.size() > 1 )
+		{
+			threadPool->parallelFor(uint32_t{0}, static_cast< uint32_t >(uniqueIndexes.size()), compileShader);
+		}
+		else
+		{
+			for ( uint32_t uniqueIndex = 0; uniqueIndex < uniqueIndexes.size(); ++uniqueIndex )
 			{
-				TraceError{ClassId} << "Unable to compile shader '" << shader.name() << "' !";
+				compileShader(uniqueIndex);
+			}
+		}
 
-				return {};
+		for ( uint32_t index = 0; index < shaders.size(); ++index )
+		{
+			if ( sourceIndexes[index] != index )
+			{
+				binaries[index] = binaries[sourceIndexes[index]];
 			}
+		}
+
+		return std::ranges::all_of(results, [] (uint8_t result) {
+			return result != 0;
+		});
+	}
+
+	bool
+	ShaderManager::bakeArchive (const std::vector< const AbstractShader * > & shaders, const std::filesystem::path & filepath, ThreadPool * threadPool) noexcept
+	{
+		std::vector< std::vector< uint32_t > > binaries;
+
+		if ( !this->compileGeneratedShaders(shaders, binaries, threadPool) )
+		{
+			TraceError{ClassId} << "Unable to compile every shader, the archive " << filepath << " is not written !";
+
+			return false;
+		}
+
+		std::vector< ShaderArchive::Entry > entries;
+		entries.reserve(shaders.size());
+
+		for ( size_t index = 0; index < shaders.size(); ++index )
+		{
+			auto & entry = entries.emplace_back();
+			entry.hash = this->binaryKey(shaders[index]->hash());
+			entry.type = shaders[index]->type();
+			entry.binaryCode = std::move(binaries[index]);
+		}
+
+		return ShaderArchive::write(filepath, std::move(entries));
+	}
+
+	size_t
+	ShaderManager::prepareShaderModules (const std::shared_ptr< Device > & device, const std::vector< const AbstractShader * > & shaders) noexcept
+	{
+		size_t readyCount = 0;
+
+		/* NOTE: Only the shaders without a shader module yet are compiled. */
+		std::vector< const AbstractShader * > missingShaders;
 
-			if ( !this->cacheShaderBinary(shader, binaryCode) )
+		for ( const auto * shader : shaders )
+		{
+			if ( shader != nullptr && shader->isGenerated() && this->findShaderModule(shader->hash()) != nullptr )
 			{
-				TraceWarning{ClassId} << "Unable to write the binary code of shader '" << shader.name() << "' to the cache !";
+				readyCount++;
+			}
+			else
+			{
+				missingShaders.emplace_back(shader);
 			}
 		}
 
-		auto shaderModule = std::make_shared< ShaderModule >(device, ShaderManager::vkShaderType(shader.type()), binaryCode);
-		shaderModule->setIdentifier(ClassId, shader.name(), "ShaderModule");
+		if ( missingShaders.empty() )
+		{
+			return readyCount;
+		}
 
-		if ( !shaderModule->createOnHardware() )
+		std::vector< std::vector< uint32_t > > binaries;
+
+		if ( !this->compileGeneratedShaders(missingShaders, binaries, m_primaryServices.threadPool().get()) )
 		{
-			Tracer::error(ClassId, "Unable to create a shader module !");
+			TraceWarning{ClassId} << "Some shaders of the batch failed to compile !";
+		}
 
-			return {};
+		for ( size_t index = 0; index < missingShaders.size(); ++index )
+		{
+			if ( binaries[index].empty() )
+			{
+				continue;
+			}
+
+			if ( this->createShaderModule(device, *missingShaders[index], std::move(binaries[index])) != nullptr )
+			{
+				readyCount++;
+			}
 		}
 
-		/* Save a copy into loaded shaders with the associated vulkan shader module. */
-		const auto [newShader, success] = m_shaderModules.emplace(shaderHash, shaderModule);
+		TraceInfo{ClassId} << readyCount << " of " << shaders.size() << " shader modules ready (" << missingShaders.size() << " prepared).";
 
-		return newShader->second;
+		return readyCount;
 	}
 
 	std::shared_ptr< ShaderModule >
@@ -475,7 +717,7 @@ namespace EmEn::Saphir
 			return {};
 		}
 
-		auto shaderModule = std::make_shared< ShaderModule >(device, ShaderManager::vkShaderType(shaderType), binaryCode);
+		auto shaderModule = std::make_shared< ShaderModule >(device, ShaderManager::vkShaderType(shaderType), std::move(binaryCode));
 		shaderModule->setIdentifier(ClassId, shaderName, "ShaderModule");
 
 		if ( !shaderModule->createOnHardware() )
@@ -504,23 +746,6 @@ namespace EmEn::Saphir
 				return {};
 			}
 
-			/* NOTE: Apply specialization constants from the Program to the fragment shader.
-			 * This is used for features like shadow mapping which can be enabled/disabled via spec constants. */
-			if ( shader->type() == ShaderType::FragmentShader && program->hasSpecializationConstants() )
-			{
-				for ( const auto & [constantId, value] : program->fragmentSpecializationConstantsBool() )
-				{
-					shaderModule->setSpecializationConstant(constantId, value);
-				}
-
-				if ( !shaderModule->rebuildPipelineShaderStageCreateInfo() )
-				{
-					TraceError{ClassId} << "Unable to rebuild pipeline shader stage create info for shader '" << shader->name() << "' !";
-
-					return {};
-				}
-			}
-
 			shaderModules.emplace_back(shaderModule);
 		}
 
@@ -528,62 +753,17 @@ namespace EmEn::Saphir
 	}
 
 	void
-	ShaderManager::readCache () noexcept
+	ShaderManager::clearCache () noexcept
 	{
-		for ( const auto & filepath : IO::directoryEntries(m_shadersSourcesDirectory) )
+		/* NOTE: The shader modules are dropped with the caches they were built from. */
 		{
-			const auto extension = IO::getFileExtension(filepath);
-			bool isShaderFile = false;
+			const std::lock_guard< std::shared_mutex > lock{m_shaderModulesAccess};
 
-			for ( const auto & allowedExtension : ShaderFileExtensions )
-			{
-				if ( extension == allowedExtension )
-				{
-					isShaderFile = true;
-					break;
-				}
-			}
-
-			if ( !isShaderFile )
-			{
-				continue;
-			}
-
-			auto hash = ShaderManager::extractHashFromFilepath(filepath);
-
-			if ( hash == 0 )
-			{
-				TraceError{ClassId} << "The hash from shader source file '" << filepath << "' is invalid !";
-
-				continue;
-			}
-
-			m_cachedShaderSourceCodes.emplace(hash, filepath);
+			m_shaderModules.clear();
 		}
 
-		for ( const auto & filepath : IO::directoryEntries(m_shadersBinariesDirectory) )
-		{
-			if ( IO::getFileExtension(filepath) != "bin" )
-			{
-				continue;
-			}
-
-			auto hash = ShaderManager::extractHashFromFilepath(filepath);
-
-			if ( hash == 0 )
-			{
-				TraceError{ClassId} << "The hash from shader binary file '" << filepath << "' is invalid !";
-
-				continue;
-			}
-
-			m_cachedShaderBinaries.emplace(hash, filepath);
-		}
-	}
+		const std::lock_guard< std::mutex > lock{m_sourceCodeCacheAccess};
 
-	void
-	ShaderManager::clearCache () noexcept
-	{
 		for ( const auto & filepath : IO::directoryEntries(m_shadersSourcesDirectory) )
 		{
 			const auto extension = IO::getFileExtension(filepath);
@@ -609,22 +789,10 @@ namespace EmEn::Saphir
 			}
 		}
 
-		m_cachedShaderSourceCodes.clear();
-
-		for ( const auto & filepath : IO::directoryEntries(m_shadersBinariesDirectory) )
+		if ( m_shaderCacheStore.isOpen() && !m_shaderCacheStore.clear() )
 		{
-			if ( IO::getFileExtension(filepath) != "bin" )
-			{
-				continue;
-			}
-
-			if ( !IO::eraseFile(filepath) )
-			{
-				TraceError{ClassId} << "Unable to erase '" << filepath << "' !";
-			}
+			Tracer::error(ClassId, "Unable to clear the shader binary cache !");
 		}
-
-		m_cachedShaderBinaries.clear();
 	}
 
 	std::filesystem::path
@@ -639,38 +807,6 @@ namespace EmEn::Saphir
 		return filepath;
 	}
 
-	std::filesystem::path
-	ShaderManager::generateShaderBinaryCacheFilepath (const AbstractShader & shader) const noexcept
-	{
-		std::stringstream filename;
-		filename << shader.name() << '_' << shader.hash() << ".bin";
-
-		auto filepath = m_shadersBinariesDirectory;
-		filepath.append(filename.str());
-
-		return filepath;
-	}
-
-	size_t
-	ShaderManager::extractHashFromFilepath (const std::filesystem::path & filepath) noexcept
-	{
-		const auto tmpA = String::explode(filepath.filename().string(), '_');
-
-		if ( tmpA.size() != 2 )
-		{
-			return 0;
-		}
-
-		const auto tmpB = String::explode(tmpA[1], '.');
-
-		if ( tmpB.size() != 2 )
-		{
-			return 0;
-		}
-
-		return std::stoull(tmpB[0]);
-	}
-
 	VkShaderStageFlagBits
 	ShaderManager::vkShaderType (ShaderType shaderType) noexcept
 	{
@@ -713,6 +849,128 @@ namespace EmEn::Saphir
 		return this->compile(shader.name(), shader.type(), shader.sourceCode(), binaryCode);
 	}
 
+	bool
+	ShaderManager::selfTest (std::string & report) noexcept
+	{
+		/* NOTE: SPIR-V magic number, the first word of every binary. */
+		constexpr uint32_t SPIRVMagic{0x07230203};
+		constexpr uint32_t ParallelCopies{8};
+
+		struct TestShader
+		{
+			const char * name;
+			ShaderType type;
+			const char * sourceCode;
+		};
+
+		const std::array< TestShader, 3 > shaders{{
+			{
+				"SelfTestVertex",
+				ShaderType::VertexShader,
+				"#version 460 core\n"
+				"layout(location = 0) in vec3 vaPosition;\n"
+				"layout(push_constant) uniform Matrices { mat4 modelViewProjection; } pcMatrices;\n"
+				"void main () { gl_Position = pcMatrices.modelViewProjection * vec4(vaPosition, 1.0); }\n"
+			},
+			{
+				"SelfTestFragment",
+				ShaderType::FragmentShader,
+				"#version 460 core\n"
+				"layout(set = 0, binding = 0) uniform sampler2D uTexture;\n"
+				"layout(location = 0) in vec2 vTexCoord;\n"
+				"layout(location = 0) out vec4 oFragColor;\n"
+				"void main () { oFragColor = texture(uTexture, vTexCoord) * 0.5; }\n"
+			},
+			{
+				"SelfTestCompute",
+				ShaderType::ComputeShader,
+				"#version 460 core\n"
+				"layout(local_size_x = 64) in;\n"
+				"layout(std430, set = 0, binding = 0) buffer Data { float values[]; } bData;\n"
+				"void main () { bData.values[gl_GlobalInvocationID.x] *= 2.0; }\n"
+			}
+		}};
+
+		if ( !this->usable() )
+		{
+			report = "The shader manager is not initialized !";
+
+			return false;
+		}
+
+		std::stringstream output;
+		bool success = true;
+
+		/* Sequential references. */
+		std::array< std::vector< uint32_t >, shaders.size() > references;
+
+		for ( size_t index = 0; index < shaders.size(); ++index )
+		{
+			const auto & shader = shaders[index];
+
+			if ( !this->compile(shader.name, shader.type, shader.sourceCode, references[index]) || references[index].empty() || references[index][0] != SPIRVMagic )
+			{
+				output << "[FAIL] " << shader.name << " does not compile to a SPIR-V binary." "\n";
+
+				success = false;
+
+				continue;
+			}
+
+			output << "[ OK ] " << shader.name << " compiles to " << references[index].size() << " words." "\n";
+		}
+
+		if ( !success )
+		{
+			report = output.str();
+
+			return false;
+		}
+
+		/* NOTE: Every shader several times at once, a compilation sharing state with another one gives a different binary. */
+		const auto taskCount = static_cast< uint32_t >(shaders.size()) * ParallelCopies;
+
+		std::vector< std::vector< uint32_t > > binaries(taskCount);
+		std::atomic< uint32_t > mismatches{0};
+
+		const auto compileTask = [&] (uint32_t taskIndex) {
+			const auto shaderIndex = taskIndex % shaders.size();
+			const auto & shader = shaders[shaderIndex];
+
+			if ( !this->compile(shader.name, shader.type, shader.sourceCode, binaries[taskIndex]) || binaries[taskIndex] != references[shaderIndex] )
+			{
+				mismatches.fetch_add(1, std::memory_order_relaxed);
+			}
+		};
+
+		if ( const auto threadPool = m_primaryServices.threadPool(); threadPool != nullptr )
+		{
+			threadPool->parallelFor(uint32_t{0}, taskCount, compileTask);
+		}
+		else
+		{
+			for ( uint32_t taskIndex = 0; taskIndex < taskCount; ++taskIndex )
+			{
+				compileTask(taskIndex);
+			}
+		}
+
+		if ( mismatches > 0 )
+		{
+			output << "[FAIL] " << mismatches.load() << " of " << taskCount << " parallel compilations differ from the sequential binary." "\n";
+
+			success = false;
+		}
+		else
+		{
+			output << "[ OK ] " << taskCount << " parallel compilations match the sequential binaries." "\n";
+		}
+
+		report = output.str();
+
+		return success;
+	}
+
 	bool
 	ShaderManager::compile (const std::string & shaderName, ShaderType type, const std::string & sourceCode, std::vector< uint32_t > & binaryCode) noexcept
 	{
@@ -754,10 +1012,16 @@ namespace EmEn::Saphir
 			glslShader.setEnvTarget(glslang::EShTargetSpv, glslang::EShTargetSpv_1_6);
 		}
 
+		/* NOTE: The includer keeps a directory stack while resolving the includes, it is local
+		 * to the compilation like the glslang shader and program, so compilations can run on
+		 * several threads. The context itself is only read, and glslang keeps its pool
+		 * allocator per thread once InitializeProcess() has been called. */
+		DirStackFileIncluder includer;
+
 		/* NOTE: Preprocess the source code. */
 		std::string preprocessedSource;
 
-		if ( !glslShader.preprocess(&m_glslang->builtInResource, m_glslang->defaultVersion, m_glslang->profile, m_glslang->forceDefaultVersionAndProfile, m_glslang->forwardCompatible, m_glslang->messageFilter, &preprocessedSource, m_glslang->includer) )
+		if ( !glslShader.preprocess(&m_glslang->builtInResource, m_glslang->defaultVersion, m_glslang->profile, m_glslang->forceDefaultVersionAndProfile, m_glslang->forwardCompatible, m_glslang->messageFilter, &preprocessedSource, includer) )
 		{
 			this->printCompilationErrors(shaderIdentifier, preprocessedSource, glslShader.getInfoLog());
 
@@ -783,7 +1047,7 @@ namespace EmEn::Saphir
 
 		glslShader.setStrings(&c_string, 1);
 
-		if ( !glslShader.parse(&m_glslang->builtInResource, m_glslang->defaultVersion, m_glslang->profile, m_glslang->forceDefaultVersionAndProfile, m_glslang->forwardCompatible, m_glslang->messageFilter, m_glslang->includer) )
+		if ( !glslShader.parse(&m_glslang->builtInResource, m_glslang->defaultVersion, m_glslang->profile, m_glslang->forceDefaultVersionAndProfile, m_glslang->forwardCompatible, m_glslang->messageFilter, includer) )
 		{
 			this->printCompilationErrors(shaderIdentifier, preprocessedSource, glslShader.getInfoLog());
 
@@ -823,7 +1087,14 @@ namespace EmEn::Saphir
 			TraceInfo{ClassId} << "GLSL to SPIR-V messages : " << messages;
 		}
 
-		this->notify(ShaderCompilationSucceed, shaderIdentifier);
+		/* NOTE: The optimization happens before the binary reaches the caches, they store the optimized version. */
+		m_spirvOptimizer.optimize(shaderIdentifier, binaryCode);
+
+		{
+			const std::lock_guard< std::mutex > lock{m_notificationAccess};
+
+			this->notify(ShaderCompilationSucceed, shaderIdentifier);
+		}
 
 		return true;
 	}
@@ -870,6 +1141,8 @@ namespace EmEn::Saphir
 			annotatedSourceCode <<
 			"/****** END OF ERRONEOUS GLSL " << shaderIdentifier << " CODE ******/" "\n";
 
+		const std::lock_guard< std::mutex > lock{m_notificationAccess};
+
 		this->notify(ShaderCompilationFailed, std::pair< std::string, std::string >(shaderIdentifier, annotatedSourceCode));
 	}
 }
@@ -33,6 +33,8 @@
 #include <filesystem>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
@@ -44,6 +46,9 @@
 #include "ObservableTrait.hpp"
 
 /* Local inclusions for usages. */
+#include "ShaderArchive.hpp"
+#include "ShaderCacheStore.hpp"
+#include "SPIRVOptimizer.hpp"
 #include "StaticVector.hpp"
 #include "Types.hpp"
 #include "Vulkan/Types.hpp"
@@ -63,6 +68,11 @@ namespace EmEn
 		class Program;
 	}
 
+	namespace Base
+	{
+		class ThreadPool;
+	}
+
 	class PrimaryServices;
 }
 
@@ -79,6 +89,8 @@ namespace EmEn::Saphir
 
 	/**
 	 * @brief The shader manager service class.
+	 * @note The compilation path is reentrant: shader modules can be requested from several
+	 * threads at once, each compilation uses its own glslang shader and includer.
 	 * @note [OBS][STATIC-OBSERVABLE]
 	 * @extends EmEn::ServiceInterface This is a service.
 	 * @extends EmEn::Base::ObservableTrait This service is observable.
@@ -90,6 +102,9 @@ namespace EmEn::Saphir
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"ShaderManagerService"};
 
+			/** @brief The cache sub-directory of generated shader source codes. */
+			static constexpr auto ShaderSourcesDirectoryName{"shader-sources"};
+
 			/** @brief Observable notification codes. */
 			enum NotificationCode : std::uint8_t
 			{
@@ -156,6 +171,8 @@ namespace EmEn::Saphir
 
 			/**
 			 * @brief Builds a Vulkan shader module a shader generated by the Saphir system.
+			 * @note The module is found by the source hash, the shader must be generated. The program key lookup
+			 * without GLSL stops at the renderer program cache, see docs/pipeline-caching-system.md.
 			 * @param device A reference to a device smart pointer.
 			 * @param shader A reference to a Saphir shader.
 			 * @return std::shared_ptr< Vulkan::ShaderModule >
@@ -183,6 +200,82 @@ namespace EmEn::Saphir
 			[[nodiscard]]
 			Base::StaticVector< std::shared_ptr< Vulkan::ShaderModule >, 5 > getShaderModules (const std::shared_ptr< Vulkan::Device > & device, const std::shared_ptr< Program > & program) noexcept;
 
+			/**
+			 * @brief Compiles a batch of generated shaders to SPIR-V across the thread pool.
+			 * @note No device is involved. The binary cache is consulted and filled like for a single shader.
+			 * @param shaders A reference to a list of generated shaders.
+			 * @param binaries A reference to a list of binaries, resized and filled in the shader order.
+			 * @param threadPool A pointer to the thread pool. Can be null to compile on the calling thread.
+			 * @return bool False if at least one shader failed to compile.
+			 */
+			[[nodiscard]]
+			bool compileGeneratedShaders (const std::vector< const AbstractShader * > & shaders, std::vector< std::vector< uint32_t > > & binaries, Base::ThreadPool * threadPool) noexcept;
+
+			/**
+			 * @brief Builds the shader modules of a batch of generated shaders, compiling the missing ones across the thread pool.
+			 * @note Used to warm the shader module cache up before the programs are created.
+			 * Must not be called from a thread pool task, the batch is split over the same pool.
+			 * @param device A reference to a device smart pointer.
+			 * @param shaders A reference to a list of generated shaders.
+			 * @return size_t The number of shaders with a shader module available.
+			 */
+			size_t prepareShaderModules (const std::shared_ptr< Vulkan::Device > & device, const std::vector< const AbstractShader * > & shaders) noexcept;
+
+			/**
+			 * @brief Writes a shader archive from a batch of generated shaders.
+			 * @note The binaries come from compileGeneratedShaders(), the archive keys from binaryKey(),
+			 * the archive matches the runtime lookup of this manager configuration.
+			 * @param shaders A reference to a list of generated shaders.
+			 * @param filepath A reference to the archive path.
+			 * @param threadPool A pointer to the thread pool. Can be null to compile on the calling thread.
+			 * @return bool False if a shader failed to compile or the archive cannot be written.
+			 */
+			[[nodiscard]]
+			bool bakeArchive (const std::vector< const AbstractShader * > & shaders, const std::filesystem::path & filepath, Base::ThreadPool * threadPool) noexcept;
+
+			/**
+			 * @brief Compiles a shader from a source code.
+			 * @note No cache is involved. Reentrant, used by the offline shader baker.
+			 * @param shaderName A reference to a string.
+			 * @param type The shader type.
+			 * @param sourceCode A reference to a string.
+			 * @param binaryCode A reference to the binary data vector to complete.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool compile (const std::string & shaderName, ShaderType type, const std::string & sourceCode, std::vector< uint32_t > & binaryCode) noexcept;
+
+			/**
+			 * @brief Compiles known shaders sequentially then in parallel and checks the binaries.
+			 * @note No device is involved. Checks the SPIR-V header and that the compilation is reentrant,
+			 * the parallel binaries must equal the sequential ones.
+			 * @param report A reference to a string receiving the results.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool selfTest (std::string & report) noexcept;
+
+			/**
+			 * @brief Returns the key of a shader binary in the shader archive and in the binary cache.
+			 * @note The source hash is mixed with the SPIR-V optimizer stamp, so a binary optimized
+			 * with another configuration is never returned. Without optimization, it is the source hash.
+			 * @param sourceHash The hash of the shader source code.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t binaryKey (size_t sourceHash) const noexcept;
+
+			/**
+			 * @brief Returns the SPIR-V optimization stage.
+			 * @return const SPIRVOptimizer &
+			 */
+			[[nodiscard]]
+			const SPIRVOptimizer &
+			spirvOptimizer () const noexcept
+			{
+				return m_spirvOptimizer;
+			}
+
 		private:
 
 			/** @copydoc EmEn::ServiceInterface::onInitialize() */
@@ -192,24 +285,41 @@ namespace EmEn::Saphir
 			bool onTerminate () noexcept override;
 
 			/**
-			 * @brief Compiles a shader from a saphir generated source code.
-			 * @param shader A reference to a shader smart pointer.
+			 * @brief Returns a shader module from the loaded list.
+			 * @param shaderHash The shader hash.
+			 * @return std::shared_ptr< Vulkan::ShaderModule >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< Vulkan::ShaderModule > findShaderModule (size_t shaderHash) const noexcept;
+
+			/**
+			 * @brief Creates a shader module from a binary and adds it to the loaded list.
+			 * @note If another thread registered the same shader first, its module is returned.
+			 * @param device A reference to a device smart pointer.
+			 * @param shader A reference to a Saphir shader.
+			 * @param binaryCode The binary data vector, moved into the shader module.
+			 * @return std::shared_ptr< Vulkan::ShaderModule >
+			 */
+			[[nodiscard]]
+			std::shared_ptr< Vulkan::ShaderModule > createShaderModule (const std::shared_ptr< Vulkan::Device > & device, const AbstractShader & shader, std::vector< uint32_t > binaryCode) noexcept;
+
+			/**
+			 * @brief Gets the binary of a generated shader from the cache or from a compilation.
+			 * @param shader A reference to a Saphir shader.
 			 * @param binaryCode A reference to the binary data vector to complete.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool compile (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept;
+			bool getBinaryCode (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept;
 
 			/**
-			 * @brief Compiles a shader from a source code.
-			 * @param shaderName A reference to a string.
-			 * @param type The shader type.
-			 * @param sourceCode A reference to a string.
+			 * @brief Compiles a shader from a saphir generated source code.
+			 * @param shader A reference to a shader smart pointer.
 			 * @param binaryCode A reference to the binary data vector to complete.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool compile (const std::string & shaderName, ShaderType type, const std::string & sourceCode, std::vector< uint32_t > & binaryCode) noexcept;
+			bool compile (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept;
 
 			/**
 			 * @brief Writes a shader source code on disk cache.
@@ -220,19 +330,13 @@ namespace EmEn::Saphir
 			bool cacheShaderSourceCode (const AbstractShader & shader) const noexcept;
 
 			/**
-			 * @brief Writes a shader binary on disk cache.
+			 * @brief Appends a shader binary to the disk cache.
 			 * @param shader A reference to a shader.
 			 * @param binaryCode A reference to the binary data vector.
 			 * @return bool
 			 */
 			[[nodiscard]]
-			bool cacheShaderBinary (const AbstractShader & shader, const std::vector< uint32_t > & binaryCode) const noexcept;
-
-			/**
-			 * @brief Reads the cache to get shader source codes and binaries.
-			 * @return void
-			 */
-			void readCache () noexcept;
+			bool cacheShaderBinary (const AbstractShader & shader, const std::vector< uint32_t > & binaryCode) noexcept;
 
 			/**
 			 * @brief Removes all sources and binary from shader cache.
@@ -249,23 +353,7 @@ namespace EmEn::Saphir
 			std::filesystem::path generateShaderSourceCacheFilepath (const AbstractShader & shader) const noexcept;
 
 			/**
-			 * @brief Generates a unique cache filepath for the shader binary.
-			 * @param shader A reference to a shader.
-			 * @return std::filesystem::path
-			 */
-			[[nodiscard]]
-			std::filesystem::path generateShaderBinaryCacheFilepath (const AbstractShader & shader) const noexcept;
-
-			/**
-			 * @brief Returns the shader hash from the filepath.
-			 * @param filepath A reference to a filesystem path.
-			 * @return size_t
-			 */
-			[[nodiscard]]
-			static size_t extractHashFromFilepath (const std::filesystem::path & filepath) noexcept;
-
-			/**
-			 * @brief Checks whether a binary exists in the cache.
+			 * @brief Checks whether a binary exists in the cache store.
 			 * @param shader A reference to a shader.
 			 * @param binaryCode A reference to the binary code to complete if exists in the cache.
 			 * @return bool
@@ -273,6 +361,12 @@ namespace EmEn::Saphir
 			[[nodiscard]]
 			bool checkBinaryFromCache (const AbstractShader & shader, std::vector< uint32_t > & binaryCode) noexcept;
 
+			/**
+			 * @brief Starts a background compaction of the binary cache when its dead records pass the threshold.
+			 * @return void
+			 */
+			void compactBinaryCacheIfNeeded () noexcept;
+
 			/**
 			 * @brief Prints compilation errors.
 			 * @param shaderIdentifier A reference to a string.
@@ -290,12 +384,11 @@ namespace EmEn::Saphir
 			[[nodiscard]]
 			static VkShaderStageFlagBits vkShaderType (ShaderType shaderType) noexcept;
 
-			static constexpr auto ShaderSourcesDirectoryName{"shader-sources"};
-			static constexpr auto ShaderBinariesDirectoryName{"shader-binaries"};
-
 			/**
-			 * @brief The GLSLang compilation context: built-in resource limits, shader
-			 * includer, GLSL profile, target version and message filter.
+			 * @brief The GLSLang compilation context: built-in resource limits, GLSL profile,
+			 * target version and message filter.
+			 * @note Read-only after onInitialize(), shared by every compiling thread. The
+			 * includer holds a directory stack, so each compilation creates its own.
 			 * @note Held by pointer so that <glslang/Public/ShaderLang.h> stays OUT of this
 			 * header. Every one of these fields is a glslang type (TBuiltInResource,
 			 * DirStackFileIncluder, EProfile, EShMessages), so keeping them by value leaked
@@ -307,14 +400,18 @@ namespace EmEn::Saphir
 
 			PrimaryServices & m_primaryServices;
 			std::map< size_t, std::shared_ptr< Vulkan::ShaderModule > > m_shaderModules;
-			std::map< size_t, std::filesystem::path > m_cachedShaderSourceCodes;
-			std::map< size_t, std::filesystem::path > m_cachedShaderBinaries;
 			std::filesystem::path m_shadersSourcesDirectory;
-			std::filesystem::path m_shadersBinariesDirectory;
 			std::unique_ptr< GLSLangContext > m_glslang;
+			ShaderArchive m_shaderArchive;
+			ShaderCacheStore m_shaderCacheStore;
+			SPIRVOptimizer m_spirvOptimizer;
+			mutable std::shared_mutex m_shaderModulesAccess;
+			mutable std::mutex m_sourceCodeCacheAccess;
+			std::mutex m_notificationAccess;
 			bool m_showInformation{false};
 			bool m_showSourceCode{false};
 			bool m_sourceCodeCacheEnabled{false};
 			bool m_binaryCacheEnabled{false};
+			bool m_shaderArchiveEnabled{false};
 	};
 }
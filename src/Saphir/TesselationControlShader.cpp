@@ -203,7 +203,7 @@ namespace EmEn::Saphir
 	}
 
 	bool
-	TesselationControlShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, std::stringstream & code, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
+	TesselationControlShader::onSourceCodeGeneration (Generator::Abstract & /*generator*/, CodeBuffer & code, std::string & /*topInstructions*/, std::string & /*outputInstructions*/) noexcept
 	{
 		/* Specific input shader code declarations. */
 		AbstractShader::generateDeclarations(code, m_stageInputs, "Stage inputs (From previous stage)");
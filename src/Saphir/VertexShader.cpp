@@ -58,7 +58,7 @@ namespace EmEn::Saphir
 	Function
 	VertexShader::generateComputeUpwardVectorFunction () noexcept
 	{
-		std::stringstream functionCode;
+		CodeBuffer functionCode;
 
 		functionCode <<
 			// Special case when backward is equal to downward (0, 1, 0).
@@ -96,7 +96,7 @@ namespace EmEn::Saphir
 
 		Function function{"computeYAxis", GLSL::FloatVector3};
 		function.addInParameter(GLSL::FloatVector3, "backward");
-		function.addInstruction(functionCode.str());
+		function.addInstruction(functionCode.view());
 
 		return function;
 	}
@@ -104,7 +104,7 @@ namespace EmEn::Saphir
 	Function
 	VertexShader::generateGetBillBoardModelMatrixFunction () noexcept
 	{
-		std::stringstream functionCode;
+		CodeBuffer functionCode;
 
 		functionCode <<
 			"\t" "const vec3 backward = normalize(cameraPosition - modelPosition);" "\n"
@@ -123,7 +123,7 @@ namespace EmEn::Saphir
 		function.addInParameter(GLSL::ConstFloatVector3, "cameraPosition");
 		function.addInParameter(GLSL::ConstFloatVector3, "modelPosition");
 		function.addInParameter(GLSL::ConstFloatVector3, "modelScaling");
-		function.addInstruction(functionCode.str());
+		function.addInstruction(functionCode.view());
 
 		return function;
 	}
@@ -239,7 +239,7 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		std::stringstream code;
+		CodeBuffer code;
 
 		if ( !this->declare(InputAttribute{VertexAttributeType::ModelPosition}) )
 		{
@@ -265,7 +265,7 @@ namespace EmEn::Saphir
 			"\t" "const mat4 InvView = inverse(" << viewMatrixSource << ");" "\n"
 			"\t" "const mat4 " << ShaderVariable::SpriteModelMatrix << " = getBillBoardModelMatrix(InvView[3].xyz, " << Attribute::ModelPosition << ", " << Attribute::ModelScaling << ");" "\n\n";
 
-		m_uniquePreparations.emplace_back(ShaderVariable::SpriteModelMatrix, code.str());
+		m_uniquePreparations.emplace_back(ShaderVariable::SpriteModelMatrix, code.take());
 
 		return true;
 	}
@@ -281,13 +281,13 @@ namespace EmEn::Saphir
 		/* NOTE: Extensions are registered in onSourceCodeGeneration() to ensure
 		 * they appear before the PerDrawDataRef declaration in the generated GLSL. */
 
-		std::stringstream code;
+		CodeBuffer code;
 
 		code <<
 			"\t" "const uint64_t perDrawAddr = packUint2x32(uvec2(" << MatrixPC(PushConstant::Component::PerDrawAddrLo) << ", " << MatrixPC(PushConstant::Component::PerDrawAddrHi) << "));" "\n"
 			"\t" "const mat4 " << ShaderVariable::MDIModelMatrix << " = mat4(PerDrawDataRef(perDrawAddr)[gl_DrawID].modelMatrix);" "\n\n";
 
-		m_uniquePreparations.emplace_back(ShaderVariable::MDIModelMatrix, code.str());
+		m_uniquePreparations.emplace_back(ShaderVariable::MDIModelMatrix, code.take());
 
 		return true;
 	}
@@ -300,7 +300,7 @@ namespace EmEn::Saphir
 			return true;
 		}
 
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* NOTE: The InstanceTransforms SSBO interleaves {model, previousModel} matrices
 		 * (stride 2). The slot is encoded in the firstInstance draw parameter: with
@@ -308,7 +308,7 @@ namespace EmEn::Saphir
 		 * shaderDrawParameters feature required (contrary to gl_BaseInstance). */
 		code << "\t" "const mat4 " << ShaderVariable::InstanceModelMatrix << " = ubInstanceTransforms.instanceMatrices[gl_InstanceIndex * 2];" "\n\n";
 
-		m_uniquePreparations.emplace_back(ShaderVariable::InstanceModelMatrix, code.str());
+		m_uniquePreparations.emplace_back(ShaderVariable::InstanceModelMatrix, code.take());
 
 		return true;
 	}
@@ -437,7 +437,7 @@ namespace EmEn::Saphir
 			return true;
 		}
 
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* NOTE: In cubemap mode, the view matrix comes from the UBO indexed by gl_ViewIndex,
 		 * not from the push constant. */
@@ -524,7 +524,7 @@ namespace EmEn::Saphir
 			code << "\t" "const mat4 " << ShaderVariable::ModelViewMatrix << " = " << MatrixPC(PushConstant::Component::ViewMatrix) << " * " << MatrixPC(PushConstant::Component::ModelMatrix) << ";" "\n";
 		}
 
-		m_uniquePreparations.emplace_back(ShaderVariable::ModelViewMatrix, code.str());
+		m_uniquePreparations.emplace_back(ShaderVariable::ModelViewMatrix, code.take());
 
 		return true;
 	}
@@ -537,7 +537,7 @@ namespace EmEn::Saphir
 			return true;
 		}
 
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		if ( this->isMDIEnabled() )
 		{
@@ -562,7 +562,7 @@ namespace EmEn::Saphir
 			code << "\t" "const mat3 " << ShaderVariable::NormalMatrix << " = transpose(mat3(inverse(" << ShaderVariable::ModelViewMatrix << ")));" "\n";
 		}
 
-		m_uniquePreparations.emplace_back(ShaderVariable::NormalMatrix, code.str());
+		m_uniquePreparations.emplace_back(ShaderVariable::NormalMatrix, code.take());
 
 		return true;
 	}
@@ -575,7 +575,7 @@ namespace EmEn::Saphir
 			return true;
 		}
 
-		std::stringstream code;
+		CodeBuffer code;
 
 		/* NOTE: CSM (Cascaded Shadow Map) mode uses multiview rendering with gl_ViewIndex
 		 * to select the correct cascade view-projection matrix from the UBO.
@@ -724,7 +724,7 @@ namespace EmEn::Saphir
 			code << "\t" "const mat4 " << ShaderVariable::ModelViewProjectionMatrix << " = " << ViewUB(Keys::UniformBlock::Component::ProjectionMatrix, false) << " * " << MatrixPC(PushConstant::Component::ViewMatrix) << " * " << MatrixPC(PushConstant::Component::ModelMatrix) << ";" "\n";
 		}
 
-		m_uniquePreparations.emplace_back(ShaderVariable::ModelViewProjectionMatrix, code.str());
+		m_uniquePreparations.emplace_back(ShaderVariable::ModelViewProjectionMatrix, code.take());
 
 		return true;
 	}
@@ -737,7 +737,7 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << '\t';
 
@@ -806,11 +806,11 @@ namespace EmEn::Saphir
 
 		if ( scope != VariableScope::ToNextStage )
 		{
-			topInstructions.append(code.str());
+			topInstructions.append(code.view());
 		}
 		else
 		{
-			outputInstructions.append(code.str());
+			outputInstructions.append(code.view());
 		}
 
 		return true;
@@ -824,7 +824,7 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << '\t';
 
@@ -848,11 +848,11 @@ namespace EmEn::Saphir
 
 		if ( scope != VariableScope::ToNextStage )
 		{
-			topInstructions.append(code.str());
+			topInstructions.append(code.view());
 		}
 		else
 		{
-			outputInstructions.append(code.str());
+			outputInstructions.append(code.view());
 		}
 
 		return true;
@@ -887,7 +887,7 @@ namespace EmEn::Saphir
 
 		const auto posExpr = m_skinningEnabled ? "skinnedPosition" : Attribute::Position;
 
-		outputInstructions.append((std::stringstream{} << "\t" "gl_Position = "  << MVPMatrix << " * vec4(" << posExpr << ", 1.0);" "\n").str());
+		outputInstructions.append((CodeBuffer{} << "\t" "gl_Position = "  << MVPMatrix << " * vec4(" << posExpr << ", 1.0);" "\n").take());
 
 		/* TAA sub-pixel jitter: applied HERE and nowhere else. Offsetting the clip position by
 		 * jitter * W is exactly an NDC translation after the perspective division. Keeping it
@@ -897,7 +897,7 @@ namespace EmEn::Saphir
 		 * main view sets a jitter, shadow maps / RTT / cubemaps push zero). */
 		if ( this->isProjectionJitterPushed() )
 		{
-			outputInstructions.append((std::stringstream{} << "\t" "gl_Position.xy += " << MatrixPC(PushConstant::Component::ProjectionJitter) << " * gl_Position.w;" "\n").str());
+			outputInstructions.append((CodeBuffer{} << "\t" "gl_Position.xy += " << MatrixPC(PushConstant::Component::ProjectionJitter) << " * gl_Position.w;" "\n").take());
 		}
 
 		return true;
@@ -906,16 +906,16 @@ namespace EmEn::Saphir
 	bool
 	VertexShader::synthesizeVertexPositionInTextureSpace (Generator::Abstract & generator, std::string & topInstructions, std::string & outputInstructions, VariableScope scope) noexcept
 	{
-		topInstructions.append((std::stringstream{} <<
+		topInstructions.append((CodeBuffer{} <<
 			"\t" "const float positionTextureX = dot(-" << ShaderVariable::PositionViewSpace << ".xyz, " << ShaderVariable::TangentViewSpace << ");" "\n" <<
 			"\t" "const float positionTextureY = dot(-" << ShaderVariable::PositionViewSpace << ".xyz, " << ShaderVariable::BinormalViewSpace << ");" "\n" <<
 			"\t" "const float positionTextureZ = dot(-" << ShaderVariable::PositionViewSpace << ".xyz, " << ShaderVariable::NormalViewSpace << ");" "\n\n"
-		).str());
+		).take());
 
 		/* FIXME: Rework this to avoid code duplication. */
 		if ( scope == VariableScope::Local )
 		{
-			topInstructions.append((std::stringstream{} << "	const vec4 " << ShaderVariable::PositionTextureSpace << " = vec4(positionTextureX, positionTextureY, positionTextureZ, 1.0);" "\n").str());
+			topInstructions.append((CodeBuffer{} << "	const vec4 " << ShaderVariable::PositionTextureSpace << " = vec4(positionTextureX, positionTextureY, positionTextureZ, 1.0);" "\n").take());
 		}
 		else
 		{
@@ -924,7 +924,7 @@ namespace EmEn::Saphir
 				return false;
 			}
 
-			const auto subCode = (std::stringstream{} << '\t' << ShaderVariable::PositionTextureSpace << " = vec4(positionTextureX, positionTextureY, positionTextureZ, 1.0);" "\n").str();
+			const auto subCode = (CodeBuffer{} << '\t' << ShaderVariable::PositionTextureSpace << " = vec4(positionTextureX, positionTextureY, positionTextureZ, 1.0);" "\n").take();
 
 			if ( scope != VariableScope::ToNextStage )
 			{
@@ -952,9 +952,9 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		outputInstructions.append((std::stringstream{} <<
+		outputInstructions.append((CodeBuffer{} <<
 			'\t' << ShaderVariable::PrimaryVertexColor << " = " << Attribute::Color << ';' << '\n'
-		).str());
+		).take());
 
 		return true;
 	}
@@ -974,9 +974,9 @@ namespace EmEn::Saphir
 				return false;
 			}
 
-			outputInstructions.append((std::stringstream{} <<
+			outputInstructions.append((CodeBuffer{} <<
 				'\t' << TCVariableName << " = " << Attribute::Primary2DTextureCoordinates << ";" "\n"
-			).str());
+			).take());
 		}
 		else if ( std::strcmp(TCVariableName, ShaderVariable::Primary3DTextureCoordinates) == 0 )
 		{
@@ -990,9 +990,9 @@ namespace EmEn::Saphir
 				return false;
 			}
 
-			outputInstructions.append((std::stringstream{} <<
+			outputInstructions.append((CodeBuffer{} <<
 				'\t' << TCVariableName << " = " << Attribute::Primary3DTextureCoordinates << ";" "\n"
-			).str());
+			).take());
 		}
 		else if ( std::strcmp(TCVariableName, ShaderVariable::Secondary2DTextureCoordinates) == 0 )
 		{
@@ -1006,9 +1006,9 @@ namespace EmEn::Saphir
 				return false;
 			}
 
-			outputInstructions.append((std::stringstream{} <<
+			outputInstructions.append((CodeBuffer{} <<
 				'\t' << TCVariableName << " = " << Attribute::Secondary2DTextureCoordinates << ";" "\n"
-			).str());
+			).take());
 		}
 		else if ( std::strcmp(TCVariableName, ShaderVariable::Secondary3DTextureCoordinates) == 0 )
 		{
@@ -1022,9 +1022,9 @@ namespace EmEn::Saphir
 				return false;
 			}
 
-			outputInstructions.append((std::stringstream{} <<
+			outputInstructions.append((CodeBuffer{} <<
 				'\t' << TCVariableName << " = " << Attribute::Secondary3DTextureCoordinates << ";" "\n"
-			).str());
+			).take());
 		}
 		else
 		{
@@ -1071,7 +1071,7 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << '\t';
 
@@ -1124,11 +1124,11 @@ namespace EmEn::Saphir
 
 		if ( scope != VariableScope::ToNextStage )
 		{
-			topInstructions.append(code.str());
+			topInstructions.append(code.view());
 		}
 		else
 		{
-			outputInstructions.append(code.str());
+			outputInstructions.append(code.view());
 		}
 
 		return true;
@@ -1169,7 +1169,7 @@ namespace EmEn::Saphir
 			return false;
 		}
 
-		std::stringstream code{};
+		CodeBuffer code{};
 
 		code << '\t';
 
@@ -1191,11 +1191,11 @@ namespace EmEn::Saphir
 
 		if ( scope != VariableScope::ToNextStage )
 		{
-			topInstructions.append(code.str());
+			topInstructions.append(code.view());
 		}
 		else
 		{
-			outputInstructions.append(code.str());
+			outputInstructions.append(code.view());
 		}
 
 		return true;
@@ -1253,15 +1253,15 @@ namespace EmEn::Saphir
 		const auto binExpr = m_skinningEnabled ? "skinnedBinormal" : Attribute::Binormal;
 		const auto norExpr = m_skinningEnabled ? "skinnedNormal" : Attribute::Normal;
 
-		topInstructions.append((std::stringstream{} <<
+		topInstructions.append((CodeBuffer{} <<
 			"	const vec3 worldT = normalize((" << modelMatrix << " * vec4(" << tanExpr << ", 0.0)).xyz);" "\n"
 			"	const vec3 worldB = normalize((" << modelMatrix << " * vec4(" << binExpr << ", 0.0)).xyz);" "\n"
 			"	const vec3 worldN = normalize((" << modelMatrix << " * vec4(" << norExpr << ", 0.0)).xyz);" "\n"
-		).str());
+		).take());
 
-		const auto matrixCode = (std::stringstream{} <<
+		const auto matrixCode = (CodeBuffer{} <<
 			'\t' << ShaderVariable::WorldTBNMatrix << " = mat3(worldT, worldB, worldN);" "\n"
-		).str();
+		).take();
 
 		if ( scope != VariableScope::ToNextStage )
 		{
@@ -1308,14 +1308,14 @@ namespace EmEn::Saphir
 			const auto binExpr = m_skinningEnabled ? "skinnedBinormal" : Attribute::Binormal;
 			const auto norExpr = m_skinningEnabled ? "skinnedNormal" : Attribute::Normal;
 
-			topInstructions.append((std::stringstream{} <<
+			topInstructions.append((CodeBuffer{} <<
 				"	const vec3 viewT = normalize(" << ShaderVariable::NormalMatrix << " * " << tanExpr << ");" "\n"
 				"	const vec3 viewB = normalize(" << ShaderVariable::NormalMatrix << " * " << binExpr << ");" "\n"
 				"	const vec3 viewN = normalize(" << ShaderVariable::NormalMatrix << " * " << norExpr << ");" "\n"
-			).str());
+			).take());
 		}
 
-		const auto matrixCode = (std::stringstream{} << '\t' << ShaderVariable::ViewTBNMatrix << " = transpose(mat3(viewT, viewB, viewN));" "\n").str();
+		const auto matrixCode = (CodeBuffer{} << '\t' << ShaderVariable::ViewTBNMatrix << " = transpose(mat3(viewT, viewB, viewN));" "\n").take();
 
 		if ( scope != VariableScope::ToNextStage )
 		{
@@ -1361,9 +1361,9 @@ namespace EmEn::Saphir
 		const auto binExpr = m_skinningEnabled ? "skinnedBinormal" : Attribute::Binormal;
 		const auto norExpr = m_skinningEnabled ? "skinnedNormal" : Attribute::Normal;
 
-		const auto matrixCode = (std::stringstream{} <<
+		const auto matrixCode = (CodeBuffer{} <<
 			'\t' << ShaderVariable::TangentToWorldMatrix << " = " << ShaderVariable::NormalMatrix << " * mat3(" << tanExpr << ", " << binExpr << ", " << norExpr << ");" "\n"
-		).str();
+		).take();
 
 		if ( scope != VariableScope::ToNextStage )
 		{
@@ -1684,7 +1684,7 @@ namespace EmEn::Saphir
 	}
 
 	bool
-	VertexShader::onSourceCodeGeneration (Generator::Abstract & generator, std::stringstream & code, std::string & topInstructions, std::string & outputInstructions) noexcept
+	VertexShader::onSourceCodeGeneration (Generator::Abstract & generator, CodeBuffer & code, std::string & topInstructions, std::string & outputInstructions) noexcept
 	{
 		/* NOTE: This will add some declarations and populate m_vertexAttributes. */
 		if ( !this->generateMainUniqueInstructions(generator, topInstructions, outputInstructions) )
@@ -28,6 +28,7 @@
 
 /* STL inclusions. */
 #include <algorithm>
+#include <atomic>
 #include <ranges>
 
 /* Local inclusions. */
@@ -44,6 +45,8 @@
 #include "Component/Visual.hpp"
 #include "Component/Weight.hpp"
 #include "Physics/AABBCollisionModel.hpp"
+#include "Graphics/Geometry/IndexedVertexResource.hpp"
+#include "Graphics/Geometry/VertexResource.hpp"
 #include "Physics/CollisionModelInterface.hpp"
 #include "Tracer.hpp"
 
@@ -56,6 +59,18 @@ namespace EmEn::Scenes
 
 	constexpr auto TracerTag{"AbstractEntity"};
 
+	namespace
+	{
+		/** @brief Creation counter of the entities, see AbstractEntity::creationIndex(). */
+		std::atomic< uint64_t > EntityCreationCounter{0};
+	}
+
+	uint64_t
+	AbstractEntity::nextCreationIndex () noexcept
+	{
+		return EntityCreationCounter.fetch_add(1, std::memory_order_relaxed);
+	}
+
 	bool
 	AbstractEntity::onNotification (const ObservableTrait * observable, int notificationCode, const std::any & data) noexcept
 	{
@@ -134,6 +149,15 @@ namespace EmEn::Scenes
 		{
 			const std::lock_guard< std::mutex > lock{m_componentsMutex};
 
+			/* NOTE: A requested hull replaces the collision model once a geometry is loaded. */
+			if ( m_convexHullMaxVertices > 0 )
+			{
+				if ( auto hull = this->generateConvexHullCollisionModel(); hull != nullptr )
+				{
+					m_collisionModel = std::move(hull);
+				}
+			}
+
 			for ( const auto & component : m_components )
 			{
 				/* Checks render ability. */
@@ -168,6 +192,7 @@ namespace EmEn::Scenes
 					switch ( m_collisionModel->modelType() )
 					{
 						case CollisionModelType::Point :
+						case CollisionModelType::ConvexHull :
 							/* Nothing to do ... */
 							break;
 
@@ -228,6 +253,7 @@ namespace EmEn::Scenes
 			switch ( m_collisionModel->modelType() )
 			{
 				case CollisionModelType::Point :
+				case CollisionModelType::ConvexHull :
 					/* Nothing to do ... */
 					break;
 
@@ -249,6 +275,86 @@ namespace EmEn::Scenes
 		m_collisionModel = std::move(model);
 	}
 
+	void
+	AbstractEntity::requestConvexHullCollisionModel (uint32_t maxVertices) noexcept
+	{
+		m_convexHullMaxVertices = std::max(maxVertices, 4U);
+
+		/* NOTE: The geometries may already be loaded, no notification would come. */
+		this->updateEntityProperties();
+	}
+
+	std::unique_ptr< ConvexHullCollisionModel >
+	AbstractEntity::generateConvexHullCollisionModel () const noexcept
+	{
+		std::vector< Vector< 3, float > > points;
+		auto loadingGeometry = false;
+
+		for ( const auto & component : m_components )
+		{
+			const auto renderableInstance = component->getRenderableInstance();
+
+			if ( renderableInstance == nullptr )
+			{
+				continue;
+			}
+
+			const auto * renderable = renderableInstance->renderable();
+
+			if ( renderable == nullptr || !renderable->isReadyForInstantiation() )
+			{
+				loadingGeometry = true;
+
+				continue;
+			}
+
+			const auto applyTransformation = renderableInstance->isFlagEnabled(Graphics::RenderableInstance::ApplyTransformationMatrix);
+			const auto & transformationMatrix = renderableInstance->transformationMatrix();
+
+			const auto addPositions = [&points, applyTransformation, &transformationMatrix] (const auto & shape) {
+				for ( const auto & vertex : shape.vertices() )
+				{
+					if ( applyTransformation )
+					{
+						const auto position = transformationMatrix * Vector< 4, float >{vertex.position(), 1.0F};
+
+						points.emplace_back(Vector< 3, float >{position[X], position[Y], position[Z]});
+					}
+					else
+					{
+						points.emplace_back(vertex.position());
+					}
+				}
+			};
+
+			const auto * geometry = renderable->geometry(0);
+
+			if ( const auto * indexedGeometry = dynamic_cast< const Graphics::Geometry::IndexedVertexResource * >(geometry); indexedGeometry != nullptr )
+			{
+				addPositions(indexedGeometry->localData());
+			}
+			else if ( const auto * vertexGeometry = dynamic_cast< const Graphics::Geometry::VertexResource * >(geometry); vertexGeometry != nullptr )
+			{
+				addPositions(vertexGeometry->localData());
+			}
+		}
+
+		/* NOTE: Wait for every geometry, a hull from a part of the entity would be replaced later anyway. */
+		if ( points.empty() || loadingGeometry )
+		{
+			return nullptr;
+		}
+
+		auto hull = ConvexHullCollisionModel::generate(points, m_convexHullMaxVertices);
+
+		if ( hull == nullptr )
+		{
+			TraceWarning{TracerTag} << "The geometry of entity '" << this->name() << "' has no volume, no convex hull collision model generated !";
+		}
+
+		return hull;
+	}
+
 	void
 	AbstractEntity::onContainerMove (const CartesianFrame< float > & worldCoordinates) noexcept
 	{
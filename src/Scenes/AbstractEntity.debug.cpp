@@ -94,6 +94,7 @@ namespace EmEn::Scenes
 
 						case CollisionModelType::AABB :
 						case CollisionModelType::Capsule : /* TODO: Implement capsule visual debug mesh. */
+						case CollisionModelType::ConvexHull : /* NOTE: Shown as its world AABB. */
 							meshResource = AbstractEntity::getBoundingBoxVisualDebug(resourceManager);
 							break;
 					}
@@ -161,6 +162,7 @@ namespace EmEn::Scenes
 							break;
 
 						case CollisionModelType::AABB :
+						case CollisionModelType::ConvexHull :
 						{
 							const auto worldFrame = this->getWorldCoordinates();
 							const auto worldAABB = m_collisionModel->getAABB(worldFrame);
@@ -303,6 +305,7 @@ namespace EmEn::Scenes
 					break;
 
 				case CollisionModelType::AABB :
+				case CollisionModelType::ConvexHull :
 				{
 					const auto worldFrame = this->getWorldCoordinates();
 					const auto worldAABB = m_collisionModel->getAABB(worldFrame);
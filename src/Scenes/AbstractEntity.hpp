@@ -52,6 +52,7 @@
 #include "Math/CartesianFrame.hpp"
 #include "StaticVector.hpp"
 #include "Physics/CollisionModelInterface.hpp"
+#include "Physics/ConvexHullCollisionModel.hpp"
 
 /* Forward declarations. */
 namespace EmEn
@@ -315,6 +316,19 @@ namespace EmEn::Scenes
 			/** @copydoc EmEn::Scenes::LocatableInterface::setCollisionModel(std::unique_ptr< Physics::CollisionModelInterface >) */
 			void setCollisionModel (std::unique_ptr< Physics::CollisionModelInterface > model) noexcept override;
 
+			/**
+			 * @brief Requests a convex hull collision model built from the geometry of the renderable components.
+			 *
+			 * The hull is generated now if the geometries are loaded, otherwise when they finish loading
+			 * (ComponentContentModified), and again each time the components change. It replaces the
+			 * current collision model. The positions come from the local data of the LOD 0 geometry
+			 * (indexed or plain vertex resources), with the instance transformation matrix applied.
+			 *
+			 * @note A geometry without volume (a plane, a line) keeps the previous collision model.
+			 * @param maxVertices The maximum number of hull vertices. Default Physics::ConvexHullCollisionModel::DefaultMaxVertices.
+			 */
+			void requestConvexHullCollisionModel (uint32_t maxVertices = Physics::ConvexHullCollisionModel::DefaultMaxVertices) noexcept;
+
 			/** @copydoc EmEn::Scenes::LocatableInterface::hasCollisionModel() const */
 			[[nodiscard]]
 			bool
@@ -669,6 +683,21 @@ namespace EmEn::Scenes
 			 */
 			bool processLogics (const Scene & scene, size_t engineCycle) noexcept;
 
+			/**
+			 * @brief Records a movement done outside processLogics() [PHYSICS].
+			 *
+			 * Used by the scene batch integration, which moves the entities after their logics update.
+			 *
+			 * @param engineCycle The current engine cycle number.
+			 * @return void
+			 * @see hasMoved()
+			 */
+			void
+			setMovedAtCycle (size_t engineCycle) noexcept
+			{
+				m_lastUpdatedMoveCycle = engineCycle;
+			}
+
 			/**
 			 * @brief Returns whether the entity has moved since the last cycle [PHYSICS].
 			 *
@@ -701,6 +730,21 @@ namespace EmEn::Scenes
 				return m_birthTime;
 			}
 
+			/**
+			 * @brief Returns the creation index of the entity.
+			 *
+			 * Entities are numbered in creation order, process wide. The physics uses it to walk
+			 * the pairs of unordered octree sectors in a reproducible order.
+			 *
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			creationIndex () const noexcept
+			{
+				return m_creationIndex;
+			}
+
 			/**
 			 * @brief Returns whether the entity is renderable.
 			 *
@@ -894,6 +938,7 @@ namespace EmEn::Scenes
 			AbstractEntity (const Scene & scene, std::string entityName, uint32_t sceneTimepointMS) noexcept
 				: NameableTrait{std::move(entityName)},
 				m_scene{scene},
+				m_creationIndex{AbstractEntity::nextCreationIndex()},
 				m_birthTime{sceneTimepointMS}
 			{
 
@@ -986,6 +1031,13 @@ namespace EmEn::Scenes
 
 		private:
 
+			/**
+			 * @brief Returns the next entity creation index.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t nextCreationIndex () noexcept;
+
 			/**
 			 * @copydoc EmEn::Base::ObserverTrait::onNotification()
 			 *
@@ -1030,6 +1082,14 @@ namespace EmEn::Scenes
 			 */
 			void refreshCollisionBoundaries () noexcept;
 
+			/**
+			 * @brief Generates the requested convex hull from the renderable components geometry.
+			 * @note Must be called with m_componentsMutex locked.
+			 * @return std::unique_ptr< Physics::ConvexHullCollisionModel > A null pointer if no geometry is loaded or the hull has no volume.
+			 */
+			[[nodiscard]]
+			std::unique_ptr< Physics::ConvexHullCollisionModel > generateConvexHullCollisionModel () const noexcept;
+
 			/**
 			 * @brief Links a component to the entity (internal).
 			 *
@@ -1178,8 +1238,10 @@ namespace EmEn::Scenes
 			mutable std::mutex m_componentsMutex;		   ///< Protects m_components for thread-safe access.
 			Physics::BodyPhysicalProperties m_bodyPhysicalProperties;  ///< Aggregated physical properties (mass, drag, etc.).
 			std::unique_ptr< Physics::CollisionModelInterface > m_collisionModel; ///< Collision model for narrow-phase detection.
+			const uint64_t m_creationIndex;				 ///< Process wide creation order (see creationIndex()).
 			const uint32_t m_birthTime{0};				  ///< Scene timestamp at creation (milliseconds).
 			size_t m_lastUpdatedMoveCycle{0};			   ///< Last engine cycle when entity moved (for hasMoved()).
+			uint32_t m_convexHullMaxVertices{0};			///< Requested convex hull vertex count, 0 when no hull is requested.
 			bool m_collisionBoundariesDirty{false};		 ///< Deferred collision shape refresh request (set under m_componentsMutex, consumed after it).
 	};
 
@@ -92,7 +92,7 @@ namespace EmEn::Scenes::Component
 			return;
 		}
 
-		m_sharedUniformBuffer->removeElement(this);
+		m_sharedUniformBuffer->removeElement(this, m_sharedUBOIndex);
 		m_sharedUniformBuffer.reset();
 	}
 
@@ -28,6 +28,7 @@
 
 /* Local inclusions. */
 #include "Scenes/Scene.hpp"
+#include "ThreadPool.hpp"
 
 namespace EmEn::Scenes::Component
 {
@@ -55,98 +56,136 @@ namespace EmEn::Scenes::Component
 		const auto & envProperties = scene.physicalEnvironmentProperties();
 		const auto emitterLocation = this->getWorldCoordinates();
 		const auto emitterMatrix = emitterLocation.getModelMatrix();
+		const auto constrained = this->isFlagEnabled(ConstrainedToEmitterSpace);
+		auto * threadPool = this->engineContext().graphicsRenderer.primaryServices().threadPool().get();
 
-		/* Particle parameters. */
-		uint32_t activeInstanceCount = 0;
-		uint32_t newParticles = this->isEmitting() ? m_particleGeneratedPerCycle : 0;
-
-		for ( auto & particle : m_particles )
+		/* Spawn new particles in the free slots. */
+		if ( this->isEmitting() )
 		{
-			bool newLocation = false;
+			/* NOTE: Constrained particles live in the emitter space, the spawn frame is the emitter origin. */
+			const auto spawnFrame = constrained ? CartesianFrame< float >{} : emitterLocation;
 
-			/* If the particle is dead, we plan a possible reset. */
-			if ( particle.isDead() )
+			for ( uint32_t index = 0; index < m_particleGeneratedPerCycle; ++index )
 			{
-				/* Replacing by a fresh new one. */
-				if ( newParticles > 0 )
-				{
-					if ( this->isFlagEnabled(ConstrainedToEmitterSpace) )
-					{
-						particle.initialize(this->getParticleLifetime(), this->getParticleSize(), m_spreadingRadius);
-					}
-					else
-					{
-						particle.initialize(this->getParticleLifetime(), this->getParticleSize(), m_spreadingRadius, emitterLocation);
-					}
-
-					newParticles--;
-
-					newLocation = true;
-				}
-				else
+				if ( !m_particles.spawn(spawnFrame, m_spreadingRadius, static_cast< float >(this->getParticleLifetime()), this->getParticleSize()) )
 				{
-					continue;
+					break;
 				}
 			}
+		}
+
+		/* Update the particles physics. */
+		ParticleSimulationParameters parameters;
+		parameters.sizeDelta = m_particleSizeDeltaPerCycle;
+		parameters.chaosMagnitude = m_chaosMagnitude;
+		parameters.toWorld = constrained ? &emitterMatrix : nullptr;
+
+		if ( !m_particlePhysicalProperties.isMassNull() )
+		{
+			parameters.gravityStep = envProperties.steppedSurfaceGravity();
+			parameters.dragFactor = 0.5F * m_particlePhysicalProperties.dragCoefficient() * envProperties.atmosphericDensity() * m_particlePhysicalProperties.surface() * m_particlePhysicalProperties.inverseMass();
+			parameters.inverseMass = m_particlePhysicalProperties.inverseMass();
+		}
+
+		/* NOTE: The modifiers are owned by scene entities, which outlive the logics update. */
+		m_activeModifiers.clear();
+
+		if ( !m_customPhysicsSimulationFunction && parameters.inverseMass > 0.0F )
+		{
+			scene.forEachModifiers([this] (const auto & modifier) {
+				m_activeModifiers.emplace_back(&modifier);
+			});
+		}
+
+		m_particles.simulate(parameters, m_activeModifiers, m_customPhysicsSimulationFunction, threadPool, static_cast< uint32_t >(scene.cycle()));
+
+		/* Update the instance buffer. */
+		this->writeInstances(emitterLocation, m_emitterMatrixRecorded ? m_previousEmitterMatrix : emitterMatrix, threadPool);
+
+		m_previousEmitterMatrix = emitterMatrix;
+		m_emitterMatrixRecorded = true;
+
+		m_renderableInstance->setActiveInstanceCount(static_cast< uint32_t >(m_particles.liveCount()));
+		m_renderableInstance->updateVideoMemory();
+	}
+
+	void
+	ParticlesEmitter::writeInstances (const CartesianFrame< float > & emitterLocation, const Matrix< 4, float > & previousEmitterMatrix, ThreadPool * threadPool) const noexcept
+	{
+		const auto constrained = this->isFlagEnabled(ConstrainedToEmitterSpace);
+		const auto emitterMatrix = emitterLocation.getModelMatrix();
+		const auto emitterScaling = emitterLocation.scalingFactor();
 
-			/* Update the particle physics. */
-			switch ( m_physicsSimulationFunction )
+		m_renderableInstance->writeLocalData([&] (float * localData, uint32_t elementCount) {
+			if ( elementCount == RenderableInstance::Multiple::SpriteVBOElementCount )
 			{
-				case PhysicsSimulationFunction::Default :
-					if ( this->isFlagEnabled(ConstrainedToEmitterSpace) )
+				/* NOTE: Sprites only need the position and the scale, no matrix is built. */
+				m_particles.forEachChunk([&] (size_t first, size_t last) {
+					for ( auto index = first; index < last; ++index )
 					{
-						const auto coordinates = CartesianFrame< float >{emitterMatrix * particle.localCoordinates().getModelMatrix()};
+						float * instance = localData + index * elementCount;
 
-						newLocation = particle.updateSimulation(scene, m_particlePhysicalProperties, coordinates);
-					}
-					else
-					{
-						newLocation = particle.updateSimulation(scene, m_particlePhysicalProperties, particle.localCoordinates());
+						auto position = m_particles.position(index);
+
+						if ( constrained )
+						{
+							CartesianFrame< float > particleFrame;
+							particleFrame.setPosition(position);
+
+							position = CartesianFrame< float >{emitterMatrix * particleFrame.getModelMatrix()}.position();
+						}
+
+						const auto scaling = emitterScaling * m_particles.size(index);
+
+						instance[0] = position[X];
+						instance[1] = position[Y];
+						instance[2] = position[Z];
+						instance[3] = scaling[X];
+						instance[4] = scaling[Y];
+						instance[5] = scaling[Z];
 					}
-					break;
+				}, threadPool);
 
-				case PhysicsSimulationFunction::Simple :
-					newLocation = m_customPhysicsSimulationSimpleFunction(particle);
-					break;
+				return;
+			}
 
-				case PhysicsSimulationFunction::Full :
-					if ( this->isFlagEnabled(ConstrainedToEmitterSpace) )
-					{
-						const auto coordinates = CartesianFrame< float >{emitterMatrix * particle.localCoordinates().getModelMatrix()};
+			const auto motionHistory = elementCount == RenderableInstance::Multiple::MeshVBOWithHistoryElementCount;
+
+			m_particles.forEachChunk([&] (size_t first, size_t last) {
+				for ( auto index = first; index < last; ++index )
+				{
+					float * instance = localData + index * elementCount;
+
+					auto particleFrame = m_particles.spawnFrame(index);
+					particleFrame.setPosition(m_particles.position(index));
 
-						newLocation = m_customPhysicsSimulationFullFunction(envProperties, m_particlePhysicalProperties, coordinates, particle);
+					if ( constrained )
+					{
+						particleFrame.setScalingFactor(m_particles.size(index));
 					}
 					else
 					{
-						newLocation = m_customPhysicsSimulationFullFunction(envProperties, m_particlePhysicalProperties, particle.localCoordinates(), particle);
+						particleFrame.setScalingFactor(emitterScaling * m_particles.size(index));
 					}
-					break;
-			}
 
-			/* Update the buffer if requested. */
-			if ( newLocation )
-			{
-				/* Update the particle. */
-				particle.update(particle.linearVelocity(), m_particleSizeDeltaPerCycle, m_chaosMagnitude);
+					const auto modelMatrix = constrained ? emitterMatrix * particleFrame.getModelMatrix() : particleFrame.getModelMatrix();
 
-				/* NOTE: This is the updated particle location. */
-				const auto particleCoordinates = particle.localCoordinates();
-				const auto modelMatrix = this->isFlagEnabled(ConstrainedToEmitterSpace) ?
-					emitterMatrix * particleCoordinates.getModelMatrix() :
-					particleCoordinates.getModelMatrix();
-				const auto scalingVector = emitterLocation.scalingFactor() * particleCoordinates.scalingFactor();
+					modelMatrix.copy(instance);
+					modelMatrix.inverse().transpose().toMatrix3().copy(instance + 16);
 
-				if ( !m_renderableInstance->updateLocalData(CartesianFrame< float >{modelMatrix, scalingVector}, activeInstanceCount) )
-				{
-					TraceError{ClassId} << "Failed to update particle local data for instance #" << activeInstanceCount;
-				}
-			}
+					/* Motion history: the previous model matrix comes from the previous position of this
+					 * particle, not from the slot, which another particle may have used last frame. */
+					if ( motionHistory )
+					{
+						particleFrame.setPosition(m_particles.previousPosition(index));
 
-			activeInstanceCount++;
-		}
+						const auto previousModelMatrix = constrained ? previousEmitterMatrix * particleFrame.getModelMatrix() : particleFrame.getModelMatrix();
 
-		m_renderableInstance->setActiveInstanceCount(activeInstanceCount);
-		m_renderableInstance->updateVideoMemory();
+						previousModelMatrix.copy(instance + RenderableInstance::Multiple::MeshVBOElementCount);
+					}
+				}
+			}, threadPool);
+		});
 	}
 
 	bool
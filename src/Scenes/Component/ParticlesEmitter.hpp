@@ -40,13 +40,15 @@
 #include "Graphics/RenderableInstance/Multiple.hpp"
 #include "Graphics/Renderer.hpp"
 #include "Time/TimedEvent.hpp"
-#include "Physics/Particle.hpp"
+#include "Physics/ParticleBatch.hpp"
 
 namespace EmEn::Scenes::Component
 {
 	/**
 	 * @brief A class that build a particle generator with a mesh or sprite instance.
 	 * @note [OBS][SHARED-OBSERVER]
+	 * Particles are stored as a structure of arrays (Physics::ParticleBatch) and simulated chunk by chunk
+	 * over the thread pool. Instance data are written straight into the renderable instance local data.
 	 * @extends EmEn::Scenes::Component::Abstract The base class for each entity component.
 	 * @extends EmEn::Base::ObserverTrait This class must dispatch modifications from a renderable instance to the entity.
 	 */
@@ -81,11 +83,9 @@ namespace EmEn::Scenes::Component
 				: Abstract{componentName, parentEntity},
 				m_renderableInterface{renderable},
 				m_renderableInstance{std::make_shared< Graphics::RenderableInstance::Multiple >(this->engineContext().graphicsRenderer.device(), renderable, instanceCount, Graphics::RenderableInstance::None)},
+				m_particles{instanceCount},
 				m_particleLimit{instanceCount}
 			{
-				/* NOTE: Prepare local data at the fixed size. */
-				m_particles.resize(m_particleLimit);
-
 				this->observe(renderable.get());
 			}
 
@@ -374,28 +374,19 @@ namespace EmEn::Scenes::Component
 
 			/**
 			 * @brief Overrides the default physics behavior for particles.
-			 * @param function A reference to a function.
-			 * @return void
-			 */
-			void
-			setCustomPhysicsSimulationFunction (const std::function< bool (Physics::Particle &) > & function) noexcept
-			{
-				m_customPhysicsSimulationSimpleFunction = function;
-
-				m_physicsSimulationFunction = PhysicsSimulationFunction::Simple;
-			}
-
-			/**
-			 * @brief Overrides the default physics behavior for particles.
-			 * @param function A reference to a function.
+			 * @note The function replaces the modifiers, gravity and drag. It is called once per span of live particles,
+			 * possibly from several threads at the same time. Lifetime, size and displacement are still applied afterward.
+			 * Positions are expressed in the emitter space when the particles are constrained to it.
+			 * @note API break: this replaces the two per-particle overloads taking a Physics::Particle, removed with that class.
+			 * A former callback ports to a loop over the span indexes, writing the position and velocity streams instead of
+			 * the particle. Its returned flag is gone, the instance data are written every tick.
+			 * @param function A reference to a function. An empty function restores the default behavior.
 			 * @return void
 			 */
 			void
-			setCustomPhysicsSimulationFunction (const std::function< bool (const Physics::EnvironmentPhysicalProperties &, const Physics::BodyPhysicalProperties &, const Base::Math::CartesianFrame< float > &, Physics::Particle &) > & function) noexcept
+			setCustomPhysicsSimulationFunction (const Physics::ParticleBatch::SpanFunction & function) noexcept
 			{
-				m_customPhysicsSimulationFullFunction = function;
-
-				m_physicsSimulationFunction = PhysicsSimulationFunction::Full;
+				m_customPhysicsSimulationFunction = function;
 			}
 
 			/**
@@ -469,6 +460,15 @@ namespace EmEn::Scenes::Component
 				return Base::Utility::quickRandom(m_minimumParticleSize, m_maximumParticleSize);
 			}
 
+			/**
+			 * @brief Writes the live particles into the renderable instance local data.
+			 * @param emitterLocation A reference to the emitter world coordinates.
+			 * @param previousEmitterMatrix A reference to the emitter model matrix of the previous tick, for the motion history of constrained particles.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			void writeInstances (const Base::Math::CartesianFrame< float > & emitterLocation, const Base::Math::Matrix< 4, float > & previousEmitterMatrix, Base::ThreadPool * threadPool) const noexcept;
+
 			/**
 			 * @brief STL streams printable object.
 			 * @param out A reference to the stream output.
@@ -485,20 +485,14 @@ namespace EmEn::Scenes::Component
 			static constexpr auto IsCollisionDisabled{UnusedFlag + 4UL};
 			static constexpr auto ConstrainedToEmitterSpace{UnusedFlag + 5UL};
 
-			enum class PhysicsSimulationFunction : uint8_t
-			{
-				Default,
-				Simple,
-				Full
-			};
-
 			std::weak_ptr< Graphics::Renderable::Abstract > m_renderableInterface;
 			std::shared_ptr< Graphics::RenderableInstance::Multiple > m_renderableInstance;
 			Physics::BodyPhysicalProperties m_particlePhysicalProperties;
-			std::vector< Physics::Particle > m_particles;
+			Physics::ParticleBatch m_particles;
 			std::unique_ptr< Base::Time::TimedEvent< uint64_t, std::micro > > m_timedEvent;
-			std::function< bool (Physics::Particle &) > m_customPhysicsSimulationSimpleFunction;
-			std::function< bool (const Physics::EnvironmentPhysicalProperties &, const Physics::BodyPhysicalProperties &, const Base::Math::CartesianFrame< float > &, Physics::Particle & particle) > m_customPhysicsSimulationFullFunction;
+			Physics::ParticleBatch::SpanFunction m_customPhysicsSimulationFunction;
+			std::vector< const AbstractModifier * > m_activeModifiers;
+			Base::Math::Matrix< 4, float > m_previousEmitterMatrix;
 			uint32_t m_particleLimit;
 			uint32_t m_particleGeneratedPerCycle{1};
 			uint32_t m_minimumParticleLifetime{1};
@@ -508,7 +502,7 @@ namespace EmEn::Scenes::Component
 			float m_particleSizeDeltaPerCycle{0.0F};
 			float m_spreadingRadius{1.0F};
 			float m_chaosMagnitude{0.0F};
-			PhysicsSimulationFunction m_physicsSimulationFunction{PhysicsSimulationFunction::Default};
+			bool m_emitterMatrixRecorded{false};
 	};
 
 	inline
@@ -527,7 +521,7 @@ namespace EmEn::Scenes::Component
 			"Particles size processLogics factor : " << obj.m_particleSizeDeltaPerCycle << "\n"
 			"Spreading : " << obj.m_spreadingRadius << "\n"
 			"Chaos magnitude : " << obj.m_chaosMagnitude << "\n"
-			"Living particles : " << obj.m_particles.size() << '\n';
+			"Living particles : " << obj.m_particles.liveCount() << '\n';
 	}
 
 	/**
@@ -101,6 +101,7 @@ namespace EmEn::Scenes::Component
 
 					case CollisionModelType::AABB :
 					case CollisionModelType::Capsule :
+					case CollisionModelType::ConvexHull :
 					{
 						const auto worldAABB = model->getAABB(worldCoordinates);
 
@@ -0,0 +1,299 @@
+/*
+ * src/Scenes/ContactIslands.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "ContactIslands.hpp"
+
+/* Local inclusions. */
+#include "AbstractEntity.hpp"
+#include "Physics/MovableTrait.hpp"
+
+namespace EmEn::Scenes
+{
+	void
+	ContactIslands::addBody (const std::shared_ptr< AbstractEntity > & entity) noexcept
+	{
+		static_cast< void >(this->bodyIndex(entity));
+
+		/* NOTE: Only awake bodies are registered, a body of a sleeping island found here
+		 * has been woken up by a force, a modifier or a teleport. */
+		this->wakeIslandOf(*entity);
+	}
+
+	void
+	ContactIslands::addContact (const std::shared_ptr< AbstractEntity > & entityA, const std::shared_ptr< AbstractEntity > & entityB) noexcept
+	{
+		const auto rootA = this->findRoot(this->bodyIndex(entityA));
+		const auto rootB = this->findRoot(this->bodyIndex(entityB));
+
+		if ( rootA != rootB )
+		{
+			m_parents[rootB] = rootA;
+		}
+
+		/* NOTE: A sleeping body touched by an awake one wakes its whole island before the solver runs. */
+		if ( !entityA->isSimulationPaused() )
+		{
+			this->wakeIslandOf(*entityB);
+		}
+
+		if ( !entityB->isSimulationPaused() )
+		{
+			this->wakeIslandOf(*entityA);
+		}
+	}
+
+	void
+	ContactIslands::removeBody (const AbstractEntity & entity) noexcept
+	{
+		this->detachSleepingBody(&entity);
+	}
+
+	void
+	ContactIslands::update () noexcept
+	{
+		/* 1. Gather the islands of this tick. */
+		std::unordered_map< size_t, std::vector< size_t > > islands;
+
+		for ( size_t index = 0; index < m_bodies.size(); ++index )
+		{
+			islands[this->findRoot(index)].emplace_back(index);
+		}
+
+		/* 2. An island sleeps when every body is at rest and one of them is lying on a stable surface. */
+		for ( const auto & island : islands )
+		{
+			const auto & members = island.second;
+			bool atRest = true;
+			bool supported = false;
+
+			for ( const auto index : members )
+			{
+				const auto & entity = m_bodies[index];
+
+				/* NOTE: A body still asleep has been touched without being pushed,
+				 * it stays at rest and its own island is already supported. */
+				if ( entity->isSimulationPaused() )
+				{
+					supported = true;
+
+					continue;
+				}
+
+				const auto * movable = entity->getMovableTrait();
+
+				if ( movable == nullptr || !movable->isAtRest() )
+				{
+					atRest = false;
+
+					break;
+				}
+
+				supported = supported || movable->isActivelyOnStableSurface();
+			}
+
+			if ( atRest && supported )
+			{
+				this->sleepIsland(members);
+			}
+		}
+
+		m_bodies.clear();
+		m_parents.clear();
+		m_bodyIndexes.clear();
+	}
+
+	void
+	ContactIslands::clear () noexcept
+	{
+		m_bodies.clear();
+		m_parents.clear();
+		m_bodyIndexes.clear();
+		m_sleepingIslands.clear();
+		m_freeIslandSlots.clear();
+		m_sleepingBodies.clear();
+	}
+
+	bool
+	ContactIslands::isSleeping (const AbstractEntity & entity) const noexcept
+	{
+		const auto bodyIt = m_sleepingBodies.find(&entity);
+
+		return bodyIt != m_sleepingBodies.cend() && bodyIt->second.entity.lock().get() == &entity;
+	}
+
+	size_t
+	ContactIslands::sleepingIslandCount () const noexcept
+	{
+		return m_sleepingIslands.size() - m_freeIslandSlots.size();
+	}
+
+	size_t
+	ContactIslands::bodyIndex (const std::shared_ptr< AbstractEntity > & entity) noexcept
+	{
+		const auto [bodyIt, inserted] = m_bodyIndexes.try_emplace(entity.get(), m_bodies.size());
+
+		if ( inserted )
+		{
+			m_bodies.emplace_back(entity);
+			m_parents.emplace_back(bodyIt->second);
+		}
+
+		return bodyIt->second;
+	}
+
+	size_t
+	ContactIslands::findRoot (size_t index) noexcept
+	{
+		while ( m_parents[index] != index )
+		{
+			/* NOTE: Path halving, every visited node skips its parent. */
+			m_parents[index] = m_parents[m_parents[index]];
+			index = m_parents[index];
+		}
+
+		return index;
+	}
+
+	void
+	ContactIslands::wakeIslandOf (const AbstractEntity & entity) noexcept
+	{
+		const auto bodyIt = m_sleepingBodies.find(&entity);
+
+		if ( bodyIt == m_sleepingBodies.end() )
+		{
+			return;
+		}
+
+		/* NOTE: The record belongs to a destroyed body which left its address to this one. */
+		if ( bodyIt->second.entity.lock().get() != &entity )
+		{
+			this->removeBody(entity);
+
+			return;
+		}
+
+		this->wakeIsland(bodyIt->second.islandIndex);
+	}
+
+	void
+	ContactIslands::wakeIsland (size_t islandIndex) noexcept
+	{
+		auto & island = m_sleepingIslands[islandIndex];
+
+		for ( const auto * key : island )
+		{
+			/* NOTE: The body may have joined another sleeping island since, which keeps it. */
+			const auto bodyIt = m_sleepingBodies.find(key);
+
+			if ( bodyIt == m_sleepingBodies.end() || bodyIt->second.islandIndex != islandIndex )
+			{
+				continue;
+			}
+
+			const auto entity = bodyIt->second.entity.lock();
+
+			m_sleepingBodies.erase(bodyIt);
+
+			if ( entity != nullptr && entity.get() == key )
+			{
+				entity->pauseSimulation(false);
+			}
+		}
+
+		island.clear();
+
+		m_freeIslandSlots.emplace_back(islandIndex);
+	}
+
+	void
+	ContactIslands::detachSleepingBody (const AbstractEntity * entity) noexcept
+	{
+		const auto bodyIt = m_sleepingBodies.find(entity);
+
+		if ( bodyIt == m_sleepingBodies.end() )
+		{
+			return;
+		}
+
+		const auto islandIndex = bodyIt->second.islandIndex;
+
+		m_sleepingBodies.erase(bodyIt);
+
+		auto & island = m_sleepingIslands[islandIndex];
+
+		std::erase(island, entity);
+
+		if ( island.empty() )
+		{
+			m_freeIslandSlots.emplace_back(islandIndex);
+		}
+	}
+
+	void
+	ContactIslands::sleepIsland (const std::vector< size_t > & members) noexcept
+	{
+		/* NOTE: A body touched while asleep is still recorded in its previous island. It leaves
+		 * it first, so the previous slot is released as soon as the rebuilt island empties it. */
+		for ( const auto index : members )
+		{
+			this->detachSleepingBody(m_bodies[index].get());
+		}
+
+		size_t islandIndex = m_sleepingIslands.size();
+
+		if ( m_freeIslandSlots.empty() )
+		{
+			m_sleepingIslands.emplace_back();
+		}
+		else
+		{
+			islandIndex = m_freeIslandSlots.back();
+
+			m_freeIslandSlots.pop_back();
+		}
+
+		auto & island = m_sleepingIslands[islandIndex];
+		island.reserve(members.size());
+
+		for ( const auto index : members )
+		{
+			const auto & entity = m_bodies[index];
+
+			if ( auto * movable = entity->getMovableTrait(); movable != nullptr )
+			{
+				/* Clamp micro-velocities to zero. */
+				movable->stopMovement();
+			}
+
+			entity->pauseSimulation(true);
+
+			island.emplace_back(entity.get());
+
+			m_sleepingBodies[entity.get()] = SleepingBody{islandIndex, entity};
+		}
+	}
+}
@@ -0,0 +1,185 @@
+/*
+ * src/Scenes/ContactIslands.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+/* Forward declarations. */
+namespace EmEn::Scenes
+{
+	class AbstractEntity;
+}
+
+namespace EmEn::Scenes
+{
+	/**
+	 * @brief Groups the awake bodies touching each other into islands and puts them to sleep together.
+	 *
+	 * Islands are rebuilt every physics tick with a union-find over the body pairs in contact.
+	 * An island sleeps only when all of its bodies are at rest and one of them lies on the ground
+	 * or a boundary floor. A sleeping island is remembered, so the whole island wakes as soon as one
+	 * of its bodies is found awake (force, modifier or teleport) or is touched by an awake body,
+	 * in the same tick, before the contacts are solved.
+	 *
+	 * Two sleeping bodies are never tested against each other, and a sleeping body never starts a
+	 * pair walk nor updates its octree sectors, so a settled pile costs nothing to the broadphase
+	 * and the solver until something touches it.
+	 *
+	 * @note Used inside the physics octree lock, by the logic thread and by the octree updates.
+	 * @since 0.9.53
+	 */
+	class EMEN_API ContactIslands final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ContactIslands"};
+
+			/**
+			 * @brief Constructs an empty island set.
+			 */
+			ContactIslands () noexcept = default;
+
+			/**
+			 * @brief Registers an awake body for this tick. If the body belongs to a sleeping island, the island wakes.
+			 * @param entity A reference to the entity smart pointer.
+			 * @return void
+			 */
+			void addBody (const std::shared_ptr< AbstractEntity > & entity) noexcept;
+
+			/**
+			 * @brief Links two bodies in contact during this tick.
+			 * If one body is awake and the other belongs to a sleeping island, the island wakes.
+			 * @note Must be called before the contacts are solved, so the woken bodies take part in the solve of this tick.
+			 * @param entityA A reference to the first entity smart pointer.
+			 * @param entityB A reference to the second entity smart pointer.
+			 * @return void
+			 */
+			void addContact (const std::shared_ptr< AbstractEntity > & entityA, const std::shared_ptr< AbstractEntity > & entityB) noexcept;
+
+			/**
+			 * @brief Forgets a body removed from the scene.
+			 * @param entity A reference to the entity.
+			 * @return void
+			 */
+			void removeBody (const AbstractEntity & entity) noexcept;
+
+			/**
+			 * @brief Puts to sleep the islands of this tick at rest, and starts the next tick.
+			 * @return void
+			 */
+			void update () noexcept;
+
+			/**
+			 * @brief Forgets every island.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+			/**
+			 * @brief Returns whether a body belongs to a sleeping island.
+			 * @note Such a body is not moved by the physics, the broadphase can skip its update.
+			 * @param entity A reference to the entity.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isSleeping (const AbstractEntity & entity) const noexcept;
+
+			/**
+			 * @brief Returns the number of sleeping islands.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t sleepingIslandCount () const noexcept;
+
+		private:
+
+			/**
+			 * @brief Returns the body index of an entity, registering it if needed.
+			 * @param entity A reference to the entity smart pointer.
+			 * @return size_t
+			 */
+			size_t bodyIndex (const std::shared_ptr< AbstractEntity > & entity) noexcept;
+
+			/**
+			 * @brief Returns the root body index of an island, compressing the path.
+			 * @param index The body index.
+			 * @return size_t
+			 */
+			size_t findRoot (size_t index) noexcept;
+
+			/**
+			 * @brief Wakes the sleeping island of a body, if any.
+			 * @param entity A reference to the entity.
+			 * @return void
+			 */
+			void wakeIslandOf (const AbstractEntity & entity) noexcept;
+
+			/**
+			 * @brief Wakes every body of a sleeping island and releases its slot.
+			 * @param islandIndex The sleeping island index.
+			 * @return void
+			 */
+			void wakeIsland (size_t islandIndex) noexcept;
+
+			/**
+			 * @brief Removes a body from the sleeping island it belongs to, and releases the slot of an emptied island.
+			 * @param entity A pointer to the entity.
+			 * @return void
+			 */
+			void detachSleepingBody (const AbstractEntity * entity) noexcept;
+
+			/**
+			 * @brief Puts every body of an island of this tick to sleep and records it.
+			 * @note A body still asleep from a previous island leaves it first, the previous slot is recycled when emptied.
+			 * @param members A reference to the body indexes of the island.
+			 * @return void
+			 */
+			void sleepIsland (const std::vector< size_t > & members) noexcept;
+
+			/* Islands of the current tick. */
+			std::vector< std::shared_ptr< AbstractEntity > > m_bodies;
+			std::vector< size_t > m_parents;
+			std::unordered_map< const AbstractEntity *, size_t > m_bodyIndexes;
+			/* Sleeping islands. */
+			struct SleepingBody
+			{
+				size_t islandIndex{0};
+				/* NOTE: Checked on every lookup, a destroyed body may leave its address to a new one. */
+				std::weak_ptr< AbstractEntity > entity;
+			};
+
+			std::vector< std::vector< const AbstractEntity * > > m_sleepingIslands;
+			std::vector< size_t > m_freeIslandSlots;
+			std::unordered_map< const AbstractEntity *, SleepingBody > m_sleepingBodies;
+	};
+}
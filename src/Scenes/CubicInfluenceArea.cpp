@@ -244,6 +244,21 @@ namespace EmEn::Scenes
 		return m_zSize;
 	}
 
+	Space3D::AACuboid< float >
+	CubicInfluenceArea::getWorldBoundingBox () const noexcept
+	{
+		const auto worldCoordinates = m_parentEntity->getWorldCoordinates();
+		const auto & scaling = worldCoordinates.scalingFactor();
+
+		/* NOTE: The sizes are half extents in the modifier space. The sphere around the
+		 * oriented box is used, so the bounds stay valid whatever the rotation. */
+		const auto radius = Vector< 3, float >{m_xSize * std::abs(scaling[X]), m_ySize * std::abs(scaling[Y]), m_zSize * std::abs(scaling[Z])}.length();
+		const auto center = worldCoordinates.position();
+		const Vector< 3, float > extent{radius, radius, radius};
+
+		return {center + extent, center - extent};
+	}
+
 	Vector< 4, float >
 	CubicInfluenceArea::getPositionInModifierSpace (const Vector< 3, float > & position) const noexcept
 	{
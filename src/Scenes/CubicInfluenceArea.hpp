@@ -103,6 +103,10 @@ namespace EmEn::Scenes
 			[[nodiscard]]
 			float influenceStrength (const Base::Math::Vector< 3, float > & worldPosition) const noexcept override;
 
+			/** @copydoc EmEn::Scenes::InfluenceAreaInterface::getWorldBoundingBox() */
+			[[nodiscard]]
+			Base::Math::Space3D::AACuboid< float > getWorldBoundingBox () const noexcept override;
+
 			/**
 			 * @brief Sets the size of the area.
 			 * @param size Unidirectional size of the area.
@@ -460,6 +460,12 @@ namespace EmEn::Scenes
 											component.getRenderableInstance()->enableLighting();
 											component.getRenderableInstance()->setTransformationMatrix(Math::Matrix4F::scaling(scale));
 										}).build(mesh);
+
+									/* NOTE: The hull is generated once the mesh geometry is loaded. */
+									if ( FastJSON::getValue< std::string >(compDef, CollisionModelKey).value_or("") == "ConvexHull" )
+									{
+										node->requestConvexHullCollisionModel();
+									}
 								}
 								else
 								{
@@ -548,6 +554,12 @@ namespace EmEn::Scenes
 											component.getRenderableInstance()->enableLighting();
 											component.getRenderableInstance()->setTransformationMatrix(Math::Matrix4F::scaling(scale));
 										}).build(mesh);
+
+									/* NOTE: The hull is generated once the mesh geometry is loaded. */
+									if ( FastJSON::getValue< std::string >(compDef, CollisionModelKey).value_or("") == "ConvexHull" )
+									{
+										entity->requestConvexHullCollisionModel();
+									}
 								}
 								else
 								{
@@ -91,6 +91,7 @@ namespace EmEn::Scenes
 			static constexpr auto PrimaryKey{"Primary"};
 			static constexpr auto MeshKey{"Mesh"};
 			static constexpr auto MaterialKey{"Material"};
+			static constexpr auto CollisionModelKey{"CollisionModel"};
 
 			/* Property keys. */
 			static constexpr auto SurfaceGravityKey{"SurfaceGravity"};
@@ -375,6 +375,7 @@ namespace EmEn::Scenes::Editor
 
 				case CollisionModelType::AABB :
 				case CollisionModelType::Capsule :
+				case CollisionModelType::ConvexHull :
 				{
 					const auto worldAABB = model->getAABB(worldFrame);
 
@@ -0,0 +1,444 @@
+/*
+ * src/Scenes/GroundHeightField.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "GroundHeightField.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+/* Local inclusions. */
+#include "ThreadPool.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Scenes
+{
+	using namespace Base::Math;
+
+	bool
+	GroundHeightField::build (const LevelFunction & levelFunction, float minimumX, float minimumZ, float cellSize, uint32_t pointCount) noexcept
+	{
+		this->clear();
+
+		if ( pointCount < 2 || cellSize <= 0.0F )
+		{
+			TraceError{ClassId} << "Invalid height field grid (" << pointCount << " points, cell size " << cellSize << ") !";
+
+			return false;
+		}
+
+		m_minimumX = minimumX;
+		m_minimumZ = minimumZ;
+		m_cellSize = cellSize;
+		m_inverseCellSize = 1.0F / cellSize;
+		m_pointCount = pointCount;
+
+		m_levels.resize(static_cast< size_t >(pointCount) * pointCount);
+
+		for ( uint32_t row = 0; row < pointCount; ++row )
+		{
+			const auto positionZ = minimumZ + static_cast< float >(row) * cellSize;
+
+			for ( uint32_t column = 0; column < pointCount; ++column )
+			{
+				m_levels[static_cast< size_t >(row) * pointCount + column] = levelFunction(minimumX + static_cast< float >(column) * cellSize, positionZ);
+			}
+		}
+
+		this->buildPyramid();
+
+		return true;
+	}
+
+	void
+	GroundHeightField::clear () noexcept
+	{
+		m_levels.clear();
+		m_levels.shrink_to_fit();
+		m_minimumLevels.clear();
+		m_maximumLevels.clear();
+		m_pointCount = 0;
+		m_pyramidSize = 0;
+	}
+
+	float
+	GroundHeightField::levelAt (float positionX, float positionZ) const noexcept
+	{
+		if ( !this->isValid() )
+		{
+			return 0.0F;
+		}
+
+		float level = 0.0F;
+
+		this->levelsInRange(&positionX, &positionZ, &level, 0, 1);
+
+		return level;
+	}
+
+	Vector< 3, float >
+	GroundHeightField::normalAt (float positionX, float positionZ) const noexcept
+	{
+		if ( !this->isValid() )
+		{
+			return {0.0F, -1.0F, 0.0F};
+		}
+
+		const auto lastPoint = static_cast< float >(m_pointCount - 1);
+		const auto lastCell = m_pointCount - 2;
+
+		const auto gridX = std::clamp((positionX - m_minimumX) * m_inverseCellSize, 0.0F, lastPoint);
+		const auto gridZ = std::clamp((positionZ - m_minimumZ) * m_inverseCellSize, 0.0F, lastPoint);
+		const auto cellX = std::min(static_cast< uint32_t >(gridX), lastCell);
+		const auto cellZ = std::min(static_cast< uint32_t >(gridZ), lastCell);
+		const auto factorX = gridX - static_cast< float >(cellX);
+		const auto factorZ = gridZ - static_cast< float >(cellZ);
+
+		const auto * nearRow = m_levels.data() + static_cast< size_t >(cellZ) * m_pointCount + cellX;
+		const auto * farRow = nearRow + m_pointCount;
+
+		/* NOTE: Analytic gradient of the bilinear surface. The surface is y = h(x, z), so the normal
+		 * pointing away from the ground (Y-) is (dh/dx, -1, dh/dz). */
+		const auto slopeX = ((nearRow[1] - nearRow[0]) * (1.0F - factorZ) + (farRow[1] - farRow[0]) * factorZ) * m_inverseCellSize;
+		const auto slopeZ = ((farRow[0] - nearRow[0]) * (1.0F - factorX) + (farRow[1] - nearRow[1]) * factorX) * m_inverseCellSize;
+
+		return Vector< 3, float >{slopeX, -1.0F, slopeZ}.normalized();
+	}
+
+	void
+	GroundHeightField::levelsAt (const float * positionsX, const float * positionsZ, float * levels, size_t count, Base::ThreadPool * threadPool) const noexcept
+	{
+		if ( !this->isValid() )
+		{
+			std::fill_n(levels, count, 0.0F);
+
+			return;
+		}
+
+		forEachChunk(count, [&] (size_t first, size_t last) {
+			this->levelsInRange(positionsX, positionsZ, levels, first, last);
+		}, threadPool);
+	}
+
+	void
+	GroundHeightField::normalsAt (const float * positionsX, const float * positionsZ, Vector< 3, float > * normals, size_t count, Base::ThreadPool * threadPool) const noexcept
+	{
+		forEachChunk(count, [&] (size_t first, size_t last) {
+			for ( auto index = first; index < last; ++index )
+			{
+				normals[index] = this->normalAt(positionsX[index], positionsZ[index]);
+			}
+		}, threadPool);
+	}
+
+	bool
+	GroundHeightField::raycast (const Vector< 3, float > & origin, const Vector< 3, float > & direction, float maxDistance, float & hitDistance) const noexcept
+	{
+		if ( !this->isValid() || maxDistance <= 0.0F )
+		{
+			return false;
+		}
+
+		/* NOTE: The last pyramid level is a single node covering the whole grid. */
+		return this->raycastNode(origin, direction, m_minimumLevels.size() - 1, 0, 0, 0.0F, maxDistance, hitDistance);
+	}
+
+	void
+	GroundHeightField::levelsInRange (const float * positionsX, const float * positionsZ, float * levels, size_t first, size_t last) const noexcept
+	{
+		const auto * data = m_levels.data();
+		const auto pointCount = static_cast< size_t >(m_pointCount);
+		const auto lastPoint = static_cast< float >(m_pointCount - 1);
+		const auto lastCell = m_pointCount - 2;
+		const auto minimumX = m_minimumX;
+		const auto minimumZ = m_minimumZ;
+		const auto inverseCellSize = m_inverseCellSize;
+
+		/* NOTE: Branchless body so the loop is vectorized, the four corner loads become gathers. */
+		for ( auto index = first; index < last; ++index )
+		{
+			const auto gridX = std::clamp((positionsX[index] - minimumX) * inverseCellSize, 0.0F, lastPoint);
+			const auto gridZ = std::clamp((positionsZ[index] - minimumZ) * inverseCellSize, 0.0F, lastPoint);
+			const auto cellX = std::min(static_cast< uint32_t >(gridX), lastCell);
+			const auto cellZ = std::min(static_cast< uint32_t >(gridZ), lastCell);
+			const auto factorX = gridX - static_cast< float >(cellX);
+			const auto factorZ = gridZ - static_cast< float >(cellZ);
+
+			const auto nearIndex = static_cast< size_t >(cellZ) * pointCount + cellX;
+			const auto farIndex = nearIndex + pointCount;
+
+			const auto nearLevel = data[nearIndex] + (data[nearIndex + 1] - data[nearIndex]) * factorX;
+			const auto farLevel = data[farIndex] + (data[farIndex + 1] - data[farIndex]) * factorX;
+
+			levels[index] = nearLevel + (farLevel - nearLevel) * factorZ;
+		}
+	}
+
+	void
+	GroundHeightField::forEachChunk (size_t count, const std::function< void (size_t, size_t) > & function, Base::ThreadPool * threadPool) noexcept
+	{
+		if ( count == 0 )
+		{
+			return;
+		}
+
+		if ( threadPool == nullptr || count < ParallelThreshold )
+		{
+			function(0, count);
+
+			return;
+		}
+
+		const auto chunkCount = static_cast< uint32_t >((count + ChunkSize - 1) / ChunkSize);
+
+		threadPool->parallelFor(uint32_t{0}, chunkCount, [&function, count] (uint32_t chunkIndex) {
+			const auto first = static_cast< size_t >(chunkIndex) * ChunkSize;
+
+			function(first, std::min(first + ChunkSize, count));
+		});
+	}
+
+	void
+	GroundHeightField::buildPyramid () noexcept
+	{
+		constexpr auto Infinity{std::numeric_limits< float >::infinity()};
+
+		const auto cellCount = m_pointCount - 1;
+
+		/* NOTE: The pyramid base is padded to a power of two. Padding cells are empty
+		 * (lowest = +inf, highest = -inf) so a ray never descends into them. */
+		m_pyramidSize = std::bit_ceil(cellCount);
+
+		auto size = m_pyramidSize;
+
+		std::vector< float > minimums(static_cast< size_t >(size) * size, Infinity);
+		std::vector< float > maximums(static_cast< size_t >(size) * size, -Infinity);
+
+		for ( uint32_t row = 0; row < cellCount; ++row )
+		{
+			for ( uint32_t column = 0; column < cellCount; ++column )
+			{
+				const auto * nearRow = m_levels.data() + static_cast< size_t >(row) * m_pointCount + column;
+				const auto * farRow = nearRow + m_pointCount;
+				const auto cellIndex = static_cast< size_t >(row) * size + column;
+
+				minimums[cellIndex] = std::min({nearRow[0], nearRow[1], farRow[0], farRow[1]});
+				maximums[cellIndex] = std::max({nearRow[0], nearRow[1], farRow[0], farRow[1]});
+			}
+		}
+
+		m_minimumLevels.emplace_back(std::move(minimums));
+		m_maximumLevels.emplace_back(std::move(maximums));
+
+		while ( size > 1 )
+		{
+			const auto parentSize = size / 2;
+			const auto & childMinimums = m_minimumLevels.back();
+			const auto & childMaximums = m_maximumLevels.back();
+
+			std::vector< float > parentMinimums(static_cast< size_t >(parentSize) * parentSize);
+			std::vector< float > parentMaximums(static_cast< size_t >(parentSize) * parentSize);
+
+			for ( uint32_t row = 0; row < parentSize; ++row )
+			{
+				for ( uint32_t column = 0; column < parentSize; ++column )
+				{
+					const auto nearRow = static_cast< size_t >(row * 2) * size + column * 2;
+					const auto farRow = nearRow + size;
+					const auto parentIndex = static_cast< size_t >(row) * parentSize + column;
+
+					parentMinimums[parentIndex] = std::min({childMinimums[nearRow], childMinimums[nearRow + 1], childMinimums[farRow], childMinimums[farRow + 1]});
+					parentMaximums[parentIndex] = std::max({childMaximums[nearRow], childMaximums[nearRow + 1], childMaximums[farRow], childMaximums[farRow + 1]});
+				}
+			}
+
+			m_minimumLevels.emplace_back(std::move(parentMinimums));
+			m_maximumLevels.emplace_back(std::move(parentMaximums));
+
+			size = parentSize;
+		}
+	}
+
+	bool
+	GroundHeightField::raycastNode (const Vector< 3, float > & origin, const Vector< 3, float > & direction, size_t pyramidLevel, uint32_t nodeX, uint32_t nodeZ, float tEnter, float tExit, float & hitDistance) const noexcept
+	{
+		if ( !this->clipToNode(origin, direction, pyramidLevel, nodeX, nodeZ, tEnter, tExit) )
+		{
+			return false;
+		}
+
+		const auto levelSize = m_pyramidSize >> pyramidLevel;
+		const auto nodeIndex = static_cast< size_t >(nodeZ) * levelSize + nodeX;
+
+		/* NOTE: Y- is up. When the deepest point of the ray segment is above the highest
+		 * ground point of the node (its minimum level), nothing below can be hit. */
+		const auto deepestRayPoint = std::max(origin[Y] + direction[Y] * tEnter, origin[Y] + direction[Y] * tExit);
+
+		if ( deepestRayPoint < m_minimumLevels[pyramidLevel][nodeIndex] )
+		{
+			return false;
+		}
+
+		if ( pyramidLevel == 0 )
+		{
+			/* NOTE: Inside a cell the ground is bilinear, the segment is marched in a few steps
+			 * then the first crossing is refined by bisection. */
+			constexpr auto MarchSteps{4};
+			constexpr auto RefineSteps{12};
+
+			const auto depthAt = [this, &origin, &direction] (float distance) {
+				const auto point = origin + direction * distance;
+
+				return point[Y] - this->levelAt(point[X], point[Z]);
+			};
+
+			if ( depthAt(tEnter) >= 0.0F )
+			{
+				hitDistance = tEnter;
+
+				return true;
+			}
+
+			auto previous = tEnter;
+
+			for ( auto step = 1; step <= MarchSteps; ++step )
+			{
+				const auto current = tEnter + (tExit - tEnter) * (static_cast< float >(step) / MarchSteps);
+
+				if ( depthAt(current) >= 0.0F )
+				{
+					auto above = previous;
+					auto below = current;
+
+					for ( auto refine = 0; refine < RefineSteps; ++refine )
+					{
+						const auto middle = (above + below) * 0.5F;
+
+						(depthAt(middle) >= 0.0F ? below : above) = middle;
+					}
+
+					hitDistance = below;
+
+					return true;
+				}
+
+				previous = current;
+			}
+
+			return false;
+		}
+
+		/* NOTE: Visit the children in the order the ray enters them, the first hit is the nearest. */
+		struct Child
+		{
+			float tEnter;
+			float tExit;
+			uint32_t nodeX;
+			uint32_t nodeZ;
+		};
+
+		std::array< Child, 4 > children{};
+		size_t childCount = 0;
+
+		for ( uint32_t offsetZ = 0; offsetZ < 2; ++offsetZ )
+		{
+			for ( uint32_t offsetX = 0; offsetX < 2; ++offsetX )
+			{
+				Child child{tEnter, tExit, nodeX * 2 + offsetX, nodeZ * 2 + offsetZ};
+
+				if ( this->clipToNode(origin, direction, pyramidLevel - 1, child.nodeX, child.nodeZ, child.tEnter, child.tExit) )
+				{
+					children[childCount++] = child;
+				}
+			}
+		}
+
+		std::sort(children.begin(), children.begin() + static_cast< std::ptrdiff_t >(childCount), [] (const Child & childA, const Child & childB) {
+			return childA.tEnter < childB.tEnter;
+		});
+
+		for ( size_t index = 0; index < childCount; ++index )
+		{
+			const auto & child = children[index];
+
+			if ( this->raycastNode(origin, direction, pyramidLevel - 1, child.nodeX, child.nodeZ, child.tEnter, child.tExit, hitDistance) )
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool
+	GroundHeightField::clipToNode (const Vector< 3, float > & origin, const Vector< 3, float > & direction, size_t pyramidLevel, uint32_t nodeX, uint32_t nodeZ, float & tEnter, float & tExit) const noexcept
+	{
+		const auto nodeSize = static_cast< float >(1U << pyramidLevel) * m_cellSize;
+
+		const std::array< float, 2 > minimums{m_minimumX + static_cast< float >(nodeX) * nodeSize, m_minimumZ + static_cast< float >(nodeZ) * nodeSize};
+		const std::array< float, 2 > origins{origin[X], origin[Z]};
+		const std::array< float, 2 > directions{direction[X], direction[Z]};
+
+		for ( size_t axis = 0; axis < 2; ++axis )
+		{
+			const auto minimum = minimums[axis];
+			const auto maximum = minimum + nodeSize;
+
+			if ( std::abs(directions[axis]) < std::numeric_limits< float >::epsilon() )
+			{
+				if ( origins[axis] < minimum || origins[axis] > maximum )
+				{
+					return false;
+				}
+
+				continue;
+			}
+
+			const auto inverse = 1.0F / directions[axis];
+			auto tNear = (minimum - origins[axis]) * inverse;
+			auto tFar = (maximum - origins[axis]) * inverse;
+
+			if ( tNear > tFar )
+			{
+				std::swap(tNear, tFar);
+			}
+
+			tEnter = std::max(tEnter, tNear);
+			tExit = std::min(tExit, tFar);
+
+			if ( tEnter > tExit )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,252 @@
+/*
+ * src/Scenes/GroundHeightField.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Math/Vector.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Base
+{
+	class ThreadPool;
+}
+
+namespace EmEn::Scenes
+{
+	/**
+	 * @brief A regular grid of ground levels sampled in batches, with a min/max pyramid for raycasting.
+	 *
+	 * The levels are copied once from the ground source (the vertex grid of a terrain) into a flat
+	 * row-major array. Batch queries run a branchless bilinear kernel over contiguous X/Z streams
+	 * (vectorized by the compiler), split in chunks over the thread pool for large batches.
+	 *
+	 * Each pyramid level stores the lowest and the highest ground point of 2^n × 2^n cells. A ray
+	 * skips every node it crosses entirely above the highest ground point, so a line of sight test
+	 * only visits the cells along the ray near the ground.
+	 *
+	 * @note Y- is up. A level is the Y coordinate of the ground surface, a point is under the ground when its Y is greater.
+	 * @note Positions outside the grid are clamped to the border.
+	 * @since 0.9.53
+	 */
+	class EMEN_API GroundHeightField final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"GroundHeightField"};
+
+			/** @brief Number of positions sampled by one thread pool task. */
+			static constexpr size_t ChunkSize{1024};
+
+			/** @brief Number of positions under which a batch is sampled on the calling thread. */
+			static constexpr size_t ParallelThreshold{4096};
+
+			/** @brief A function returning the ground level at a X/Z coordinate. */
+			using LevelFunction = std::function< float (float, float) >;
+
+			/**
+			 * @brief Constructs an empty height field.
+			 */
+			GroundHeightField () noexcept = default;
+
+			/**
+			 * @brief Builds the height field by sampling a ground source on a regular grid.
+			 * @param levelFunction A reference to a function returning the level at a X/Z coordinate.
+			 * @param minimumX The X coordinate of the first grid point.
+			 * @param minimumZ The Z coordinate of the first grid point.
+			 * @param cellSize The distance between two grid points.
+			 * @param pointCount The number of grid points along one side. Must be at least 2.
+			 * @return bool
+			 */
+			bool build (const LevelFunction & levelFunction, float minimumX, float minimumZ, float cellSize, uint32_t pointCount) noexcept;
+
+			/**
+			 * @brief Builds the height field from a vertex grid, one sample per grid point.
+			 * @tparam grid_t The type of grid. Must provide boundingBox(), squaredPointCount() and getHeightAt().
+			 * @param grid A reference to the grid.
+			 * @return bool
+			 */
+			template< typename grid_t >
+			bool
+			buildFromGrid (const grid_t & grid) noexcept
+			{
+				const auto & boundingBox = grid.boundingBox();
+				const auto pointCount = static_cast< uint32_t >(grid.squaredPointCount());
+
+				if ( pointCount < 2 )
+				{
+					return false;
+				}
+
+				const auto cellSize = (boundingBox.maximum(Base::Math::X) - boundingBox.minimum(Base::Math::X)) / static_cast< float >(pointCount - 1);
+
+				return this->build([&grid] (float positionX, float positionZ) {
+					return grid.getHeightAt(positionX, positionZ);
+				}, boundingBox.minimum(Base::Math::X), boundingBox.minimum(Base::Math::Z), cellSize, pointCount);
+			}
+
+			/**
+			 * @brief Returns whether the height field is built.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isValid () const noexcept
+			{
+				return !m_levels.empty();
+			}
+
+			/**
+			 * @brief Releases the height field data.
+			 * @return void
+			 */
+			void clear () noexcept;
+
+			/**
+			 * @brief Returns the bilinear level at a X/Z coordinate.
+			 * @param positionX The X coordinate.
+			 * @param positionZ The Z coordinate.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float levelAt (float positionX, float positionZ) const noexcept;
+
+			/**
+			 * @brief Returns the normal of the bilinear surface at a X/Z coordinate.
+			 * @note The normal points away from the ground (Y-).
+			 * @param positionX The X coordinate.
+			 * @param positionZ The Z coordinate.
+			 * @return Base::Math::Vector< 3, float >
+			 */
+			[[nodiscard]]
+			Base::Math::Vector< 3, float > normalAt (float positionX, float positionZ) const noexcept;
+
+			/**
+			 * @brief Samples the levels of a batch of positions.
+			 * @param positionsX A pointer to the X coordinates.
+			 * @param positionsZ A pointer to the Z coordinates.
+			 * @param levels A pointer to the output levels.
+			 * @param count The number of positions.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			void levelsAt (const float * positionsX, const float * positionsZ, float * levels, size_t count, Base::ThreadPool * threadPool) const noexcept;
+
+			/**
+			 * @brief Samples the normals of a batch of positions.
+			 * @param positionsX A pointer to the X coordinates.
+			 * @param positionsZ A pointer to the Z coordinates.
+			 * @param normals A pointer to the output normals.
+			 * @param count The number of positions.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			void normalsAt (const float * positionsX, const float * positionsZ, Base::Math::Vector< 3, float > * normals, size_t count, Base::ThreadPool * threadPool) const noexcept;
+
+			/**
+			 * @brief Casts a ray against the ground.
+			 * @param origin A reference to the ray origin.
+			 * @param direction A reference to the normalized ray direction.
+			 * @param maxDistance The ray length.
+			 * @param hitDistance A reference to the distance of the first ground hit.
+			 * @return bool True if the ground is hit within the ray length.
+			 */
+			[[nodiscard]]
+			bool raycast (const Base::Math::Vector< 3, float > & origin, const Base::Math::Vector< 3, float > & direction, float maxDistance, float & hitDistance) const noexcept;
+
+		private:
+
+			/**
+			 * @brief Samples the levels of a range of positions.
+			 * @param positionsX A pointer to the X coordinates.
+			 * @param positionsZ A pointer to the Z coordinates.
+			 * @param levels A pointer to the output levels.
+			 * @param first The first position index.
+			 * @param last The index past the last position.
+			 * @return void
+			 */
+			void levelsInRange (const float * positionsX, const float * positionsZ, float * levels, size_t first, size_t last) const noexcept;
+
+			/**
+			 * @brief Runs a function over a batch, chunk by chunk.
+			 * @param count The number of elements.
+			 * @param function A reference to a function receiving the first index and the index past the last one.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			static void forEachChunk (size_t count, const std::function< void (size_t, size_t) > & function, Base::ThreadPool * threadPool) noexcept;
+
+			/**
+			 * @brief Builds the min/max pyramid from the levels.
+			 * @return void
+			 */
+			void buildPyramid () noexcept;
+
+			/**
+			 * @brief Tests a ray against a pyramid node and its children, front to back.
+			 * @param origin A reference to the ray origin.
+			 * @param direction A reference to the ray direction.
+			 * @param pyramidLevel The pyramid level of the node.
+			 * @param nodeX The node column at this level.
+			 * @param nodeZ The node row at this level.
+			 * @param tEnter The ray distance entering the node.
+			 * @param tExit The ray distance leaving the node.
+			 * @param hitDistance A reference to the distance of the ground hit.
+			 * @return bool
+			 */
+			bool raycastNode (const Base::Math::Vector< 3, float > & origin, const Base::Math::Vector< 3, float > & direction, size_t pyramidLevel, uint32_t nodeX, uint32_t nodeZ, float tEnter, float tExit, float & hitDistance) const noexcept;
+
+			/**
+			 * @brief Returns the ray distance interval inside a node.
+			 * @param origin A reference to the ray origin.
+			 * @param direction A reference to the ray direction.
+			 * @param pyramidLevel The pyramid level of the node.
+			 * @param nodeX The node column at this level.
+			 * @param nodeZ The node row at this level.
+			 * @param tEnter A reference to the entering distance, clipped in place.
+			 * @param tExit A reference to the leaving distance, clipped in place.
+			 * @return bool False if the ray misses the node.
+			 */
+			bool clipToNode (const Base::Math::Vector< 3, float > & origin, const Base::Math::Vector< 3, float > & direction, size_t pyramidLevel, uint32_t nodeX, uint32_t nodeZ, float & tEnter, float & tExit) const noexcept;
+
+			std::vector< float > m_levels;
+			std::vector< std::vector< float > > m_minimumLevels;
+			std::vector< std::vector< float > > m_maximumLevels;
+			float m_minimumX{0.0F};
+			float m_minimumZ{0.0F};
+			float m_cellSize{1.0F};
+			float m_inverseCellSize{1.0F};
+			uint32_t m_pointCount{0};
+			uint32_t m_pyramidSize{0};
+	};
+}
@@ -26,9 +26,18 @@
 
 #pragma once
 
+/* STL inclusions. */
+#include <cstddef>
+
 /* Local inclusions for usages. */
 #include "Math/Vector.hpp"
 
+/* Forward declarations. */
+namespace EmEn::Base
+{
+	class ThreadPool;
+}
+
 namespace EmEn::Scenes
 {
 	/**
@@ -69,6 +78,78 @@ namespace EmEn::Scenes
 			[[nodiscard]]
 			virtual Base::Math::Vector< 3, float > getNormalAt (const Base::Math::Vector< 3, float > & worldPosition) const noexcept = 0;
 
+			/**
+			 * @brief Returns the ground levels under a batch of positions.
+			 * @note The default implementation calls getLevelAt() for each position.
+			 * @param positionsX A pointer to the X coordinates.
+			 * @param positionsZ A pointer to the Z coordinates.
+			 * @param levels A pointer to the output levels.
+			 * @param count The number of positions.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			virtual
+			void
+			getLevelsAt (const float * positionsX, const float * positionsZ, float * levels, size_t count, Base::ThreadPool * /*threadPool*/) const noexcept
+			{
+				for ( size_t index = 0; index < count; ++index )
+				{
+					levels[index] = this->getLevelAt(Base::Math::Vector< 3, float >{positionsX[index], 0.0F, positionsZ[index]});
+				}
+			}
+
+			/**
+			 * @brief Returns the normal vectors under a batch of positions.
+			 * @note The default implementation calls getNormalAt() for each position.
+			 * @param positionsX A pointer to the X coordinates.
+			 * @param positionsZ A pointer to the Z coordinates.
+			 * @param normals A pointer to the output normals.
+			 * @param count The number of positions.
+			 * @param threadPool A pointer to the thread pool. Can be null.
+			 * @return void
+			 */
+			virtual
+			void
+			getNormalsAt (const float * positionsX, const float * positionsZ, Base::Math::Vector< 3, float > * normals, size_t count, Base::ThreadPool * /*threadPool*/) const noexcept
+			{
+				for ( size_t index = 0; index < count; ++index )
+				{
+					normals[index] = this->getNormalAt(Base::Math::Vector< 3, float >{positionsX[index], 0.0F, positionsZ[index]});
+				}
+			}
+
+			/**
+			 * @brief Casts a ray against the ground.
+			 * @note The default implementation marches along the ray with getLevelAt().
+			 * @param origin A reference to the ray origin.
+			 * @param direction A reference to the normalized ray direction.
+			 * @param maxDistance The ray length.
+			 * @param hitDistance A reference to the distance of the first ground hit.
+			 * @return bool True if the ground is hit within the ray length.
+			 */
+			[[nodiscard]]
+			virtual
+			bool
+			raycast (const Base::Math::Vector< 3, float > & origin, const Base::Math::Vector< 3, float > & direction, float maxDistance, float & hitDistance) const noexcept
+			{
+				constexpr auto StepDistance{0.5F};
+
+				/* NOTE: Y- is up, a point is under the ground when its Y is greater than the level. */
+				for ( auto distance = 0.0F; distance <= maxDistance; distance += StepDistance )
+				{
+					const auto point = origin + direction * distance;
+
+					if ( point[Base::Math::Y] >= this->getLevelAt(point) )
+					{
+						hitDistance = distance;
+
+						return true;
+					}
+				}
+
+				return false;
+			}
+
 			/**
 			 * @brief Updates the ground visibility from the camera position.
 			 * @note This is not frustum-culling, but help the ground to know where the point of view is located.
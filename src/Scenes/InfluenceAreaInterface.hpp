@@ -127,6 +127,15 @@ namespace EmEn::Scenes
 			[[nodiscard]]
 			virtual float influenceStrength (const Base::Math::Vector< 3, float > & worldPosition) const noexcept = 0;
 
+			/**
+			 * @brief Returns a world axis aligned box enclosing the whole influence area.
+			 * @note The box can be conservative, it is used to find the entities a modifier can reach.
+			 * @return Base::Math::Space3D::AACuboid< float >
+			 * @since 0.9.53
+			 */
+			[[nodiscard]]
+			virtual Base::Math::Space3D::AACuboid< float > getWorldBoundingBox () const noexcept = 0;
+
 		protected:
 
 			/**
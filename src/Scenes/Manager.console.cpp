@@ -27,7 +27,9 @@
 #include "Manager.hpp"
 
 /* STL inclusions. */
+#include <algorithm>
 #include <chrono>
+#include <filesystem>
 #include <ranges>
 
 /* Local inclusions. */
@@ -42,6 +44,9 @@
 #include "FileSystem.hpp"
 #include "Graphics/RenderableInstance/Abstract.hpp"
 #include "Graphics/Renderer.hpp"
+#include "Graphics/SceneRenderTarget.hpp"
+#include "IO/IO.hpp"
+#include "Physics/ContinuousCollision.hpp"
 #include "PixelFactory/FileIO.hpp"
 #include "PrimaryServices.hpp"
 #include "Resources/Manager.hpp"
@@ -805,6 +810,21 @@ namespace EmEn::Scenes
 			return true;
 		}, "Returns scene information (name, node count, entity count, active camera).");
 
+		this->bindCommand("testContinuousCollision", [] (const Console::Arguments & /*arguments*/, Console::Outputs & outputs) {
+			std::string report;
+
+			if ( !Physics::selfTestContinuousCollision(report) )
+			{
+				outputs.emplace_back(Severity::Error, std::stringstream{} << "Continuous collision self-test failed !" "\n" << report);
+
+				return false;
+			}
+
+			outputs.emplace_back(Severity::Success, std::stringstream{} << "Continuous collision self-test passed." "\n" << report);
+
+			return true;
+		}, "Self-tests the continuous collision time of impact (fast sphere through a thin box).");
+
 		this->bindCommand("getNode", [this] (const Console::Arguments & arguments, Console::Outputs & outputs) {
 			if ( arguments.empty() )
 			{
@@ -911,6 +931,81 @@ namespace EmEn::Scenes
 			return true;
 		}, "Toggles TBN space debug rendering on the active scene's renderables. Usage: enableTBN([true|false]) — defaults to true.");
 
+		this->bindCommand("bakeShaders", [this] (const Console::Arguments & arguments, Console::Outputs & outputs) {
+			if ( m_activeScene == nullptr )
+			{
+				outputs.emplace_back(Severity::Error, "No active scene !");
+
+				return false;
+			}
+
+			auto & renderer = m_resourceManager.graphicsRenderer();
+			const auto & fileSystem = m_primaryServices.fileSystem();
+
+			std::filesystem::path filepath;
+
+			if ( arguments.empty() )
+			{
+				/* NOTE: The shader manager looks for the archive in the data directories, in their order. */
+				const auto & dataDirectories = fileSystem.dataDirectories();
+
+				const auto directoryIt = std::ranges::find_if(dataDirectories, [] (const std::filesystem::path & directory) {
+					return IO::writable(directory);
+				});
+
+				if ( directoryIt == dataDirectories.cend() )
+				{
+					outputs.emplace_back(Severity::Error, "No writable data directory for the shader archive !");
+
+					return false;
+				}
+
+				filepath = *directoryIt;
+				filepath.append(Saphir::ShaderArchive::DataStoreDirectory);
+				filepath.append(Saphir::ShaderArchive::DefaultFilename);
+			}
+			else
+			{
+				filepath = arguments[0].asString();
+			}
+
+			if ( filepath.has_parent_path() )
+			{
+				std::error_code errorCode;
+
+				std::filesystem::create_directories(filepath.parent_path(), errorCode);
+
+				if ( errorCode )
+				{
+					outputs.emplace_back(Severity::Error, std::stringstream{} << "Unable to create the directory " << filepath.parent_path() << " : " << errorCode.message());
+
+					return false;
+				}
+			}
+
+			/* NOTE: Both main targets, the post-processing can be toggled at runtime. */
+			if ( const auto failureCount = m_activeScene->generateProgramVariants({renderer.mainRenderTarget(), renderer.sceneTarget()}); failureCount > 0 )
+			{
+				outputs.emplace_back(Severity::Warning, std::stringstream{} << failureCount << " renderable instance(s) of scene '" << m_activeScene->name() << "' failed to generate some program variants.");
+			}
+
+			if ( !renderer.bakeShaderArchive(filepath) )
+			{
+				outputs.emplace_back(Severity::Error, std::stringstream{} << "Unable to bake the shader archive " << filepath << " !");
+
+				return false;
+			}
+
+			outputs.emplace_back(Severity::Success, std::stringstream{} << "Shader archive written to " << filepath << ", it is loaded at the next start.");
+
+			if ( const auto loadedFilepath = fileSystem.getFilepathFromDataDirectories(Saphir::ShaderArchive::DataStoreDirectory, Saphir::ShaderArchive::DefaultFilename); loadedFilepath != filepath )
+			{
+				outputs.emplace_back(Severity::Warning, std::stringstream{} << "The shader manager reads " << (loadedFilepath.empty() ? std::filesystem::path{"nothing"} : loadedFilepath) << " at startup, not this archive.");
+			}
+
+			return true;
+		}, "Generates every program variant of the active scene and bakes their shaders into the shader archive. Optional argument: the archive path, by default 'data-stores/Shaders/shaders.spva' in the first writable data directory.");
+
 		this->bindCommand("setNodeLookAt", [this] (const Console::Arguments & arguments, Console::Outputs & outputs) {
 			if ( arguments.size() < 4 )
 			{
@@ -877,19 +877,23 @@ namespace EmEn::Scenes
 			return false;
 		}
 
-		/* NOTE: Apply scene modifiers to modify acceleration vectors.
-		 * This can resume the physics simulation. */
-		scene.forEachModifiers([this] (const auto & modifier) {
-			/* NOTE: Avoid working on the same Node. */
-			if ( this == &modifier.parentEntity() )
-			{
-				return;
-			}
+		/* NOTE: Scene modifier forces are applied by Scene::applyModifiers() to the bodies of the
+		 * physics octree. A node without a usable collision model is not in it, so it still gathers
+		 * them here. This can resume the physics simulation. */
+		if ( const auto * collisionModel = this->collisionModel(); collisionModel == nullptr || !collisionModel->getAABB(this->getWorldCoordinates()).isValid() )
+		{
+			scene.forEachModifiers([this] (const auto & modifier) {
+				/* NOTE: Avoid working on the same Node. */
+				if ( this == &modifier.parentEntity() || !modifier.isEnabled() )
+				{
+					return;
+				}
 
-			const auto modifierForce = modifier.getForceAppliedTo(*this);
+				const auto modifierForce = modifier.getForceAppliedTo(*this);
 
-			this->addForce(modifierForce);
-		});
+				this->addForce(modifierForce);
+			});
+		}
 
 		/* NOTE: If the physics engine has determined that the entity
 		 * does not need physics calculation, we stop here. */
@@ -898,15 +902,11 @@ namespace EmEn::Scenes
 			return false;
 		}
 
-		const auto result = this->updateSimulation(scene.physicalEnvironmentProperties());
+		/* NOTE: The integration step is batched over every active node by the scene,
+		 * the movement and the sleep check happen in Scene::integrateBodies(). */
+		this->setFlag(IsIntegrationRequested, true);
 
-		/* Sleep/Wake: check if entity has been stable long enough to pause simulation. */
-		if ( this->checkSimulationInertia() )
-		{
-			this->pauseSimulation(true);
-		}
-
-		return result;
+		return false;
 	}
 
 	void
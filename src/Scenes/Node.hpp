@@ -779,6 +779,29 @@ namespace EmEn::Scenes
 				return m_lifetime;
 			}
 
+			/**
+			 * @brief Returns whether this node requested the physics integration this tick, and clears the request.
+			 *
+			 * Set by onProcessLogics() for an active movable node. The scene gathers the requesting
+			 * nodes during the node crawl, then integrates them in one batch.
+			 *
+			 * @return bool
+			 * @see Scene::integrateBodies()
+			 */
+			[[nodiscard]]
+			bool
+			consumeIntegrationRequest () noexcept
+			{
+				if ( !this->isFlagEnabled(IsIntegrationRequested) )
+				{
+					return false;
+				}
+
+				this->setFlag(IsIntegrationRequested, false);
+
+				return true;
+			}
+
 			/**
 			 * @brief Marks this node for deferred destruction.
 			 *
@@ -913,7 +936,8 @@ namespace EmEn::Scenes
 
 			/**
 			 * @copydoc EmEn::Scenes::AbstractEntity::onProcessLogics()
-			 * @note Updates animations, increments lifetime, applies scene modifiers, and runs physics simulation.
+			 * @note Updates animations, increments lifetime, applies scene modifiers, and requests the physics integration.
+			 * The integration itself is batched by the scene (see consumeIntegrationRequest()), so this returns false for physics moves.
 			 */
 			bool onProcessLogics (const Scene & scene) noexcept override;
 
@@ -924,6 +948,7 @@ namespace EmEn::Scenes
 			void onContentModified () noexcept override;
 
 			static constexpr auto IsDiscardable{NextFlag + 0UL};
+			static constexpr auto IsIntegrationRequested{NextFlag + 1UL};
 
 			std::weak_ptr< Node > m_parent;
 			std::map< std::string, std::shared_ptr< Node >, std::less<> > m_children;
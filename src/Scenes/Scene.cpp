@@ -99,12 +99,16 @@ namespace EmEn::Scenes
 		static_cast< void >(m_instanceTransforms.initializePerFrameBuffers(graphicsRenderer));
 
 		m_LODScreenCoverageThreshold = settings.getOrSetDefault< float >(GraphicsLODScreenCoverageThresholdKey, DefaultGraphicsLODScreenCoverageThreshold);
+		m_asynchronousProgramPreparation = settings.getOrSetDefault< bool >(GraphicsAsynchronousProgramPreparationKey, DefaultGraphicsAsynchronousProgramPreparation);
 
 		this->buildOctrees(octreeOptions);
 	}
 
 	Scene::~Scene ()
 	{
+		/* NOTE: A program preparation task may still read the scene. */
+		m_graphicsRenderer.programPreparationQueue().waitIdle();
+
 		/* From 'Scene setup data' */
 		{
 			m_initialized = false;
@@ -468,25 +472,8 @@ namespace EmEn::Scenes
 			}
 		}
 
-		/* Update scene nodes logics. */
-		{
-			const std::lock_guard< std::mutex > lock{m_sceneNodesAccess};
-
-			NodeCrawler< Node > crawler{m_rootNode};
-
-			std::shared_ptr< Node > currentNode{};
-
-			while ( (currentNode = crawler.nextNode()) != nullptr )
-			{
-				if ( currentNode->processLogics(*this, engineCycle) )
-				{
-					this->checkEntityLocationInOctrees(currentNode);
-				}
-			}
-
-			/* Clean all dead nodes. */
-			m_rootNode->trimTree();
-		}
+		/* Update scene nodes logics and simulate the physics. */
+		this->simulatePhysics(engineCycle);
 
 		/* Update scene-level visual components (background, ground, sea).
 		 * These are not entity components, so they must be updated explicitly. */
@@ -498,9 +485,6 @@ namespace EmEn::Scenes
 			}
 		}
 
-		/* NOTE: Simulate physical collisions. */
-		this->resolveCollisions();
-
 		if ( m_groundLevel != nullptr )
 		{
 			const auto worldCoordinates = m_AVConsoleManager.getPrimaryVideoDevice()->getWorldCoordinates();
@@ -521,6 +505,50 @@ namespace EmEn::Scenes
 		m_cycle++;
 	}
 
+	void
+	Scene::simulatePhysics (size_t engineCycle) noexcept
+	{
+		auto phaseStart = std::chrono::steady_clock::now();
+
+		/* Update scene nodes logics. */
+		{
+			const std::lock_guard< std::mutex > lock{m_sceneNodesAccess};
+
+			/* NOTE: Modifier forces are gathered before the crawl, they can resume a paused simulation. */
+			this->applyModifiers();
+
+			NodeCrawler< Node > crawler{m_rootNode};
+
+			std::shared_ptr< Node > currentNode{};
+
+			while ( (currentNode = crawler.nextNode()) != nullptr )
+			{
+				if ( currentNode->processLogics(*this, engineCycle) )
+				{
+					this->checkEntityLocationInOctrees(currentNode);
+				}
+
+				if ( currentNode->consumeIntegrationRequest() )
+				{
+					static_cast< void >(currentNode->gatherIntegrationState(m_environmentPhysicalProperties, m_bodyIntegrator));
+
+					m_integratedNodes.emplace_back(currentNode);
+				}
+			}
+
+			/* NOTE: Integrate every active node in one batch, then move them in the crawl order. */
+			this->integrateBodies(engineCycle);
+
+			/* Clean all dead nodes. */
+			m_rootNode->trimTree();
+		}
+
+		this->measurePhysicsPhase(m_physicsTimings.integration, phaseStart);
+
+		/* NOTE: Simulate physical collisions. */
+		this->resolveCollisions();
+	}
+
 	void
 	Scene::updateCSMCascades (const std::shared_ptr< RenderTarget::Abstract > & mainRenderTarget) const noexcept
 	{
@@ -977,6 +1005,8 @@ namespace EmEn::Scenes
 			const std::lock_guard< std::mutex > lock{m_physicsOctreeAccess};
 
 			m_physicsOctree.reset();
+
+			m_contactIslands.clear();
 		}
 	}
 }
@@ -195,6 +195,8 @@ namespace EmEn::Scenes
 			const std::lock_guard< std::mutex > lock{m_physicsOctreeAccess};
 
 			m_physicsOctree->erase(staticEntity);
+
+			m_contactIslands.removeBody(*staticEntity);
 		}
 
 		staticEntity->clearComponents();
@@ -536,6 +538,13 @@ namespace EmEn::Scenes
 
 			const std::lock_guard< std::mutex > lock{m_physicsOctreeAccess};
 
+			/* NOTE: A body of a sleeping island does not move, its sectors stay valid until the island wakes.
+			 * A teleport resumes the simulation first, so a moved body is always updated. */
+			if ( entity->isSimulationPaused() && m_contactIslands.isSleeping(*entity) )
+			{
+				return;
+			}
+
 			m_physicsOctree->updateOrInsert(entity);
 		}
 	}
@@ -576,6 +585,8 @@ namespace EmEn::Scenes
 					const std::lock_guard< std::mutex > lock{m_physicsOctreeAccess};
 
 					m_physicsOctree->erase(node);
+
+					m_contactIslands.removeBody(*node);
 				}
 			}
 				return true;
@@ -34,12 +34,15 @@
 #include <cstdint>
 #include <any>
 #include <array>
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 /* Local inclusions for inheritances. */
@@ -59,10 +62,12 @@
 #include "GroundLevelInterface.hpp"
 #include "Randomizer.hpp"
 #include "BindlessTextureSet.hpp"
+#include "ContactIslands.hpp"
 #include "LightSet.hpp"
 #include "Node.hpp"
 #include "NodeController.hpp"
 #include "OctreeSector.hpp"
+#include "Physics/BodyIntegrator.hpp"
 #include "Physics/ConstraintSolver.hpp"
 #include "RenderBatch.hpp"
 #include "SceneInstanceTransforms.hpp"
@@ -150,6 +155,31 @@ namespace EmEn::Scenes
 		size_t physicsOctreeReserve{3};
 	};
 
+	/**
+	 * @brief Accumulated wall-clock time of the physics phases of a scene, in nanoseconds.
+	 *
+	 * Only measured after Scene::enablePhysicsTimings(true).
+	 *
+	 * @see Scene::physicsTimings()
+	 */
+	struct EMEN_API ScenePhysicsTimings
+	{
+		/** @brief Modifiers, node logics and batch integration of the awake bodies. */
+		uint64_t integration{0};
+
+		/** @brief Continuous collisions, ground probes, boundaries, ground and static entities. */
+		uint64_t staticCollisions{0};
+
+		/** @brief Candidate pair gathering in the physics octree sectors and pair ordering. */
+		uint64_t broadphase{0};
+
+		/** @brief Body versus body collision model tests. */
+		uint64_t narrowphase{0};
+
+		/** @brief Impulse solver, boundary clipping and sleeping islands. */
+		uint64_t solver{0};
+	};
+
 	/**
 	 * @brief Options for Scene::applyBackgroundLighting().
 	 *
@@ -403,6 +433,16 @@ namespace EmEn::Scenes
 			 */
 			void processLogics (size_t engineCycle) noexcept;
 
+			/**
+			 * @brief Runs the node and physics part of a scene tick.
+			 * @note Called by processLogics(). It applies the modifiers, processes the node tree, integrates
+			 * the bodies and resolves the collisions (continuous collisions, ground probes, solver, sleeping
+			 * islands). It needs no camera nor render target, tools can step a scene physics with it.
+			 * @param engineCycle The cycle number of the engine (for time-based logic).
+			 * @return void
+			 */
+			void simulatePhysics (size_t engineCycle) noexcept;
+
 			/**
 			 * @brief Publishes the current simulation state for the render thread.
 			 *
@@ -899,6 +939,31 @@ namespace EmEn::Scenes
 				return m_environmentPhysicalProperties;
 			}
 
+			/**
+			 * @brief Enables the measure of the physics phases.
+			 * @note Enabling it resets the accumulated timings.
+			 * @param state The state.
+			 * @return void
+			 */
+			void
+			enablePhysicsTimings (bool state) noexcept
+			{
+				m_physicsTimings = {};
+				m_physicsTimingsEnabled = state;
+			}
+
+			/**
+			 * @brief Returns the accumulated physics phase timings.
+			 * @see enablePhysicsTimings()
+			 * @return const ScenePhysicsTimings &
+			 */
+			[[nodiscard]]
+			const ScenePhysicsTimings &
+			physicsTimings () const noexcept
+			{
+				return m_physicsTimings;
+			}
+
 			/* ============================================================
 			 * [CONCEPT: ENTITIES]
 			 * Node tree, static entities, modifiers.
@@ -1687,6 +1752,35 @@ namespace EmEn::Scenes
 			 */
 			void castShadows (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer) noexcept;
 
+			/**
+			 * @brief Prepares the shadow map rendering pass for a recording split in chunks.
+			 *
+			 * Populates the shadow casting render list like castShadows() does, then splits it in
+			 * contiguous chunks to be recorded by castShadowsChunk(), possibly from different threads.
+			 * The batches of one renderable instance always stay in the same chunk, so a renderable
+			 * instance is never accessed from two threads at once.
+			 *
+			 * @note Skipped if LightSet is disabled.
+			 * @param renderTarget The shadow map render target (2D or cubemap).
+			 * @param maxChunkCount The maximum number of chunks.
+			 * @param minimumChunkSize The number of batches under which a chunk is not worth splitting.
+			 * @return uint32_t The number of chunks, 0 if there is nothing to render.
+			 * @since 0.9.53
+			 */
+			[[nodiscard]]
+			uint32_t prepareShadowCasting (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, uint32_t maxChunkCount, uint32_t minimumChunkSize) noexcept;
+
+			/**
+			 * @brief Records one chunk of the shadow map rendering pass prepared by prepareShadowCasting().
+			 * @note Different chunks can be recorded at the same time into different command buffers.
+			 * @param renderTarget The shadow map render target given to prepareShadowCasting().
+			 * @param chunkIndex The chunk index.
+			 * @param commandBuffer The Vulkan command buffer for recording draw calls.
+			 * @return void
+			 * @since 0.9.53
+			 */
+			void castShadowsChunk (const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget, uint32_t chunkIndex, const Vulkan::CommandBuffer & commandBuffer) const noexcept;
+
 			/**
 			 * @brief Declares the beginning of a rendered frame on the render thread.
 			 *
@@ -1800,6 +1894,17 @@ namespace EmEn::Scenes
 			[[nodiscard]]
 			bool hasTranslucentGBObjects () const noexcept;
 
+			/**
+			 * @brief Checks whether a renderable instance is queued in both the opaque and the translucent render lists.
+			 * @note Only meaningful after prepareRender() has been called. renderOpaque() and renderTranslucent()
+			 * can only run at the same time on different threads when this returns false, because a renderable
+			 * instance caches its resolved programs and flushes its skinning data while rendering.
+			 * @return bool
+			 * @since 0.9.53
+			 */
+			[[nodiscard]]
+			bool opaqueAndTranslucentShareInstances () const noexcept;
+
 			/**
 			 * @brief Debug rendering of TBN (Tangent, Binormal, Normal) space vectors.
 			 * @note Requires geometry shader support. Iterates all renderable instances
@@ -2053,6 +2158,21 @@ namespace EmEn::Scenes
 			 */
 			void forEachRenderableInstance (const std::function< void (const std::shared_ptr< Graphics::RenderableInstance::Abstract > & renderableInstance) > & function) const noexcept;
 
+			/**
+			 * @brief Generates every program variant the renderable instances of the scene can use, visible or not.
+			 * @note The rendering programs are generated for each given render target, the render to textures and
+			 * the render to views, with every render pass type of the instance: the simple pass and, for a lighted
+			 * instance, every light pass whatever the light set state. The MDI variant and the TBN space programs
+			 * follow the instance flags, and the shadow casting programs are generated for every shadow map.
+			 * The programs land in the renderer program cache, see Graphics::Renderer::bakeShaderArchive().
+			 * An instance whose renderable is not loaded yet, or whose skinning resources are not created yet,
+			 * is skipped.
+			 * @param renderTargets A reference to a list of the main render targets of the renderer.
+			 * @return size_t The number of instances whose generation failed.
+			 * @since 0.9.53
+			 */
+			size_t generateProgramVariants (const std::vector< std::shared_ptr< Graphics::RenderTarget::Abstract > > & renderTargets) noexcept;
+
 		private:
 
 			/* ============================================================
@@ -2280,6 +2400,14 @@ namespace EmEn::Scenes
 			[[nodiscard]]
 			Base::StaticVector< Graphics::RenderPassType, Graphics::MaxPassCount > prepareRenderPassTypes (const Graphics::RenderableInstance::Abstract & renderableInstance) const noexcept;
 
+			/**
+			 * @brief Returns whether a renderable instance is drawn through the multi-draw indirect path.
+			 * @param renderableInstance A reference to a renderable instance.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isMDIRenderableInstance (const Graphics::RenderableInstance::Abstract & renderableInstance) const noexcept;
+
 			/**
 			 * @brief Prepares a renderable instance for shadow map rendering.
 			 *
@@ -2305,6 +2433,8 @@ namespace EmEn::Scenes
 			 * @return True if ready or deferred, false on permanent failure.
 			 *
 			 * @note Returns true even if preparation is deferred.
+			 * @note With asynchronous program preparation, the programs are generated by a thread pool
+			 * task and the instance is not ready to render until the task publishes them.
 			 */
 			[[nodiscard]]
 			bool getRenderableInstanceReadyForRendering (const std::shared_ptr< Graphics::RenderableInstance::Abstract > & renderableInstance, const std::shared_ptr< Graphics::RenderTarget::Abstract > & renderTarget) noexcept;
@@ -2335,6 +2465,41 @@ namespace EmEn::Scenes
 			 */
 			void resolveCollisions () const noexcept;
 
+			/**
+			 * @brief Applies the scene modifier forces to the movable bodies of the physics octree.
+			 * @note Each modifier is evaluated over the bodies overlapping its influence area bounds only,
+			 * found through the physics octree sectors. Modifiers without influence area reach every body.
+			 * @since 0.9.53
+			 */
+			void applyModifiers () const noexcept;
+
+			/**
+			 * @brief Integrates the nodes gathered during the node crawl in one batch, then moves them.
+			 * @note Must be called with the scene nodes lock held. Large batches are split over the thread pool.
+			 * @param engineCycle The current engine cycle number.
+			 * @since 0.9.53
+			 */
+			void integrateBodies (size_t engineCycle) noexcept;
+
+			/**
+			 * @brief Adds the time elapsed since the start of a physics phase to its timing, then restarts the phase.
+			 * @note Does nothing unless enablePhysicsTimings() is set.
+			 * @param accumulatorNS A reference to the phase timing, in nanoseconds.
+			 * @param phaseStart A reference to the phase start, set to now.
+			 * @return void
+			 */
+			void measurePhysicsPhase (uint64_t & accumulatorNS, std::chrono::steady_clock::time_point & phaseStart) const noexcept;
+
+			/**
+			 * @brief Sweeps the bodies flagged for continuous collision and clamps them at their first time of impact.
+			 * @note Runs before the discrete phases. Static entity and ground impacts get the same velocity response
+			 * as the static phase, impacts against other bodies are appended to the solver manifolds.
+			 * @param dynamicManifolds [out] The manifolds resolved by the constraint solver.
+			 * @param involvedEntities [out] The entities to clip inside the boundaries after solving.
+			 * @since 0.9.53
+			 */
+			void resolveContinuousCollisions (std::vector< Physics::ContactManifold > & dynamicManifolds, std::vector< std::shared_ptr< AbstractEntity > > & involvedEntities) const noexcept;
+
 			/**
 			 * @brief Performs collision tests within a single sector.
 			 * @param sector A reference to a sector.
@@ -2418,6 +2583,24 @@ namespace EmEn::Scenes
 			 */
 			void accumulateBoundaryCorrection (const std::shared_ptr< AbstractEntity > & entity, Base::Math::Vector< 3, float > & positionCorrection, Base::Math::Vector< 3, float > & dominantNormal, float & maxPenetration) const noexcept;
 
+			/**
+			 * @brief Samples the ground level under every awake movable entity in one batch.
+			 * @note The probes are the points accumulateGroundCorrection() tests: the center for points
+			 * and spheres, the four bottom corners for boxes and hulls.
+			 * @return void
+			 */
+			void sampleGroundProbes () const noexcept;
+
+			/**
+			 * @brief Returns the ground level under a probe of an entity, from the batch when still valid.
+			 * @param entity A reference to the entity.
+			 * @param probeIndex The probe index for this entity.
+			 * @param probePosition A reference to the current probe position.
+			 * @return float
+			 */
+			[[nodiscard]]
+			float groundLevelAt (const AbstractEntity & entity, size_t probeIndex, const Base::Math::Vector< 3, float > & probePosition) const noexcept;
+
 			/**
 			 * @brief Accumulates position correction from ground collision.
 			 *
@@ -2541,6 +2724,12 @@ namespace EmEn::Scenes
 			SceneInstanceTransforms m_instanceTransforms;
 			/** @brief Render lists indexed by render category (Opaque, Translucent, TranslucentGB, etc.). */
 			std::array< RenderBatch::List, 7 > m_renderLists{};
+			/** @brief Flattened shadow casting render list, built by prepareShadowCasting(). */
+			std::vector< const RenderBatch * > m_shadowCastingBatches;
+			/** @brief Batch ranges [first, last) of the shadow casting chunks. */
+			std::vector< std::pair< size_t, size_t > > m_shadowCastingChunks;
+			/** @brief Double-buffer read index captured by prepareShadowCasting(). */
+			uint32_t m_shadowCastingReadStateIndex{0};
 			/** @brief RT opaque render list (all scene geometry, no frustum culling). */
 			RenderBatch::List m_rtOpaqueList;
 			/** @brief RT opaque lighted render list (all scene geometry, no frustum culling). */
@@ -2602,6 +2791,20 @@ namespace EmEn::Scenes
 			Physics::EnvironmentPhysicalProperties m_environmentPhysicalProperties{Physics::EnvironmentPhysicalProperties::Earth()};
 			/** @brief [PHYSICS-NEW-SYSTEM] Sequential impulse constraint solver. */
 			mutable Physics::ConstraintSolver m_constraintSolver{8, 3};
+			/** @brief Batch integrator of the active nodes (structure of arrays, cleared each tick). */
+			Physics::BodyIntegrator m_bodyIntegrator;
+			/** @brief Nodes gathered in the batch integrator this tick, in crawl order. */
+			std::vector< std::shared_ptr< Node > > m_integratedNodes;
+			/** @brief Ground probe coordinates and levels sampled in one batch before the static collisions. */
+			mutable std::vector< float > m_groundProbesX;
+			mutable std::vector< float > m_groundProbesZ;
+			mutable std::vector< float > m_groundProbeLevels;
+			/** @brief First ground probe index of each entity sampled this tick. */
+			mutable std::unordered_map< const AbstractEntity *, size_t > m_groundProbeOffsets;
+			/** @brief Contact islands of the awake bodies, and the sleeping islands to wake on contact. */
+			mutable ContactIslands m_contactIslands;
+			/** @brief Accumulated physics phase timings, see enablePhysicsTimings(). */
+			mutable ScenePhysicsTimings m_physicsTimings;
 			/** @brief Scene-local random float generator. */
 			Base::Randomizer< float > m_floatRandomizer;
 			/** @brief Scene-local random integer generator. */
@@ -2650,6 +2853,10 @@ namespace EmEn::Scenes
 			 * irradiance is published and the scalar ambient pushed to the view UBOs is
 			 * zeroed (see refreshAmbientLightProperties / updateEnvironmentIBL). */
 			bool m_iblAmbientEnabled{false};
+			/** @brief True when new renderable instances get their programs from thread pool tasks (see Graphics::ProgramPreparationQueue). */
+			bool m_asynchronousProgramPreparation{true};
+			/** @brief True when the physics phases are timed (benchmarks). */
+			bool m_physicsTimingsEnabled{false};
 			/** @brief True after first enable() call succeeds. */
 			bool m_initialized{false};
 	};
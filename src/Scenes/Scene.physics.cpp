@@ -26,8 +26,15 @@
 
 #include "Scene.hpp"
 
+/* STL inclusions. */
+#include <algorithm>
+
 /* Local inclusions. */
+#include "Graphics/Renderer.hpp"
 #include "Physics/CollisionDetection.hpp"
+#include "Physics/ContinuousCollision.hpp"
+#include "Component/AbstractModifier.hpp"
+#include "ThreadPool.hpp"
 
 namespace EmEn::Scenes
 {
@@ -35,6 +42,21 @@ namespace EmEn::Scenes
 	using namespace Base::Math;
 	using namespace Physics;
 
+	/**
+	 * @brief Returns whether two axis aligned boxes overlap.
+	 * @param boxA A reference to the first box.
+	 * @param boxB A reference to the second box.
+	 * @return bool
+	 */
+	static bool
+	isOverlapping (const Space3D::AACuboid< float > & boxA, const Space3D::AACuboid< float > & boxB) noexcept
+	{
+		return
+			boxA.minimum(X) <= boxB.maximum(X) && boxA.maximum(X) >= boxB.minimum(X) &&
+			boxA.minimum(Y) <= boxB.maximum(Y) && boxA.maximum(Y) >= boxB.minimum(Y) &&
+			boxA.minimum(Z) <= boxB.maximum(Z) && boxA.maximum(Z) >= boxB.minimum(Z);
+	}
+
 	/**
 	 * @brief Applies complete collision response: velocity bounce + grounded state.
 	 * @param movable The movable trait to update.
@@ -95,6 +117,22 @@ namespace EmEn::Scenes
 		 * concurrent modifications from other threads (e.g., checkEntityLocationInOctrees). */
 		const std::lock_guard< std::mutex > lock{m_physicsOctreeAccess};
 
+		auto phaseStart = std::chrono::steady_clock::now();
+
+		std::vector< ContactManifold > dynamicManifolds;
+		std::vector< std::shared_ptr< AbstractEntity > > involvedEntities;
+
+		/* ============================================================
+		 * PHASE 0: CONTINUOUS COLLISIONS (opt-in fast bodies)
+		 * - Sweep the last displacement, clamp at the first time of impact
+		 * - Static and ground hits are answered here, body hits feed the solver
+		 * ============================================================ */
+
+		this->resolveContinuousCollisions(dynamicManifolds, involvedEntities);
+
+		/* NOTE: The ground levels under every awake body are fetched in one batch. */
+		this->sampleGroundProbes();
+
 		/* ============================================================
 		 * PHASE 1: STATIC COLLISIONS (Boundaries, Ground, StaticEntity)
 		 * - Accumulate position corrections from ALL static collisions
@@ -119,6 +157,8 @@ namespace EmEn::Scenes
 					continue;
 				}
 
+				m_contactIslands.addBody(entity);
+
 				/* Accumulation variables. */
 				Vector< 3, float > positionCorrection{0.0F, 0.0F, 0.0F};
 				Vector< 3, float > dominantNormal{0.0F, 0.0F, 0.0F};
@@ -207,41 +247,43 @@ namespace EmEn::Scenes
 			}
 		});
 
+		this->measurePhysicsPhase(m_physicsTimings.staticCollisions, phaseStart);
+
 		/* ============================================================
 		 * PHASE 2: DYNAMIC COLLISIONS (Node vs Node)
+		 * - Candidate pairs gathered in the octree sectors, in creation order
 		 * - Detection via collision models
 		 * - Resolution via Sequential Impulse Solver
 		 * ============================================================ */
 
-		std::vector< ContactManifold > dynamicManifolds;
 		std::unordered_set< uint64_t > testedEntityPairs;
-		std::vector< std::shared_ptr< AbstractEntity > > involvedEntities;
+		std::vector< std::pair< const std::shared_ptr< AbstractEntity > *, const std::shared_ptr< AbstractEntity > * > > candidatePairs;
 
-		m_physicsOctree->forLeafSectors([&dynamicManifolds, &testedEntityPairs, &involvedEntities] (const OctreeSector< AbstractEntity, true > & leafSector) {
+		m_physicsOctree->forLeafSectors([&candidatePairs, &testedEntityPairs] (const OctreeSector< AbstractEntity, true > & leafSector) {
 			const auto & elements = leafSector.elements();
 
-			for ( auto elementIt = elements.begin(); elementIt != elements.end(); ++elementIt )
+			for ( const auto & entityA : elements )
 			{
-				const auto & entityA = *elementIt;
-
-				/* Skip non-movable entities. */
-				if ( !entityA->hasMovableAbility() )
+				/* NOTE: Only awake bodies start a pair walk. A sleeping body is only met as the other
+				 * side of an awake one, so a sector of sleeping bodies costs a single pass. */
+				if ( !entityA->hasMovableAbility() || entityA->isSimulationPaused() )
 				{
 					continue;
 				}
 
-				const bool entityAPaused = entityA->isSimulationPaused();
+				bool beforeEntityA = true;
 
-				auto elementItCopy = elementIt;
-
-				for ( ++elementItCopy; elementItCopy != elements.end(); ++elementItCopy )
+				for ( const auto & entityB : elements )
 				{
-					const auto & entityB = *elementItCopy;
+					if ( entityB == entityA )
+					{
+						beforeEntityA = false;
 
-					/* Skip non-movable entities, or pairs where both are paused
-					 * (two sleeping bodies don't need collision testing).
-					 * An active entity must still collide with paused ones. */
-					if ( !entityB->hasMovableAbility() || (entityAPaused && entityB->isSimulationPaused()) )
+						continue;
+					}
+
+					/* Skip non-movable entities. An awake body met before A already walked this pair. */
+					if ( !entityB->hasMovableAbility() || (beforeEntityA && !entityB->isSimulationPaused()) )
 					{
 						continue;
 					}
@@ -252,16 +294,52 @@ namespace EmEn::Scenes
 						continue;
 					}
 
-					/* Detect and collect collision manifold. */
-					if ( detectCollisionMovableToMovable(*entityA, *entityB, dynamicManifolds) )
+					/* NOTE: The oldest entity of the pair is always the first one. */
+					if ( entityA->creationIndex() < entityB->creationIndex() )
+					{
+						candidatePairs.emplace_back(&entityA, &entityB);
+					}
+					else
 					{
-						involvedEntities.push_back(entityA);
-						involvedEntities.push_back(entityB);
+						candidatePairs.emplace_back(&entityB, &entityA);
 					}
 				}
 			}
 		});
 
+		/* NOTE: The sectors store their elements in unordered sets. Sorting the pairs by creation index
+		 * gives the solver the same contact order from one run to another. The pointers stay valid, the
+		 * physics octree is locked. */
+		std::ranges::sort(candidatePairs, [] (const auto & pairA, const auto & pairB) {
+			if ( (*pairA.first)->creationIndex() != (*pairB.first)->creationIndex() )
+			{
+				return (*pairA.first)->creationIndex() < (*pairB.first)->creationIndex();
+			}
+
+			return (*pairA.second)->creationIndex() < (*pairB.second)->creationIndex();
+		});
+
+		this->measurePhysicsPhase(m_physicsTimings.broadphase, phaseStart);
+
+		for ( const auto & [entityA, entityB] : candidatePairs )
+		{
+			/* Detect and collect collision manifold. */
+			if ( detectCollisionMovableToMovable(**entityA, **entityB, dynamicManifolds) )
+			{
+				involvedEntities.push_back(*entityA);
+				involvedEntities.push_back(*entityB);
+			}
+		}
+
+		this->measurePhysicsPhase(m_physicsTimings.narrowphase, phaseStart);
+
+		/* NOTE: Involved entities are pushed two by two, one pair per contact. Linking them before
+		 * the solver wakes the sleeping islands touched by an awake body within this tick. */
+		for ( size_t index = 0; index + 1 < involvedEntities.size(); index += 2 )
+		{
+			m_contactIslands.addContact(involvedEntities[index], involvedEntities[index + 1]);
+		}
+
 		/* Resolve dynamic collisions via impulse solver, then enforce boundaries. */
 		if ( !dynamicManifolds.empty() )
 		{
@@ -274,6 +352,311 @@ namespace EmEn::Scenes
 				this->clipInsideBoundaries(entity);
 			}
 		}
+
+		/* ============================================================
+		 * PHASE 3: SLEEPING ISLANDS
+		 * - Bodies in contact are linked into islands
+		 * - An island sleeps as a whole, and wakes as a whole
+		 * ============================================================ */
+
+		m_contactIslands.update();
+
+		this->measurePhysicsPhase(m_physicsTimings.solver, phaseStart);
+	}
+
+	void
+	Scene::measurePhysicsPhase (uint64_t & accumulatorNS, std::chrono::steady_clock::time_point & phaseStart) const noexcept
+	{
+		if ( !m_physicsTimingsEnabled )
+		{
+			return;
+		}
+
+		const auto now = std::chrono::steady_clock::now();
+
+		accumulatorNS += static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(now - phaseStart).count());
+
+		phaseStart = now;
+	}
+
+	void
+	Scene::applyModifiers () const noexcept
+	{
+		if ( m_physicsOctree == nullptr || m_modifiers.empty() )
+		{
+			return;
+		}
+
+		/* NOTE: The octree sectors are walked, keep them from being reorganized by the location updates. */
+		const std::lock_guard< std::mutex > lock{m_physicsOctreeAccess};
+
+		std::unordered_set< const AbstractEntity * > affectedEntities;
+
+		const auto applyModifier = [] (const Component::AbstractModifier & modifier, const std::shared_ptr< AbstractEntity > & entity) {
+			/* NOTE: Avoid working on the same entity. */
+			if ( entity.get() == &modifier.parentEntity() || !entity->hasMovableAbility() )
+			{
+				return;
+			}
+
+			auto * movable = entity->getMovableTrait();
+
+			if ( movable == nullptr || !movable->isMovable() )
+			{
+				return;
+			}
+
+			movable->addForce(modifier.getForceAppliedTo(*entity));
+		};
+
+		/* NOTE: One pass per modifier over the bodies it can reach. Bounded modifiers only
+		 * visit the physics octree sectors touched by their influence area. */
+		this->forEachModifiers([&] (const Component::AbstractModifier & modifier) {
+			if ( !modifier.isEnabled() )
+			{
+				return;
+			}
+
+			const auto influenceBounds = modifier.hasInfluenceArea() ?
+				modifier.influenceArea()->getWorldBoundingBox() :
+				Space3D::AACuboid< float >{};
+
+			/* An unbounded modifier (no influence area) applies everywhere. */
+			if ( !influenceBounds.isValid() )
+			{
+				for ( const auto & entity : m_physicsOctree->elements() )
+				{
+					applyModifier(modifier, entity);
+				}
+
+				return;
+			}
+
+			affectedEntities.clear();
+
+			m_physicsOctree->forTouchedSector(influenceBounds, [&] (const OctreeSector< AbstractEntity, true > & sector) {
+				for ( const auto & entity : sector.elements() )
+				{
+					if ( !affectedEntities.insert(entity.get()).second )
+					{
+						continue;
+					}
+
+					if ( !isOverlapping(influenceBounds, entity->collisionModel()->getAABB(entity->getWorldCoordinates())) )
+					{
+						continue;
+					}
+
+					applyModifier(modifier, entity);
+				}
+			});
+		});
+	}
+
+	void
+	Scene::integrateBodies (size_t engineCycle) noexcept
+	{
+		if ( m_integratedNodes.empty() )
+		{
+			return;
+		}
+
+		m_bodyIntegrator.integrate(m_graphicsRenderer.primaryServices().threadPool().get());
+
+		for ( size_t index = 0; index < m_integratedNodes.size(); ++index )
+		{
+			const auto & node = m_integratedNodes[index];
+
+			if ( node->applyIntegrationResults(m_bodyIntegrator, index) )
+			{
+				node->setMovedAtCycle(engineCycle);
+
+				this->checkEntityLocationInOctrees(node);
+			}
+
+			/* NOTE: The sleep decision is taken by island after the collisions, see ContactIslands. */
+			node->updateRestState();
+		}
+
+		m_integratedNodes.clear();
+		m_bodyIntegrator.clear();
+	}
+
+	void
+	Scene::resolveContinuousCollisions (std::vector< ContactManifold > & dynamicManifolds, std::vector< std::shared_ptr< AbstractEntity > > & involvedEntities) const noexcept
+	{
+		std::unordered_set< const AbstractEntity * > testedEntities;
+		std::vector< std::shared_ptr< AbstractEntity > > sweptEntities;
+
+		for ( const auto & entity : m_physicsOctree->elements() )
+		{
+			if ( !entity->hasMovableAbility() || entity->isSimulationPaused() || !entity->hasCollisionModel() )
+			{
+				continue;
+			}
+
+			const auto * movable = entity->getMovableTrait();
+
+			if ( movable == nullptr || !movable->isMovable() || !movable->isContinuousCollisionEnabled() )
+			{
+				continue;
+			}
+
+			sweptEntities.emplace_back(entity);
+		}
+
+		/* NOTE: A clamped body is an obstacle for the next sweeps, they run in creation order
+		 * so the result does not depend on the unordered octree sets. */
+		std::ranges::sort(sweptEntities, [] (const auto & entityA, const auto & entityB) {
+			return entityA->creationIndex() < entityB->creationIndex();
+		});
+
+		for ( const auto & entity : sweptEntities )
+		{
+			auto * movable = entity->getMovableTrait();
+
+			const auto * model = entity->collisionModel();
+			const auto displacement = movable->lastPhysicsDisplacement();
+
+			/* NOTE: A body moving less than its own radius per tick cannot tunnel, the discrete pass is enough. */
+			if ( displacement.length() <= model->getRadius() )
+			{
+				continue;
+			}
+
+			const auto endFrame = entity->getWorldCoordinates();
+			auto startFrame = endFrame;
+			startFrame.setPosition(endFrame.position() - displacement);
+
+			auto sweptVolume = model->getAABB(startFrame);
+			sweptVolume.merge(model->getAABB(endFrame));
+
+			TimeOfImpactResults earliestImpact;
+			std::shared_ptr< AbstractEntity > impactedEntity;
+			bool groundImpact = false;
+
+			/* 0.1 - Sweep against static entities and other bodies along the path. */
+			testedEntities.clear();
+
+			m_physicsOctree->forTouchedSector(sweptVolume, [&] (const OctreeSector< AbstractEntity, true > & sector) {
+				for ( const auto & otherEntity : sector.elements() )
+				{
+					if ( otherEntity.get() == entity.get() || !otherEntity->hasCollisionModel() || !testedEntities.insert(otherEntity.get()).second )
+					{
+						continue;
+					}
+
+					const auto * otherModel = otherEntity->collisionModel();
+
+					/* Point models have no volume to hit. */
+					if ( otherModel->modelType() == CollisionModelType::Point )
+					{
+						continue;
+					}
+
+					auto otherStartFrame = otherEntity->getWorldCoordinates();
+					Vector< 3, float > otherDisplacement;
+
+					if ( otherEntity->hasMovableAbility() && !otherEntity->isSimulationPaused() )
+					{
+						if ( const auto * otherMovable = otherEntity->getMovableTrait(); otherMovable != nullptr )
+						{
+							otherDisplacement = otherMovable->lastPhysicsDisplacement();
+							otherStartFrame.setPosition(otherStartFrame.position() - otherDisplacement);
+						}
+					}
+
+					const auto impact = computeTimeOfImpact(*model, startFrame, displacement, *otherModel, otherStartFrame, otherDisplacement);
+
+					if ( !impact.m_impactDetected )
+					{
+						continue;
+					}
+
+					/* NOTE: Equal times of impact are broken by creation index, the sector order is not stable. */
+					const bool earliest = impact.m_time < earliestImpact.m_time ||
+						(impact.m_time == earliestImpact.m_time && impactedEntity != nullptr && otherEntity->creationIndex() < impactedEntity->creationIndex());
+
+					if ( earliest )
+					{
+						earliestImpact = impact;
+						impactedEntity = otherEntity;
+						groundImpact = false;
+					}
+				}
+			});
+
+			/* 0.2 - Sweep the lowest point of the body against the ground. */
+			if ( m_groundLevel != nullptr )
+			{
+				auto lowestPoint = startFrame.position();
+				lowestPoint[Y] = model->getAABB(startFrame).maximum(Y);
+
+				const auto impact = computeTimeOfImpactWithHeightField(
+					lowestPoint,
+					displacement,
+					[this] (const Vector< 3, float > & position) {
+						return m_groundLevel->getLevelAt(position);
+					},
+					std::max(model->getRadius(), 0.1F)
+				);
+
+				if ( impact.m_impactDetected && impact.m_time < earliestImpact.m_time )
+				{
+					earliestImpact = impact;
+					/* NOTE: Y- is up, the ground pushes the body toward Y-. */
+					earliestImpact.m_impactNormal = {0.0F, -1.0F, 0.0F};
+					impactedEntity.reset();
+					groundImpact = true;
+				}
+			}
+
+			if ( !earliestImpact.m_impactDetected )
+			{
+				continue;
+			}
+
+			/* 0.3 - Clamp the body at the time of impact, slightly inside so the contact persists. */
+			const auto clampedPosition = startFrame.position() + displacement * earliestImpact.m_time - earliestImpact.m_impactNormal * ContinuousCollisionSkin;
+
+			movable->moveFromPhysics(clampedPosition - endFrame.position());
+
+			/* 0.4 - Body against body: let the impulse solver answer. */
+			if ( impactedEntity != nullptr && impactedEntity->hasMovableAbility() )
+			{
+				if ( auto * otherMovable = impactedEntity->getMovableTrait(); otherMovable != nullptr )
+				{
+					ContactManifold manifold{movable, otherMovable};
+					/* NOTE: Impact normal points from B toward A, the solver expects A toward B. */
+					manifold.addContact(earliestImpact.m_contact, -earliestImpact.m_impactNormal, ContinuousCollisionSkin);
+					dynamicManifolds.push_back(manifold);
+
+					involvedEntities.push_back(entity);
+					involvedEntities.push_back(impactedEntity);
+
+					continue;
+				}
+			}
+
+			/* 0.5 - Body against static entity or ground: same response as the discrete static phase. */
+			const auto surfaceNormal = -earliestImpact.m_impactNormal;
+			const float impactVelocity = Vector< 3, float >::dotProduct(movable->linearVelocity(), surfaceNormal);
+			const float impactForce = std::max(0.0F, impactVelocity) * movable->getBodyPhysicalProperties().mass() / WorldPhysicsUpdateCycleDurationS< float >;
+
+			if ( groundImpact )
+			{
+				applyCollisionResponse(movable, surfaceNormal, ContinuousCollisionSkin, GroundedSource::Ground, nullptr);
+			}
+			else
+			{
+				applyCollisionResponse(movable, surfaceNormal, 0.0F, GroundedSource::Entity, impactedEntity->getMovableTrait());
+			}
+
+			if ( impactForce > 0.0F )
+			{
+				movable->onCollision(impactForce);
+			}
+		}
 	}
 
 	uint64_t
@@ -485,7 +868,9 @@ namespace EmEn::Scenes
 			}
 				break;
 
+			/* NOTE: Convex hulls are resolved against the scene boundary and the ground through their world AABB. */
 			case CollisionModelType::AABB :
+			case CollisionModelType::ConvexHull :
 			{
 				const auto aabb = model->getAABB(worldCoords);
 
@@ -581,6 +966,7 @@ namespace EmEn::Scenes
 				break;
 
 			case CollisionModelType::AABB :
+			case CollisionModelType::ConvexHull :
 			{
 				const auto aabb = model->getAABB(worldCoords);
 
@@ -750,6 +1136,7 @@ namespace EmEn::Scenes
 				break;
 
 			case CollisionModelType::AABB :
+			case CollisionModelType::ConvexHull :
 			{
 				const auto aabb = model->getAABB(worldCoords);
 
@@ -875,6 +1262,7 @@ namespace EmEn::Scenes
 				break;
 
 			case CollisionModelType::AABB :
+			case CollisionModelType::ConvexHull :
 			{
 				const auto aabb = model->getAABB(worldCoords);
 
@@ -1011,6 +1399,7 @@ namespace EmEn::Scenes
 				break;
 
 			case CollisionModelType::AABB :
+			case CollisionModelType::ConvexHull :
 			{
 				const auto aabb = model->getAABB(worldCoords);
 
@@ -1049,6 +1438,84 @@ namespace EmEn::Scenes
 		}
 	}
 
+	void
+	Scene::sampleGroundProbes () const noexcept
+	{
+		m_groundProbesX.clear();
+		m_groundProbesZ.clear();
+		m_groundProbeOffsets.clear();
+
+		if ( m_groundLevel == nullptr )
+		{
+			return;
+		}
+
+		for ( const auto & entity : m_physicsOctree->elements() )
+		{
+			if ( !entity->hasMovableAbility() || entity->isSimulationPaused() || !entity->hasCollisionModel() )
+			{
+				continue;
+			}
+
+			const auto * model = entity->collisionModel();
+			const auto worldCoords = entity->getWorldCoordinates();
+			const auto firstProbe = m_groundProbesX.size();
+
+			switch ( model->modelType() )
+			{
+				case CollisionModelType::Point :
+				case CollisionModelType::Sphere :
+				{
+					const auto position = worldCoords.position();
+
+					m_groundProbesX.emplace_back(position[X]);
+					m_groundProbesZ.emplace_back(position[Z]);
+				}
+					break;
+
+				case CollisionModelType::AABB :
+				case CollisionModelType::ConvexHull :
+				{
+					const auto aabb = model->getAABB(worldCoords);
+
+					/* NOTE: Same corner order as accumulateGroundCorrection(). */
+					for ( const auto & corner : {aabb.bottomSouthEast(), aabb.bottomSouthWest(), aabb.bottomNorthWest(), aabb.bottomNorthEast()} )
+					{
+						m_groundProbesX.emplace_back(corner[X]);
+						m_groundProbesZ.emplace_back(corner[Z]);
+					}
+				}
+					break;
+
+				case CollisionModelType::Capsule :
+					continue;
+			}
+
+			m_groundProbeOffsets.emplace(entity.get(), firstProbe);
+		}
+
+		m_groundProbeLevels.resize(m_groundProbesX.size());
+
+		m_groundLevel->getLevelsAt(m_groundProbesX.data(), m_groundProbesZ.data(), m_groundProbeLevels.data(), m_groundProbesX.size(), m_graphicsRenderer.primaryServices().threadPool().get());
+	}
+
+	float
+	Scene::groundLevelAt (const AbstractEntity & entity, size_t probeIndex, const Vector< 3, float > & probePosition) const noexcept
+	{
+		if ( const auto offsetIt = m_groundProbeOffsets.find(&entity); offsetIt != m_groundProbeOffsets.cend() )
+		{
+			const auto index = offsetIt->second + probeIndex;
+
+			/* NOTE: An earlier correction this tick may have shifted the entity horizontally, the batch level is then stale. */
+			if ( m_groundProbesX[index] == probePosition[X] && m_groundProbesZ[index] == probePosition[Z] )
+			{
+				return m_groundProbeLevels[index];
+			}
+		}
+
+		return m_groundLevel->getLevelAt(probePosition);
+	}
+
 	void
 	Scene::accumulateGroundCorrection (const std::shared_ptr< AbstractEntity > & entity, Vector< 3, float > & positionCorrection, Vector< 3, float > & dominantNormal, float & maxPenetration, Vector< 3, float > & groundNormal, float & groundPenetration) const noexcept
 	{
@@ -1094,7 +1561,7 @@ namespace EmEn::Scenes
 		{
 			case CollisionModelType::Point :
 			{
-				const auto groundLevel = m_groundLevel->getLevelAt(position);
+				const auto groundLevel = this->groundLevelAt(*entity, 0, position);
 
 				/* NOTE: Y- is up, so position[Y] > groundLevel means below ground. */
 				if ( position[Y] > groundLevel )
@@ -1108,7 +1575,7 @@ namespace EmEn::Scenes
 			{
 				const auto aabb = model->getAABB(worldCoords);
 				const auto radius = aabb.width() * 0.5F;
-				const auto groundLevel = m_groundLevel->getLevelAt(position);
+				const auto groundLevel = this->groundLevelAt(*entity, 0, position);
 				/* NOTE: Y- is up, so the lowest point of the sphere is position[Y] + radius. */
 				const auto lowestPoint = position[Y] + radius;
 
@@ -1120,6 +1587,7 @@ namespace EmEn::Scenes
 				break;
 
 			case CollisionModelType::AABB :
+			case CollisionModelType::ConvexHull :
 			{
 				const auto aabb = model->getAABB(worldCoords);
 
@@ -1134,9 +1602,10 @@ namespace EmEn::Scenes
 
 				auto deepestPenetration = 0.0F;
 
-				for ( const auto & corner : bottomCorners )
+				for ( size_t cornerIndex = 0; cornerIndex < bottomCorners.size(); ++cornerIndex )
 				{
-					const auto groundLevel = m_groundLevel->getLevelAt(corner);
+					const auto & corner = bottomCorners[cornerIndex];
+					const auto groundLevel = this->groundLevelAt(*entity, cornerIndex, corner);
 					const auto penetration = corner[Y] - groundLevel;
 
 					if ( penetration > deepestPenetration )
@@ -27,7 +27,9 @@
 #include "Scene.hpp"
 
 /* STL inclusions. */
+#include <algorithm>
 #include <ranges>
+#include <unordered_set>
 
 /* Local inclusions. */
 #include "Graphics/BindlessTextureManager.hpp"
@@ -45,6 +47,64 @@ namespace EmEn::Scenes
 	using namespace Base::Math;
 	using namespace Graphics;
 
+	namespace
+	{
+		/**
+		 * @brief Returns the render pass types of a renderable instance.
+		 * @param lighted Whether the instance is drawn with the light passes.
+		 * @param shadowMapsEnabled Whether the shadow maps are enabled in the renderer.
+		 * @return StaticVector< RenderPassType, MaxPassCount >
+		 */
+		StaticVector< RenderPassType, MaxPassCount >
+		getRenderPassTypes (bool lighted, bool shadowMapsEnabled) noexcept
+		{
+			StaticVector< RenderPassType, MaxPassCount > renderPassTypes;
+
+			if ( !lighted )
+			{
+				renderPassTypes.emplace_back(RenderPassType::SimplePass);
+			}
+			else
+			{
+				renderPassTypes.emplace_back(RenderPassType::AmbientPass);
+
+				renderPassTypes.emplace_back(RenderPassType::DirectionalLightPass);
+				renderPassTypes.emplace_back(RenderPassType::PointLightPass);
+				renderPassTypes.emplace_back(RenderPassType::SpotLightPass);
+
+				/* Color projection pass types. */
+				renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassColorMap);
+				renderPassTypes.emplace_back(RenderPassType::PointLightPassColorMap);
+				renderPassTypes.emplace_back(RenderPassType::SpotLightPassColorMap);
+
+				if ( shadowMapsEnabled )
+				{
+					renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassShadowMap);
+					renderPassTypes.emplace_back(RenderPassType::PointLightPassShadowMap);
+					renderPassTypes.emplace_back(RenderPassType::SpotLightPassShadowMap);
+
+					/* Cascaded variant: renderLightedSelection() picks it the moment a directional
+					 * light was built with the CSM constructor, so the program must exist even
+					 * though no light declares CSM at this point — the light set is not what this
+					 * list is keyed on.
+					 * NOTE: DirectionalLightPassFullCSM is deliberately absent. CSM and colour
+					 * projection are mutually exclusive by contract (a per-cascade light-space
+					 * position cannot address one projection texture, cf. docs/shadow-mapping.md),
+					 * and the CSM light block carries no colour-projection member — generating it
+					 * only produces a shader that cannot compile. */
+					renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassCSM);
+
+					/* Full pass types (shadow + color projection). */
+					renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassFull);
+					renderPassTypes.emplace_back(RenderPassType::PointLightPassFull);
+					renderPassTypes.emplace_back(RenderPassType::SpotLightPassFull);
+				}
+			}
+
+			return renderPassTypes;
+		}
+	}
+
 	std::shared_ptr< RenderTarget::ShadowMap< ViewMatrices2DUBO > >
 	Scene::createRenderToShadowMap (const std::string & name, uint32_t resolution, float viewDistance, bool isOrthographicProjection) noexcept
 	{
@@ -396,6 +456,74 @@ namespace EmEn::Scenes
 		}
 	}
 
+	uint32_t
+	Scene::prepareShadowCasting (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t maxChunkCount, uint32_t minimumChunkSize) noexcept
+	{
+		m_shadowCastingBatches.clear();
+		m_shadowCastingChunks.clear();
+		m_shadowCastingReadStateIndex = m_renderStateIndex.load(std::memory_order_acquire);
+
+		if ( !m_lightSet.isEnabled() )
+		{
+			return 0;
+		}
+
+		if ( !this->populateShadowCastingRenderList(renderTarget, m_shadowCastingReadStateIndex) )
+		{
+			return 0;
+		}
+
+		for ( const auto & renderBatch : m_renderLists[Shadows] | std::views::values )
+		{
+			m_shadowCastingBatches.emplace_back(&renderBatch);
+		}
+
+		const auto batchCount = m_shadowCastingBatches.size();
+		const auto chunkCount = std::clamp< size_t >(batchCount / std::max(minimumChunkSize, 1U), 1, std::max(maxChunkCount, 1U));
+		const auto chunkSize = (batchCount + chunkCount - 1) / chunkCount;
+
+		size_t first = 0;
+
+		while ( first < batchCount )
+		{
+			auto last = std::min(first + chunkSize, batchCount);
+
+			/* NOTE: The layers of a renderable instance are inserted next to each other. A chunk is
+			 * extended until the instance changes, because the instance caches resolved programs
+			 * and flushes its skinning data while casting shadows. */
+			while ( last < batchCount && m_shadowCastingBatches[last]->renderableInstance() == m_shadowCastingBatches[last - 1]->renderableInstance() )
+			{
+				last++;
+			}
+
+			m_shadowCastingChunks.emplace_back(first, last);
+
+			first = last;
+		}
+
+		return static_cast< uint32_t >(m_shadowCastingChunks.size());
+	}
+
+	void
+	Scene::castShadowsChunk (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, uint32_t chunkIndex, const Vulkan::CommandBuffer & commandBuffer) const noexcept
+	{
+		if ( chunkIndex >= m_shadowCastingChunks.size() )
+		{
+			TraceError{ClassId} << "The shadow casting chunk #" << chunkIndex << " does not exist !";
+
+			return;
+		}
+
+		const auto [first, last] = m_shadowCastingChunks[chunkIndex];
+
+		for ( auto batchIndex = first; batchIndex < last; ++batchIndex )
+		{
+			const auto * renderBatch = m_shadowCastingBatches[batchIndex];
+
+			renderBatch->renderableInstance()->castShadows(m_shadowCastingReadStateIndex, renderTarget, renderBatch->subGeometryIndex(), renderBatch->worldCoordinates(), commandBuffer, renderBatch->LODLevel());
+		}
+	}
+
 	void
 	Scene::beginRenderFrame () noexcept
 	{
@@ -573,6 +701,33 @@ namespace EmEn::Scenes
 		return !m_renderLists[TranslucentGB].empty() || !m_renderLists[TranslucentGBLighted].empty();
 	}
 
+	bool
+	Scene::opaqueAndTranslucentShareInstances () const noexcept
+	{
+		std::unordered_set< const RenderableInstance::Abstract * > opaqueInstances;
+
+		for ( const auto category : {Opaque, OpaqueLighted} )
+		{
+			for ( const auto & renderBatch : m_renderLists[category] | std::views::values )
+			{
+				opaqueInstances.emplace(renderBatch.renderableInstance().get());
+			}
+		}
+
+		for ( const auto category : {Translucent, TranslucentLighted} )
+		{
+			for ( const auto & renderBatch : m_renderLists[category] | std::views::values )
+			{
+				if ( opaqueInstances.contains(renderBatch.renderableInstance().get()) )
+				{
+					return true;
+				}
+			}
+		}
+
+		return false;
+	}
+
 	void
 	Scene::renderTBNSpace (const std::shared_ptr< RenderTarget::Abstract > & renderTarget, const Vulkan::CommandBuffer & commandBuffer) noexcept
 	{
@@ -1045,7 +1200,8 @@ namespace EmEn::Scenes
 
 		if ( this->getRenderableInstanceReadyForRendering(renderableInstance, renderTarget) )
 		{
-			return false; // Render
+			/* NOTE: The instance is skipped while a program preparation task works for it. */
+			return !renderableInstance->isReadyToRender(renderTarget);
 		}
 
 		/* If the object cannot be loaded, mark it as broken! */
@@ -1659,6 +1815,103 @@ namespace EmEn::Scenes
 		}
 	}
 
+	size_t
+	Scene::generateProgramVariants (const std::vector< std::shared_ptr< RenderTarget::Abstract > > & renderTargets) noexcept
+	{
+		auto & renderer = m_AVConsoleManager.graphicsRenderer();
+
+		std::vector< std::shared_ptr< RenderTarget::Abstract > > sceneRenderTargets{renderTargets};
+		std::vector< std::shared_ptr< RenderTarget::Abstract > > shadowMaps;
+
+		this->forEachRenderToTexture([&sceneRenderTargets] (const std::shared_ptr< RenderTarget::Abstract > & renderTarget) {
+			sceneRenderTargets.emplace_back(renderTarget);
+		});
+
+		this->forEachRenderToView([&sceneRenderTargets] (const std::shared_ptr< RenderTarget::Abstract > & renderTarget) {
+			sceneRenderTargets.emplace_back(renderTarget);
+		});
+
+		this->forEachRenderToShadowMap([&shadowMaps] (const std::shared_ptr< RenderTarget::Abstract > & renderTarget) {
+			shadowMaps.emplace_back(renderTarget);
+		});
+
+		/* NOTE: The instances are copied out of the scene locks, the generation can be long. */
+		std::vector< std::shared_ptr< RenderableInstance::Abstract > > renderableInstances;
+
+		this->forEachRenderableInstance([&renderableInstances] (const std::shared_ptr< RenderableInstance::Abstract > & renderableInstance) {
+			renderableInstances.emplace_back(renderableInstance);
+		});
+
+		const auto shadowMapsEnabled = renderer.isShadowMapsEnabled();
+
+		size_t failureCount = 0;
+
+		for ( const auto & renderableInstance : renderableInstances )
+		{
+			const auto * renderable = renderableInstance->renderable();
+
+			/* NOTE: The skinning resources change the instance state, they are only created by the render thread. */
+			if ( renderableInstance->isBroken() || renderable == nullptr || !renderable->isReadyForInstantiation() || renderableInstance->isMissingSkinningResources() )
+			{
+				continue;
+			}
+
+			/* NOTE: A lighted instance falls back to the simple pass when the light set is disabled. */
+			auto renderPassTypes = getRenderPassTypes(renderableInstance->isLightingEnabled(), shadowMapsEnabled);
+
+			if ( renderableInstance->isLightingEnabled() )
+			{
+				renderPassTypes.emplace_back(RenderPassType::SimplePass);
+			}
+
+			const auto prepareMDI = this->isMDIRenderableInstance(*renderableInstance);
+
+			bool succeed = true;
+
+			for ( const auto & renderTarget : sceneRenderTargets )
+			{
+				if ( renderTarget == nullptr || renderTarget->framebuffer() == nullptr )
+				{
+					continue;
+				}
+
+				std::string errorMessage;
+
+				if ( !renderableInstance->generateRenderPrograms(*this, renderTarget, renderPassTypes, renderer, errorMessage) )
+				{
+					TraceWarning{ClassId} << "Unable to generate the program variants of '" << renderable->name() << "' for render target '" << renderTarget->id() << "' : " << errorMessage;
+
+					succeed = false;
+				}
+
+				if ( prepareMDI && !renderableInstance->getReadyForMDI(*this, renderTarget, renderer) )
+				{
+					succeed = false;
+				}
+			}
+
+			if ( renderableInstance->isShadowCastingEnabled() )
+			{
+				for ( const auto & shadowMap : shadowMaps )
+				{
+					if ( !renderableInstance->getReadyForShadowCasting(shadowMap, renderer) )
+					{
+						TraceWarning{ClassId} << "Unable to generate the shadow casting programs of '" << renderable->name() << "' for shadow map '" << shadowMap->id() << "' !";
+
+						succeed = false;
+					}
+				}
+			}
+
+			if ( !succeed )
+			{
+				failureCount++;
+			}
+		}
+
+		return failureCount;
+	}
+
 	void
 	Scene::initializeRenderTarget (const std::shared_ptr< RenderTarget::Abstract > & renderTarget) noexcept
 	{
@@ -1701,50 +1954,21 @@ namespace EmEn::Scenes
 	{
 		const std::scoped_lock lock{m_lightSet.mutex()};
 
-		StaticVector< RenderPassType, MaxPassCount > renderPassTypes;
-
-		if ( !m_lightSet.isEnabled() || !renderableInstance.isLightingEnabled() )
-		{
-			renderPassTypes.emplace_back(RenderPassType::SimplePass);
-		}
-		else
-		{
-			renderPassTypes.emplace_back(RenderPassType::AmbientPass);
-
-			renderPassTypes.emplace_back(RenderPassType::DirectionalLightPass);
-			renderPassTypes.emplace_back(RenderPassType::PointLightPass);
-			renderPassTypes.emplace_back(RenderPassType::SpotLightPass);
-
-			/* Color projection pass types. */
-			renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassColorMap);
-			renderPassTypes.emplace_back(RenderPassType::PointLightPassColorMap);
-			renderPassTypes.emplace_back(RenderPassType::SpotLightPassColorMap);
-
-			if ( m_AVConsoleManager.graphicsRenderer().isShadowMapsEnabled() )
-			{
-				renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassShadowMap);
-				renderPassTypes.emplace_back(RenderPassType::PointLightPassShadowMap);
-				renderPassTypes.emplace_back(RenderPassType::SpotLightPassShadowMap);
-
-				/* Cascaded variant: renderLightedSelection() picks it the moment a directional
-				 * light was built with the CSM constructor, so the program must exist even
-				 * though no light declares CSM at this point — the light set is not what this
-				 * list is keyed on.
-				 * NOTE: DirectionalLightPassFullCSM is deliberately absent. CSM and colour
-				 * projection are mutually exclusive by contract (a per-cascade light-space
-				 * position cannot address one projection texture, cf. docs/shadow-mapping.md),
-				 * and the CSM light block carries no colour-projection member — generating it
-				 * only produces a shader that cannot compile. */
-				renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassCSM);
-
-				/* Full pass types (shadow + color projection). */
-				renderPassTypes.emplace_back(RenderPassType::DirectionalLightPassFull);
-				renderPassTypes.emplace_back(RenderPassType::PointLightPassFull);
-				renderPassTypes.emplace_back(RenderPassType::SpotLightPassFull);
-			}
-		}
+		return getRenderPassTypes(m_lightSet.isEnabled() && renderableInstance.isLightingEnabled(), m_AVConsoleManager.graphicsRenderer().isShadowMapsEnabled());
+	}
 
-		return renderPassTypes;
+	bool
+	Scene::isMDIRenderableInstance (const RenderableInstance::Abstract & renderableInstance) const noexcept
+	{
+		/* Sprites, InfinityView, and other special objects are excluded — they need per-object
+		 * push constant handling that's incompatible with the MDI push constant layout. */
+		return m_AVConsoleManager.graphicsRenderer().isMDIEnabled()
+			&& !renderableInstance.isLightingEnabled()
+			&& renderableInstance.renderable() != nullptr
+			&& !renderableInstance.renderable()->isSprite()
+			&& !renderableInstance.isUsingInfinityView()
+			&& !renderableInstance.isDepthTestDisabled()
+			&& !renderableInstance.isDepthWriteDisabled();
 	}
 
 	bool
@@ -1786,6 +2010,27 @@ namespace EmEn::Scenes
 			return true;
 		}
 
+		auto & renderer = m_AVConsoleManager.graphicsRenderer();
+
+		if ( m_asynchronousProgramPreparation )
+		{
+			std::string errorMessage;
+
+			switch ( renderer.programPreparationQueue().poll(renderableInstance, renderTarget, errorMessage) )
+			{
+				case ProgramPreparationQueue::State::Pending :
+					return true;
+
+				case ProgramPreparationQueue::State::Failed :
+					renderableInstance->setBroken(errorMessage);
+
+					return false;
+
+				case ProgramPreparationQueue::State::None :
+					break;
+			}
+		}
+
 		/* A previous try to set up the renderable instance for rendering has failed ... */
 		if ( renderableInstance->isBroken() )
 		{
@@ -1802,7 +2047,48 @@ namespace EmEn::Scenes
 			return false;
 		}
 
-		if ( !renderableInstance->getReadyForRender(*this, renderTarget, renderPassTypes, m_AVConsoleManager.graphicsRenderer()) )
+		/* Generate MDI shader variants for standard opaque non-lighted objects when MDI is enabled. */
+		const auto prepareMDI = this->isMDIRenderableInstance(*renderableInstance);
+
+		/* NOTE: Saphir generation, GLSL compilation and pipeline creation take from milliseconds
+		 * to hundreds of milliseconds per program. They run on the thread pool and the instance
+		 * is skipped until every program is published. Only the skinning resources, which change
+		 * the instance state, are created here on the render thread. */
+		if ( m_asynchronousProgramPreparation && renderableInstance->renderable() != nullptr )
+		{
+			if ( !renderableInstance->renderable()->isReadyForInstantiation() )
+			{
+				return true;
+			}
+
+			if ( !renderableInstance->prepareSkinningResources(renderer) )
+			{
+				return false;
+			}
+
+			/* NOTE: An identical request already in flight is ignored by the queue. */
+			renderer.programPreparationQueue().submit(*renderer.primaryServices().threadPool(), renderableInstance, renderTarget, [this, &renderer, renderableInstance, renderTarget, renderPassTypes, prepareMDI] (std::string & errorMessage) {
+				/* NOTE: The MDI variants first, the rendering programs publication makes the instance ready. */
+				if ( prepareMDI )
+				{
+					static_cast< void >(renderableInstance->getReadyForMDI(*this, renderTarget, renderer));
+				}
+
+				if ( !renderableInstance->generateRenderPrograms(*this, renderTarget, renderPassTypes, renderer, errorMessage) )
+				{
+					return false;
+				}
+
+				/* NOTE: Same on-demand target contract as the inline path below (atomic flag). */
+				this->signalOnDemandRenderTargets();
+
+				return true;
+			});
+
+			return true;
+		}
+
+		if ( !renderableInstance->getReadyForRender(*this, renderTarget, renderPassTypes, renderer) )
 		{
 			return false;
 		}
@@ -1813,18 +2099,9 @@ namespace EmEn::Scenes
 		 * specific changes (movements) through setRenderOutOfDate() itself. */
 		this->signalOnDemandRenderTargets();
 
-		/* Generate MDI shader variants for standard opaque non-lighted objects when MDI is enabled.
-		 * Sprites, InfinityView, and other special objects are excluded — they need per-object
-		 * push constant handling that's incompatible with the MDI push constant layout. */
-		if ( m_AVConsoleManager.graphicsRenderer().isMDIEnabled()
-			&& !renderableInstance->isLightingEnabled()
-			&& renderableInstance->renderable() != nullptr
-			&& !renderableInstance->renderable()->isSprite()
-			&& !renderableInstance->isUsingInfinityView()
-			&& !renderableInstance->isDepthTestDisabled()
-			&& !renderableInstance->isDepthWriteDisabled() )
-		{
-			static_cast< void >(renderableInstance->getReadyForMDI(*this, renderTarget, m_AVConsoleManager.graphicsRenderer()));
+		if ( prepareMDI )
+		{
+			static_cast< void >(renderableInstance->getReadyForMDI(*this, renderTarget, renderer));
 		}
 
 		return true;
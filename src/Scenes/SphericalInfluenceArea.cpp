@@ -173,6 +173,15 @@ namespace EmEn::Scenes
 		return 1.0F - ((distance - m_innerRadius) / falloutDistance);
 	}
 
+	Space3D::AACuboid< float >
+	SphericalInfluenceArea::getWorldBoundingBox () const noexcept
+	{
+		const auto center = m_parentEntity->getWorldCoordinates().position();
+		const Vector< 3, float > extent{m_outerRadius, m_outerRadius, m_outerRadius};
+
+		return {center + extent, center - extent};
+	}
+
 	void
 	SphericalInfluenceArea::setOuterRadius (float outerRadius) noexcept
 	{
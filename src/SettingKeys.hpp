@@ -228,6 +228,9 @@ namespace EmEn
 			/* Use the Vulkan Memory Allocator (VMA) for GPU allocations. */
 			constexpr auto VkDeviceUseVMAKey{"Core/Video/VulkanDevice/UseVMA"};
 			constexpr auto DefaultVkDeviceUseVMA{true};
+			/* Keep the compiled pipelines on disk (VkPipelineCache) to speed up the next launches. */
+			constexpr auto VkDeviceEnablePipelineCacheKey{"Core/Video/VulkanDevice/EnablePipelineCache"};
+			constexpr auto DefaultVkDeviceEnablePipelineCache{true};
 
 			/* Window */
 			/* Ignore the saved position and center the window on each launch. */
@@ -334,6 +337,10 @@ namespace EmEn
 		 * and it stays dead now; a user-facing framing control has yet to be wired. */
 		constexpr auto GraphicsFocalLengthKey{"Core/Graphics/FocalLength"};
 		constexpr auto DefaultGraphicsFocalLength{13.096F}; /* NOTE: 85° vertical, full frame. */
+		/* Generate the programs (Saphir, GLSL compilation, pipelines) of newly seen
+		 * renderable instances on the thread pool. The instance is skipped until ready. */
+		constexpr auto GraphicsAsynchronousProgramPreparationKey{"Core/Graphics/AsynchronousProgramPreparation"};
+		constexpr auto DefaultGraphicsAsynchronousProgramPreparation{true};
 
 			/* Texture */
 			/* Magnification / minification / mipmap filtering (shared default). Values: "nearest", "linear". */
@@ -361,6 +368,24 @@ namespace EmEn
 			constexpr auto GraphicsGPUProfilerEnabledKey{"Core/Graphics/GPUProfiler/Enabled"};
 			constexpr auto DefaultGraphicsGPUProfilerEnabled{false};
 
+			/* Frame ring allocator.
+			 * Initial size in bytes of one frame-in-flight partition of the ring buffer
+			 * holding the transient uniform and storage data. Grows when a frame runs out. */
+			constexpr auto GraphicsFrameRingAllocatorPartitionSizeKey{"Core/Graphics/FrameRingAllocator/PartitionSize"};
+			constexpr auto DefaultGraphicsFrameRingAllocatorPartitionSize{1048576U};
+
+			/* Frame descriptor allocator.
+			 * Number of sets in one pool of the transient descriptor sets. A frame takes
+			 * as many pools as it needs, they are reset in bulk when its fence signals. */
+			constexpr auto GraphicsFrameDescriptorAllocatorSetsPerPoolKey{"Core/Graphics/FrameDescriptorAllocator/SetsPerPool"};
+			constexpr auto DefaultGraphicsFrameDescriptorAllocatorSetsPerPool{256U};
+
+			/* Render graph.
+			 * Logs the render graph of the post-process chain each time the chain is
+			 * reconfigured: passes, culling, barriers and transient memory aliasing. */
+			constexpr auto GraphicsRenderGraphDumpKey{"Core/Graphics/RenderGraph/Dump"};
+			constexpr auto DefaultGraphicsRenderGraphDump{false};
+
 			/* Ray Tracing.
 			 * The root group holds the master switch and the acceleration-structure
 			 * (BLAS/TLAS) options; each ray-traced effect has its own sub-group. */
@@ -711,6 +736,14 @@ namespace EmEn
 			constexpr auto GraphicsMDIEnabledKey{"Core/Graphics/MDI/Enabled"};
 			constexpr auto DefaultGraphicsMDIEnabled{false};
 
+			/* Parallel recording */
+			/* Record the shadow map draw lists and the main scene pass lists into secondary command buffers on the thread pool. */
+			constexpr auto GraphicsParallelRecordingEnabledKey{"Core/Graphics/ParallelRecording/Enabled"};
+			constexpr auto DefaultGraphicsParallelRecordingEnabled{false};
+			/* Number of render batches under which a draw list is not split further. */
+			constexpr auto GraphicsParallelRecordingMinimumChunkSizeKey{"Core/Graphics/ParallelRecording/MinimumChunkSize"};
+			constexpr auto DefaultGraphicsParallelRecordingMinimumChunkSize{64U};
+
 			/* Shadow Mapping */
 			/* Master switch for shadow mapping. */
 			constexpr auto GraphicsShadowMappingEnabledKey{"Core/Graphics/ShadowMapping/Enabled"};
@@ -738,9 +771,21 @@ namespace EmEn
 			/* Cache compiled SPIR-V binaries on disk. */
 			constexpr auto BinaryCacheEnabledKey{"Core/Graphics/Shader/EnableBinaryCache"};
 			constexpr auto DefaultBinaryCacheEnabled{false};
+			/* Look compiled SPIR-V binaries up in the pre-baked shader archive (data-stores/Shaders/shaders.spva). */
+			constexpr auto ShaderArchiveEnabledKey{"Core/Graphics/Shader/EnableArchive"};
+			constexpr auto DefaultShaderArchiveEnabled{true};
+			/* SPIR-V optimization level applied after the compilation. Values: "None", "Performance", "Size". */
+			constexpr auto ShaderOptimizationLevelKey{"Core/Graphics/Shader/OptimizationLevel"};
+			constexpr auto DefaultShaderOptimizationLevel{"None"};
+			/* Strip the debug names and the non-semantic instructions from the SPIR-V binaries. */
+			constexpr auto ShaderStripDebugInfoKey{"Core/Graphics/Shader/StripDebugInfo"};
+			constexpr auto DefaultShaderStripDebugInfo{false};
 			/* Generate higher-quality (more expensive) shader variants. */
 			constexpr auto EnableHighQualityKey{"Core/Graphics/Shader/EnableHighQuality"};
 			constexpr auto DefaultEnableHighQuality{false};
+			/* Merge the shadow and no-shadow light pass variants into one program switched by a specialization constant. */
+			constexpr auto EnableUberShadersKey{"Core/Graphics/Shader/EnableUberShaders"};
+			constexpr auto DefaultEnableUberShaders{false};
 
 		/* RushMaker (in-engine screencast / video recorder) */
 		/* Enable video / audio capture in RushMaker (shared default). */
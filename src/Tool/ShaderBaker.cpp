@@ -0,0 +1,218 @@
+/*
+ * src/Tool/ShaderBaker.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "ShaderBaker.hpp"
+
+/* STL inclusions. */
+#include <atomic>
+#include <functional>
+#include <string>
+#include <vector>
+
+/* Local inclusions. */
+#include "Arguments.hpp"
+#include "FileSystem.hpp"
+#include "IO/IO.hpp"
+#include "PrimaryServices.hpp"
+#include "Saphir/ShaderArchive.hpp"
+#include "Saphir/ShaderManager.hpp"
+#include "ThreadPool.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Tool
+{
+	using namespace Base;
+	using namespace Saphir;
+
+	/**
+	 * @brief Returns the shader type from a source file extension.
+	 * @param extension A reference to a string.
+	 * @return ShaderType
+	 */
+	[[nodiscard]]
+	static
+	ShaderType
+	shaderTypeFromExtension (const std::string & extension) noexcept
+	{
+		if ( extension == VertexShaderFileExtension )
+		{
+			return ShaderType::VertexShader;
+		}
+
+		if ( extension == TesselationControlShaderFileExtension )
+		{
+			return ShaderType::TesselationControlShader;
+		}
+
+		if ( extension == TesselationEvaluationShaderFileExtension )
+		{
+			return ShaderType::TesselationEvaluationShader;
+		}
+
+		if ( extension == GeometryShaderFileExtension )
+		{
+			return ShaderType::GeometryShader;
+		}
+
+		if ( extension == FragmentShaderFileExtension )
+		{
+			return ShaderType::FragmentShader;
+		}
+
+		if ( extension == ComputeShaderFileExtension )
+		{
+			return ShaderType::ComputeShader;
+		}
+
+		return ShaderType::Undefined;
+	}
+
+	ShaderBaker::ShaderBaker (const Arguments & arguments, PrimaryServices & primaryServices) noexcept
+		: m_primaryServices{primaryServices},
+		m_inputDirectory{primaryServices.fileSystem().cacheDirectory(ShaderManager::ShaderSourcesDirectoryName)},
+		m_outputFilepath{ShaderArchive::DefaultFilename}
+	{
+		if ( const auto arg = arguments.get("--input", "-i") )
+		{
+			m_inputDirectory = arg.value();
+		}
+
+		if ( const auto arg = arguments.get("--output", "-o") )
+		{
+			m_outputFilepath = arg.value();
+		}
+	}
+
+	bool
+	ShaderBaker::execute () noexcept
+	{
+		TraceInfo{ClassId} << "Baking the shader sources from " << m_inputDirectory << " ...";
+
+		/* Collects the sources. The hash is recomputed from the content, like AbstractShader::hash(). */
+		std::vector< std::filesystem::path > filepaths;
+		std::vector< ShaderArchive::Entry > entries;
+		std::vector< std::string > sourceCodes;
+
+		for ( const auto & filepath : IO::directoryEntries(m_inputDirectory) )
+		{
+			const auto shaderType = shaderTypeFromExtension(IO::getFileExtension(filepath));
+
+			if ( shaderType == ShaderType::Undefined )
+			{
+				continue;
+			}
+
+			std::string sourceCode;
+
+			if ( !IO::fileGetContents(filepath, sourceCode) || sourceCode.empty() )
+			{
+				TraceWarning{ClassId} << "Unable to read the shader source " << filepath << ", skipping it.";
+
+				continue;
+			}
+
+			auto & entry = entries.emplace_back();
+			entry.hash = std::hash< std::string >{}(sourceCode);
+			entry.type = shaderType;
+
+			filepaths.emplace_back(filepath);
+			sourceCodes.emplace_back(std::move(sourceCode));
+		}
+
+		if ( entries.empty() )
+		{
+			TraceError{ClassId} << "No shader source found in " << m_inputDirectory << " !";
+
+			return false;
+		}
+
+		/* NOTE: A dedicated manager, no device is needed to compile to SPIR-V. */
+		ShaderManager shaderManager{m_primaryServices};
+
+		if ( !shaderManager.initialize() )
+		{
+			Tracer::error(ClassId, "Unable to initialize the shader manager !");
+
+			return false;
+		}
+
+		std::atomic< uint32_t > failures{0};
+
+		const auto compileShader = [&] (uint32_t index) {
+			auto & entry = entries[index];
+
+			const auto shaderName = filepaths[index].stem().string();
+
+			if ( !shaderManager.compile(shaderName, entry.type, sourceCodes[index], entry.binaryCode) )
+			{
+				TraceError{ClassId} << "Unable to compile the shader source " << filepaths[index] << " !";
+
+				failures.fetch_add(1, std::memory_order_relaxed);
+
+				return;
+			}
+
+			/* NOTE: Every baked binary goes through the SPIR-V validator, optimized or not. */
+			if ( !shaderManager.spirvOptimizer().validate(shaderName, entry.binaryCode) )
+			{
+				TraceError{ClassId} << "The binary of the shader source " << filepaths[index] << " is not valid SPIR-V !";
+
+				entry.binaryCode.clear();
+
+				failures.fetch_add(1, std::memory_order_relaxed);
+
+				return;
+			}
+
+			/* NOTE: The archive key follows the SPIR-V optimizer configuration, like the runtime lookup. */
+			entry.hash = shaderManager.binaryKey(entry.hash);
+		};
+
+		const auto count = static_cast< uint32_t >(entries.size());
+
+		if ( const auto threadPool = m_primaryServices.threadPool(); threadPool != nullptr )
+		{
+			threadPool->parallelFor(uint32_t{0}, count, compileShader);
+		}
+		else
+		{
+			for ( uint32_t index = 0; index < count; ++index )
+			{
+				compileShader(index);
+			}
+		}
+
+		shaderManager.terminate();
+
+		if ( failures > 0 )
+		{
+			TraceWarning{ClassId} << failures.load() << " shader(s) failed to compile and are left out of the archive.";
+		}
+
+		return ShaderArchive::write(m_outputFilepath, std::move(entries));
+	}
+}
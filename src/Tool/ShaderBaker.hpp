@@ -0,0 +1,79 @@
+/*
+ * src/Tool/ShaderBaker.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#pragma once
+
+/* STL inclusions. */
+#include <filesystem>
+
+/* Local inclusions for inheritances. */
+#include "ToolInterface.hpp"
+
+/* Forward declarations. */
+namespace EmEn
+{
+	class PrimaryServices;
+}
+
+namespace EmEn::Tool
+{
+	/**
+	 * @brief The shader baker tool. Compiles generated shader sources into a packed SPIR-V archive.
+	 * @details The sources are the ones captured by the shader source cache of a previous run
+	 * (Core/Graphics/Shader/EnableSourceCodeCache), or any directory given with "--input" ("-i").
+	 * The archive written to "--output" ("-o") is meant to be shipped in "data-stores/Shaders/".
+	 * @note Tools mode has no renderer and no scene. To enumerate the program variants of a scene,
+	 * load it in the application and use the scene manager "bakeShaders" console command instead,
+	 * see Scenes::Scene::generateProgramVariants() and Graphics::Renderer::bakeShaderArchive().
+	 * @extends EmEn::Tool::ToolInterface This is a tool interface.
+	 * @since 0.9.53
+	 */
+	class EMEN_API ShaderBaker final : public ToolInterface
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"ShaderBaker"};
+
+			/**
+			 * @brief Constructs the shader baker.
+			 * @param arguments A reference to the arguments.
+			 * @param primaryServices A reference to the primary services.
+			 */
+			ShaderBaker (const Arguments & arguments, PrimaryServices & primaryServices) noexcept;
+
+			/** @copydoc EmEn::Tool::ToolInterface::execute() */
+			[[nodiscard]]
+			bool execute () noexcept override;
+
+		private:
+
+			PrimaryServices & m_primaryServices;
+			std::filesystem::path m_inputDirectory;
+			std::filesystem::path m_outputFilepath;
+	};
+}
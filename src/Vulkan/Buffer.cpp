@@ -48,6 +48,8 @@ namespace EmEn::Vulkan
 		m_createInfo{other.m_createInfo},
 		m_deviceMemory{std::move(other.m_deviceMemory)},
 		m_memoryAllocation{other.m_memoryAllocation},
+		m_transferTicket{other.m_transferTicket.load()},
+		m_stagingRing{std::move(other.m_stagingRing)},
 		m_hostVisible{other.m_hostVisible}
 	{
 		other.m_handle = VK_NULL_HANDLE;
@@ -72,6 +74,8 @@ namespace EmEn::Vulkan
 			m_createInfo = other.m_createInfo;
 			m_deviceMemory = std::move(other.m_deviceMemory);
 			m_memoryAllocation = other.m_memoryAllocation;
+			m_transferTicket = other.m_transferTicket.load();
+			m_stagingRing = std::move(other.m_stagingRing);
 			m_hostVisible = other.m_hostVisible;
 
 			other.m_handle = VK_NULL_HANDLE;
@@ -119,6 +123,14 @@ namespace EmEn::Vulkan
 	bool
 	Buffer::destroyFromHardware () noexcept
 	{
+		/* NOTE: A batched copy may still target the buffer, the ring drops it or waits for it. */
+		if ( const auto stagingRing = m_stagingRing.lock(); stagingRing != nullptr )
+		{
+			stagingRing->releaseBuffer(m_handle, m_transferTicket.exchange(0, std::memory_order_relaxed));
+		}
+
+		m_stagingRing.reset();
+
 		const auto result =
 			this->device()->useMemoryAllocator() ?
 			this->destroyWithVMA() :
@@ -303,6 +315,21 @@ namespace EmEn::Vulkan
 		}
 	}
 
+	void
+	Buffer::flushMemory (VkDeviceSize offset, VkDeviceSize size) const noexcept
+	{
+		if ( !this->isHostVisible() )
+		{
+			return;
+		}
+
+		/* NOTE: The manual path always allocates host-coherent memory. */
+		if ( m_memoryAllocation != VK_NULL_HANDLE )
+		{
+			vmaFlushAllocation(this->device()->memoryAllocatorHandle(), m_memoryAllocation, offset, size);
+		}
+	}
+
 	bool
 	Buffer::transferData (TransferManager & transferManager, const MemoryRegion & memoryRegion) noexcept
 	{
@@ -313,9 +340,21 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		return transferManager.uploadBuffer(*this, memoryRegion.bytes(), [&memoryRegion] (const Buffer & stagingBuffer) {
-			return stagingBuffer.writeData(memoryRegion);
-		});
+		uint64_t ticket = 0;
+
+		if ( !transferManager.queueBufferUpload(*this, memoryRegion, ticket) )
+		{
+			return false;
+		}
+
+		m_transferTicket.store(ticket, std::memory_order_relaxed);
+
+		if ( ticket != 0 )
+		{
+			m_stagingRing = transferManager.stagingRing();
+		}
+
+		return true;
 	}
 
 	bool
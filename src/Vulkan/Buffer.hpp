@@ -32,6 +32,7 @@
 /* STL inclusions. */
 #include <cstddef>
 #include <cstdint>
+#include <atomic>
 #include <memory>
 
 /* Third-party forward declarations (see Device.hpp note). */
@@ -47,6 +48,7 @@ typedef struct VmaAllocation_T * VmaAllocation;
 /* Forward declarations. */
 namespace EmEn::Vulkan
 {
+	class StagingRing;
 	class TransferManager;
 }
 
@@ -232,8 +234,21 @@ namespace EmEn::Vulkan
 				return m_createInfo.usage;
 			}
 
+			/**
+			 * @brief Returns the ticket of the last upload to this buffer.
+			 * @note The buffer can be read on the rendering queue once TransferManager::isTransferComplete() accepts it.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			transferTicket () const noexcept
+			{
+				return m_transferTicket.load(std::memory_order_relaxed);
+			}
+
 			/**
 			 * @brief Writes data into the device (GPU side) video memory.
+			 * @note The copy is batched with the other uploads, see TransferManager::queueBufferUpload().
 			 * @param transferManager A reference to a transfer manager.
 			 * @param memoryRegion A reference to the memory region.
 			 * @return bool
@@ -336,6 +351,16 @@ namespace EmEn::Vulkan
 			 */
 			void unmapMemory (VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) const noexcept;
 
+			/**
+			 * @brief Flushes a range of the mapped memory to make host writes visible to the device.
+			 * @note Useful for a buffer kept mapped. Does nothing on host-coherent memory.
+			 * @warning Only available for host buffers.
+			 * @param offset The beginning of the range. Default 0.
+			 * @param size The size of the range. Default whole size.
+			 * @return void
+			 */
+			void flushMemory (VkDeviceSize offset = 0, VkDeviceSize size = VK_WHOLE_SIZE) const noexcept;
+
 			/**
 			 * @brief Returns the descriptor buffer info.
 			 * @param offset Where to start in the buffer.
@@ -388,6 +413,8 @@ namespace EmEn::Vulkan
 			VkBufferCreateInfo m_createInfo{};
 			std::unique_ptr< DeviceMemory > m_deviceMemory;
 			VmaAllocation m_memoryAllocation{VK_NULL_HANDLE};
+			std::atomic< uint64_t > m_transferTicket{0};
+			std::weak_ptr< StagingRing > m_stagingRing;
 			mutable std::mutex m_hostMemoryAccess;
 			bool m_hostVisible{false};
 			bool m_hostReadable{false};
@@ -84,6 +84,49 @@ namespace EmEn::Vulkan
 		return true;
 	}
 
+	bool
+	CommandBuffer::beginSecondary (const Framebuffer & framebuffer, uint32_t subpass) const noexcept
+	{
+		if ( !this->isCreated() )
+		{
+			Tracer::error(ClassId, "The command buffer is not created !");
+
+			return false;
+		}
+
+		if ( m_primaryLevel )
+		{
+			Tracer::error(ClassId, "The command buffer is not a secondary one !");
+
+			return false;
+		}
+
+		VkCommandBufferInheritanceInfo inheritanceInfo{};
+		inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+		inheritanceInfo.pNext = nullptr;
+		inheritanceInfo.renderPass = framebuffer.renderPass()->handle();
+		inheritanceInfo.subpass = subpass;
+		inheritanceInfo.framebuffer = framebuffer.handle();
+		inheritanceInfo.occlusionQueryEnable = VK_FALSE;
+		inheritanceInfo.queryFlags = 0;
+		inheritanceInfo.pipelineStatistics = 0;
+
+		VkCommandBufferBeginInfo beginInfo{};
+		beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+		beginInfo.pNext = nullptr;
+		beginInfo.flags = VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT | VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+		beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+		if ( const auto result = vkBeginCommandBuffer(m_handle, &beginInfo); result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to begin record to the secondary command buffer " << m_handle << " : " << vkResultToCString(result) << " !";
+
+			return false;
+		}
+
+		return true;
+	}
+
 	bool
 	CommandBuffer::end () const noexcept
 	{
@@ -172,6 +215,17 @@ namespace EmEn::Vulkan
 		vkCmdEndRenderPass(m_handle);
 	}
 
+	void
+	CommandBuffer::executeCommands (std::span< const VkCommandBuffer > commandBuffers) const noexcept
+	{
+		if ( commandBuffers.empty() )
+		{
+			return;
+		}
+
+		vkCmdExecuteCommands(m_handle, static_cast< uint32_t >(commandBuffers.size()), commandBuffers.data());
+	}
+
 	void
 	CommandBuffer::update (const Buffer & buffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, const void * pData) const noexcept
 	{
@@ -1206,6 +1260,45 @@ namespace EmEn::Vulkan
 		);
 	}
 
+	void
+	CommandBuffer::bind (VkDescriptorSet descriptorSetHandle, const PipelineLayout & pipelineLayout, VkPipelineBindPoint bindPoint, uint32_t firstSet) const noexcept
+	{
+		if constexpr ( IsDebug )
+		{
+			if ( !pipelineLayout.isCreated() )
+			{
+				Tracer::error(ClassId, "The pipeline layout is not created !");
+
+				return;
+			}
+
+			if ( descriptorSetHandle == VK_NULL_HANDLE )
+			{
+				Tracer::error(ClassId, "The descriptor set handle is null !");
+
+				return;
+			}
+
+			if ( !this->isCreated() )
+			{
+				TraceError{ClassId} <<
+					"The command buffer is not created !" "\n"
+					"Unable to bind descriptor set " << descriptorSetHandle << " with pipeline layout " << pipelineLayout.handle();
+
+				return;
+			}
+		}
+
+		vkCmdBindDescriptorSets(
+			m_handle,
+			bindPoint,
+			pipelineLayout.handle(),
+			firstSet,
+			1, &descriptorSetHandle,
+			0, nullptr
+		);
+	}
+
 	void
 	CommandBuffer::bind (const DescriptorSet & descriptorSet, const PipelineLayout & pipelineLayout, VkPipelineBindPoint bindPoint, uint32_t firstSet, uint32_t dynamicOffset) const noexcept
 	{
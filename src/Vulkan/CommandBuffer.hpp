@@ -209,6 +209,16 @@ namespace EmEn::Vulkan
 			[[nodiscard]]
 			bool begin (VkCommandBufferUsageFlagBits vkFlags = VkCommandBufferUsageFlagBits{}) const noexcept;
 
+			/**
+			 * @brief Begins registering commands of a secondary command buffer executed inside a render pass.
+			 * @note The render pass and the framebuffer are inherited from the primary command buffer recording this one.
+			 * @param framebuffer A reference to the framebuffer the primary command buffer renders to.
+			 * @param subpass The subpass index where the commands will be executed. Default 0.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool beginSecondary (const Framebuffer & framebuffer, uint32_t subpass = 0) const noexcept;
+
 			/**
 			 * @brief Ends registering commands.
 			 * @return bool
@@ -269,6 +279,14 @@ namespace EmEn::Vulkan
 			 */
 			void endRenderPass () const noexcept;
 
+			/**
+			 * @brief Registers the execution of secondary command buffers.
+			 * @note The render pass must have been begun with VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+			 * @param commandBuffers A list of secondary command buffer handles.
+			 * @return void
+			 */
+			void executeCommands (std::span< const VkCommandBuffer > commandBuffers) const noexcept;
+
 			/**
 			 * @brief Registers an update buffer command.
 			 * @param buffer A reference to the buffer.
@@ -544,6 +562,17 @@ namespace EmEn::Vulkan
 			 */
 			void bind (const DescriptorSet & descriptorSet, const PipelineLayout & pipelineLayout, VkPipelineBindPoint bindPoint, uint32_t firstSet) const noexcept;
 
+			/**
+			 * @brief Binds a single descriptor set from its handle.
+			 * @note Used for the transient sets of the frame descriptor allocator, which have no DescriptorSet object.
+			 * @param descriptorSetHandle The descriptor set handle.
+			 * @param pipelineLayout A reference to a pipeline layout.
+			 * @param bindPoint The target binding point in the pipeline.
+			 * @param firstSet The first set.
+			 * @return void
+			 */
+			void bind (VkDescriptorSet descriptorSetHandle, const PipelineLayout & pipelineLayout, VkPipelineBindPoint bindPoint, uint32_t firstSet) const noexcept;
+
 			/**
 			 * @brief Binds a single descriptor set.
 			 * @param descriptorSet A reference to a descriptor set.
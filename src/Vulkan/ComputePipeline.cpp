@@ -26,6 +26,9 @@
 
 #include "ComputePipeline.hpp"
 
+/* STL inclusions. */
+#include <chrono>
+
 /* Local inclusions. */
 #include "Device.hpp"
 #include "PipelineLayout.hpp"
@@ -53,13 +56,17 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
-		if ( const auto result = vkCreateComputePipelines(this->device()->handle(), VK_NULL_HANDLE, 1, &m_createInfo, nullptr, &m_handle); result != VK_SUCCESS )
+		const auto start = std::chrono::steady_clock::now();
+
+		if ( const auto result = vkCreateComputePipelines(this->device()->handle(), this->device()->pipelineCacheHandle(), 1, &m_createInfo, nullptr, &m_handle); result != VK_SUCCESS )
 		{
 			TraceError{ClassId} << "Unable to create a compute pipeline : " << vkResultToCString(result) << " !";
 
 			return false;
 		}
 
+		this->device()->notifyPipelineCreation(this->identifier(), std::chrono::steady_clock::now() - start);
+
 		this->setVulkanObjectName(this->device()->handle(), VK_OBJECT_TYPE_PIPELINE, reinterpret_cast< uint64_t >(m_handle));
 
 		this->setCreated();
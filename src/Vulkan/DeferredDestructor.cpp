@@ -0,0 +1,162 @@
+/*
+ * src/Vulkan/DeferredDestructor.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "DeferredDestructor.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+
+namespace EmEn::Vulkan
+{
+	void
+	DeferredDestructor::setFramesInFlight (uint32_t framesInFlight) noexcept
+	{
+		if ( framesInFlight >= SlotCount )
+		{
+			TraceWarning{ClassId} << framesInFlight << " frames in flight exceed the " << SlotCount << " tick slots, the delay is clamped to " << SlotCount - 1 << " !";
+		}
+
+		/* NOTE: Entries already pending keep their slot. Lowering the delay releases them at
+		 * the next pass over their slot, never before the new delay has elapsed. */
+		m_delayTicks.store(std::clamp(framesInFlight, 1U, SlotCount - 1), std::memory_order_relaxed);
+	}
+
+	void
+	DeferredDestructor::push (Entry * entry) noexcept
+	{
+		/* NOTE: Counted before the entry is visible, a release can only follow. */
+		m_pendingCount.fetch_add(1, std::memory_order_relaxed);
+		m_pendingBytes.fetch_add(entry->bytes, std::memory_order_relaxed);
+		m_retiredCount.fetch_add(1, std::memory_order_relaxed);
+
+		/* NOTE: A retiring thread may read the tick just before the render thread advances it.
+		 * The entry then lands in an older slot: if that slot was already released, the entry
+		 * waits for the next pass over it, which is later, never earlier. */
+		auto & slot = m_slots[m_currentTick.load(std::memory_order_acquire) % SlotCount];
+
+		entry->next = slot.head.load(std::memory_order_relaxed);
+
+		while ( !slot.head.compare_exchange_weak(entry->next, entry, std::memory_order_release, std::memory_order_relaxed) )
+		{
+			/* The head changed, entry->next holds the new one. */
+		}
+	}
+
+	void
+	DeferredDestructor::tick () noexcept
+	{
+		const auto currentTick = m_currentTick.fetch_add(1, std::memory_order_acq_rel) + 1;
+		const auto delayTicks = m_delayTicks.load(std::memory_order_relaxed);
+
+		if ( currentTick < delayTicks )
+		{
+			m_lastTickReleasedCount.store(0, std::memory_order_relaxed);
+
+			return;
+		}
+
+		/* NOTE: The slot holds the entries retired delayTicks ago. The delay is lower than
+		 * the slot count, so the slot being filled from now on is a different one. */
+		auto * expired = m_slots[(currentTick - delayTicks) % SlotCount].head.exchange(nullptr, std::memory_order_acquire);
+
+		m_lastTickReleasedCount.store(this->release(expired), std::memory_order_relaxed);
+	}
+
+	void
+	DeferredDestructor::flush () noexcept
+	{
+		/* NOTE: From the oldest slot to the current one, which is filled last. */
+		const auto currentTick = m_currentTick.load(std::memory_order_acquire);
+
+		for ( uint64_t offset = 1; offset <= SlotCount; ++offset )
+		{
+			this->release(m_slots[(currentTick + offset) % SlotCount].head.exchange(nullptr, std::memory_order_acquire));
+		}
+	}
+
+	uint64_t
+	DeferredDestructor::release (Entry * entry) noexcept
+	{
+		uint64_t count = 0;
+		uint64_t bytes = 0;
+
+		/* NOTE: The slot is a stack, the newest entry is on top. The list is reversed first,
+		 * so the objects of a slot are destroyed in their retirement order. */
+		Entry * oldest = nullptr;
+
+		while ( entry != nullptr )
+		{
+			auto * next = entry->next;
+
+			entry->next = oldest;
+			oldest = entry;
+
+			entry = next;
+		}
+
+		entry = oldest;
+
+		/* NOTE: The list is detached, a destructor or an action retiring further objects
+		 * pushes them on the current slot. */
+		while ( entry != nullptr )
+		{
+			auto * next = entry->next;
+
+			if ( entry->action != nullptr )
+			{
+				entry->action();
+			}
+
+			bytes += entry->bytes;
+			count++;
+
+			delete entry;
+
+			entry = next;
+		}
+
+		m_pendingCount.fetch_sub(count, std::memory_order_relaxed);
+		m_pendingBytes.fetch_sub(bytes, std::memory_order_relaxed);
+
+		return count;
+	}
+
+	DeferredDestructor::Statistics
+	DeferredDestructor::statistics () const noexcept
+	{
+		return {
+			.pendingCount = m_pendingCount.load(std::memory_order_relaxed),
+			.pendingBytes = m_pendingBytes.load(std::memory_order_relaxed),
+			.retiredCount = m_retiredCount.load(std::memory_order_relaxed),
+			.lastTickReleasedCount = m_lastTickReleasedCount.load(std::memory_order_relaxed),
+			.delayTicks = m_delayTicks.load(std::memory_order_relaxed)
+		};
+	}
+}
@@ -27,14 +27,12 @@
 #pragma once
 
 /* STL inclusions. */
-#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
-#include <deque>
 #include <functional>
 #include <memory>
-#include <mutex>
 #include <utility>
-#include <vector>
 
 namespace EmEn::Vulkan
 {
@@ -47,6 +45,13 @@ namespace EmEn::Vulkan
 	 * Instead, retire the object (or a destruction action) here; it is destroyed once
 	 * the renderer has ticked framesInFlight times, i.e. once every command buffer that
 	 * could reference it has completed execution and been re-recorded.
+	 *
+	 * Retired entries are pushed on a lock-free list, one per tick slot: retiring is a
+	 * single compare-and-swap from any thread. tick() detaches the whole list of the slot
+	 * that became old enough and destroys it, without scanning the younger entries.
+	 * Entries are destroyed in their retirement order (FIFO), within a slot and across
+	 * the slots on flush().
+	 *
 	 * Retiring is thread-safe; tick() and flush() belong to the render thread.
 	 */
 	class EMEN_API DeferredDestructor final
@@ -56,6 +61,24 @@ namespace EmEn::Vulkan
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"DeferredDestructor"};
 
+			/** @brief The number of tick slots. The retirement delay is at most one less. */
+			static constexpr uint32_t SlotCount{16};
+
+			/** @brief The pending entries and the releases, for the console. */
+			struct Statistics
+			{
+				/** @brief The number of entries waiting for their delay. */
+				uint64_t pendingCount{0};
+				/** @brief The known size in bytes of the pending objects (buffers and images). */
+				uint64_t pendingBytes{0};
+				/** @brief The number of entries retired since the creation. */
+				uint64_t retiredCount{0};
+				/** @brief The number of entries destroyed by the last tick. */
+				uint64_t lastTickReleasedCount{0};
+				/** @brief The retirement delay in ticks. */
+				uint32_t delayTicks{0};
+			};
+
 			/**
 			 * @brief Constructs the deferred destructor.
 			 * @note The default retirement delay is conservative (5 ticks); the renderer
@@ -64,23 +87,23 @@ namespace EmEn::Vulkan
 			DeferredDestructor () noexcept = default;
 
 			/**
-			 * @brief Deleted copy constructor (owns a mutex).
+			 * @brief Deleted copy constructor (owns the pending lists).
 			 */
 			DeferredDestructor (const DeferredDestructor & copy) noexcept = delete;
 
 			/**
-			 * @brief Deleted move constructor (owns a mutex).
+			 * @brief Deleted move constructor (owns the pending lists).
 			 */
 			DeferredDestructor (DeferredDestructor && copy) noexcept = delete;
 
 			/**
-			 * @brief Deleted copy assignment (owns a mutex).
+			 * @brief Deleted copy assignment (owns the pending lists).
 			 * @return DeferredDestructor &
 			 */
 			DeferredDestructor & operator= (const DeferredDestructor & copy) noexcept = delete;
 
 			/**
-			 * @brief Deleted move assignment (owns a mutex).
+			 * @brief Deleted move assignment (owns the pending lists).
 			 * @return DeferredDestructor &
 			 */
 			DeferredDestructor & operator= (DeferredDestructor && copy) noexcept = delete;
@@ -95,39 +118,57 @@ namespace EmEn::Vulkan
 
 			/**
 			 * @brief Sets the retirement delay from the renderer frames-in-flight count.
+			 * @note The delay is clamped to SlotCount - 1.
 			 * @param framesInFlight The number of frames in flight.
 			 * @return void
 			 */
-			void
-			setFramesInFlight (uint32_t framesInFlight) noexcept
-			{
-				const std::scoped_lock lock{m_mutex};
-
-				m_delayTicks = std::max(framesInFlight, 1U);
-			}
+			void setFramesInFlight (uint32_t framesInFlight) noexcept;
 
 			/**
 			 * @brief Retires an owning pointer; the object is destroyed after the delay.
 			 * @param object The last (or a keep-alive) reference to the object.
+			 * @param bytes The size of the object for the statistics. Default unknown.
 			 * @return void
 			 */
 			void
-			retireObject (std::shared_ptr< void > object) noexcept
+			retireObject (std::shared_ptr< void > object, uint64_t bytes = 0) noexcept
 			{
 				if ( object == nullptr )
 				{
 					return;
 				}
 
-				const std::scoped_lock lock{m_mutex};
-
-				m_entries.emplace_back(Entry{
-					.retiredAtTick = m_currentTick,
+				this->push(new Entry{
 					.object = std::move(object),
-					.action = nullptr
+					.action = nullptr,
+					.bytes = bytes
 				});
 			}
 
+			/**
+			 * @brief Retires a typed owning pointer; the object is destroyed after the delay.
+			 * @note Objects exposing bytes() (buffers, images) are accounted in the statistics.
+			 * @tparam object_t The concrete object type.
+			 * @param object The last (or a keep-alive) reference to the object.
+			 * @return void
+			 */
+			template< typename object_t >
+			void
+			retireObject (std::shared_ptr< object_t > object) noexcept
+			{
+				uint64_t bytes = 0;
+
+				if constexpr ( requires { object->bytes(); } )
+				{
+					if ( object != nullptr )
+					{
+						bytes = static_cast< uint64_t >(object->bytes());
+					}
+				}
+
+				this->retireObject(std::shared_ptr< void >{std::move(object)}, bytes);
+			}
+
 			/**
 			 * @brief Retires an owning unique pointer; the object is destroyed after the delay.
 			 * @tparam object_t The concrete object type.
@@ -138,7 +179,7 @@ namespace EmEn::Vulkan
 			void
 			retireObject (std::unique_ptr< object_t > object) noexcept
 			{
-				this->retireObject(std::shared_ptr< void >{std::move(object)});
+				this->retireObject(std::shared_ptr< object_t >{std::move(object)});
 			}
 
 			/**
@@ -148,22 +189,21 @@ namespace EmEn::Vulkan
 			 * plain destruction. The callable must be copyable: capture the
 			 * object through a std::shared_ptr.
 			 * @param action The destruction action.
+			 * @param bytes The size of the captured objects for the statistics. Default unknown.
 			 * @return void
 			 */
 			void
-			retireAction (std::function< void () > action) noexcept
+			retireAction (std::function< void () > action, uint64_t bytes = 0) noexcept
 			{
 				if ( action == nullptr )
 				{
 					return;
 				}
 
-				const std::scoped_lock lock{m_mutex};
-
-				m_entries.emplace_back(Entry{
-					.retiredAtTick = m_currentTick,
+				this->push(new Entry{
 					.object = nullptr,
-					.action = std::move(action)
+					.action = std::move(action),
+					.bytes = bytes
 				});
 			}
 
@@ -174,73 +214,60 @@ namespace EmEn::Vulkan
 			 * ticks ago are no longer referenced by any pending command buffer.
 			 * @return void
 			 */
-			void
-			tick () noexcept
-			{
-				std::vector< Entry > expired;
-
-				{
-					const std::scoped_lock lock{m_mutex};
-
-					++m_currentTick;
-
-					while ( !m_entries.empty() && m_currentTick - m_entries.front().retiredAtTick >= m_delayTicks )
-					{
-						expired.emplace_back(std::move(m_entries.front()));
-
-						m_entries.pop_front();
-					}
-				}
-
-				/* NOTE: Destruction happens outside the lock so that a Vulkan object
-				 * destructor retiring further objects cannot deadlock. */
-				for ( auto & entry : expired )
-				{
-					if ( entry.action != nullptr )
-					{
-						entry.action();
-					}
-				}
-			}
+			void tick () noexcept;
 
 			/**
 			 * @brief Destroys every pending entry immediately.
 			 * @warning The caller must guarantee the device is idle (shutdown, resize).
 			 * @return void
 			 */
-			void
-			flush () noexcept
-			{
-				std::deque< Entry > entries;
-
-				{
-					const std::scoped_lock lock{m_mutex};
-
-					entries.swap(m_entries);
-				}
+			void flush () noexcept;
 
-				for ( auto & entry : entries )
-				{
-					if ( entry.action != nullptr )
-					{
-						entry.action();
-					}
-				}
-			}
+			/**
+			 * @brief Returns the pending counts and bytes.
+			 * @note Thread-safe, the values are a snapshot.
+			 * @return Statistics
+			 */
+			[[nodiscard]]
+			Statistics statistics () const noexcept;
 
 		private:
 
-			/** @brief A retired object or destruction action, stamped with its retirement tick. */
+			/** @brief A retired object or destruction action, linked in the list of its tick slot. */
 			struct Entry
 			{
-				uint64_t retiredAtTick{0};
 				std::shared_ptr< void > object;
 				std::function< void () > action;
+				uint64_t bytes{0};
+				Entry * next{nullptr};
+			};
+
+			/** @brief The list head of a tick slot, alone on its cache line. */
+			struct alignas(64) Slot
+			{
+				std::atomic< Entry * > head{nullptr};
 			};
 
-			std::mutex m_mutex;
-			std::deque< Entry > m_entries;
-			uint64_t m_currentTick{0};
-			uint32_t m_delayTicks{5};
+			/**
+			 * @brief Links an entry in the slot of the current tick.
+			 * @param entry A pointer to the entry, owned by the list from now on.
+			 * @return void
+			 */
+			void push (Entry * entry) noexcept;
+
+			/**
+			 * @brief Destroys a detached list of entries, in their retirement order (FIFO).
+			 * @param entry A pointer to the first entry. Can be null.
+			 * @return uint64_t The number of destroyed entries.
+			 */
+			uint64_t release (Entry * entry) noexcept;
+
+			std::array< Slot, SlotCount > m_slots{};
+			std::atomic< uint64_t > m_currentTick{0};
+			std::atomic< uint64_t > m_pendingCount{0};
+			std::atomic< uint64_t > m_pendingBytes{0};
+			std::atomic< uint64_t > m_retiredCount{0};
+			std::atomic< uint64_t > m_lastTickReleasedCount{0};
+			std::atomic< uint32_t > m_delayTicks{5};
 	};
 }
@@ -178,6 +178,16 @@ namespace EmEn::Vulkan
 			[[nodiscard]]
 			bool writeUniformBufferObjectDynamic (uint32_t bindingIndex, const UniformBufferObject & uniformBufferObject) const noexcept;
 
+			/**
+			 * @brief Writes a dynamic uniform buffer to the descriptor set using pre-computed descriptor info.
+			 * @note Used with Graphics::FrameRingAllocator::descriptorInfo(), the offset is given at bind time.
+			 * @param bindingIndex The binding index inside the descriptor set layout.
+			 * @param descriptorInfo The pre-configured VkDescriptorBufferInfo with buffer, offset, and range.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool writeUniformBufferDynamic (uint32_t bindingIndex, const VkDescriptorBufferInfo & descriptorInfo) const noexcept;
+
 			/**
 			 * @brief Writes a sampled texture to the descriptor set.
 			 * @param bindingIndex The binding index of the texture inside the descriptor set layout.
@@ -368,6 +368,8 @@ namespace EmEn::Vulkan
 			/* [VULKAN-CPU-SYNC] vkDestroyDevice() through waidIdle() */
 			this->waitIdle("Destroying the logical device !");
 
+			this->destroyPipelineCache();
+
 			vkDestroyDevice(m_deviceHandle, nullptr);
 
 			m_deviceHandle = VK_NULL_HANDLE;
@@ -27,9 +27,16 @@
 #pragma once
 
 /* STL inclusions. */
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
 
 /* Third-party forward declarations (the VMA implementation header is only
  * needed by the few .cpp files that call vma* functions — VmaAllocator is
@@ -46,10 +53,18 @@ typedef struct VmaAllocator_T * VmaAllocator;
 #include "Types.hpp"
 
 /* Forward declarations. */
-namespace EmEn::Vulkan
+namespace EmEn
 {
-	class Instance;
-	class DeviceRequirements;
+	namespace Base
+	{
+		class ThreadPool;
+	}
+
+	namespace Vulkan
+	{
+		class Instance;
+		class DeviceRequirements;
+	}
 }
 
 namespace EmEn::Vulkan
@@ -582,6 +597,53 @@ namespace EmEn::Vulkan
 			 */
 			void dumpDeviceLostDiagnostics (const char * context) const noexcept;
 
+			/**
+			 * @brief Creates the device pipeline cache, filled from the file of a previous launch when it matches this device.
+			 * @note The file is rejected if the vendor ID, the device ID, the driver version or the pipeline cache UUID differ.
+			 * @param directory A reference to the pipeline cache directory.
+			 * @return bool
+			 */
+			bool enablePipelineCache (const std::filesystem::path & directory) noexcept;
+
+			/**
+			 * @brief Returns the pipeline cache handle to pass to every pipeline creation.
+			 * @note This returns VK_NULL_HANDLE when the pipeline cache is disabled.
+			 * @return VkPipelineCache
+			 */
+			[[nodiscard]]
+			VkPipelineCache
+			pipelineCacheHandle () const noexcept
+			{
+				return m_pipelineCacheHandle;
+			}
+
+			/**
+			 * @brief Records a pipeline creation for the logs and the next pipeline cache save.
+			 * @param name The pipeline identifier.
+			 * @param duration The time spent in the driver.
+			 * @return void
+			 */
+			void notifyPipelineCreation (const std::string & name, std::chrono::steady_clock::duration duration) noexcept;
+
+			/**
+			 * @brief Writes the pipeline cache to disk if pipelines were created since the last save.
+			 * @note The file is written aside, then renamed over the previous one, so a crash never leaves a truncated cache.
+			 * A background save in progress is waited for first.
+			 * @return bool
+			 */
+			bool savePipelineCache () noexcept;
+
+			/**
+			 * @brief Saves the pipeline cache on the thread pool when the last save is older than PipelineCacheSaveInterval.
+			 * @note Called once per frame by the renderer, the disk write never happens on the calling thread.
+			 * @param threadPool A reference to the thread pool.
+			 * @return void
+			 */
+			void autoSavePipelineCache (Base::ThreadPool & threadPool) noexcept;
+
+			/** @brief Minimum delay between two automatic pipeline cache saves. */
+			static constexpr std::chrono::seconds PipelineCacheSaveInterval{60};
+
 		private:
 
 			/**
@@ -677,6 +739,27 @@ namespace EmEn::Vulkan
 			[[nodiscard]]
 			bool installQueues (const std::map< uint32_t, Base::StaticVector< float, 16 > > & queuePriorityValues, const DeviceQueueConfiguration & configuration) noexcept;
 
+			/**
+			 * @brief Returns the pipeline cache data of the file, or an empty vector if the file does not match this device.
+			 * @param filepath A reference to the pipeline cache file path.
+			 * @return std::vector< uint8_t >
+			 */
+			[[nodiscard]]
+			std::vector< uint8_t > readPipelineCacheFile (const std::filesystem::path & filepath) const noexcept;
+
+			/**
+			 * @brief Retrieves the pipeline cache data from the driver and writes the file.
+			 * @note The caller owns the save slot (m_pipelineCacheSaveRunning).
+			 * @return bool
+			 */
+			bool writePipelineCacheFile () noexcept;
+
+			/**
+			 * @brief Saves and destroys the pipeline cache.
+			 * @return void
+			 */
+			void destroyPipelineCache () noexcept;
+
 			const Instance & m_instance;
 			std::shared_ptr< PhysicalDevice > m_physicalDevice;
 			VkDevice m_deviceHandle{VK_NULL_HANDLE};
@@ -684,13 +767,22 @@ namespace EmEn::Vulkan
 			PFN_vkGetDeviceFaultInfoEXT m_fpGetDeviceFaultInfo{nullptr};
 			PFN_vkGetQueueCheckpointDataNV m_fpGetQueueCheckpointData{nullptr};
 			PFN_vkCmdSetCheckpointNV m_fpCmdSetCheckpoint{nullptr};
+			VkPipelineCache m_pipelineCacheHandle{VK_NULL_HANDLE};
+			std::filesystem::path m_pipelineCacheFilepath;
+			std::chrono::steady_clock::time_point m_pipelineCacheLastSave;
 			Base::StaticVector< std::unique_ptr< Queue >, 32 > m_queues;
 			DeviceQueueConfiguration m_graphicsQueueConfiguration;
 			DeviceQueueConfiguration m_computeQueueConfiguration;
 			DeviceQueueConfiguration m_transferQueueConfiguration;
 			DeviceQueueConfiguration m_videoEncodeQueueConfiguration;
 			mutable std::mutex m_logicalDeviceAccess;
+			/** @brief Guards the last save time and the save slot. */
+			std::mutex m_pipelineCacheAccess;
+			std::condition_variable m_pipelineCacheSaveDone;
 			mutable std::atomic_bool m_deviceLostReported{false};
+			std::atomic< uint32_t > m_pipelinesCreatedSinceSave{0};
+			std::atomic< uint64_t > m_pipelineCreationTimeUS{0};
+			bool m_pipelineCacheSaveRunning{false};
 			bool m_showInformation{false};
 			bool m_basicSupport{false};
 			bool m_videoEncodeH265Enabled{false};
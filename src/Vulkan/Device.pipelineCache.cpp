@@ -0,0 +1,428 @@
+/*
+ * src/Vulkan/Device.pipelineCache.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+
+#include "Device.hpp"
+
+/* STL inclusions. */
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+/* Local inclusions. */
+#include "ThreadPool.hpp"
+#include "Utility.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Vulkan
+{
+	using namespace Base;
+
+	/** @brief Magic number of a pipeline cache file ("EMPC"). */
+	static constexpr uint32_t PipelineCacheFileMagic{0x43504D45};
+
+	/** @brief Version of the pipeline cache file layout. */
+	static constexpr uint32_t PipelineCacheFileVersion{1};
+
+	/** @brief Number of size queries before saving a pipeline cache which keeps growing. */
+	static constexpr uint32_t PipelineCacheDataAttempts{4};
+
+	/**
+	 * @brief The header written before the driver data in a pipeline cache file.
+	 * @note The driver data has its own header, but it misses the driver version, and a mismatching blob must never reach the driver.
+	 */
+	struct PipelineCacheFileHeader
+	{
+		uint32_t magic{PipelineCacheFileMagic};
+		uint32_t version{PipelineCacheFileVersion};
+		uint32_t vendorID{0};
+		uint32_t deviceID{0};
+		uint32_t driverVersion{0};
+		std::array< uint8_t, VK_UUID_SIZE > pipelineCacheUUID{};
+		uint64_t dataSize{0};
+		uint64_t dataHash{0};
+	};
+
+	/**
+	 * @brief Returns the FNV-1a hash of the driver data, to reject a corrupted file.
+	 * @param data A reference to the data.
+	 * @return uint64_t
+	 */
+	static
+	uint64_t
+	hashPipelineCacheData (const std::vector< uint8_t > & data) noexcept
+	{
+		uint64_t hash = 0xCBF29CE484222325ULL;
+
+		for ( const auto byte : data )
+		{
+			hash ^= byte;
+			hash *= 0x100000001B3ULL;
+		}
+
+		return hash;
+	}
+
+	/**
+	 * @brief Returns the pipeline cache file header matching a physical device.
+	 * @param properties A reference to the physical device properties.
+	 * @return PipelineCacheFileHeader
+	 */
+	static
+	PipelineCacheFileHeader
+	pipelineCacheFileHeader (const VkPhysicalDeviceProperties & properties) noexcept
+	{
+		PipelineCacheFileHeader header;
+		header.vendorID = properties.vendorID;
+		header.deviceID = properties.deviceID;
+		header.driverVersion = properties.driverVersion;
+		std::memcpy(header.pipelineCacheUUID.data(), properties.pipelineCacheUUID, VK_UUID_SIZE);
+
+		return header;
+	}
+
+	bool
+	Device::enablePipelineCache (const std::filesystem::path & directory) noexcept
+	{
+		if ( m_deviceHandle == VK_NULL_HANDLE || m_pipelineCacheHandle != VK_NULL_HANDLE )
+		{
+			return false;
+		}
+
+		const auto & properties = m_physicalDevice->propertiesVK10();
+
+		/* NOTE: One file per GPU model, so switching GPUs does not throw away the other cache. */
+		std::stringstream filename;
+		filename << std::hex << properties.vendorID << '-' << properties.deviceID << ".pipelines";
+
+		std::error_code errorCode;
+
+		if ( !std::filesystem::create_directories(directory, errorCode) && errorCode )
+		{
+			TraceWarning{ClassId} << "Unable to create the pipeline cache directory '" << directory << "' : " << errorCode.message() << " !";
+
+			return false;
+		}
+
+		m_pipelineCacheFilepath = directory / filename.str();
+
+		const auto initialData = this->readPipelineCacheFile(m_pipelineCacheFilepath);
+
+		VkPipelineCacheCreateInfo createInfo{};
+		createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+		createInfo.pNext = nullptr;
+		createInfo.flags = 0;
+		createInfo.initialDataSize = initialData.size();
+		createInfo.pInitialData = initialData.empty() ? nullptr : initialData.data();
+
+		if ( const auto result = vkCreatePipelineCache(m_deviceHandle, &createInfo, nullptr, &m_pipelineCacheHandle); result != VK_SUCCESS )
+		{
+			TraceWarning{ClassId} << "Unable to create the pipeline cache : " << vkResultToCString(result) << " ! Pipelines will be compiled from scratch.";
+
+			m_pipelineCacheHandle = VK_NULL_HANDLE;
+
+			return false;
+		}
+
+		m_pipelineCacheLastSave = std::chrono::steady_clock::now();
+
+		if ( initialData.empty() )
+		{
+			TraceInfo{ClassId} << "Empty pipeline cache created, it will be saved to '" << m_pipelineCacheFilepath << "'.";
+		}
+		else
+		{
+			TraceSuccess{ClassId} << "Pipeline cache loaded from '" << m_pipelineCacheFilepath << "' (" << (initialData.size() / 1024) << " KiB).";
+		}
+
+		return true;
+	}
+
+	void
+	Device::notifyPipelineCreation (const std::string & name, std::chrono::steady_clock::duration duration) noexcept
+	{
+		const auto durationUS = std::chrono::duration_cast< std::chrono::microseconds >(duration).count();
+
+		m_pipelinesCreatedSinceSave.fetch_add(1, std::memory_order_relaxed);
+		m_pipelineCreationTimeUS.fetch_add(static_cast< uint64_t >(durationUS), std::memory_order_relaxed);
+
+		TraceDebug{ClassId} << "Pipeline '" << name << "' created in " << (static_cast< double >(durationUS) / 1000.0) << " ms" << (m_pipelineCacheHandle != VK_NULL_HANDLE ? "." : " (no pipeline cache).");
+	}
+
+	bool
+	Device::savePipelineCache () noexcept
+	{
+		if ( m_pipelineCacheHandle == VK_NULL_HANDLE )
+		{
+			return false;
+		}
+
+		{
+			std::unique_lock< std::mutex > lock{m_pipelineCacheAccess};
+
+			m_pipelineCacheSaveDone.wait(lock, [this] {
+				return !m_pipelineCacheSaveRunning;
+			});
+
+			m_pipelineCacheSaveRunning = true;
+			m_pipelineCacheLastSave = std::chrono::steady_clock::now();
+		}
+
+		const auto success = this->writePipelineCacheFile();
+
+		const std::lock_guard< std::mutex > lock{m_pipelineCacheAccess};
+
+		m_pipelineCacheSaveRunning = false;
+
+		m_pipelineCacheSaveDone.notify_all();
+
+		return success;
+	}
+
+	void
+	Device::autoSavePipelineCache (ThreadPool & threadPool) noexcept
+	{
+		if ( m_pipelineCacheHandle == VK_NULL_HANDLE || m_pipelinesCreatedSinceSave.load(std::memory_order_relaxed) == 0 )
+		{
+			return;
+		}
+
+		{
+			const std::lock_guard< std::mutex > lock{m_pipelineCacheAccess};
+
+			if ( m_pipelineCacheSaveRunning || std::chrono::steady_clock::now() - m_pipelineCacheLastSave < PipelineCacheSaveInterval )
+			{
+				return;
+			}
+
+			m_pipelineCacheSaveRunning = true;
+			m_pipelineCacheLastSave = std::chrono::steady_clock::now();
+		}
+
+		/* NOTE: The device destruction saves through savePipelineCache(), which waits for this task. */
+		threadPool.enqueue([this] {
+			static_cast< void >(this->writePipelineCacheFile());
+
+			/* NOTE: Notify under the lock, the device may be destroyed right after. */
+			const std::lock_guard< std::mutex > lock{m_pipelineCacheAccess};
+
+			m_pipelineCacheSaveRunning = false;
+
+			m_pipelineCacheSaveDone.notify_all();
+		});
+	}
+
+	bool
+	Device::writePipelineCacheFile () noexcept
+	{
+		const auto createdPipelines = m_pipelinesCreatedSinceSave.exchange(0, std::memory_order_relaxed);
+		const auto creationTimeUS = m_pipelineCreationTimeUS.exchange(0, std::memory_order_relaxed);
+
+		if ( createdPipelines == 0 )
+		{
+			return true;
+		}
+
+		/* NOTE: vkGetPipelineCacheData() is called twice, once for the size, once for the data.
+		 * Another thread can create a pipeline in between and grow the cache, the copy then returns
+		 * VK_INCOMPLETE with a valid but partial blob, so the size is queried again. */
+		std::vector< uint8_t > data;
+		auto result = VK_INCOMPLETE;
+
+		for ( uint32_t attempt = 0; attempt < PipelineCacheDataAttempts && result == VK_INCOMPLETE; ++attempt )
+		{
+			size_t dataSize = 0;
+
+			result = vkGetPipelineCacheData(m_deviceHandle, m_pipelineCacheHandle, &dataSize, nullptr);
+
+			if ( result != VK_SUCCESS )
+			{
+				TraceError{ClassId} << "Unable to get the pipeline cache size : " << vkResultToCString(result) << " !";
+
+				return false;
+			}
+
+			data.resize(dataSize);
+
+			result = vkGetPipelineCacheData(m_deviceHandle, m_pipelineCacheHandle, &dataSize, data.data());
+
+			data.resize(dataSize);
+		}
+
+		if ( result == VK_INCOMPLETE )
+		{
+			/* NOTE: The partial blob is still usable, the next save will retry the whole cache. */
+			m_pipelinesCreatedSinceSave.fetch_add(createdPipelines, std::memory_order_relaxed);
+
+			TraceWarning{ClassId} << "The pipeline cache kept growing during the save, only a part of it is written.";
+		}
+		else if ( result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to get the pipeline cache data : " << vkResultToCString(result) << " !";
+
+			return false;
+		}
+
+		auto header = pipelineCacheFileHeader(m_physicalDevice->propertiesVK10());
+		header.dataSize = data.size();
+		header.dataHash = hashPipelineCacheData(data);
+
+		/* NOTE: Write aside then rename, a crash during the write leaves the previous file intact. */
+		auto temporaryFilepath = m_pipelineCacheFilepath;
+		temporaryFilepath += ".tmp";
+
+		{
+			std::ofstream file{temporaryFilepath, std::ios::binary | std::ios::trunc};
+
+			if ( !file.is_open() )
+			{
+				TraceError{ClassId} << "Unable to open '" << temporaryFilepath << "' to save the pipeline cache !";
+
+				return false;
+			}
+
+			file.write(reinterpret_cast< const char * >(&header), sizeof(header));
+			file.write(reinterpret_cast< const char * >(data.data()), static_cast< std::streamsize >(data.size()));
+
+			if ( !file.good() )
+			{
+				TraceError{ClassId} << "Unable to write the pipeline cache to '" << temporaryFilepath << "' !";
+
+				return false;
+			}
+		}
+
+		std::error_code errorCode;
+		std::filesystem::rename(temporaryFilepath, m_pipelineCacheFilepath, errorCode);
+
+		if ( errorCode )
+		{
+			TraceError{ClassId} << "Unable to replace the pipeline cache file '" << m_pipelineCacheFilepath << "' : " << errorCode.message() << " !";
+
+			return false;
+		}
+
+		TraceInfo{ClassId} <<
+			"Pipeline cache saved (" << (data.size() / 1024) << " KiB), " << createdPipelines << " pipeline(s) created in " <<
+			(static_cast< double >(creationTimeUS) / 1000.0) << " ms since the last save.";
+
+		return true;
+	}
+
+	std::vector< uint8_t >
+	Device::readPipelineCacheFile (const std::filesystem::path & filepath) const noexcept
+	{
+		std::ifstream file{filepath, std::ios::binary};
+
+		if ( !file.is_open() )
+		{
+			return {};
+		}
+
+		PipelineCacheFileHeader header;
+
+		if ( !file.read(reinterpret_cast< char * >(&header), sizeof(header)) )
+		{
+			TraceWarning{ClassId} << "The pipeline cache file '" << filepath << "' is truncated, ignoring it.";
+
+			return {};
+		}
+
+		const auto expectedHeader = pipelineCacheFileHeader(m_physicalDevice->propertiesVK10());
+
+		if ( header.magic != expectedHeader.magic || header.version != expectedHeader.version )
+		{
+			TraceWarning{ClassId} << "The pipeline cache file '" << filepath << "' has an unknown format, ignoring it.";
+
+			return {};
+		}
+
+		if ( header.vendorID != expectedHeader.vendorID || header.deviceID != expectedHeader.deviceID || header.driverVersion != expectedHeader.driverVersion || header.pipelineCacheUUID != expectedHeader.pipelineCacheUUID )
+		{
+			TraceInfo{ClassId} << "The pipeline cache file '" << filepath << "' was written by another device or driver, starting a new one.";
+
+			return {};
+		}
+
+		/* NOTE: Never trust the stored size before allocating. */
+		std::error_code errorCode;
+		const auto fileSize = std::filesystem::file_size(filepath, errorCode);
+
+		if ( errorCode || fileSize != sizeof(header) + header.dataSize )
+		{
+			TraceWarning{ClassId} << "The pipeline cache file '" << filepath << "' is truncated, ignoring it.";
+
+			return {};
+		}
+
+		std::vector< uint8_t > data(header.dataSize);
+
+		if ( !file.read(reinterpret_cast< char * >(data.data()), static_cast< std::streamsize >(data.size())) || hashPipelineCacheData(data) != header.dataHash )
+		{
+			TraceWarning{ClassId} << "The pipeline cache file '" << filepath << "' is corrupted, ignoring it.";
+
+			return {};
+		}
+
+		/* NOTE: Double-check the driver's own header, the driver may misbehave on a foreign blob. */
+		VkPipelineCacheHeaderVersionOne driverHeader{};
+
+		if ( data.size() < sizeof(driverHeader) )
+		{
+			return {};
+		}
+
+		std::memcpy(&driverHeader, data.data(), sizeof(driverHeader));
+
+		if ( driverHeader.headerVersion != VK_PIPELINE_CACHE_HEADER_VERSION_ONE ||
+			driverHeader.vendorID != expectedHeader.vendorID ||
+			driverHeader.deviceID != expectedHeader.deviceID ||
+			std::memcmp(driverHeader.pipelineCacheUUID, expectedHeader.pipelineCacheUUID.data(), VK_UUID_SIZE) != 0 )
+		{
+			TraceWarning{ClassId} << "The pipeline cache data in '" << filepath << "' does not match this device, ignoring it.";
+
+			return {};
+		}
+
+		return data;
+	}
+
+	void
+	Device::destroyPipelineCache () noexcept
+	{
+		if ( m_pipelineCacheHandle == VK_NULL_HANDLE )
+		{
+			return;
+		}
+
+		static_cast< void >(this->savePipelineCache());
+
+		vkDestroyPipelineCache(m_deviceHandle, m_pipelineCacheHandle, nullptr);
+
+		m_pipelineCacheHandle = VK_NULL_HANDLE;
+	}
+}
@@ -28,6 +28,7 @@
 
 /* STL inclusions. */
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <ranges>
 
@@ -81,6 +82,58 @@ namespace EmEn::Vulkan
 		return true;
 	}
 
+	bool
+	GraphicsPipeline::configureSpecializationConstants (VkShaderStageFlagBits stage, const std::map< uint32_t, uint32_t > & constants) noexcept
+	{
+		if ( constants.empty() )
+		{
+			return true;
+		}
+
+		const auto stageIt = std::ranges::find_if(m_shaderStages, [stage] (const auto & shaderStage) {
+			return shaderStage.stage == stage;
+		});
+
+		if ( stageIt == m_shaderStages.end() )
+		{
+			Tracer::error(ClassId, "There is no shader stage to specialize !");
+
+			return false;
+		}
+
+		if ( stageIt->pSpecializationInfo != nullptr )
+		{
+			Tracer::error(ClassId, "The shader stage is already specialized !");
+
+			return false;
+		}
+
+		/* NOTE: The stage storage never moves once added, the pointers given to Vulkan stay valid. */
+		auto & specialization = m_specializationStages.emplace_back();
+		specialization.mapEntries.reserve(constants.size());
+		specialization.data.reserve(constants.size());
+
+		for ( const auto & [constantId, value] : constants )
+		{
+			specialization.mapEntries.emplace_back(VkSpecializationMapEntry{
+				.constantID = constantId,
+				.offset = static_cast< uint32_t >(specialization.data.size() * sizeof(uint32_t)),
+				.size = sizeof(uint32_t)
+			});
+
+			specialization.data.emplace_back(value);
+		}
+
+		specialization.info.mapEntryCount = static_cast< uint32_t >(specialization.mapEntries.size());
+		specialization.info.pMapEntries = specialization.mapEntries.data();
+		specialization.info.dataSize = specialization.data.size() * sizeof(uint32_t);
+		specialization.info.pData = specialization.data.data();
+
+		stageIt->pSpecializationInfo = &specialization.info;
+
+		return true;
+	}
+
 	bool
 	GraphicsPipeline::configureVertexInputState (const VertexBufferFormat & vertexBufferFormat, VkPipelineVertexInputStateCreateFlags flags) noexcept
 	{
@@ -1031,13 +1084,17 @@ namespace EmEn::Vulkan
 	bool
 	GraphicsPipeline::createOnHardware () noexcept
 	{
-		if ( const auto result = vkCreateGraphicsPipelines(this->device()->handle(), VK_NULL_HANDLE, 1, &m_createInfo, nullptr, &m_handle); result != VK_SUCCESS )
+		const auto start = std::chrono::steady_clock::now();
+
+		if ( const auto result = vkCreateGraphicsPipelines(this->device()->handle(), this->device()->pipelineCacheHandle(), 1, &m_createInfo, nullptr, &m_handle); result != VK_SUCCESS )
 		{
 			TraceError{ClassId} << "Unable to create a graphics pipeline : " << vkResultToCString(result) << " !";
 
 			return false;
 		}
 
+		this->device()->notifyPipelineCreation(this->identifier(), std::chrono::steady_clock::now() - start);
+
 		this->setVulkanObjectName(this->device()->handle(), VK_OBJECT_TYPE_PIPELINE, reinterpret_cast< uint64_t >(m_handle));
 
 		this->setCreated();
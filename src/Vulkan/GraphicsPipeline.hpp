@@ -29,7 +29,9 @@
 /* STL inclusions. */
 #include <cstddef>
 #include <cstdint>
+#include <map>
 #include <memory>
+#include <vector>
 
 /* Local inclusions for inheritances. */
 #include "AbstractDeviceDependentObject.hpp"
@@ -167,6 +169,18 @@ namespace EmEn::Vulkan
 			[[nodiscard]]
 			bool configureShaderStages (const Base::StaticVector< std::shared_ptr< ShaderModule >, 5 > & shaderModules) noexcept;
 
+			/**
+			 * @brief Configures the specialization constants of a shader stage.
+			 * @note The constant values are owned by the pipeline, the shader modules stay shared between pipelines.
+			 * Every constant is a 32-bit scalar (bool as VkBool32, int or uint).
+			 * This must be called after GraphicsPipeline::configureShaderStages().
+			 * @param stage The shader stage receiving the constants.
+			 * @param constants A reference to a map of constant ID and value.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool configureSpecializationConstants (VkShaderStageFlagBits stage, const std::map< uint32_t, uint32_t > & constants) noexcept;
+
 			/**
 			 * @brief Generates vertex input state into the graphics pipeline createInfo.
 			 * @param vertexBufferFormat A reference to a vertex buffer format.
@@ -409,9 +423,18 @@ namespace EmEn::Vulkan
 			 */
 			void defaultColorBlendState () noexcept;
 
+			/** @brief The specialization constants owned by the pipeline for one shader stage. */
+			struct SpecializationStage
+			{
+				std::vector< VkSpecializationMapEntry > mapEntries;
+				std::vector< uint32_t > data;
+				VkSpecializationInfo info{};
+			};
+
 			VkPipeline m_handle{VK_NULL_HANDLE};
 			VkGraphicsPipelineCreateInfo m_createInfo{};
 			Base::StaticVector< VkPipelineShaderStageCreateInfo, 5 > m_shaderStages;
+			Base::StaticVector< SpecializationStage, 5 > m_specializationStages;
 			VkPipelineVertexInputStateCreateInfo m_vertexInputState{};
 			VkPipelineInputAssemblyStateCreateInfo m_inputAssemblyState{};
 			VkPipelineTessellationStateCreateInfo m_tessellationState{};
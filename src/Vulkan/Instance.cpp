@@ -46,6 +46,7 @@
 #include "Arguments.hpp"
 #include "Device.hpp"
 #include "DeviceRequirements.hpp"
+#include "FileSystem.hpp"
 #include "Identification.hpp"
 #include "PhysicalDevice.hpp"
 #include "PortabilitySubset.hpp"
@@ -872,6 +873,7 @@ namespace EmEn::Vulkan
 			requirements.featuresVK12().shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
 		}
 		requirements.featuresVK12().bufferDeviceAddress = VK_TRUE; // Required for buffer device addresses (VBO/IBO for RT, etc.)
+		requirements.featuresVK12().timelineSemaphore = VK_TRUE; // Required for the batched transfers completion (TransferManager)
 		/* Multi-Draw Indirect features - Required for GPU-driven rendering (MDI). */
 		requirements.featuresVK10().multiDrawIndirect = VK_TRUE; // Required for vkCmdDrawIndexedIndirect with drawCount > 1
 		requirements.featuresVK10().drawIndirectFirstInstance = VK_TRUE; // Required for firstInstance in indirect commands
@@ -1085,6 +1087,13 @@ namespace EmEn::Vulkan
 			return {};
 		}
 
+		/* NOTE: Reuse the pipelines compiled by the previous launches on this device and driver.
+		 * Only the graphics device owns the file, a compute device on the same GPU would race on it. */
+		if ( settings.getOrSetDefault< bool >(VkDeviceEnablePipelineCacheKey, DefaultVkDeviceEnablePipelineCache) )
+		{
+			static_cast< void >(logicalDevice->enablePipelineCache(m_primaryServices.fileSystem().cacheDirectory(PipelineCacheDirectoryName)));
+		}
+
 		m_graphicsDevice = logicalDevice;
 
 		/* NOTE: Basic GPU do not support flexible textures. */
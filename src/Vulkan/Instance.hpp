@@ -74,6 +74,9 @@ namespace EmEn::Vulkan
 			/** @brief Class identifier. */
 			static constexpr auto ClassId{"VulkanInstanceService"};
 
+			/** @brief Pipeline cache directory name, inside the application cache directory. */
+			static constexpr auto PipelineCacheDirectoryName{"pipeline-cache"};
+
 			/**
 			 * @brief Constructs a Vulkan instance.
 			 * @param identification A reference to the application identification.
@@ -36,6 +36,46 @@ namespace EmEn::Vulkan
 {
 	using namespace Base;
 
+	namespace
+	{
+		[[nodiscard]]
+		bool
+		usesTimelineValues (const SynchInfo & synchInfo) noexcept
+		{
+			return !synchInfo.waitTimelineValues.empty() || !synchInfo.signalTimelineValues.empty();
+		}
+
+		[[nodiscard]]
+		bool
+		timelineValuesMatch (const SynchInfo & synchInfo) noexcept
+		{
+			if ( !usesTimelineValues(synchInfo) )
+			{
+				return true;
+			}
+
+			/* NOTE: An empty list is allowed when only one side of the submission uses timeline semaphores. */
+			const auto waitsMatch = synchInfo.waitTimelineValues.empty() || synchInfo.waitTimelineValues.size() == synchInfo.waitSemaphores.size();
+			const auto signalsMatch = synchInfo.signalTimelineValues.empty() || synchInfo.signalTimelineValues.size() == synchInfo.signalSemaphores.size();
+
+			return waitsMatch && signalsMatch;
+		}
+
+		[[nodiscard]]
+		VkTimelineSemaphoreSubmitInfo
+		timelineSubmitInfoFrom (const SynchInfo & synchInfo) noexcept
+		{
+			return {
+				.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO,
+				.pNext = nullptr,
+				.waitSemaphoreValueCount = static_cast< uint32_t >(synchInfo.waitTimelineValues.size()),
+				.pWaitSemaphoreValues = synchInfo.waitTimelineValues.data(),
+				.signalSemaphoreValueCount = static_cast< uint32_t >(synchInfo.signalTimelineValues.size()),
+				.pSignalSemaphoreValues = synchInfo.signalTimelineValues.data()
+			};
+		}
+	}
+
 	bool
 	Queue::submit (const CommandBuffer & commandBuffer) const noexcept
 	{
@@ -82,12 +122,21 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
+		if ( !timelineValuesMatch(synchInfo) )
+		{
+			Tracer::error(ClassId, "Timeline value counts must equal semaphore counts!");
+
+			return false;
+		}
+
+		const auto timelineSubmitInfo = timelineSubmitInfoFrom(synchInfo);
+
 		VkCommandBuffer commandBufferHandle = commandBuffer.handle();
 
 		const VkSubmitInfo submitInfo
 		{
 			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-			.pNext = nullptr,
+			.pNext = usesTimelineValues(synchInfo) ? &timelineSubmitInfo : nullptr,
 			.waitSemaphoreCount = static_cast< uint32_t >(synchInfo.waitSemaphores.size()),
 			.pWaitSemaphores = synchInfo.waitSemaphores.data(),
 			.pWaitDstStageMask = synchInfo.waitStages.data(),
@@ -125,10 +174,19 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
+		if ( !timelineValuesMatch(synchInfo) )
+		{
+			Tracer::error(ClassId, "Timeline value counts must equal semaphore counts!");
+
+			return false;
+		}
+
+		const auto timelineSubmitInfo = timelineSubmitInfoFrom(synchInfo);
+
 		const VkSubmitInfo submitInfo
 		{
 			.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO,
-			.pNext = nullptr,
+			.pNext = usesTimelineValues(synchInfo) ? &timelineSubmitInfo : nullptr,
 			.waitSemaphoreCount = static_cast< uint32_t >(synchInfo.waitSemaphores.size()),
 			.pWaitSemaphores = synchInfo.waitSemaphores.data(),
 			.pWaitDstStageMask = synchInfo.waitStages.data(),
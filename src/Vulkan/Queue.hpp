@@ -79,6 +79,22 @@ namespace EmEn::Vulkan
 			return *this;
 		}
 
+		/**
+		 * @brief Adds the values of timeline semaphores.
+		 * @note The lists follow the wait and signal semaphore lists, a binary semaphore entry is ignored.
+		 * @param waitValues A list of values to wait for.
+		 * @param signalValues A list of values to signal.
+		 * @return SynchInfo &
+		 */
+		SynchInfo &
+		timelineValues (std::span< const uint64_t > waitValues, std::span< const uint64_t > signalValues)
+		{
+			waitTimelineValues = waitValues;
+			signalTimelineValues = signalValues;
+
+			return *this;
+		}
+
 		/**
 		 * @brief Adds a fence to signal.
 		 * @param fenceHandle A fence handle.
@@ -95,6 +111,8 @@ namespace EmEn::Vulkan
 		std::span< const VkSemaphore > waitSemaphores;
 		std::span< const VkPipelineStageFlags > waitStages;
 		std::span< const VkSemaphore > signalSemaphores;
+		std::span< const uint64_t > waitTimelineValues;
+		std::span< const uint64_t > signalTimelineValues;
 		VkFence fence{VK_NULL_HANDLE};
 	};
 
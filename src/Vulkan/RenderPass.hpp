@@ -27,7 +27,9 @@
 #pragma once
 
 /* STL inclusions. */
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 
 /* Local inclusions for inheritances. */
 #include "AbstractDeviceDependentObject.hpp"
@@ -216,6 +218,108 @@ namespace EmEn::Vulkan
 				return static_cast< uint32_t >(m_renderSubPasses[subPassIndex].m_colorAttachments.size());
 			}
 
+			/**
+			 * @brief Visits every input deciding the compatibility of this render pass.
+			 * Two render passes giving the same inputs are compatible, a pipeline created with one can be used with the other.
+			 * @note Following the Vulkan compatibility rules, attachment references give the format and the sample count
+			 * of the referenced attachment, and the image layouts and the load/store operations are left out.
+			 * A render pass built from a raw createInfo has no description, its handle is visited instead.
+			 * @tparam function_t The type of the visitor. Signature: void (uint64_t)
+			 * @param visitor The function receiving the inputs.
+			 * @return void
+			 */
+			template< typename function_t >
+			void
+			visitCompatibilityInputs (function_t && visitor) const noexcept requires (std::is_invocable_v< function_t, uint64_t >)
+			{
+				if ( m_attachmentDescriptions.empty() && m_renderSubPasses.empty() )
+				{
+					visitor(static_cast< uint64_t >(reinterpret_cast< uintptr_t >(m_handle)));
+
+					return;
+				}
+
+				const auto visitReference = [this, &visitor] (const VkAttachmentReference & reference) {
+					if ( reference.attachment >= m_attachmentDescriptions.size() )
+					{
+						visitor(static_cast< uint64_t >(VK_ATTACHMENT_UNUSED));
+
+						return;
+					}
+
+					const auto & description = m_attachmentDescriptions[reference.attachment];
+
+					visitor(static_cast< uint64_t >(description.format));
+					visitor(static_cast< uint64_t >(description.samples));
+				};
+
+				visitor(m_createInfo.flags);
+				visitor(m_attachmentDescriptions.size());
+
+				for ( const auto & description : m_attachmentDescriptions )
+				{
+					visitor(description.flags);
+					visitor(static_cast< uint64_t >(description.format));
+					visitor(static_cast< uint64_t >(description.samples));
+				}
+
+				visitor(m_renderSubPasses.size());
+
+				for ( const auto & subPass : m_renderSubPasses )
+				{
+					visitor(subPass.m_flags);
+					visitor(static_cast< uint64_t >(subPass.m_pipelineBindPoint));
+
+					for ( const auto * references : {&subPass.m_inputAttachments, &subPass.m_colorAttachments, &subPass.m_resolveAttachments} )
+					{
+						visitor(references->size());
+
+						for ( const auto & reference : *references )
+						{
+							visitReference(reference);
+						}
+					}
+
+					visitor(subPass.m_depthStencilAttachmentSet);
+
+					if ( subPass.m_depthStencilAttachmentSet )
+					{
+						visitReference(subPass.m_depthStencilAttachment);
+					}
+
+					visitor(subPass.m_depthStencilResolveSet);
+
+					if ( subPass.m_depthStencilResolveSet )
+					{
+						visitReference(subPass.m_depthStencilResolveAttachment);
+						visitor(static_cast< uint64_t >(subPass.m_depthResolveMode));
+						visitor(static_cast< uint64_t >(subPass.m_stencilResolveMode));
+					}
+
+					visitor(subPass.m_preserveAttachments.size());
+
+					for ( const auto index : subPass.m_preserveAttachments )
+					{
+						visitor(index);
+					}
+				}
+
+				visitor(m_subPassDependencies.size());
+
+				for ( const auto & dependency : m_subPassDependencies )
+				{
+					visitor(dependency.srcSubpass);
+					visitor(dependency.dstSubpass);
+					visitor(dependency.srcStageMask);
+					visitor(dependency.dstStageMask);
+					visitor(dependency.srcAccessMask);
+					visitor(dependency.dstAccessMask);
+					visitor(dependency.dependencyFlags);
+				}
+
+				visitor(m_multiviewEnabled ? m_viewMask : 0U);
+			}
+
 		private:
 
 			/**
@@ -29,6 +29,7 @@
 /* STL inclusions. */
 #include <cstdint>
 #include <memory>
+#include <utility>
 #include <vector>
 
 /* Local inclusions for inheritances. */
@@ -54,13 +55,13 @@ namespace EmEn::Vulkan
 			 * @brief Constructs a shader module.
 			 * @param device A reference to a device smart pointer.
 			 * @param shaderType The vulkan shader type.
-			 * @param binaryCode A reference to a binary data vector.
+			 * @param binaryCode A binary data vector, moved into the shader module.
 			 * @param createFlags The createInfo flags. Default none.
 			 */
-			ShaderModule (const std::shared_ptr< Device > & device, VkShaderStageFlagBits shaderType, const std::vector< uint32_t > & binaryCode, VkShaderModuleCreateFlags createFlags = 0) noexcept
+			ShaderModule (const std::shared_ptr< Device > & device, VkShaderStageFlagBits shaderType, std::vector< uint32_t > binaryCode, VkShaderModuleCreateFlags createFlags = 0) noexcept
 				: AbstractDeviceDependentObject{device},
 				m_shaderType{shaderType},
-				m_binaryCode{binaryCode}
+				m_binaryCode{std::move(binaryCode)}
 			{
 				m_createInfo.sType = VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO;
 				m_createInfo.pNext = nullptr;
@@ -0,0 +1,743 @@
+/*
+ * src/Vulkan/StagingRing.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "StagingRing.hpp"
+
+/* STL inclusions. */
+#include <cstring>
+#include <vector>
+
+/* Local inclusions. */
+#include "Buffer.hpp"
+#include "CommandBuffer.hpp"
+#include "CommandPool.hpp"
+#include "Device.hpp"
+#include "Queue.hpp"
+#include "Sync/MemoryBarrier.hpp"
+#include "Sync/TimelineSemaphore.hpp"
+#include "Tracer.hpp"
+
+namespace EmEn::Vulkan
+{
+	using namespace Base;
+
+	namespace
+	{
+		/** @brief Every way the graphics family reads an uploaded buffer. */
+		constexpr VkAccessFlags UploadReadAccess{
+			VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT |
+			VK_ACCESS_INDEX_READ_BIT |
+			VK_ACCESS_INDIRECT_COMMAND_READ_BIT |
+			VK_ACCESS_UNIFORM_READ_BIT |
+			VK_ACCESS_SHADER_READ_BIT |
+			VK_ACCESS_TRANSFER_READ_BIT
+		};
+	}
+
+	StagingRing::StagingRing (const std::shared_ptr< Device > & device, VkDeviceSize capacity) noexcept
+		: m_device{device},
+		m_capacity{(capacity + Alignment - 1) & ~(Alignment - 1)}
+	{
+
+	}
+
+	StagingRing::~StagingRing ()
+	{
+		if ( m_timeline != nullptr )
+		{
+			/* NOTE: Both timelines only move forward, waiting their last values is enough here. */
+			if ( m_copyTimeline != nullptr )
+			{
+				m_copyTimeline->wait(m_lastCopyValue.load());
+			}
+
+			m_timeline->wait(m_lastSignaledValue.load());
+
+			const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+			m_copyingBatches.clear();
+			m_submittedBatches.clear();
+			m_freeCommandBuffers.clear();
+			m_freeTransferCommandBuffers.clear();
+		}
+
+		if ( m_mappedData != nullptr )
+		{
+			m_buffer->unmapMemory();
+
+			m_mappedData = nullptr;
+		}
+	}
+
+	bool
+	StagingRing::createOnHardware () noexcept
+	{
+		if ( m_device == nullptr || !m_device->isCreated() )
+		{
+			Tracer::error(ClassId, "No valid device to create the staging ring !");
+
+			return false;
+		}
+
+		m_buffer = std::make_unique< Buffer >(m_device, 0, m_capacity, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, true);
+		m_buffer->setIdentifier(ClassId, "Ring", "Buffer");
+
+		if ( !m_buffer->createOnHardware() )
+		{
+			TraceError{ClassId} << "Unable to create the staging ring buffer (" << m_capacity << " bytes) !";
+
+			m_buffer.reset();
+
+			return false;
+		}
+
+		m_commandPool = std::make_shared< CommandPool >(m_device, m_device->getGraphicsFamilyIndex(), true, true, false);
+		m_commandPool->setIdentifier(ClassId, "Batch", "CommandPool");
+
+		if ( !m_commandPool->createOnHardware() )
+		{
+			Tracer::error(ClassId, "Unable to create the batch command pool !");
+
+			m_commandPool.reset();
+			m_buffer.reset();
+
+			return false;
+		}
+
+		m_timeline = std::make_unique< Sync::TimelineSemaphore >(m_device);
+		m_timeline->setIdentifier(ClassId, "Batch", "TimelineSemaphore");
+
+		if ( !m_timeline->createOnHardware() )
+		{
+			Tracer::error(ClassId, "Unable to create the batch timeline semaphore !");
+
+			m_timeline.reset();
+			m_commandPool.reset();
+			m_buffer.reset();
+
+			return false;
+		}
+
+		/* NOTE: A dedicated transfer family runs the copies on its own queue. A single queue is kept
+		 * for the whole lifetime, the copy timeline values must be signaled in submission order. */
+		if ( m_device->getGraphicsTransferFamilyIndex() != m_device->getGraphicsFamilyIndex() )
+		{
+			m_transferCommandPool = std::make_shared< CommandPool >(m_device, m_device->getGraphicsTransferFamilyIndex(), true, true, false);
+			m_transferCommandPool->setIdentifier(ClassId, "Transfer", "CommandPool");
+
+			m_copyTimeline = std::make_unique< Sync::TimelineSemaphore >(m_device);
+			m_copyTimeline->setIdentifier(ClassId, "Copy", "TimelineSemaphore");
+
+			if ( m_transferCommandPool->createOnHardware() && m_copyTimeline->createOnHardware() )
+			{
+				m_transferQueue = m_device->getGraphicsTransferQueue(QueuePriority::High);
+			}
+
+			if ( m_transferQueue == nullptr )
+			{
+				Tracer::warning(ClassId, "Unable to set up the dedicated transfer queue, the copies will run on the rendering queue.");
+
+				m_copyTimeline.reset();
+				m_transferCommandPool.reset();
+			}
+		}
+
+		/* NOTE: The ring stays mapped for its whole lifetime. */
+		m_mappedData = m_buffer->mapMemoryAs< std::byte >();
+
+		if ( m_mappedData == nullptr )
+		{
+			Tracer::error(ClassId, "Unable to map the staging ring buffer !");
+
+			m_transferQueue = nullptr;
+			m_copyTimeline.reset();
+			m_transferCommandPool.reset();
+			m_timeline.reset();
+			m_commandPool.reset();
+			m_buffer.reset();
+
+			return false;
+		}
+
+		return true;
+	}
+
+	std::optional< uint64_t >
+	StagingRing::reserve (VkDeviceSize bytes) noexcept
+	{
+		if ( bytes > m_capacity )
+		{
+			return std::nullopt;
+		}
+
+		auto position = m_head.load(std::memory_order_relaxed);
+
+		while ( true )
+		{
+			auto start = position;
+
+			if ( const auto offset = start % m_capacity; offset + bytes > m_capacity )
+			{
+				start += m_capacity - offset;
+			}
+
+			const auto end = start + bytes;
+
+			if ( end - m_tail.load(std::memory_order_acquire) > m_capacity )
+			{
+				return std::nullopt;
+			}
+
+			if ( m_head.compare_exchange_weak(position, end, std::memory_order_acq_rel, std::memory_order_relaxed) )
+			{
+				return start;
+			}
+		}
+	}
+
+	bool
+	StagingRing::queueUpload (const Buffer & targetBuffer, const MemoryRegion & memoryRegion, uint64_t & ticket) noexcept
+	{
+		ticket = 0;
+
+		if ( m_mappedData == nullptr )
+		{
+			return false;
+		}
+
+		if ( memoryRegion.bytes() == 0 )
+		{
+			return true;
+		}
+
+		const auto bytes = (static_cast< VkDeviceSize >(memoryRegion.bytes()) + Alignment - 1) & ~(Alignment - 1);
+
+		/* NOTE: The writer counter is raised before the reservation, submit() uses it to know
+		 * whether every range under the head is already queued. */
+		m_activeWriters.fetch_add(1);
+
+		auto position = this->reserve(bytes);
+
+		if ( !position )
+		{
+			m_activeWriters.fetch_sub(1);
+
+			{
+				const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+				this->reclaimCompletedBatches();
+			}
+
+			m_activeWriters.fetch_add(1);
+
+			position = this->reserve(bytes);
+
+			if ( !position )
+			{
+				m_activeWriters.fetch_sub(1);
+
+				return false;
+			}
+		}
+
+		const auto offset = *position % m_capacity;
+
+		std::memcpy(m_mappedData + offset, memoryRegion.source(), memoryRegion.bytes());
+
+		m_buffer->flushMemory(offset, memoryRegion.bytes());
+
+		{
+			const std::lock_guard< std::mutex > lock{m_pendingAccess};
+
+			m_pendingCopies.emplace_back(PendingCopy{
+				.dstBuffer = targetBuffer.handle(),
+				.srcOffset = offset,
+				.dstOffset = static_cast< VkDeviceSize >(memoryRegion.offset()),
+				.size = static_cast< VkDeviceSize >(memoryRegion.bytes())
+			});
+
+			ticket = m_nextSerial;
+		}
+
+		m_activeWriters.fetch_sub(1);
+
+		return true;
+	}
+
+	std::unique_ptr< CommandBuffer >
+	StagingRing::acquireCommandBuffer (std::vector< std::unique_ptr< CommandBuffer > > & freeCommandBuffers, const std::shared_ptr< CommandPool > & commandPool) noexcept
+	{
+		if ( freeCommandBuffers.empty() )
+		{
+			auto commandBuffer = std::make_unique< CommandBuffer >(commandPool, true);
+			commandBuffer->setIdentifier(ClassId, "Batch", "CommandBuffer");
+
+			return commandBuffer;
+		}
+
+		auto commandBuffer = std::move(freeCommandBuffers.back());
+
+		freeCommandBuffers.pop_back();
+
+		return commandBuffer;
+	}
+
+	bool
+	StagingRing::submit (const Queue & queue) noexcept
+	{
+		if ( m_mappedData == nullptr )
+		{
+			return false;
+		}
+
+		const std::lock_guard< std::mutex > batchLock{m_batchAccess};
+
+		this->reclaimCompletedBatches();
+
+		if ( this->usesDedicatedQueue() && !this->acquireCopiedBatches(queue) )
+		{
+			return false;
+		}
+
+		/* NOTE: With no writer in flight, every range under the head is in the queued list
+		 * (or in a previous batch), so this batch may release the ring up to the head. Otherwise,
+		 * an unfinished range may lie under the head and the reclaim position stays where it was. */
+		const auto head = m_head.load();
+
+		if ( m_activeWriters.load() == 0 )
+		{
+			m_reclaimPosition = head;
+		}
+
+		SubmittedBatch batch;
+
+		{
+			const std::lock_guard< std::mutex > lock{m_pendingAccess};
+
+			if ( m_pendingCopies.empty() )
+			{
+				/* NOTE: Nothing queued and nothing running, the ring space can be released right away. */
+				if ( m_copyingBatches.empty() && m_submittedBatches.empty() )
+				{
+					m_tail.store(m_reclaimPosition, std::memory_order_release);
+				}
+
+				return true;
+			}
+
+			batch.copies.swap(m_pendingCopies);
+			batch.serial = m_nextSerial++;
+		}
+
+		batch.reclaimPosition = m_reclaimPosition;
+
+		if ( !this->submitCopies(queue, batch) )
+		{
+			TraceError{ClassId} << "Unable to submit a batch of " << batch.copies.size() << " buffer copies !";
+
+			/* NOTE: The copies go back in the queue for the next batch, the tickets still resolve
+			 * since the serial of that batch is greater. */
+			const std::lock_guard< std::mutex > lock{m_pendingAccess};
+
+			m_pendingCopies.insert(m_pendingCopies.begin(), batch.copies.begin(), batch.copies.end());
+
+			return false;
+		}
+
+		m_submittedCopyCount.fetch_add(batch.copies.size(), std::memory_order_relaxed);
+
+		if ( this->usesDedicatedQueue() )
+		{
+			m_copyingBatches.emplace_back(std::move(batch));
+		}
+		else
+		{
+			batch.copies.clear();
+
+			m_submittedBatches.emplace_back(std::move(batch));
+		}
+
+		return true;
+	}
+
+	bool
+	StagingRing::submitCopies (const Queue & queue, SubmittedBatch & batch) noexcept
+	{
+		const auto dedicated = this->usesDedicatedQueue();
+
+		auto commandBuffer = dedicated ?
+			acquireCommandBuffer(m_freeTransferCommandBuffers, m_transferCommandPool) :
+			acquireCommandBuffer(m_freeCommandBuffers, m_commandPool);
+
+		auto & freeCommandBuffers = dedicated ? m_freeTransferCommandBuffers : m_freeCommandBuffers;
+
+		if ( !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
+		{
+			freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+			return false;
+		}
+
+		for ( const auto & copy : batch.copies )
+		{
+			const VkBufferCopy region{
+				.srcOffset = copy.srcOffset,
+				.dstOffset = copy.dstOffset,
+				.size = copy.size
+			};
+
+			vkCmdCopyBuffer(commandBuffer->handle(), m_buffer->handle(), copy.dstBuffer, 1, &region);
+		}
+
+		if ( dedicated )
+		{
+			/* NOTE: Release half of the ownership transfer, mirrored by acquireCopiedBatches(). */
+			std::vector< VkBufferMemoryBarrier > releaseBarriers;
+			releaseBarriers.reserve(batch.copies.size());
+
+			for ( const auto & copy : batch.copies )
+			{
+				releaseBarriers.emplace_back(VkBufferMemoryBarrier{
+					.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+					.pNext = nullptr,
+					.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT,
+					.dstAccessMask = 0,
+					.srcQueueFamilyIndex = m_device->getGraphicsTransferFamilyIndex(),
+					.dstQueueFamilyIndex = m_device->getGraphicsFamilyIndex(),
+					.buffer = copy.dstBuffer,
+					.offset = copy.dstOffset,
+					.size = copy.size
+				});
+			}
+
+			vkCmdPipelineBarrier(
+				commandBuffer->handle(),
+				VK_PIPELINE_STAGE_TRANSFER_BIT,
+				VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT,
+				0,
+				0, nullptr,
+				static_cast< uint32_t >(releaseBarriers.size()), releaseBarriers.data(),
+				0, nullptr
+			);
+		}
+		else
+		{
+			/* NOTE: One barrier for the whole batch, every later submission on the queue sees the copies. */
+			commandBuffer->pipelineBarrier(Sync::MemoryBarrier{VK_ACCESS_TRANSFER_WRITE_BIT, UploadReadAccess}, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+		}
+
+		if ( !commandBuffer->end() )
+		{
+			freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+			return false;
+		}
+
+		if ( dedicated )
+		{
+			const auto copyValue = m_lastCopyValue.load(std::memory_order_relaxed) + 1;
+			const auto copyTimelineHandle = m_copyTimeline->handle();
+
+			if ( !m_transferQueue->submit(*commandBuffer, SynchInfo{}
+				.signals({&copyTimelineHandle, 1})
+				.timelineValues({}, {&copyValue, 1})
+			) )
+			{
+				commandBuffer->reset();
+
+				freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+				return false;
+			}
+
+			m_lastCopyValue.store(copyValue, std::memory_order_release);
+
+			batch.copyValue = copyValue;
+			batch.transferCommandBuffer = std::move(commandBuffer);
+
+			return true;
+		}
+
+		const auto timelineValue = m_lastSignaledValue.load(std::memory_order_relaxed) + 1;
+		const auto timelineHandle = m_timeline->handle();
+
+		if ( !queue.submit(*commandBuffer, SynchInfo{}
+			.signals({&timelineHandle, 1})
+			.timelineValues({}, {&timelineValue, 1})
+		) )
+		{
+			commandBuffer->reset();
+
+			freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+			return false;
+		}
+
+		m_lastSignaledValue.store(timelineValue, std::memory_order_release);
+		m_readySerial.store(batch.serial, std::memory_order_release);
+
+		batch.timelineValue = timelineValue;
+		batch.commandBuffer = std::move(commandBuffer);
+
+		return true;
+	}
+
+	bool
+	StagingRing::acquireCopiedBatches (const Queue & queue) noexcept
+	{
+		if ( m_copyingBatches.empty() )
+		{
+			return true;
+		}
+
+		/* NOTE: Only the batches already copied are acquired, the rendering queue never waits for the transfer queue. */
+		const auto copiedValue = m_copyTimeline->counterValue();
+
+		while ( !m_copyingBatches.empty() && m_copyingBatches.front().copyValue <= copiedValue )
+		{
+			auto & batch = m_copyingBatches.front();
+
+			auto commandBuffer = acquireCommandBuffer(m_freeCommandBuffers, m_commandPool);
+
+			if ( !commandBuffer->begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT) )
+			{
+				m_freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+				return false;
+			}
+
+			std::vector< VkBufferMemoryBarrier > acquireBarriers;
+			acquireBarriers.reserve(batch.copies.size());
+
+			for ( const auto & copy : batch.copies )
+			{
+				acquireBarriers.emplace_back(VkBufferMemoryBarrier{
+					.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER,
+					.pNext = nullptr,
+					.srcAccessMask = 0,
+					.dstAccessMask = UploadReadAccess,
+					.srcQueueFamilyIndex = m_device->getGraphicsTransferFamilyIndex(),
+					.dstQueueFamilyIndex = m_device->getGraphicsFamilyIndex(),
+					.buffer = copy.dstBuffer,
+					.offset = copy.dstOffset,
+					.size = copy.size
+				});
+			}
+
+			vkCmdPipelineBarrier(
+				commandBuffer->handle(),
+				VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+				VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
+				0,
+				0, nullptr,
+				static_cast< uint32_t >(acquireBarriers.size()), acquireBarriers.data(),
+				0, nullptr
+			);
+
+			if ( !commandBuffer->end() )
+			{
+				m_freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+				return false;
+			}
+
+			/* NOTE: The copy value is already reached, the wait only carries the memory dependency. */
+			const auto copyTimelineHandle = m_copyTimeline->handle();
+			const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+			const auto timelineHandle = m_timeline->handle();
+			const auto timelineValue = m_lastSignaledValue.load(std::memory_order_relaxed) + 1;
+
+			if ( !queue.submit(*commandBuffer, SynchInfo{}
+				.waits({&copyTimelineHandle, 1}, {&waitStage, 1})
+				.signals({&timelineHandle, 1})
+				.timelineValues({&batch.copyValue, 1}, {&timelineValue, 1})
+			) )
+			{
+				Tracer::error(ClassId, "Unable to acquire the buffers of a copied batch !");
+
+				commandBuffer->reset();
+
+				m_freeCommandBuffers.emplace_back(std::move(commandBuffer));
+
+				return false;
+			}
+
+			m_lastSignaledValue.store(timelineValue, std::memory_order_release);
+			m_readySerial.store(batch.serial, std::memory_order_release);
+
+			batch.timelineValue = timelineValue;
+			batch.commandBuffer = std::move(commandBuffer);
+			batch.copies.clear();
+
+			m_submittedBatches.emplace_back(std::move(batch));
+			m_copyingBatches.pop_front();
+		}
+
+		return true;
+	}
+
+	bool
+	StagingRing::wait (const Queue & queue) noexcept
+	{
+		if ( m_timeline == nullptr )
+		{
+			return false;
+		}
+
+		if ( this->usesDedicatedQueue() )
+		{
+			if ( const auto copyValue = m_lastCopyValue.load(std::memory_order_acquire); copyValue > 0 && !m_copyTimeline->wait(copyValue) )
+			{
+				return false;
+			}
+
+			const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+			if ( !this->acquireCopiedBatches(queue) )
+			{
+				return false;
+			}
+		}
+
+		const auto timelineValue = m_lastSignaledValue.load(std::memory_order_acquire);
+
+		if ( timelineValue == 0 )
+		{
+			return true;
+		}
+
+		if ( !m_timeline->wait(timelineValue) )
+		{
+			return false;
+		}
+
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+		this->reclaimCompletedBatches();
+
+		return true;
+	}
+
+	void
+	StagingRing::releaseBuffer (VkBuffer bufferHandle, uint64_t ticket) noexcept
+	{
+		if ( m_mappedData == nullptr || bufferHandle == VK_NULL_HANDLE || ticket == 0 )
+		{
+			return;
+		}
+
+		const auto targetsBuffer = [bufferHandle] (const PendingCopy & copy) {
+			return copy.dstBuffer == bufferHandle;
+		};
+
+		/* NOTE: The batch lock goes first, like in submit(), so no batch is taken from the queue meanwhile. */
+		const std::lock_guard< std::mutex > batchLock{m_batchAccess};
+
+		{
+			const std::lock_guard< std::mutex > lock{m_pendingAccess};
+
+			std::erase_if(m_pendingCopies, targetsBuffer);
+
+			if ( ticket >= m_nextSerial )
+			{
+				return;
+			}
+		}
+
+		/* NOTE: Copied on the transfer queue, not acquired yet. The copies are dropped from the
+		 * acquire half, the buffer will never be used on the rendering queue. */
+		for ( auto & batch : m_copyingBatches )
+		{
+			if ( std::erase_if(batch.copies, targetsBuffer) > 0 )
+			{
+				m_copyTimeline->wait(batch.copyValue);
+			}
+		}
+
+		this->reclaimCompletedBatches();
+
+		for ( const auto & batch : m_submittedBatches )
+		{
+			if ( batch.serial == ticket )
+			{
+				m_timeline->wait(batch.timelineValue);
+
+				break;
+			}
+		}
+	}
+
+	bool
+	StagingRing::hasWork () noexcept
+	{
+		{
+			const std::lock_guard< std::mutex > lock{m_pendingAccess};
+
+			if ( !m_pendingCopies.empty() )
+			{
+				return true;
+			}
+		}
+
+		const std::lock_guard< std::mutex > lock{m_batchAccess};
+
+		this->reclaimCompletedBatches();
+
+		return !m_copyingBatches.empty() || !m_submittedBatches.empty();
+	}
+
+	void
+	StagingRing::reclaimCompletedBatches () noexcept
+	{
+		if ( m_submittedBatches.empty() )
+		{
+			return;
+		}
+
+		const auto completedValue = m_timeline->counterValue();
+
+		/* NOTE: The batches complete in submission order, and their reclaim positions only grow. */
+		while ( !m_submittedBatches.empty() && m_submittedBatches.front().timelineValue <= completedValue )
+		{
+			auto & batch = m_submittedBatches.front();
+
+			m_tail.store(batch.reclaimPosition, std::memory_order_release);
+
+			if ( batch.transferCommandBuffer != nullptr )
+			{
+				batch.transferCommandBuffer->reset();
+
+				m_freeTransferCommandBuffers.emplace_back(std::move(batch.transferCommandBuffer));
+			}
+
+			batch.commandBuffer->reset();
+
+			m_freeCommandBuffers.emplace_back(std::move(batch.commandBuffer));
+
+			m_submittedBatches.pop_front();
+		}
+	}
+}
@@ -0,0 +1,343 @@
+/*
+ * src/Vulkan/StagingRing.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+/* Third-party inclusions. */
+#include <vulkan/vulkan.h>
+
+/* Local inclusions for usages. */
+#include "MemoryRegion.hpp"
+
+/* Forward declarations. */
+namespace EmEn::Vulkan
+{
+	namespace Sync
+	{
+		class TimelineSemaphore;
+	}
+
+	class Device;
+	class Buffer;
+	class CommandPool;
+	class CommandBuffer;
+	class Queue;
+}
+
+namespace EmEn::Vulkan
+{
+	/**
+	 * @brief A persistently mapped staging buffer shared by every buffer upload, with batched submissions.
+	 *
+	 * Uploads reserve a range of the ring with an atomic bump of a monotonic head, copy their data
+	 * into the mapped memory and queue a copy command description. submit() records all the queued
+	 * copies into one command buffer and submits it without waiting. Each batch signals the next
+	 * value of a timeline semaphore; the ring space of a batch is reclaimed once the GPU reaches it.
+	 *
+	 * When the device exposes a dedicated transfer queue family, the copies run on the transfer
+	 * queue and release the buffers to the graphics family. The acquire half is only submitted on
+	 * the rendering queue by a later submit(), once the copy timeline shows the batch complete, so
+	 * the rendering never waits for a copy. Each upload gets a ticket, isReady() tells whether the
+	 * rendering queue may use the buffer.
+	 *
+	 * @note The reservation and the data copy are lock-free. Only the append to the queued copy list
+	 * and the batch recording take a lock.
+	 * @note A destination buffer must be released with releaseBuffer() before its destruction.
+	 * @since 0.9.53
+	 */
+	class EMEN_API StagingRing final
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanStagingRing"};
+
+			/** @brief The default ring capacity in bytes (64 MiB). */
+			static constexpr VkDeviceSize DefaultCapacity{64ULL * 1024ULL * 1024ULL};
+
+			/** @brief The alignment of every reservation in bytes. */
+			static constexpr VkDeviceSize Alignment{16};
+
+			/**
+			 * @brief Constructs a staging ring.
+			 * @param device A reference to a device smart pointer.
+			 * @param capacity The ring capacity in bytes. Default 64 MiB.
+			 */
+			explicit StagingRing (const std::shared_ptr< Device > & device, VkDeviceSize capacity = DefaultCapacity) noexcept;
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StagingRing (const StagingRing & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			StagingRing (StagingRing && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StagingRing &
+			 */
+			StagingRing & operator= (const StagingRing & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return StagingRing &
+			 */
+			StagingRing & operator= (StagingRing && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the staging ring.
+			 * @note Waits for the submitted batches.
+			 */
+			~StagingRing ();
+
+			/**
+			 * @brief Creates the ring buffer, the command pool and the timeline semaphore.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool createOnHardware () noexcept;
+
+			/**
+			 * @brief Returns whether the ring is ready to take uploads.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isCreated () const noexcept
+			{
+				return m_mappedData != nullptr;
+			}
+
+			/**
+			 * @brief Returns whether the copies run on a dedicated transfer queue.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			usesDedicatedQueue () const noexcept
+			{
+				return m_transferQueue != nullptr;
+			}
+
+			/**
+			 * @brief Copies data into the ring and queues the copy to a buffer for the next batch.
+			 * @note Thread-safe.
+			 * @param targetBuffer A reference to the destination buffer.
+			 * @param memoryRegion A reference to the memory region. The offset is the destination offset.
+			 * @param ticket A reference to the upload ticket, see isReady() and releaseBuffer().
+			 * @return bool False if the ring has no room for the data, the upload must take another path.
+			 */
+			[[nodiscard]]
+			bool queueUpload (const Buffer & targetBuffer, const MemoryRegion & memoryRegion, uint64_t & ticket) noexcept;
+
+			/**
+			 * @brief Records every queued copy into one command buffer and submits it without waiting.
+			 * @note Thread-safe. With a dedicated queue, this also acquires on the given queue the buffers of the copies completed since the last call.
+			 * @param queue A reference to the rendering queue. Must always be the same queue, of the graphics family.
+			 * @return bool
+			 */
+			bool submit (const Queue & queue) noexcept;
+
+			/**
+			 * @brief Waits for every submitted batch, including the acquire half with a dedicated queue.
+			 * @note Queued copies not submitted yet are not waited for, call submit() first.
+			 * @param queue A reference to the rendering queue.
+			 * @return bool
+			 */
+			bool wait (const Queue & queue) noexcept;
+
+			/**
+			 * @brief Returns whether an upload may be used by the next submissions on the rendering queue.
+			 * @note Always true without a dedicated queue, the batch goes first on the rendering queue.
+			 * @param ticket The upload ticket.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isReady (uint64_t ticket) const noexcept
+			{
+				return !this->usesDedicatedQueue() || ticket <= m_readySerial.load(std::memory_order_acquire);
+			}
+
+			/**
+			 * @brief Forgets a buffer about to be destroyed.
+			 * @note Thread-safe. The queued copies to the buffer are dropped. When the batch of its last
+			 * upload still runs, this waits for its copies, so the buffer can be destroyed right after.
+			 * @param bufferHandle The buffer handle.
+			 * @param ticket The ticket of the last upload to the buffer.
+			 * @return void
+			 */
+			void releaseBuffer (VkBuffer bufferHandle, uint64_t ticket) noexcept;
+
+			/**
+			 * @brief Returns whether copies are queued or batches are still running.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool hasWork () noexcept;
+
+			/**
+			 * @brief Returns the ring capacity in bytes.
+			 * @return VkDeviceSize
+			 */
+			[[nodiscard]]
+			VkDeviceSize
+			capacity () const noexcept
+			{
+				return m_capacity;
+			}
+
+			/**
+			 * @brief Returns the number of submitted batches.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			submittedBatchCount () const noexcept
+			{
+				return m_lastSignaledValue.load(std::memory_order_relaxed);
+			}
+
+			/**
+			 * @brief Returns the number of buffer copies that went through the ring.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			submittedCopyCount () const noexcept
+			{
+				return m_submittedCopyCount.load(std::memory_order_relaxed);
+			}
+
+		private:
+
+			/** @brief A copy waiting for the next batch. */
+			struct PendingCopy
+			{
+				VkBuffer dstBuffer{VK_NULL_HANDLE};
+				VkDeviceSize srcOffset{0};
+				VkDeviceSize dstOffset{0};
+				VkDeviceSize size{0};
+			};
+
+			/** @brief A batch submitted to the GPU. */
+			struct SubmittedBatch
+			{
+				std::unique_ptr< CommandBuffer > transferCommandBuffer;
+				std::unique_ptr< CommandBuffer > commandBuffer;
+				std::vector< PendingCopy > copies;
+				uint64_t serial{0};
+				uint64_t copyValue{0};
+				uint64_t timelineValue{0};
+				uint64_t reclaimPosition{0};
+			};
+
+			/**
+			 * @brief Reserves a range of the ring without locking.
+			 * @note A range never straddles the end of the buffer, the remaining bytes are skipped.
+			 * @param bytes The aligned size in bytes.
+			 * @return std::optional< uint64_t > The monotonic position of the range.
+			 */
+			[[nodiscard]]
+			std::optional< uint64_t > reserve (VkDeviceSize bytes) noexcept;
+
+			/**
+			 * @brief Returns a recycled or a new command buffer.
+			 * @param freeCommandBuffers A reference to the free list.
+			 * @param commandPool A reference to the command pool smart pointer.
+			 * @return std::unique_ptr< CommandBuffer >
+			 */
+			[[nodiscard]]
+			static std::unique_ptr< CommandBuffer > acquireCommandBuffer (std::vector< std::unique_ptr< CommandBuffer > > & freeCommandBuffers, const std::shared_ptr< CommandPool > & commandPool) noexcept;
+
+			/**
+			 * @brief Submits the acquire half of the batches whose copies are complete on the transfer queue.
+			 * @note Must be called with m_batchAccess locked.
+			 * @param queue A reference to the rendering queue.
+			 * @return bool
+			 */
+			bool acquireCopiedBatches (const Queue & queue) noexcept;
+
+			/**
+			 * @brief Records and submits the copies of a batch.
+			 * @note Must be called with m_batchAccess locked.
+			 * @param queue A reference to the rendering queue.
+			 * @param batch A reference to the batch.
+			 * @return bool
+			 */
+			bool submitCopies (const Queue & queue, SubmittedBatch & batch) noexcept;
+
+			/**
+			 * @brief Releases the command buffers and the ring space of the completed batches.
+			 * @note Must be called with m_batchAccess locked.
+			 * @return void
+			 */
+			void reclaimCompletedBatches () noexcept;
+
+			std::shared_ptr< Device > m_device;
+			std::unique_ptr< Buffer > m_buffer;
+			std::shared_ptr< CommandPool > m_commandPool;
+			std::shared_ptr< CommandPool > m_transferCommandPool;
+			std::unique_ptr< Sync::TimelineSemaphore > m_timeline;
+			std::unique_ptr< Sync::TimelineSemaphore > m_copyTimeline;
+			const Queue * m_transferQueue{nullptr};
+			std::byte * m_mappedData{nullptr};
+			VkDeviceSize m_capacity;
+			std::atomic< uint64_t > m_head{0};
+			std::atomic< uint64_t > m_tail{0};
+			std::atomic< uint32_t > m_activeWriters{0};
+			std::atomic< uint64_t > m_lastSignaledValue{0};
+			std::atomic< uint64_t > m_lastCopyValue{0};
+			std::atomic< uint64_t > m_readySerial{0};
+			std::atomic< uint64_t > m_submittedCopyCount{0};
+			uint64_t m_reclaimPosition{0};
+			uint64_t m_nextSerial{1};
+			std::vector< PendingCopy > m_pendingCopies;
+			std::deque< SubmittedBatch > m_copyingBatches;
+			std::deque< SubmittedBatch > m_submittedBatches;
+			std::vector< std::unique_ptr< CommandBuffer > > m_freeCommandBuffers;
+			std::vector< std::unique_ptr< CommandBuffer > > m_freeTransferCommandBuffers;
+			std::mutex m_pendingAccess;
+			std::mutex m_batchAccess;
+	};
+}
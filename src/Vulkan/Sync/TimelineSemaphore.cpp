@@ -0,0 +1,129 @@
+/*
+ * src/Vulkan/Sync/TimelineSemaphore.cpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#include "TimelineSemaphore.hpp"
+
+/* Local inclusions. */
+#include "Tracer.hpp"
+#include "Vulkan/Device.hpp"
+#include "Vulkan/Utility.hpp"
+
+namespace EmEn::Vulkan::Sync
+{
+	bool
+	TimelineSemaphore::createOnHardware () noexcept
+	{
+		if ( !this->hasDevice() )
+		{
+			Tracer::error(ClassId, "No device to create this timeline semaphore !");
+
+			return false;
+		}
+
+		const VkSemaphoreCreateInfo createInfo{
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO,
+			.pNext = &m_typeCreateInfo,
+			.flags = 0
+		};
+
+		const auto result = vkCreateSemaphore(this->device()->handle(), &createInfo, nullptr, &m_handle);
+
+		if ( result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to create a timeline semaphore : " << vkResultToCString(result) << " !";
+
+			return false;
+		}
+
+		this->setCreated();
+
+		return true;
+	}
+
+	bool
+	TimelineSemaphore::destroyFromHardware () noexcept
+	{
+		if ( !this->hasDevice() )
+		{
+			TraceError{ClassId} << "No device to destroy the timeline semaphore " << m_handle << " (" << this->identifier() << ") !";
+
+			return false;
+		}
+
+		if ( m_handle != VK_NULL_HANDLE )
+		{
+			vkDestroySemaphore(this->device()->handle(), m_handle, nullptr);
+
+			m_handle = VK_NULL_HANDLE;
+		}
+
+		this->setDestroyed();
+
+		return true;
+	}
+
+	uint64_t
+	TimelineSemaphore::counterValue () const noexcept
+	{
+		uint64_t value = 0;
+
+		if ( const auto result = vkGetSemaphoreCounterValue(this->device()->handle(), m_handle, &value); result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to read the timeline semaphore counter : " << vkResultToCString(result) << " !";
+
+			return 0;
+		}
+
+		return value;
+	}
+
+	bool
+	TimelineSemaphore::wait (uint64_t value, uint64_t timeout) const noexcept
+	{
+		const VkSemaphoreWaitInfo waitInfo{
+			.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO,
+			.pNext = nullptr,
+			.flags = 0,
+			.semaphoreCount = 1,
+			.pSemaphores = &m_handle,
+			.pValues = &value
+		};
+
+		if ( const auto result = vkWaitSemaphores(this->device()->handle(), &waitInfo, timeout); result != VK_SUCCESS )
+		{
+			TraceError{ClassId} << "Unable to wait the timeline semaphore value " << value << " : " << vkResultToCString(result) << " !";
+
+			if ( result == VK_ERROR_DEVICE_LOST )
+			{
+				this->device()->dumpDeviceLostDiagnostics("TimelineSemaphore::wait");
+			}
+
+			return false;
+		}
+
+		return true;
+	}
+}
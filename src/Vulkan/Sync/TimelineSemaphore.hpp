@@ -0,0 +1,140 @@
+/*
+ * src/Vulkan/Sync/TimelineSemaphore.hpp
+ * This file is part of Emeraude-Engine
+ *
+ * Copyright (C) 2010-2026 - Sébastien Léon Claude Christian Bémelmans "LondNoir" <londnoir@gmail.com>
+ *
+ * Emeraude-Engine is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 3 of the License, or (at your option) any later version.
+ *
+ * Emeraude-Engine is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with Emeraude-Engine; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * Complete project and additional information can be found at :
+ * https://github.com/EmeraudeEngine/emeraude-engine
+ *
+ * --- THIS IS AUTOMATICALLY GENERATED, DO NOT CHANGE ---
+ */
+
+#pragma once
+
+/* STL inclusions. */
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+/* Local inclusions for inheritances. */
+#include "Vulkan/AbstractDeviceDependentObject.hpp"
+
+namespace EmEn::Vulkan::Sync
+{
+	/**
+	 * @brief The timeline semaphore class. A single semaphore carrying a monotonic 64-bit counter.
+	 * @note The GPU signals values through SynchInfo::timelineValues(), the CPU polls or waits for them.
+	 * One timeline replaces a pool of fences when the submissions complete in order.
+	 * @extends EmEn::Vulkan::AbstractDeviceDependentObject This object needs a device.
+	 * @since 0.9.53
+	 */
+	class EMEN_API TimelineSemaphore final : public AbstractDeviceDependentObject
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"VulkanTimelineSemaphore"};
+
+			/**
+			 * @brief Constructs a timeline semaphore.
+			 * @param device A reference to a smart pointer of the device.
+			 * @param initialValue The counter value at creation. Default 0.
+			 */
+			explicit
+			TimelineSemaphore (const std::shared_ptr< Device > & device, uint64_t initialValue = 0) noexcept
+				: AbstractDeviceDependentObject{device}
+			{
+				m_typeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+				m_typeCreateInfo.pNext = nullptr;
+				m_typeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+				m_typeCreateInfo.initialValue = initialValue;
+			}
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			TimelineSemaphore (const TimelineSemaphore & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			TimelineSemaphore (TimelineSemaphore && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return TimelineSemaphore &
+			 */
+			TimelineSemaphore & operator= (const TimelineSemaphore & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return TimelineSemaphore &
+			 */
+			TimelineSemaphore & operator= (TimelineSemaphore && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the timeline semaphore.
+			 */
+			~TimelineSemaphore () override
+			{
+				this->destroyFromHardware();
+			}
+
+			/** @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::createOnHardware() */
+			bool createOnHardware () noexcept override;
+
+			/** @copydoc EmEn::Vulkan::AbstractDeviceDependentObject::destroyFromHardware() */
+			bool destroyFromHardware () noexcept override;
+
+			/**
+			 * @brief Returns the semaphore vulkan handle.
+			 * @return VkSemaphore
+			 */
+			[[nodiscard]]
+			VkSemaphore
+			handle () const noexcept
+			{
+				return m_handle;
+			}
+
+			/**
+			 * @brief Returns the current counter value without blocking.
+			 * @note Returns 0 on error.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t counterValue () const noexcept;
+
+			/**
+			 * @brief Waits until the counter reaches a value.
+			 * @param value The value to wait for.
+			 * @param timeout The timeout in nanoseconds. Default infinite.
+			 * @return bool
+			 */
+			bool wait (uint64_t value, uint64_t timeout = std::numeric_limits< uint64_t >::max()) const noexcept;
+
+		private:
+
+			VkSemaphore m_handle{VK_NULL_HANDLE};
+			VkSemaphoreTypeCreateInfo m_typeCreateInfo{};
+	};
+}
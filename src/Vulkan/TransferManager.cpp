@@ -31,6 +31,7 @@
 #include "CommandBuffer.hpp"
 #include "Device.hpp"
 #include "Image.hpp"
+#include "Queue.hpp"
 #include "Sync/Fence.hpp"
 #include "Sync/ImageMemoryBarrier.hpp"
 
@@ -97,6 +98,26 @@ namespace EmEn::Vulkan
 			return false;
 		}
 
+		/* NOTE: The batches need one queue for the whole lifetime, the rendering one when the renderer gives it. */
+		if ( m_batchQueue == nullptr )
+		{
+			m_batchQueue = m_device->getGraphicsQueue(QueuePriority::High);
+		}
+
+		/* NOTE: Without the staging ring, every buffer upload uses its own staging buffer and submission. */
+		m_stagingRing = std::make_shared< StagingRing >(m_device);
+
+		if ( m_batchQueue == nullptr || !m_stagingRing->createOnHardware() )
+		{
+			Tracer::warning(ClassId, "Unable to create the staging ring, buffer uploads will not be batched !");
+
+			m_stagingRing.reset();
+		}
+		else if ( m_stagingRing->usesDedicatedQueue() )
+		{
+			Tracer::info(ClassId, "Buffer uploads run on the dedicated transfer queue.");
+		}
+
 		return true;
 	}
 
@@ -105,6 +126,15 @@ namespace EmEn::Vulkan
 	{
 		m_device->waitIdle("TransferManager::onTerminate()");
 
+		if ( m_stagingRing != nullptr )
+		{
+			TraceInfo{ClassId} << "Staging ring : " << m_stagingRing->submittedCopyCount() << " buffer copies in " << m_stagingRing->submittedBatchCount() << " batches.";
+
+			m_stagingRing.reset();
+		}
+
+		m_batchQueue = nullptr;
+
 		m_imageLayoutTransitionFence.reset();
 		m_imageLayoutTransitionCommandBuffer.reset();
 
@@ -119,6 +149,73 @@ namespace EmEn::Vulkan
 		return true;
 	}
 
+	bool
+	TransferManager::queueBufferUpload (Buffer & targetBuffer, const MemoryRegion & memoryRegion, uint64_t & ticket) noexcept
+	{
+		ticket = 0;
+
+		if ( !this->usable() )
+		{
+			TraceError{ClassId} << "The transfer manager is not usable !";
+
+			return false;
+		}
+
+		if ( m_stagingRing != nullptr )
+		{
+			if ( m_stagingRing->queueUpload(targetBuffer, memoryRegion, ticket) )
+			{
+				return true;
+			}
+
+			/* NOTE: An older batched copy to the same buffer must not land after the direct upload below.
+			 * Completing the batches also frees the ring, so the upload gets a second chance there. */
+			if ( !this->waitPendingTransfers() )
+			{
+				TraceError{ClassId} << "Unable to complete the pending buffer uploads !";
+
+				return false;
+			}
+
+			if ( m_stagingRing->queueUpload(targetBuffer, memoryRegion, ticket) )
+			{
+				return true;
+			}
+		}
+
+		/* NOTE: Larger than the ring, the upload takes its own staging buffer. */
+		return this->uploadBuffer(targetBuffer, memoryRegion.bytes(), [&memoryRegion] (const Buffer & stagingBuffer) {
+			return stagingBuffer.writeData(memoryRegion);
+		});
+	}
+
+	bool
+	TransferManager::submitPendingTransfers () const noexcept
+	{
+		if ( m_stagingRing == nullptr )
+		{
+			return true;
+		}
+
+		return m_stagingRing->submit(*m_batchQueue);
+	}
+
+	bool
+	TransferManager::waitPendingTransfers () const noexcept
+	{
+		if ( m_stagingRing == nullptr || !m_stagingRing->hasWork() )
+		{
+			return true;
+		}
+
+		if ( !this->submitPendingTransfers() )
+		{
+			return false;
+		}
+
+		return m_stagingRing->wait(*m_batchQueue);
+	}
+
 	bool
 	TransferManager::transitionImageLayout (Image & image, VkImageAspectFlags aspectMask, VkImageLayout oldLayout, VkImageLayout newLayout) const noexcept
 	{
@@ -41,6 +41,8 @@
 /* Local inclusions for usages. */
 #include "BufferTransferOperation.hpp"
 #include "ImageTransferOperation.hpp"
+#include "MemoryRegion.hpp"
+#include "StagingRing.hpp"
 #include "Tracer.hpp"
 
 /* Forward declarations. */
@@ -50,6 +52,7 @@ namespace EmEn::Vulkan
 	class CommandPool;
 	class Buffer;
 	class Image;
+	class Queue;
 }
 
 namespace EmEn::Vulkan
@@ -100,6 +103,72 @@ namespace EmEn::Vulkan
 				return m_device;
 			}
 
+			/**
+			 * @brief Sets the queue receiving the batched buffer uploads.
+			 * @note The renderer gives its own queue, so the batches are ordered before the frames. If none is set, a graphics queue is taken from the device.
+			 * @param queue A pointer to a queue of the graphics family.
+			 * @return void
+			 */
+			void
+			setBatchQueue (const Queue * queue) noexcept
+			{
+				m_batchQueue = queue;
+			}
+
+			/**
+			 * @brief Queues data for a buffer inside the GPU memory, without submitting anything.
+			 * @note The data is copied into the staging ring right away, the copy to the buffer goes with the next batch (see submitPendingTransfers()).
+			 * When the data does not fit in the ring, the batches are completed first, then the upload falls
+			 * back to uploadBuffer(), so the uploads to a buffer always land in order.
+			 * @param targetBuffer A writable reference to the destination buffer.
+			 * @param memoryRegion A reference to the memory region. The offset is the destination offset.
+			 * @param ticket A reference to the upload ticket, see isTransferComplete().
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool queueBufferUpload (Buffer & targetBuffer, const MemoryRegion & memoryRegion, uint64_t & ticket) noexcept;
+
+			/**
+			 * @brief Returns the staging ring batching the buffer uploads.
+			 * @note Null when the ring is not available.
+			 * @return const std::shared_ptr< StagingRing > &
+			 */
+			[[nodiscard]]
+			const std::shared_ptr< StagingRing > &
+			stagingRing () const noexcept
+			{
+				return m_stagingRing;
+			}
+
+			/**
+			 * @brief Returns whether a queued upload may be read by the next submissions on the rendering queue.
+			 * @note Always true without a dedicated transfer queue, the batches go first on the rendering queue.
+			 * @param ticket The upload ticket.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isTransferComplete (uint64_t ticket) const noexcept
+			{
+				return ticket == 0 || m_stagingRing == nullptr || m_stagingRing->isReady(ticket);
+			}
+
+			/**
+			 * @brief Submits every queued buffer upload in one command buffer, without waiting.
+			 * @note Called by the renderer before each of its submissions. With a dedicated transfer queue,
+			 * the copies run there and the buffers of the batches already copied are acquired on the rendering queue.
+			 * @return bool
+			 */
+			bool submitPendingTransfers () const noexcept;
+
+			/**
+			 * @brief Submits the queued buffer uploads and waits for every batch to complete.
+			 * @note For consumers on another queue, like the acceleration structure builds.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool waitPendingTransfers () const noexcept;
+
 			/**
 			 * @brief Transfer data to a buffer inside the GPU memory.
 			 * @tparam function_t The type of lambda to describe the data to write. Signature: bool (const Buffer &).
@@ -317,6 +386,8 @@ namespace EmEn::Vulkan
 			std::vector< ImageTransferOperation > m_imageTransferOperations;
 			std::unique_ptr< CommandBuffer > m_imageLayoutTransitionCommandBuffer;
 			std::unique_ptr< Sync::Fence > m_imageLayoutTransitionFence;
+			std::shared_ptr< StagingRing > m_stagingRing;
+			const Queue * m_batchQueue{nullptr};
 			mutable std::mutex m_transferOperationsAccess;
 	};
 }
@@ -0,0 +1,38 @@
+#include "AbstractWorld.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
+namespace Benchmark
+{
+	void
+	AbstractWorld::step () noexcept
+	{
+		const auto start = std::chrono::steady_clock::now();
+
+		this->simulate(m_cycle++);
+
+		const auto tickNS = static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+
+		m_slowestTickNS = std::max(m_slowestTickNS, tickNS);
+	}
+
+	uint64_t
+	AbstractWorld::hashFloat (uint64_t hash, float value) noexcept
+	{
+		constexpr uint64_t Prime{0x100000001B3ULL};
+
+		auto bits = std::bit_cast< uint32_t >(value);
+
+		for ( int byte = 0; byte < 4; ++byte )
+		{
+			hash ^= bits & 0xFFU;
+			hash *= Prime;
+			bits >>= 8;
+		}
+
+		return hash;
+	}
+}
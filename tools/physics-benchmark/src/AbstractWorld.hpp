@@ -0,0 +1,191 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/* Local inclusions for usages. */
+#include "Math/CartesianFrame.hpp"
+#include "Physics/BodyPhysicalProperties.hpp"
+#include "Physics/CollisionModelInterface.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief Accumulated wall-clock time of each physics phase, in nanoseconds.
+	 */
+	struct PhaseTimings
+	{
+		uint64_t integration{0};
+		uint64_t staticCollisions{0};
+		uint64_t broadphase{0};
+		uint64_t narrowphase{0};
+		uint64_t solver{0};
+	};
+
+	/** @brief Options of a movable body. */
+	enum BodyOption : uint32_t
+	{
+		NoBodyOption = 0,
+		RotationPhysics = 1U << 0,
+		ContinuousCollision = 1U << 1
+	};
+
+	/**
+	 * @brief The interface of a scenario world.
+	 *
+	 * A world is either a real scene of the engine (SceneWorld, needs a device) or the physics
+	 * building blocks stepped directly (PhysicsWorld, device-less). The scenarios are built and
+	 * reported the same way on both.
+	 */
+	class AbstractWorld
+	{
+		public:
+
+			/**
+			 * @brief Copy constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			AbstractWorld (const AbstractWorld & copy) noexcept = delete;
+
+			/**
+			 * @brief Move constructor.
+			 * @param copy A reference to the copied instance.
+			 */
+			AbstractWorld (AbstractWorld && copy) noexcept = delete;
+
+			/**
+			 * @brief Copy assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return AbstractWorld &
+			 */
+			AbstractWorld & operator= (const AbstractWorld & copy) noexcept = delete;
+
+			/**
+			 * @brief Move assignment.
+			 * @param copy A reference to the copied instance.
+			 * @return AbstractWorld &
+			 */
+			AbstractWorld & operator= (AbstractWorld && copy) noexcept = delete;
+
+			/**
+			 * @brief Destructs the world.
+			 */
+			virtual ~AbstractWorld () = default;
+
+			/**
+			 * @brief Returns whether the world is ready to be stepped.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			virtual bool isValid () const noexcept = 0;
+
+			/**
+			 * @brief Creates a movable body.
+			 * @note The collision model is given explicit shape parameters, the body properties do not resize it.
+			 * @param name A reference to a string.
+			 * @param coordinates A reference to the initial world frame.
+			 * @param collisionModel A collision model.
+			 * @param properties A reference to the physical properties.
+			 * @param options A combination of BodyOption.
+			 * @return bool
+			 */
+			virtual bool createBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel, const EmEn::Physics::BodyPhysicalProperties & properties, uint32_t options) noexcept = 0;
+
+			/**
+			 * @brief Creates a static body.
+			 * @param name A reference to a string.
+			 * @param coordinates A reference to the world frame.
+			 * @param collisionModel A collision model.
+			 * @return bool
+			 */
+			virtual bool createStaticBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel) noexcept = 0;
+
+			/**
+			 * @brief Adds a push over the whole world, like a wind.
+			 * @param direction A reference to the push direction.
+			 * @param magnitude The push force in newtons.
+			 * @return bool
+			 */
+			virtual bool addDirectionalPush (const EmEn::Base::Math::Vector< 3, float > & direction, float magnitude) noexcept = 0;
+
+			/**
+			 * @brief Returns the number of bodies, movable and static.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			virtual size_t bodyCount () const noexcept = 0;
+
+			/**
+			 * @brief Returns the number of sleeping movable bodies.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			virtual size_t sleepingBodyCount () const noexcept = 0;
+
+			/**
+			 * @brief Returns the accumulated phase timings.
+			 * @return PhaseTimings
+			 */
+			[[nodiscard]]
+			virtual PhaseTimings timings () const noexcept = 0;
+
+			/**
+			 * @brief Returns a FNV-1a hash of every movable body position and velocity bits, in creation order.
+			 * @note Two runs of the same build with the same scenario, seed and tick count give the same value.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			virtual uint64_t checksum () const noexcept = 0;
+
+			/**
+			 * @brief Returns the slowest tick duration, in nanoseconds.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			uint64_t
+			slowestTickNS () const noexcept
+			{
+				return m_slowestTickNS;
+			}
+
+			/**
+			 * @brief Simulates one physics tick.
+			 * @return void
+			 */
+			void step () noexcept;
+
+		protected:
+
+			/**
+			 * @brief Constructs a world.
+			 */
+			AbstractWorld () noexcept = default;
+
+			/**
+			 * @brief Simulates one physics tick.
+			 * @param cycle The tick number.
+			 * @return void
+			 */
+			virtual void simulate (size_t cycle) noexcept = 0;
+
+			/**
+			 * @brief Mixes a float into a FNV-1a hash.
+			 * @param hash The current hash.
+			 * @param value The value.
+			 * @return uint64_t
+			 */
+			[[nodiscard]]
+			static uint64_t hashFloat (uint64_t hash, float value) noexcept;
+
+			/** @brief FNV-1a offset basis, the checksum starting value. */
+			static constexpr uint64_t ChecksumBasis{0xCBF29CE484222325ULL};
+
+		private:
+
+			size_t m_cycle{0};
+			uint64_t m_slowestTickNS{0};
+	};
+}
@@ -0,0 +1,27 @@
+#include "Application.hpp"
+
+/* STL inclusions. */
+#include <cstdlib>
+#include <memory>
+
+/* Local inclusions. */
+#include "Report.hpp"
+#include "SceneWorld.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn;
+
+	bool
+	Application::onCoreStarted (const Arguments & arguments, Settings & /*settings*/) noexcept
+	{
+		const auto sceneWorldFactory = [this] (const std::string & name, float boundary, FunctionGround::LevelFunction groundLevel) -> std::unique_ptr< AbstractWorld > {
+			return std::make_unique< SceneWorld >(this->sceneManager(), name, boundary, std::move(groundLevel));
+		};
+
+		/* NOTE: The benchmark never enters the main loop for real, the report is complete. */
+		this->stop(writeReport(sceneWorldFactory, arguments) ? EXIT_SUCCESS : EXIT_FAILURE);
+
+		return true;
+	}
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+/* Local inclusions for inheritances. */
+#include "Core.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief The benchmark application. Boots the engine without window and audio, runs every
+	 * requested scenario into a real scene of the scene manager, writes the JSON report and stops.
+	 * @note Started with --no-device, the benchmark runs without this application, see PhysicsWorld.
+	 * @extends EmEn::Core The benchmark is an engine application.
+	 */
+	class Application final : public EmEn::Core
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"PhysicsBenchmark"};
+
+			/**
+			 * @brief Constructs the benchmark application.
+			 * @param argc The argument count.
+			 * @param argv The argument values.
+			 */
+			Application (int argc, char * * argv) noexcept
+				: Core{argc, argv, ClassId, {1, 0, 0}, "EmeraudeEngine", "localhost"}
+			{
+
+			}
+
+		private:
+
+			/** @copydoc EmEn::Core::onCoreStarted() */
+			bool onCoreStarted (const EmEn::Arguments & arguments, EmEn::Settings & settings) noexcept override;
+
+			/** @copydoc EmEn::Core::onCoreProcessLogics() */
+			void
+			onCoreProcessLogics (size_t /*engineCycle*/) noexcept override
+			{
+				/* NOTE: The scenarios are stepped from onCoreStarted(), the logic loop has no active scene. */
+			}
+	};
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+/* STL inclusions. */
+#include <functional>
+#include <utility>
+
+/* Local inclusions for inheritances. */
+#include "Scenes/GroundLevelInterface.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief A renderless ground whose level comes from a function.
+	 * @extends EmEn::Scenes::GroundLevelInterface The scene queries it like any ground.
+	 */
+	class FunctionGround final : public EmEn::Scenes::GroundLevelInterface
+	{
+		public:
+
+			/** @brief A function returning the ground level (Y-down) at a X/Z coordinate. */
+			using LevelFunction = std::function< float (float, float) >;
+
+			/**
+			 * @brief Constructs a function ground.
+			 * @param levelFunction The level function.
+			 */
+			explicit
+			FunctionGround (LevelFunction levelFunction) noexcept
+				: m_levelFunction{std::move(levelFunction)}
+			{
+
+			}
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getLevelAt(const Vector< 3, float > &) const */
+			[[nodiscard]]
+			float
+			getLevelAt (const EmEn::Base::Math::Vector< 3, float > & worldPosition) const noexcept override
+			{
+				return m_levelFunction(worldPosition[EmEn::Base::Math::X], worldPosition[EmEn::Base::Math::Z]);
+			}
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getLevelAt(float, float, float) const */
+			[[nodiscard]]
+			EmEn::Base::Math::Vector< 3, float >
+			getLevelAt (float positionX, float positionZ, float deltaY) const noexcept override
+			{
+				return {positionX, m_levelFunction(positionX, positionZ) + deltaY, positionZ};
+			}
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::getNormalAt() */
+			[[nodiscard]]
+			EmEn::Base::Math::Vector< 3, float >
+			getNormalAt (const EmEn::Base::Math::Vector< 3, float > & worldPosition) const noexcept override
+			{
+				using namespace EmEn::Base::Math;
+
+				constexpr auto Delta{0.1F};
+
+				/* NOTE: Central differences. In Y-down, a flat ground normal points toward -Y. */
+				const auto x = worldPosition[X];
+				const auto z = worldPosition[Z];
+				const auto slopeX = (m_levelFunction(x + Delta, z) - m_levelFunction(x - Delta, z)) / (2.0F * Delta);
+				const auto slopeZ = (m_levelFunction(x, z + Delta) - m_levelFunction(x, z - Delta)) / (2.0F * Delta);
+
+				return Vector< 3, float >{slopeX, -1.0F, slopeZ}.normalized();
+			}
+
+			/** @copydoc EmEn::Scenes::GroundLevelInterface::updateVisibility() */
+			void
+			updateVisibility (const EmEn::Base::Math::Vector< 3, float > & /*worldPosition*/) noexcept override
+			{
+
+			}
+
+		private:
+
+			LevelFunction m_levelFunction;
+	};
+}
@@ -0,0 +1,348 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <memory>
+#include <string>
+
+/* Local inclusions for inheritances. */
+#include "NameableTrait.hpp"
+#include "Physics/MovableTrait.hpp"
+#include "Scenes/LocatableInterface.hpp"
+
+/* Local inclusions for usages. */
+#include "Physics/BodyPhysicalProperties.hpp"
+#include "Physics/CollisionModelInterface.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief A scene-less physical body.
+	 * @note It fills the role of a Node (movable) or a StaticEntity (not movable) without any
+	 * scene, renderer or audio dependency, so it can live in the physics octree and be solved
+	 * by the constraint solver as is.
+	 * @extends EmEn::Base::NameableTrait The octree elements are named.
+	 * @extends EmEn::Scenes::LocatableInterface The octree elements are locatable.
+	 * @extends EmEn::Physics::MovableTrait The body is integrated and solved like a node.
+	 */
+	class PhysicsBody final : public EmEn::Base::NameableTrait, public EmEn::Scenes::LocatableInterface, public EmEn::Physics::MovableTrait
+	{
+		public:
+
+			/**
+			 * @brief Constructs a body.
+			 * @param name A reference to a string.
+			 * @param identifier The creation index of the body, used to order pairs deterministically.
+			 * @param coordinates A reference to the initial world frame.
+			 * @param collisionModel A collision model.
+			 * @param properties A reference to the physical properties.
+			 * @param movable Whether the body moves (node) or not (static entity).
+			 */
+			PhysicsBody (std::string name, size_t identifier, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel, const EmEn::Physics::BodyPhysicalProperties & properties, bool movable) noexcept
+				: NameableTrait{std::move(name)},
+				m_coordinates{coordinates},
+				m_collisionModel{std::move(collisionModel)},
+				m_properties{properties},
+				m_identifier{identifier}
+			{
+				this->setMovingAbility(movable);
+			}
+
+			/**
+			 * @brief Returns the creation index of the body.
+			 * @return size_t
+			 */
+			[[nodiscard]]
+			size_t
+			identifier () const noexcept
+			{
+				return m_identifier;
+			}
+
+			/**
+			 * @brief Returns whether the body is sleeping.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isSimulationPaused () const noexcept
+			{
+				return m_simulationPaused;
+			}
+
+			/**
+			 * @brief Puts the body to sleep or wakes it up.
+			 * @param state The state.
+			 * @return void
+			 */
+			void
+			pauseSimulation (bool state) noexcept
+			{
+				m_simulationPaused = state;
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::setPosition() */
+			void
+			setPosition (const EmEn::Base::Math::Vector< 3, float > & position, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setPosition(position);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::setXPosition() */
+			void
+			setXPosition (float position, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setXPosition(position);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::setYPosition() */
+			void
+			setYPosition (float position, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setYPosition(position);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::setZPosition() */
+			void
+			setZPosition (float position, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setZPosition(position);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::move() */
+			void
+			move (const EmEn::Base::Math::Vector< 3, float > & distance, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.translate(distance, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::moveX() */
+			void
+			moveX (float distance, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.translateX(distance, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::moveY() */
+			void
+			moveY (float distance, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.translateY(distance, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::moveZ() */
+			void
+			moveZ (float distance, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.translateZ(distance, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::rotate() */
+			void
+			rotate (float radian, const EmEn::Base::Math::Vector< 3, float > & axis, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.rotate(radian, axis, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::pitch() */
+			void
+			pitch (float radian, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.pitch(radian, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::yaw() */
+			void
+			yaw (float radian, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.yaw(radian, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::roll() */
+			void
+			roll (float radian, EmEn::Base::Math::TransformSpace transformSpace) noexcept override
+			{
+				m_coordinates.roll(radian, transformSpace == EmEn::Base::Math::TransformSpace::Local);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::scale(const EmEn::Base::Math::Vector< 3, float > &, EmEn::Base::Math::TransformSpace) */
+			void
+			scale (const EmEn::Base::Math::Vector< 3, float > & factor, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setScalingFactor(factor);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::scale(float, EmEn::Base::Math::TransformSpace) */
+			void
+			scale (float factor, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setScalingFactor(factor);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::scaleX() */
+			void
+			scaleX (float factor, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setScalingXFactor(factor);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::scaleY() */
+			void
+			scaleY (float factor, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setScalingYFactor(factor);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::scaleZ() */
+			void
+			scaleZ (float factor, EmEn::Base::Math::TransformSpace /*transformSpace*/) noexcept override
+			{
+				m_coordinates.setScalingZFactor(factor);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::lookAt() */
+			void
+			lookAt (const EmEn::Base::Math::Vector< 3, float > & target, bool flipZAxis) noexcept override
+			{
+				m_coordinates.lookAt(target, flipZAxis);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::setLocalCoordinates() */
+			void
+			setLocalCoordinates (const EmEn::Base::Math::CartesianFrame< float > & coordinates) noexcept override
+			{
+				m_coordinates = coordinates;
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::localCoordinates() const */
+			[[nodiscard]]
+			const EmEn::Base::Math::CartesianFrame< float > &
+			localCoordinates () const noexcept override
+			{
+				return m_coordinates;
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::localCoordinates() */
+			[[nodiscard]]
+			EmEn::Base::Math::CartesianFrame< float > &
+			localCoordinates () noexcept override
+			{
+				return m_coordinates;
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::getWorldCoordinates() */
+			[[nodiscard]]
+			EmEn::Base::Math::CartesianFrame< float >
+			getWorldCoordinates () const noexcept override
+			{
+				return m_coordinates;
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::setCollisionModel() */
+			void
+			setCollisionModel (std::unique_ptr< EmEn::Physics::CollisionModelInterface > model) noexcept override
+			{
+				m_collisionModel = std::move(model);
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::hasCollisionModel() */
+			[[nodiscard]]
+			bool
+			hasCollisionModel () const noexcept override
+			{
+				return m_collisionModel != nullptr;
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::collisionModel() const */
+			[[nodiscard]]
+			const EmEn::Physics::CollisionModelInterface *
+			collisionModel () const noexcept override
+			{
+				return m_collisionModel.get();
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::collisionModel() */
+			[[nodiscard]]
+			EmEn::Physics::CollisionModelInterface *
+			collisionModel () noexcept override
+			{
+				return m_collisionModel.get();
+			}
+
+			/** @copydoc EmEn::Scenes::LocatableInterface::isVisibleTo() */
+			[[nodiscard]]
+			bool
+			isVisibleTo (const EmEn::Graphics::Frustum & /*frustum*/) const noexcept override
+			{
+				return false;
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::getWorldVelocity() */
+			[[nodiscard]]
+			EmEn::Base::Math::Vector< 3, float >
+			getWorldVelocity () const noexcept override
+			{
+				return this->linearVelocity();
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::getWorldCenterOfMass() */
+			[[nodiscard]]
+			EmEn::Base::Math::Vector< 3, float >
+			getWorldCenterOfMass () const noexcept override
+			{
+				return m_coordinates.position() + this->centerOfMass();
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::getBodyPhysicalProperties() */
+			[[nodiscard]]
+			const EmEn::Physics::BodyPhysicalProperties &
+			getBodyPhysicalProperties () const noexcept override
+			{
+				return m_properties;
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::onCollision() */
+			void
+			onCollision (float /*impactForce*/) noexcept override
+			{
+
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::onImpulse() */
+			void
+			onImpulse () noexcept override
+			{
+				m_simulationPaused = false;
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::moveFromPhysics() */
+			void
+			moveFromPhysics (const EmEn::Base::Math::Vector< 3, float > & positionDelta) noexcept override
+			{
+				m_coordinates.translate(positionDelta, false);
+			}
+
+			/** @copydoc EmEn::Physics::MovableTrait::rotateFromPhysics() */
+			void
+			rotateFromPhysics (float radianAngle, const EmEn::Base::Math::Vector< 3, float > & worldDirection) noexcept override
+			{
+				m_coordinates.rotate(radianAngle, worldDirection, true);
+			}
+
+		private:
+
+			/** @copydoc EmEn::Physics::MovableTrait::getWorldPosition() */
+			[[nodiscard]]
+			EmEn::Base::Math::Vector< 3, float >
+			getWorldPosition () const noexcept override
+			{
+				return m_coordinates.position();
+			}
+
+			EmEn::Base::Math::CartesianFrame< float > m_coordinates;
+			std::unique_ptr< EmEn::Physics::CollisionModelInterface > m_collisionModel;
+			EmEn::Physics::BodyPhysicalProperties m_properties;
+			size_t m_identifier;
+			bool m_simulationPaused{false};
+	};
+}
@@ -0,0 +1,485 @@
+#include "PhysicsWorld.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+#include <chrono>
+#include <unordered_set>
+
+/* Local inclusions. */
+#include "Constants.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn;
+	using namespace EmEn::Base::Math;
+	using namespace EmEn::Physics;
+
+	/**
+	 * @brief Returns the elapsed nanoseconds since a time point.
+	 * @param start A reference to a time point.
+	 * @return uint64_t
+	 */
+	static uint64_t
+	elapsedSince (const std::chrono::steady_clock::time_point & start) noexcept
+	{
+		return static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+	}
+
+	/**
+	 * @brief Returns whether two axis aligned boxes overlap.
+	 * @param boxA A reference to the first box.
+	 * @param boxB A reference to the second box.
+	 * @return bool
+	 */
+	static bool
+	isOverlapping (const Space3D::AACuboid< float > & boxA, const Space3D::AACuboid< float > & boxB) noexcept
+	{
+		return
+			boxA.minimum(X) <= boxB.maximum(X) && boxA.maximum(X) >= boxB.minimum(X) &&
+			boxA.minimum(Y) <= boxB.maximum(Y) && boxA.maximum(Y) >= boxB.minimum(Y) &&
+			boxA.minimum(Z) <= boxB.maximum(Z) && boxA.maximum(Z) >= boxB.minimum(Z);
+	}
+
+	/**
+	 * @brief Applies the velocity bounce and the grounded state, like the scene does after static collisions.
+	 * @param body A reference to a body.
+	 * @param surfaceNormal A reference to the dominant surface normal.
+	 * @param source The grounded source when the body rests on the surface.
+	 * @return void
+	 */
+	static void
+	applyCollisionResponse (PhysicsBody & body, const Vector< 3, float > & surfaceNormal, GroundedSource source) noexcept
+	{
+		constexpr auto GroundNormalThreshold{0.7F};
+
+		auto velocity = body.linearVelocity();
+		const auto normalVelocity = Vector< 3, float >::dotProduct(velocity, surfaceNormal);
+
+		if ( normalVelocity > 0.0F )
+		{
+			velocity -= surfaceNormal * normalVelocity * (1.0F + body.getBodyPhysicalProperties().bounciness());
+			body.setLinearVelocity(velocity);
+		}
+
+		/* NOTE: In Y-down, a floor-like normal points toward +Y. */
+		if ( surfaceNormal[Y] > GroundNormalThreshold && velocity[Y] >= -0.1F )
+		{
+			velocity[Y] = 0.0F;
+			body.setLinearVelocity(velocity);
+			body.setGrounded(source);
+		}
+	}
+
+	PhysicsWorld::PhysicsWorld (float boundary, FunctionGround::LevelFunction groundLevel) noexcept
+		: m_octree{std::make_shared< Octree >(Vector< 3, float >{boundary, boundary, boundary}, Vector< 3, float >{-boundary, -boundary, -boundary}, 32, false)},
+		m_groundLevel{std::move(groundLevel)},
+		m_boundary{boundary}
+	{
+		m_octree->reserve(3);
+	}
+
+	bool
+	PhysicsWorld::createBody (const std::string & name, const CartesianFrame< float > & coordinates, std::unique_ptr< CollisionModelInterface > collisionModel, const BodyPhysicalProperties & properties, uint32_t options) noexcept
+	{
+		const auto body = this->addBody(name, coordinates, std::move(collisionModel), properties, true);
+
+		body->enableRotationPhysics((options & RotationPhysics) != 0);
+
+		return true;
+	}
+
+	bool
+	PhysicsWorld::createStaticBody (const std::string & name, const CartesianFrame< float > & coordinates, std::unique_ptr< CollisionModelInterface > collisionModel) noexcept
+	{
+		this->addBody(name, coordinates, std::move(collisionModel), BodyPhysicalProperties{1000.0F, 1.0F, 0.5F, 0.5F, 0.2F, 0.0F}, false);
+
+		return true;
+	}
+
+	bool
+	PhysicsWorld::addDirectionalPush (const Vector< 3, float > & direction, float magnitude) noexcept
+	{
+		m_pushForce += direction.normalized() * magnitude;
+
+		return true;
+	}
+
+	std::shared_ptr< PhysicsBody >
+	PhysicsWorld::addBody (const std::string & name, const CartesianFrame< float > & coordinates, std::unique_ptr< CollisionModelInterface > collisionModel, const BodyPhysicalProperties & properties, bool movable) noexcept
+	{
+		auto body = std::make_shared< PhysicsBody >(name, m_bodies.size(), coordinates, std::move(collisionModel), properties, movable);
+
+		m_bodies.emplace_back(body);
+
+		m_octree->updateOrInsert(body);
+
+		return body;
+	}
+
+	size_t
+	PhysicsWorld::sleepingBodyCount () const noexcept
+	{
+		return static_cast< size_t >(std::ranges::count_if(m_bodies, [] (const auto & body) {
+			return body->isMovable() && body->isSimulationPaused();
+		}));
+	}
+
+	void
+	PhysicsWorld::simulate (size_t /*cycle*/) noexcept
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		this->integrateBodies();
+
+		m_timings.integration += elapsedSince(start);
+		start = std::chrono::steady_clock::now();
+
+		this->gatherCandidatePairs();
+
+		m_timings.broadphase += elapsedSince(start);
+		start = std::chrono::steady_clock::now();
+
+		this->resolveStaticCollisions();
+
+		m_timings.staticCollisions += elapsedSince(start);
+		start = std::chrono::steady_clock::now();
+
+		this->detectDynamicCollisions();
+
+		m_timings.narrowphase += elapsedSince(start);
+		start = std::chrono::steady_clock::now();
+
+		if ( !m_manifolds.empty() )
+		{
+			m_constraintSolver.solve(m_manifolds, WorldPhysicsUpdateCycleDurationS< float >);
+		}
+
+		m_timings.solver += elapsedSince(start);
+	}
+
+	uint64_t
+	PhysicsWorld::checksum () const noexcept
+	{
+		uint64_t hash{ChecksumBasis};
+
+		for ( const auto & body : m_bodies )
+		{
+			if ( !body->isMovable() )
+			{
+				continue;
+			}
+
+			const auto position = body->localCoordinates().position();
+			const auto velocity = body->linearVelocity();
+
+			for ( size_t axis = 0; axis < 3; ++axis )
+			{
+				hash = hashFloat(hash, position[axis]);
+				hash = hashFloat(hash, velocity[axis]);
+			}
+		}
+
+		return hash;
+	}
+
+	void
+	PhysicsWorld::integrateBodies () noexcept
+	{
+		m_bodyIntegrator.clear();
+		m_integratedBodies.clear();
+
+		for ( size_t bodyIndex = 0; bodyIndex < m_bodies.size(); ++bodyIndex )
+		{
+			auto & body = *m_bodies[bodyIndex];
+
+			if ( !body.isMovable() || body.isSimulationPaused() )
+			{
+				continue;
+			}
+
+			if ( !m_pushForce.isZero() )
+			{
+				body.addForce(m_pushForce);
+			}
+
+			static_cast< void >(body.gatherIntegrationState(m_environment, m_bodyIntegrator));
+
+			m_integratedBodies.emplace_back(bodyIndex);
+		}
+
+		/* NOTE: No thread pool, the scenarios must give the same result on every machine. */
+		m_bodyIntegrator.integrate(nullptr);
+
+		for ( size_t index = 0; index < m_integratedBodies.size(); ++index )
+		{
+			auto & body = *m_bodies[m_integratedBodies[index]];
+
+			static_cast< void >(body.applyIntegrationResults(m_bodyIntegrator, index));
+
+			/* NOTE: No contact islands here, a body sleeps alone once it rests on the ground or a boundary floor. */
+			if ( body.checkSimulationInertia() )
+			{
+				body.pauseSimulation(true);
+			}
+		}
+	}
+
+	void
+	PhysicsWorld::gatherCandidatePairs () noexcept
+	{
+		m_dynamicPairs.clear();
+		m_staticPairs.clear();
+
+		for ( const auto & body : m_bodies )
+		{
+			if ( body->isMovable() && !body->isSimulationPaused() )
+			{
+				m_octree->updateOrInsert(body);
+			}
+		}
+
+		std::unordered_set< uint64_t > testedPairs;
+
+		m_octree->forLeafSectors([&] (const Octree & leafSector) {
+			const auto & elements = leafSector.elements();
+
+			for ( auto elementIt = elements.begin(); elementIt != elements.end(); ++elementIt )
+			{
+				auto elementItCopy = elementIt;
+
+				for ( ++elementItCopy; elementItCopy != elements.end(); ++elementItCopy )
+				{
+					/* NOTE: The pair is stored with the lowest creation index first. */
+					auto * bodyA = elementIt->get();
+					auto * bodyB = elementItCopy->get();
+
+					if ( bodyA->identifier() > bodyB->identifier() )
+					{
+						std::swap(bodyA, bodyB);
+					}
+
+					const auto awakeA = bodyA->isMovable() && !bodyA->isSimulationPaused();
+					const auto awakeB = bodyB->isMovable() && !bodyB->isSimulationPaused();
+
+					/* NOTE: Two sleeping or static bodies are not tested. */
+					if ( !awakeA && !awakeB )
+					{
+						continue;
+					}
+
+					/* Avoid duplicate pair testing across sectors. */
+					const auto pairKey = (static_cast< uint64_t >(bodyA->identifier()) << 32) | static_cast< uint64_t >(bodyB->identifier());
+
+					if ( !testedPairs.insert(pairKey).second )
+					{
+						continue;
+					}
+
+					const auto overlapping = isOverlapping(
+						bodyA->collisionModel()->getAABB(bodyA->getWorldCoordinates()),
+						bodyB->collisionModel()->getAABB(bodyB->getWorldCoordinates())
+					);
+
+					if ( !overlapping )
+					{
+						continue;
+					}
+
+					if ( bodyA->isMovable() && bodyB->isMovable() )
+					{
+						m_dynamicPairs.emplace_back(bodyA, bodyB);
+					}
+					else if ( bodyA->isMovable() )
+					{
+						m_staticPairs.emplace_back(bodyA, bodyB);
+					}
+					else
+					{
+						m_staticPairs.emplace_back(bodyB, bodyA);
+					}
+				}
+			}
+		});
+
+		const auto byIdentifiers = [] (const auto & pairA, const auto & pairB) {
+			if ( pairA.first->identifier() != pairB.first->identifier() )
+			{
+				return pairA.first->identifier() < pairB.first->identifier();
+			}
+
+			return pairA.second->identifier() < pairB.second->identifier();
+		};
+
+		std::ranges::sort(m_dynamicPairs, byIdentifiers);
+		std::ranges::sort(m_staticPairs, byIdentifiers);
+	}
+
+	void
+	PhysicsWorld::resolveStaticCollisions () noexcept
+	{
+		struct Correction
+		{
+			Vector< 3, float > position{0.0F, 0.0F, 0.0F};
+			Vector< 3, float > dominantNormal{0.0F, 0.0F, 0.0F};
+			float maxPenetration{0.0F};
+			GroundedSource source{GroundedSource::None};
+		};
+
+		std::vector< Correction > corrections(m_bodies.size());
+
+		for ( size_t bodyIndex = 0; bodyIndex < m_bodies.size(); ++bodyIndex )
+		{
+			const auto & body = *m_bodies[bodyIndex];
+
+			if ( !body.isMovable() || body.isSimulationPaused() )
+			{
+				continue;
+			}
+
+			auto & correction = corrections[bodyIndex];
+
+			this->accumulateBoundaryCorrection(body, correction.position, correction.dominantNormal, correction.maxPenetration);
+
+			if ( correction.maxPenetration > 0.0F )
+			{
+				correction.source = GroundedSource::Boundary;
+			}
+
+			if ( this->accumulateGroundCorrection(body, correction.position, correction.dominantNormal, correction.maxPenetration) )
+			{
+				correction.source = GroundedSource::Ground;
+			}
+		}
+
+		for ( const auto & [movable, staticBody] : m_staticPairs )
+		{
+			if ( movable->isSimulationPaused() )
+			{
+				continue;
+			}
+
+			const auto results = movable->collisionModel()->isCollidingWith(movable->getWorldCoordinates(), *staticBody->collisionModel(), staticBody->getWorldCoordinates());
+
+			if ( !results.m_collisionDetected || results.m_depth <= 0.0F )
+			{
+				continue;
+			}
+
+			auto & correction = corrections[movable->identifier()];
+
+			correction.position += results.m_MTV;
+
+			if ( results.m_depth > correction.maxPenetration )
+			{
+				correction.maxPenetration = results.m_depth;
+				correction.dominantNormal = -results.m_impactNormal;
+				correction.source = GroundedSource::Entity;
+			}
+		}
+
+		for ( size_t bodyIndex = 0; bodyIndex < m_bodies.size(); ++bodyIndex )
+		{
+			const auto & correction = corrections[bodyIndex];
+
+			if ( correction.maxPenetration <= 0.0F )
+			{
+				continue;
+			}
+
+			auto & body = *m_bodies[bodyIndex];
+
+			body.moveFromPhysics(correction.position);
+
+			applyCollisionResponse(body, correction.dominantNormal, correction.source);
+		}
+	}
+
+	void
+	PhysicsWorld::detectDynamicCollisions () noexcept
+	{
+		m_manifolds.clear();
+
+		for ( const auto & [bodyA, bodyB] : m_dynamicPairs )
+		{
+			const auto results = bodyA->collisionModel()->isCollidingWith(bodyA->getWorldCoordinates(), *bodyB->collisionModel(), bodyB->getWorldCoordinates());
+
+			if ( !results.m_collisionDetected )
+			{
+				continue;
+			}
+
+			ContactManifold manifold{bodyA, bodyB};
+
+			/* NOTE: isCollidingWith() returns the normal from B toward A, the solver expects A toward B. */
+			manifold.addContact(results.m_contact, -results.m_impactNormal, results.m_depth);
+
+			m_manifolds.emplace_back(manifold);
+		}
+	}
+
+	bool
+	PhysicsWorld::accumulateGroundCorrection (const PhysicsBody & body, Vector< 3, float > & positionCorrection, Vector< 3, float > & dominantNormal, float & maxPenetration) const noexcept
+	{
+		if ( !m_groundLevel )
+		{
+			return false;
+		}
+
+		const auto worldCoordinates = body.getWorldCoordinates();
+		const auto position = worldCoordinates.position();
+		const auto aabb = body.collisionModel()->getAABB(worldCoordinates);
+
+		/* NOTE: Y- is up, the lowest point of the body is the maximum of its box on Y. */
+		const auto penetration = aabb.maximum(Y) - m_groundLevel(position[X], position[Z]);
+
+		if ( penetration <= 0.0F )
+		{
+			return false;
+		}
+
+		positionCorrection[Y] -= penetration;
+
+		if ( penetration > maxPenetration )
+		{
+			maxPenetration = penetration;
+			dominantNormal = {0.0F, 1.0F, 0.0F};
+		}
+
+		return true;
+	}
+
+	void
+	PhysicsWorld::accumulateBoundaryCorrection (const PhysicsBody & body, Vector< 3, float > & positionCorrection, Vector< 3, float > & dominantNormal, float & maxPenetration) const noexcept
+	{
+		const auto aabb = body.collisionModel()->getAABB(body.getWorldCoordinates());
+
+		for ( size_t axis = 0; axis < 3; ++axis )
+		{
+			const auto overMaximum = aabb.maximum(axis) - m_boundary;
+			const auto underMinimum = -m_boundary - aabb.minimum(axis);
+
+			if ( overMaximum > 0.0F )
+			{
+				positionCorrection[axis] -= overMaximum;
+
+				if ( overMaximum > maxPenetration )
+				{
+					maxPenetration = overMaximum;
+					dominantNormal = {0.0F, 0.0F, 0.0F};
+					dominantNormal[axis] = 1.0F;
+				}
+			}
+			else if ( underMinimum > 0.0F )
+			{
+				positionCorrection[axis] += underMinimum;
+
+				if ( underMinimum > maxPenetration )
+				{
+					maxPenetration = underMinimum;
+					dominantNormal = {0.0F, 0.0F, 0.0F};
+					dominantNormal[axis] = -1.0F;
+				}
+			}
+		}
+	}
+}
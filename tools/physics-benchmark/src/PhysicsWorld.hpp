@@ -0,0 +1,177 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "AbstractWorld.hpp"
+
+/* Local inclusions for usages. */
+#include "Physics/BodyIntegrator.hpp"
+#include "Physics/ConstraintSolver.hpp"
+#include "Physics/ContactManifold.hpp"
+#include "Physics/EnvironmentPhysicalProperties.hpp"
+#include "Scenes/OctreeSector.hpp"
+#include "FunctionGround.hpp"
+#include "PhysicsBody.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief A device-less scenario world, stepping the physics building blocks without any scene.
+	 *
+	 * Every tick runs: body integration, physics octree update and candidate pair gathering,
+	 * static collisions (ground level, boundaries, static bodies), body versus body narrowphase
+	 * and the sequential impulse solver. Each phase is timed separately.
+	 *
+	 * @note It needs neither renderer nor audio, so it runs on machines without a Vulkan device.
+	 * It does not cover the continuous collisions nor the contact islands: a body sleeps alone,
+	 * when it rests on the ground or a boundary floor.
+	 * @note Candidate pairs are sorted by body creation index before the narrowphase, and the
+	 * integration runs without the thread pool.
+	 * @extends Benchmark::AbstractWorld This is a scenario world.
+	 */
+	class PhysicsWorld final : public AbstractWorld
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"PhysicsWorld"};
+
+			/**
+			 * @brief Constructs a world.
+			 * @param boundary The half size of the world cube.
+			 * @param groundLevel A function returning the ground level. Can be empty.
+			 */
+			PhysicsWorld (float boundary, FunctionGround::LevelFunction groundLevel) noexcept;
+
+			/** @copydoc Benchmark::AbstractWorld::isValid() */
+			[[nodiscard]]
+			bool
+			isValid () const noexcept override
+			{
+				return m_octree != nullptr;
+			}
+
+			/**
+			 * @copydoc Benchmark::AbstractWorld::createBody()
+			 * @note The ContinuousCollision option is ignored.
+			 */
+			bool createBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel, const EmEn::Physics::BodyPhysicalProperties & properties, uint32_t options) noexcept override;
+
+			/** @copydoc Benchmark::AbstractWorld::createStaticBody() */
+			bool createStaticBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel) noexcept override;
+
+			/**
+			 * @copydoc Benchmark::AbstractWorld::addDirectionalPush()
+			 * @note The force is added to every awake body before its integration.
+			 */
+			bool addDirectionalPush (const EmEn::Base::Math::Vector< 3, float > & direction, float magnitude) noexcept override;
+
+			/** @copydoc Benchmark::AbstractWorld::bodyCount() */
+			[[nodiscard]]
+			size_t
+			bodyCount () const noexcept override
+			{
+				return m_bodies.size();
+			}
+
+			/** @copydoc Benchmark::AbstractWorld::sleepingBodyCount() */
+			[[nodiscard]]
+			size_t sleepingBodyCount () const noexcept override;
+
+			/** @copydoc Benchmark::AbstractWorld::timings() */
+			[[nodiscard]]
+			PhaseTimings
+			timings () const noexcept override
+			{
+				return m_timings;
+			}
+
+			/** @copydoc Benchmark::AbstractWorld::checksum() */
+			[[nodiscard]]
+			uint64_t checksum () const noexcept override;
+
+		private:
+
+			using Octree = EmEn::Scenes::OctreeSector< PhysicsBody, true >;
+
+			/** @copydoc Benchmark::AbstractWorld::simulate() */
+			void simulate (size_t cycle) noexcept override;
+
+			/**
+			 * @brief Creates a body and adds it to the world.
+			 * @note The creation index of the body is its position in the world list.
+			 * @param name A reference to a string.
+			 * @param coordinates A reference to the initial world frame.
+			 * @param collisionModel A collision model.
+			 * @param properties A reference to the physical properties.
+			 * @param movable Whether the body moves.
+			 * @return std::shared_ptr< PhysicsBody >
+			 */
+			std::shared_ptr< PhysicsBody > addBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel, const EmEn::Physics::BodyPhysicalProperties & properties, bool movable) noexcept;
+
+			/**
+			 * @brief Integrates the awake movable bodies.
+			 * @return void
+			 */
+			void integrateBodies () noexcept;
+
+			/**
+			 * @brief Updates the octree and gathers the candidate pairs.
+			 * @return void
+			 */
+			void gatherCandidatePairs () noexcept;
+
+			/**
+			 * @brief Pushes the movable bodies out of the ground, the boundaries and the static bodies.
+			 * @return void
+			 */
+			void resolveStaticCollisions () noexcept;
+
+			/**
+			 * @brief Tests the movable pairs and fills the manifold list.
+			 * @return void
+			 */
+			void detectDynamicCollisions () noexcept;
+
+			/**
+			 * @brief Accumulates the ground level correction of a body.
+			 * @param body A reference to a body.
+			 * @param positionCorrection A reference to the accumulated correction.
+			 * @param dominantNormal A reference to the dominant normal.
+			 * @param maxPenetration A reference to the deepest penetration.
+			 * @return bool True if the ground is touched.
+			 */
+			bool accumulateGroundCorrection (const PhysicsBody & body, EmEn::Base::Math::Vector< 3, float > & positionCorrection, EmEn::Base::Math::Vector< 3, float > & dominantNormal, float & maxPenetration) const noexcept;
+
+			/**
+			 * @brief Accumulates the boundary correction of a body.
+			 * @param body A reference to a body.
+			 * @param positionCorrection A reference to the accumulated correction.
+			 * @param dominantNormal A reference to the dominant normal.
+			 * @param maxPenetration A reference to the deepest penetration.
+			 * @return void
+			 */
+			void accumulateBoundaryCorrection (const PhysicsBody & body, EmEn::Base::Math::Vector< 3, float > & positionCorrection, EmEn::Base::Math::Vector< 3, float > & dominantNormal, float & maxPenetration) const noexcept;
+
+			std::shared_ptr< Octree > m_octree;
+			std::vector< std::shared_ptr< PhysicsBody > > m_bodies;
+			std::vector< std::pair< PhysicsBody *, PhysicsBody * > > m_dynamicPairs;
+			std::vector< std::pair< PhysicsBody *, PhysicsBody * > > m_staticPairs;
+			std::vector< EmEn::Physics::ContactManifold > m_manifolds;
+			std::vector< size_t > m_integratedBodies;
+			EmEn::Physics::BodyIntegrator m_bodyIntegrator;
+			EmEn::Physics::ConstraintSolver m_constraintSolver{8, 3};
+			EmEn::Physics::EnvironmentPhysicalProperties m_environment{EmEn::Physics::EnvironmentPhysicalProperties::Earth()};
+			EmEn::Base::Math::Vector< 3, float > m_pushForce;
+			FunctionGround::LevelFunction m_groundLevel;
+			PhaseTimings m_timings;
+			float m_boundary;
+	};
+}
@@ -0,0 +1,133 @@
+#include "Report.hpp"
+
+/* STL inclusions. */
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace Benchmark
+{
+	using namespace EmEn;
+
+	/**
+	 * @brief Runs a scenario and appends its JSON report to a stream.
+	 * @param worldFactory A reference to the world factory.
+	 * @param name The scenario name.
+	 * @param ticks The number of physics ticks.
+	 * @param seed The random seed.
+	 * @param output A reference to the output stream.
+	 * @return bool
+	 */
+	static bool
+	runScenario (const WorldFactory & worldFactory, std::string_view name, uint32_t ticks, uint32_t seed, std::ostream & output) noexcept
+	{
+		const auto world = buildScenario(worldFactory, name, seed);
+
+		if ( world == nullptr )
+		{
+			std::cerr << "Unable to build the scenario '" << name << "' !" "\n";
+
+			return false;
+		}
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for ( uint32_t tick = 0; tick < ticks; ++tick )
+		{
+			world->step();
+		}
+
+		const auto totalNS = static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+		const auto timings = world->timings();
+
+		/* NOTE: Timings are reported in milliseconds, the checksum as a hexadecimal string to survive JSON parsers. */
+		const auto toMS = [] (uint64_t nanoseconds) {
+			return static_cast< double >(nanoseconds) / 1000000.0;
+		};
+
+		std::ostringstream checksum;
+		checksum << std::hex << world->checksum();
+
+		output <<
+			"\t{" "\n"
+			"\t\t\"scenario\": \"" << name << "\"," "\n"
+			"\t\t\"seed\": " << seed << "," "\n"
+			"\t\t\"ticks\": " << ticks << "," "\n"
+			"\t\t\"bodies\": " << world->bodyCount() << "," "\n"
+			"\t\t\"sleepingBodies\": " << world->sleepingBodyCount() << "," "\n"
+			"\t\t\"timingsMS\": {" "\n"
+			"\t\t\t\"integration\": " << toMS(timings.integration) << "," "\n"
+			"\t\t\t\"staticCollisions\": " << toMS(timings.staticCollisions) << "," "\n"
+			"\t\t\t\"broadphase\": " << toMS(timings.broadphase) << "," "\n"
+			"\t\t\t\"narrowphase\": " << toMS(timings.narrowphase) << "," "\n"
+			"\t\t\t\"solver\": " << toMS(timings.solver) << "," "\n"
+			"\t\t\t\"total\": " << toMS(totalNS) << "," "\n"
+			"\t\t\t\"averageTick\": " << (ticks > 0 ? toMS(totalNS) / ticks : 0.0) << "," "\n"
+			"\t\t\t\"slowestTick\": " << toMS(world->slowestTickNS()) << "\n"
+			"\t\t}," "\n"
+			"\t\t\"checksum\": \"" << checksum.str() << "\"" "\n"
+			"\t}";
+
+		return true;
+	}
+
+	bool
+	writeReport (const WorldFactory & worldFactory, const Arguments & arguments) noexcept
+	{
+		const auto scenario = arguments.get("--scenario").value_or("all");
+		const auto ticks = static_cast< uint32_t >(std::stoul(arguments.get("--ticks").value_or("600")));
+		const auto seed = static_cast< uint32_t >(std::stoul(arguments.get("--seed").value_or("1")));
+
+		std::vector< std::string_view > scenarios;
+
+		if ( scenario == "all" )
+		{
+			scenarios.assign(ScenarioNames.cbegin(), ScenarioNames.cend());
+		}
+		else
+		{
+			scenarios.emplace_back(scenario);
+		}
+
+		std::ostringstream report;
+		report << "[" "\n";
+
+		for ( size_t index = 0; index < scenarios.size(); ++index )
+		{
+			if ( index > 0 )
+			{
+				report << "," "\n";
+			}
+
+			if ( !runScenario(worldFactory, scenarios[index], ticks, seed, report) )
+			{
+				return false;
+			}
+		}
+
+		report << "\n" "]" "\n";
+
+		if ( const auto outputFilepath = arguments.get("--output") )
+		{
+			std::ofstream file{*outputFilepath, std::ios::trunc};
+
+			if ( !file.is_open() )
+			{
+				std::cerr << "Unable to write '" << *outputFilepath << "' !" "\n";
+
+				return false;
+			}
+
+			file << report.str();
+		}
+		else
+		{
+			std::cout << report.str();
+		}
+
+		return true;
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+/* Local inclusions for usages. */
+#include "Arguments.hpp"
+#include "Scenarios.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief Runs the scenarios requested on the command line and writes the JSON report.
+	 * @note Reads --scenario, --ticks, --seed and --output. The report goes to the standard output without --output.
+	 * @param worldFactory A reference to the function creating the scenario worlds.
+	 * @param arguments A reference to the command line arguments.
+	 * @return bool
+	 */
+	[[nodiscard]]
+	bool writeReport (const WorldFactory & worldFactory, const EmEn::Arguments & arguments) noexcept;
+}
@@ -0,0 +1,286 @@
+#include "Scenarios.hpp"
+
+/* STL inclusions. */
+#include <cmath>
+#include <random>
+#include <string>
+
+/* Local inclusions. */
+#include "Physics/AABBCollisionModel.hpp"
+#include "Physics/CapsuleCollisionModel.hpp"
+#include "Physics/SphereCollisionModel.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn::Base::Math;
+	using namespace EmEn::Physics;
+
+	/**
+	 * @brief Returns a frame at a world position.
+	 * @param x The X coordinate.
+	 * @param y The Y coordinate (Y-down).
+	 * @param z The Z coordinate.
+	 * @return CartesianFrame< float >
+	 */
+	static CartesianFrame< float >
+	frameAt (float x, float y, float z) noexcept
+	{
+		CartesianFrame< float > frame;
+		frame.setPosition({x, y, z});
+
+		return frame;
+	}
+
+	/**
+	 * @brief Returns the properties of a dynamic body.
+	 * @param mass The mass in kg.
+	 * @param surface The drag surface in m².
+	 * @return BodyPhysicalProperties
+	 */
+	static BodyPhysicalProperties
+	dynamicProperties (float mass, float surface) noexcept
+	{
+		return {mass, surface, 0.5F, 0.5F, 0.2F, 0.0F};
+	}
+
+	/**
+	 * @brief Towers of boxes resting on a flat ground. Exercises the solver with deep contact chains.
+	 * @param worldFactory A reference to the world factory.
+	 * @param generator A reference to the random generator.
+	 * @return std::unique_ptr< AbstractWorld >
+	 */
+	static std::unique_ptr< AbstractWorld >
+	buildStacks (const WorldFactory & worldFactory, std::mt19937 & generator) noexcept
+	{
+		constexpr auto Towers{16};
+		constexpr auto Height{12};
+		constexpr auto HalfExtent{0.5F};
+
+		auto world = worldFactory("stacks", 64.0F, [] (float, float) {
+			return 0.0F;
+		});
+
+		if ( world == nullptr || !world->isValid() )
+		{
+			return nullptr;
+		}
+
+		std::uniform_real_distribution< float > jitter{-0.02F, 0.02F};
+
+		for ( int tower = 0; tower < Towers; ++tower )
+		{
+			const auto baseX = static_cast< float >(tower % 4) * 4.0F - 6.0F;
+			const auto baseZ = static_cast< float >(tower / 4) * 4.0F - 6.0F;
+
+			for ( int level = 0; level < Height; ++level )
+			{
+				/* NOTE: Y-down, the tower grows toward negative Y. */
+				const auto y = -(HalfExtent + static_cast< float >(level) * HalfExtent * 2.0F);
+
+				world->createBody(
+					"Box" + std::to_string(tower) + "_" + std::to_string(level),
+					frameAt(baseX + jitter(generator), y, baseZ + jitter(generator)),
+					std::make_unique< AABBCollisionModel >(HalfExtent, true),
+					dynamicProperties(10.0F, 1.0F),
+					NoBodyOption
+				);
+			}
+		}
+
+		return world;
+	}
+
+	/**
+	 * @brief A cloud of spheres falling on a slope. Exercises the broadphase with many short lived pairs.
+	 * @param worldFactory A reference to the world factory.
+	 * @param generator A reference to the random generator.
+	 * @return std::unique_ptr< AbstractWorld >
+	 */
+	static std::unique_ptr< AbstractWorld >
+	buildAvalanche (const WorldFactory & worldFactory, std::mt19937 & generator) noexcept
+	{
+		constexpr auto Count{2000};
+
+		/* NOTE: The ground rises toward -X (Y-down), the spheres roll toward +X. */
+		auto world = worldFactory("avalanche", 128.0F, [] (float x, float) {
+			return x * 0.25F;
+		});
+
+		if ( world == nullptr || !world->isValid() )
+		{
+			return nullptr;
+		}
+
+		std::uniform_real_distribution< float > horizontal{-40.0F, 0.0F};
+		std::uniform_real_distribution< float > depth{-20.0F, 20.0F};
+		std::uniform_real_distribution< float > altitude{-40.0F, -20.0F};
+		std::uniform_real_distribution< float > radius{0.2F, 0.6F};
+
+		for ( int index = 0; index < Count; ++index )
+		{
+			const auto sphereRadius = radius(generator);
+
+			/* NOTE: The smallest spheres reach the highest speeds on the slope, they go through the continuous collision path. */
+			world->createBody(
+				"Sphere" + std::to_string(index),
+				frameAt(horizontal(generator), altitude(generator), depth(generator)),
+				std::make_unique< SphereCollisionModel >(sphereRadius, true),
+				dynamicProperties(sphereRadius * 20.0F, sphereRadius * sphereRadius * 3.14F),
+				sphereRadius < 0.3F ? ContinuousCollision : NoBodyOption
+			);
+		}
+
+		/* NOTE: A crosswind over the whole slope, so the modifier phase is part of the measure. */
+		world->addDirectionalPush({0.0F, 0.0F, 1.0F}, 2.0F);
+
+		return world;
+	}
+
+	/**
+	 * @brief Rows of touching capsules with rotation enabled. Exercises capsule narrowphase and angular solving.
+	 * @param worldFactory A reference to the world factory.
+	 * @param generator A reference to the random generator.
+	 * @return std::unique_ptr< AbstractWorld >
+	 */
+	static std::unique_ptr< AbstractWorld >
+	buildCapsuleChains (const WorldFactory & worldFactory, std::mt19937 & generator) noexcept
+	{
+		constexpr auto Chains{24};
+		constexpr auto Links{20};
+		constexpr auto Radius{0.25F};
+		constexpr auto Height{1.5F};
+
+		auto world = worldFactory("capsule_chains", 64.0F, [] (float, float) {
+			return 0.0F;
+		});
+
+		if ( world == nullptr || !world->isValid() )
+		{
+			return nullptr;
+		}
+
+		std::uniform_real_distribution< float > tilt{-0.3F, 0.3F};
+
+		for ( int chain = 0; chain < Chains; ++chain )
+		{
+			const auto z = static_cast< float >(chain) * 1.2F - 14.0F;
+
+			for ( int link = 0; link < Links; ++link )
+			{
+				/* NOTE: Each link touches the previous one, the chain falls as a whole. */
+				auto frame = frameAt(static_cast< float >(link) * (Radius * 2.0F) - 5.0F, -4.0F - static_cast< float >(chain % 3), z);
+				frame.rotate(tilt(generator), {1.0F, 0.0F, 0.0F}, true);
+
+				world->createBody(
+					"Capsule" + std::to_string(chain) + "_" + std::to_string(link),
+					frame,
+					std::make_unique< CapsuleCollisionModel >(Radius, Height, true),
+					dynamicProperties(4.0F, Radius * Height * 2.0F),
+					RotationPhysics
+				);
+			}
+		}
+
+		return world;
+	}
+
+	/**
+	 * @brief A grid of static buildings on a rolling heightfield with mixed falling bodies.
+	 * Exercises the static collision phase and the ground level queries.
+	 * @param worldFactory A reference to the world factory.
+	 * @param generator A reference to the random generator.
+	 * @return std::unique_ptr< AbstractWorld >
+	 */
+	static std::unique_ptr< AbstractWorld >
+	buildCity (const WorldFactory & worldFactory, std::mt19937 & generator) noexcept
+	{
+		constexpr auto GridSize{12};
+		constexpr auto BlockSize{8.0F};
+		constexpr auto DynamicCount{1500};
+
+		const auto groundLevel = [] (float x, float z) {
+			return std::sin(x * 0.05F) * 2.0F + std::cos(z * 0.07F) * 1.5F;
+		};
+
+		auto world = worldFactory("city", 128.0F, groundLevel);
+
+		if ( world == nullptr || !world->isValid() )
+		{
+			return nullptr;
+		}
+
+		std::uniform_real_distribution< float > buildingHalfHeight{2.0F, 10.0F};
+
+		for ( int row = 0; row < GridSize; ++row )
+		{
+			for ( int column = 0; column < GridSize; ++column )
+			{
+				const auto x = (static_cast< float >(column) - GridSize * 0.5F) * BlockSize;
+				const auto z = (static_cast< float >(row) - GridSize * 0.5F) * BlockSize;
+				const auto halfHeight = buildingHalfHeight(generator);
+
+				world->createStaticBody(
+					"Building" + std::to_string(row) + "_" + std::to_string(column),
+					frameAt(x, groundLevel(x, z) - halfHeight, z),
+					std::make_unique< AABBCollisionModel >(2.5F, halfHeight, 2.5F, true)
+				);
+			}
+		}
+
+		const auto halfCity = GridSize * BlockSize * 0.5F;
+
+		std::uniform_real_distribution< float > horizontal{-halfCity, halfCity};
+		std::uniform_real_distribution< float > altitude{-40.0F, -25.0F};
+		std::uniform_int_distribution< int > shape{0, 2};
+
+		for ( int index = 0; index < DynamicCount; ++index )
+		{
+			const auto frame = frameAt(horizontal(generator), altitude(generator), horizontal(generator));
+
+			switch ( shape(generator) )
+			{
+				case 0 :
+					world->createBody("Sphere" + std::to_string(index), frame, std::make_unique< SphereCollisionModel >(0.4F, true), dynamicProperties(8.0F, 0.5F), NoBodyOption);
+					break;
+
+				case 1 :
+					world->createBody("Box" + std::to_string(index), frame, std::make_unique< AABBCollisionModel >(0.4F, true), dynamicProperties(12.0F, 0.64F), NoBodyOption);
+					break;
+
+				default :
+					world->createBody("Capsule" + std::to_string(index), frame, std::make_unique< CapsuleCollisionModel >(0.3F, 1.2F, true), dynamicProperties(6.0F, 0.72F), RotationPhysics);
+					break;
+			}
+		}
+
+		return world;
+	}
+
+	std::unique_ptr< AbstractWorld >
+	buildScenario (const WorldFactory & worldFactory, std::string_view name, uint32_t seed) noexcept
+	{
+		std::mt19937 generator{seed};
+
+		if ( name == "stacks" )
+		{
+			return buildStacks(worldFactory, generator);
+		}
+
+		if ( name == "avalanche" )
+		{
+			return buildAvalanche(worldFactory, generator);
+		}
+
+		if ( name == "capsule_chains" )
+		{
+			return buildCapsuleChains(worldFactory, generator);
+		}
+
+		if ( name == "city" )
+		{
+			return buildCity(worldFactory, generator);
+		}
+
+		return nullptr;
+	}
+}
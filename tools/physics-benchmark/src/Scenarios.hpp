@@ -0,0 +1,41 @@
+#pragma once
+
+/* STL inclusions. */
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+
+/* Local inclusions for usages. */
+#include "AbstractWorld.hpp"
+#include "FunctionGround.hpp"
+
+namespace Benchmark
+{
+	/** @brief The names of the available scenarios. */
+	inline constexpr std::array< std::string_view, 4 > ScenarioNames{
+		"stacks",
+		"avalanche",
+		"capsule_chains",
+		"city"
+	};
+
+	/**
+	 * @brief A function creating an empty world from a name, a half size and a ground level function.
+	 */
+	using WorldFactory = std::function< std::unique_ptr< AbstractWorld > (const std::string & name, float boundary, FunctionGround::LevelFunction groundLevel) >;
+
+	/**
+	 * @brief Builds a scenario world.
+	 * @note Every random value comes from a generator seeded with the given seed, so a scenario
+	 * is the same from one run to another.
+	 * @param worldFactory A reference to the function creating the empty world.
+	 * @param name The scenario name, one of ScenarioNames.
+	 * @param seed The random seed.
+	 * @return std::unique_ptr< AbstractWorld > Null if the name is unknown or the world cannot be created.
+	 */
+	[[nodiscard]]
+	std::unique_ptr< AbstractWorld > buildScenario (const WorldFactory & worldFactory, std::string_view name, uint32_t seed) noexcept;
+}
@@ -0,0 +1,163 @@
+#include "SceneWorld.hpp"
+
+/* STL inclusions. */
+#include <algorithm>
+
+/* Local inclusions. */
+#include "Scenes/Component/DirectionalPushModifier.hpp"
+#include "Scenes/Component/Weight.hpp"
+#include "Scenes/StaticEntity.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn;
+	using namespace EmEn::Base::Math;
+	using namespace EmEn::Physics;
+
+	SceneWorld::SceneWorld (Scenes::Manager & sceneManager, const std::string & name, float boundary, FunctionGround::LevelFunction groundLevel) noexcept
+		: m_sceneManager{sceneManager}
+	{
+		std::shared_ptr< Scenes::GroundLevelInterface > ground;
+
+		if ( groundLevel )
+		{
+			ground = std::make_shared< FunctionGround >(std::move(groundLevel));
+		}
+
+		m_scene = m_sceneManager.newScene(name, boundary, nullptr, ground);
+
+		if ( m_scene != nullptr )
+		{
+			m_scene->enablePhysicsTimings(true);
+		}
+	}
+
+	SceneWorld::~SceneWorld ()
+	{
+		if ( m_scene == nullptr )
+		{
+			return;
+		}
+
+		const auto name = m_scene->name();
+
+		m_bodies.clear();
+		m_scene.reset();
+
+		static_cast< void >(m_sceneManager.deleteScene(name));
+	}
+
+	bool
+	SceneWorld::createBody (const std::string & name, const CartesianFrame< float > & coordinates, std::unique_ptr< CollisionModelInterface > collisionModel, const BodyPhysicalProperties & properties, uint32_t options) noexcept
+	{
+		const auto node = m_scene->root()->createChild(name, coordinates);
+
+		if ( node == nullptr )
+		{
+			return false;
+		}
+
+		/* NOTE: The collision model comes first, the weight component signals the content
+		 * modification which inserts the node in the physics octree. */
+		node->setCollisionModel(std::move(collisionModel));
+		node->componentBuilder< Scenes::Component::Weight >("Weight").build(properties);
+
+		node->enableRotationPhysics((options & RotationPhysics) != 0);
+		node->enableContinuousCollision((options & ContinuousCollision) != 0);
+
+		m_bodies.emplace_back(node);
+
+		return true;
+	}
+
+	bool
+	SceneWorld::createStaticBody (const std::string & name, const CartesianFrame< float > & coordinates, std::unique_ptr< CollisionModelInterface > collisionModel) noexcept
+	{
+		const auto staticEntity = m_scene->createStaticEntity(name, coordinates);
+
+		if ( staticEntity == nullptr )
+		{
+			return false;
+		}
+
+		/* NOTE: An entity without mass is not collidable, the mass of a static body is never used to move it. */
+		staticEntity->setCollisionModel(std::move(collisionModel));
+		staticEntity->componentBuilder< Scenes::Component::Weight >("Weight").build(BodyPhysicalProperties{1000.0F, 1.0F, 0.5F, 0.5F, 0.2F, 0.0F});
+
+		m_staticBodyCount++;
+
+		return true;
+	}
+
+	bool
+	SceneWorld::addDirectionalPush (const Vector< 3, float > & direction, float magnitude) noexcept
+	{
+		const auto source = m_scene->createStaticEntity("PushSource" + std::to_string(m_pushCount), CartesianFrame< float >{});
+
+		if ( source == nullptr )
+		{
+			return false;
+		}
+
+		const auto push = source->componentBuilder< Scenes::Component::DirectionalPushModifier >("Push").build(direction);
+
+		if ( push == nullptr )
+		{
+			return false;
+		}
+
+		push->setMagnitude(magnitude);
+
+		m_pushCount++;
+
+		return true;
+	}
+
+	size_t
+	SceneWorld::sleepingBodyCount () const noexcept
+	{
+		return static_cast< size_t >(std::ranges::count_if(m_bodies, [] (const auto & body) {
+			return body->isSimulationPaused();
+		}));
+	}
+
+	PhaseTimings
+	SceneWorld::timings () const noexcept
+	{
+		const auto & sceneTimings = m_scene->physicsTimings();
+
+		return {
+			sceneTimings.integration,
+			sceneTimings.staticCollisions,
+			sceneTimings.broadphase,
+			sceneTimings.narrowphase,
+			sceneTimings.solver
+		};
+	}
+
+	void
+	SceneWorld::simulate (size_t cycle) noexcept
+	{
+		m_scene->simulatePhysics(cycle);
+	}
+
+	uint64_t
+	SceneWorld::checksum () const noexcept
+	{
+		uint64_t hash{ChecksumBasis};
+
+		for ( const auto & body : m_bodies )
+		{
+			const auto position = body->getWorldCoordinates().position();
+			const auto velocity = body->linearVelocity();
+
+			for ( size_t axis = 0; axis < 3; ++axis )
+			{
+				hash = hashFloat(hash, position[axis]);
+				hash = hashFloat(hash, velocity[axis]);
+			}
+		}
+
+		return hash;
+	}
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "AbstractWorld.hpp"
+
+/* Local inclusions for usages. */
+#include "Scenes/Manager.hpp"
+#include "Scenes/Node.hpp"
+#include "Scenes/Scene.hpp"
+#include "FunctionGround.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief A scenario world, backed by a real scene of the scene manager.
+	 *
+	 * Every tick runs Scenes::Scene::simulatePhysics(), the node and physics part of a scene tick:
+	 * modifiers, node logics, body integration, continuous collisions, ground probes, static
+	 * collisions, narrowphase, solver and sleeping islands. The phases are timed by the scene.
+	 *
+	 * @note The scene is deleted from the manager with the world.
+	 * @extends Benchmark::AbstractWorld This is a scenario world.
+	 */
+	class SceneWorld final : public AbstractWorld
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"SceneWorld"};
+
+			/**
+			 * @brief Constructs a world.
+			 * @param sceneManager A reference to the scene manager.
+			 * @param name A reference to the scene name.
+			 * @param boundary The half size of the world cube.
+			 * @param groundLevel A function returning the ground level. Can be empty.
+			 */
+			SceneWorld (EmEn::Scenes::Manager & sceneManager, const std::string & name, float boundary, FunctionGround::LevelFunction groundLevel) noexcept;
+
+			/**
+			 * @brief Destructs the world and deletes its scene.
+			 */
+			~SceneWorld () override;
+
+			/** @copydoc Benchmark::AbstractWorld::isValid() */
+			[[nodiscard]]
+			bool
+			isValid () const noexcept override
+			{
+				return m_scene != nullptr;
+			}
+
+			/** @copydoc Benchmark::AbstractWorld::createBody() */
+			bool createBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel, const EmEn::Physics::BodyPhysicalProperties & properties, uint32_t options) noexcept override;
+
+			/**
+			 * @copydoc Benchmark::AbstractWorld::createStaticBody()
+			 * @note The body is a static entity of the scene.
+			 */
+			bool createStaticBody (const std::string & name, const EmEn::Base::Math::CartesianFrame< float > & coordinates, std::unique_ptr< EmEn::Physics::CollisionModelInterface > collisionModel) noexcept override;
+
+			/**
+			 * @copydoc Benchmark::AbstractWorld::addDirectionalPush()
+			 * @note The push is a directional push modifier on a static entity, without influence area.
+			 */
+			bool addDirectionalPush (const EmEn::Base::Math::Vector< 3, float > & direction, float magnitude) noexcept override;
+
+			/** @copydoc Benchmark::AbstractWorld::bodyCount() */
+			[[nodiscard]]
+			size_t
+			bodyCount () const noexcept override
+			{
+				return m_bodies.size() + m_staticBodyCount;
+			}
+
+			/** @copydoc Benchmark::AbstractWorld::sleepingBodyCount() */
+			[[nodiscard]]
+			size_t sleepingBodyCount () const noexcept override;
+
+			/** @copydoc Benchmark::AbstractWorld::timings() */
+			[[nodiscard]]
+			PhaseTimings timings () const noexcept override;
+
+			/** @copydoc Benchmark::AbstractWorld::checksum() */
+			[[nodiscard]]
+			uint64_t checksum () const noexcept override;
+
+		private:
+
+			/** @copydoc Benchmark::AbstractWorld::simulate() */
+			void simulate (size_t cycle) noexcept override;
+
+			EmEn::Scenes::Manager & m_sceneManager;
+			std::shared_ptr< EmEn::Scenes::Scene > m_scene;
+			std::vector< std::shared_ptr< EmEn::Scenes::Node > > m_bodies;
+			size_t m_staticBodyCount{0};
+			size_t m_pushCount{0};
+	};
+}
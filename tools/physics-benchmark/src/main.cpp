@@ -0,0 +1,67 @@
+/* STL inclusions. */
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/* Local inclusions. */
+#include "Application.hpp"
+#include "PhysicsWorld.hpp"
+#include "Report.hpp"
+
+int
+main (int argc, char * * argv)
+{
+	std::vector< char * > engineArguments{argv, argv + argc};
+
+	bool deviceLess = false;
+
+	for ( int index = 1; index < argc; ++index )
+	{
+		if ( std::strcmp(argv[index], "--help") == 0 || std::strcmp(argv[index], "-h") == 0 )
+		{
+			std::cout <<
+				"Usage : PhysicsBenchmark [--scenario={name|all}] [--ticks={count}] [--seed={value}] [--output={filepath}] [--no-device]" "\n"
+				"Scenarios : stacks, avalanche, capsule_chains, city (default: all)" "\n"
+				"Ticks default to 600 (10 seconds of simulation), seed defaults to 1." "\n"
+				"The engine boots without window and audio, a Vulkan device is still required." "\n"
+				"With --no-device, the engine is not started: the physics building blocks are stepped directly (headless CI)." "\n";
+
+			return EXIT_SUCCESS;
+		}
+
+		if ( std::strcmp(argv[index], "--no-device") == 0 )
+		{
+			deviceLess = true;
+		}
+	}
+
+	if ( deviceLess )
+	{
+		EmEn::Arguments arguments{argc, argv, false};
+
+		if ( !arguments.initialize() )
+		{
+			return EXIT_FAILURE;
+		}
+
+		const auto physicsWorldFactory = [] (const std::string & /*name*/, float boundary, Benchmark::FunctionGround::LevelFunction groundLevel) -> std::unique_ptr< Benchmark::AbstractWorld > {
+			return std::make_unique< Benchmark::PhysicsWorld >(boundary, std::move(groundLevel));
+		};
+
+		return Benchmark::writeReport(physicsWorldFactory, arguments) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	/* NOTE: The scenarios run into real scenes, the engine is started without window nor audio. */
+	static char windowLess[] = "--window-less";
+	static char disableAudio[] = "--disable-audio";
+
+	engineArguments.emplace_back(windowLess);
+	engineArguments.emplace_back(disableAudio);
+	engineArguments.emplace_back(nullptr);
+
+	Benchmark::Application application{static_cast< int >(engineArguments.size() - 1), engineArguments.data()};
+
+	return application.run();
+}
@@ -0,0 +1,360 @@
+#include "Application.hpp"
+
+/* STL inclusions. */
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+
+/* Local inclusions. */
+#include "Graphics/Geometry/Helpers.hpp"
+#include "Graphics/Geometry/ResourceGenerator.hpp"
+#include "Graphics/Material/BasicResource.hpp"
+#include "Graphics/Material/StandardResource.hpp"
+#include "Graphics/Renderable/MeshResource.hpp"
+#include "Graphics/RenderableInstance/Abstract.hpp"
+#include "Saphir/Generator/SceneRendering.hpp"
+#include "Saphir/Generator/ShadowCasting.hpp"
+#include "Saphir/ShaderManager.hpp"
+#include "Scenes/Component/Visual.hpp"
+#include "Scenes/StaticEntity.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn;
+	using namespace EmEn::Base;
+	using namespace EmEn::Graphics;
+
+	/** @brief The render pass types of a lit instance, like Scene::prepareRenderPassTypes() with shadow maps enabled. */
+	static constexpr std::array< RenderPassType, 14 > LitRenderPassTypes{
+		RenderPassType::AmbientPass,
+		RenderPassType::DirectionalLightPass,
+		RenderPassType::PointLightPass,
+		RenderPassType::SpotLightPass,
+		RenderPassType::DirectionalLightPassColorMap,
+		RenderPassType::PointLightPassColorMap,
+		RenderPassType::SpotLightPassColorMap,
+		RenderPassType::DirectionalLightPassShadowMap,
+		RenderPassType::PointLightPassShadowMap,
+		RenderPassType::SpotLightPassShadowMap,
+		RenderPassType::DirectionalLightPassCSM,
+		RenderPassType::DirectionalLightPassFull,
+		RenderPassType::PointLightPassFull,
+		RenderPassType::SpotLightPassFull
+	};
+
+	/** @brief The number of logic cycles to wait for the scene resources before giving up (10 seconds). */
+	static constexpr uint32_t MaxWaitedCycles{600};
+
+	bool
+	Application::onCoreStarted (const Arguments & arguments, Settings & /*settings*/) noexcept
+	{
+		m_iterations = static_cast< uint32_t >(std::stoul(arguments.get("--iterations").value_or("20")));
+		m_outputFilepath = arguments.get("--output").value_or("");
+
+		if ( !this->buildScene() )
+		{
+			std::cerr << "Unable to build the benchmark scene !" "\n";
+
+			m_isFinished = true;
+
+			this->stop(EXIT_FAILURE);
+		}
+
+		return true;
+	}
+
+	void
+	Application::onCoreProcessLogics (size_t /*engineCycle*/) noexcept
+	{
+		if ( m_isFinished || m_scene == nullptr )
+		{
+			return;
+		}
+
+		/* NOTE: The geometries load on the thread pool, the scene set waits for them. */
+		if ( !this->isSceneReady() )
+		{
+			if ( ++m_waitedCycles >= MaxWaitedCycles )
+			{
+				std::cerr << "The benchmark scene resources are not loaded after " << m_waitedCycles << " cycles !" "\n";
+
+				m_isFinished = true;
+
+				this->releaseScene();
+
+				this->stop(EXIT_FAILURE);
+			}
+
+			return;
+		}
+
+		m_isFinished = true;
+
+		this->runBenchmark();
+
+		this->releaseScene();
+	}
+
+	bool
+	Application::buildScene () noexcept
+	{
+		m_scene = this->sceneManager().newScene(ClassId, 256.0F);
+
+		if ( m_scene == nullptr )
+		{
+			return false;
+		}
+
+		auto & resources = this->resourceManager();
+
+		/* NOTE: A plain geometry and one with vertex colors and tangent space, the material code depends on both. */
+		const Geometry::ResourceGenerator plainGenerator{resources, Geometry::EnableNormal | Geometry::EnablePrimaryTextureCoordinates};
+		const Geometry::ResourceGenerator richGenerator{resources, Geometry::EnableNormal | Geometry::EnableTangentSpace | Geometry::EnablePrimaryTextureCoordinates | Geometry::EnableVertexColor};
+
+		const std::array< std::shared_ptr< Geometry::Interface >, 2 > geometries{
+			plainGenerator.sphere(1.0F, 16, 8, "SaphirBenchmarkSphere"),
+			richGenerator.cube(1.0F, "SaphirBenchmarkCube")
+		};
+
+		std::vector< std::shared_ptr< Material::Interface > > materials;
+
+		materials.emplace_back(resources.container< Material::BasicResource >()->getOrCreateResourceSync("SaphirBenchmarkColor", [] (Material::BasicResource & material) {
+			return material.load(PixelFactory::Red, PixelFactory::White);
+		}));
+
+		materials.emplace_back(resources.container< Material::BasicResource >()->getOrCreateResourceSync("SaphirBenchmarkVertexColor", [] (Material::BasicResource & material) {
+			material.enableVertexColor();
+
+			return material.load(PixelFactory::White, PixelFactory::White, 64.0F);
+		}));
+
+		materials.emplace_back(resources.container< Material::BasicResource >()->getOrCreateResourceSync("SaphirBenchmarkTranslucent", [] (Material::BasicResource & material) {
+			return material.load(PixelFactory::Blue, PixelFactory::White, 16.0F, 0.5F, BlendingMode::Normal);
+		}));
+
+		materials.emplace_back(resources.container< Material::StandardResource >()->getOrCreateResourceSync("SaphirBenchmarkStandard", [] (Material::StandardResource & material) {
+			if ( !material.enableManualLoading() )
+			{
+				return false;
+			}
+
+			const auto success =
+				material.setDiffuseComponent(PixelFactory::Green) &&
+				material.setSpecularComponent(PixelFactory::White, 48.0F) &&
+				material.setAutoIlluminationComponent(PixelFactory::Green, 0.2F);
+
+			return material.setManualLoadSuccess(success);
+		}));
+
+		auto * meshes = resources.container< Renderable::MeshResource >();
+
+		uint32_t index = 0;
+
+		for ( const auto & geometry : geometries )
+		{
+			for ( const auto & material : materials )
+			{
+				if ( geometry == nullptr || material == nullptr )
+				{
+					return false;
+				}
+
+				const auto name = "SaphirBenchmarkMesh" + std::to_string(index);
+
+				const auto mesh = meshes->getOrCreateResourceSync(name, [&geometry, &material] (Renderable::MeshResource & meshResource) {
+					return meshResource.load(geometry, material);
+				});
+
+				/* NOTE: Every mesh twice, lit and unlit, the unlit one only has the simple pass. */
+				for ( const auto lighting : {true, false} )
+				{
+					const auto entity = m_scene->createStaticEntity(name + (lighting ? "Lit" : "Unlit"), Math::Vector< 3, float >{static_cast< float >(index) * 3.0F, 0.0F, lighting ? 0.0F : 3.0F});
+
+					if ( entity == nullptr )
+					{
+						return false;
+					}
+
+					const auto visual = entity->componentBuilder< Scenes::Component::Visual >("Visual")
+						.setup([lighting] (auto & component) {
+							if ( lighting )
+							{
+								component.getRenderableInstance()->enableLighting();
+							}
+						}).build(mesh);
+
+					if ( visual == nullptr )
+					{
+						return false;
+					}
+
+					m_renderableInstances.emplace_back(visual->getRenderableInstance());
+				}
+
+				index++;
+			}
+		}
+
+		return true;
+	}
+
+	void
+	Application::releaseScene () noexcept
+	{
+		m_renderableInstances.clear();
+		m_scene.reset();
+
+		this->sceneManager().deleteScene(ClassId);
+	}
+
+	bool
+	Application::isSceneReady () const noexcept
+	{
+		for ( const auto & renderableInstance : m_renderableInstances )
+		{
+			const auto renderable = renderableInstance->renderable();
+
+			if ( renderable == nullptr || !renderable->isReadyForInstantiation() )
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void
+	Application::generateSceneSet (Results & results, std::vector< ShaderSource > * sources) noexcept
+	{
+		auto & renderer = this->graphicsRenderer();
+		auto & settings = this->primaryServices().settings();
+
+		const auto renderTarget = renderer.mainRenderTarget();
+
+		for ( const auto & renderableInstance : m_renderableInstances )
+		{
+			const auto layerCount = renderableInstance->renderable()->layerCount();
+
+			for ( uint32_t layerIndex = 0; layerIndex < layerCount; ++layerIndex )
+			{
+				/* NOTE: Same generator setup as RenderableInstance::Abstract::generateRenderPrograms(), none of these materials use the environment cubemap. */
+				const auto generateRendering = [&] (RenderPassType renderPassType) {
+					Saphir::Generator::SceneRendering generator{ClassId, renderTarget, renderableInstance, layerIndex, *m_scene, renderPassType, settings};
+
+					if ( renderableInstance->isLightingEnabled() && renderer.bindlessTextureManager().usable() )
+					{
+						generator.enableBindlessTextures(true);
+					}
+
+					generate(generator, results, sources);
+				};
+
+				if ( renderableInstance->isLightingEnabled() )
+				{
+					for ( const auto renderPassType : LitRenderPassTypes )
+					{
+						generateRendering(renderPassType);
+					}
+				}
+				else
+				{
+					generateRendering(RenderPassType::SimplePass);
+				}
+
+				Saphir::Generator::ShadowCasting generator{renderTarget, renderableInstance, layerIndex};
+
+				generate(generator, results, sources);
+			}
+		}
+	}
+
+	CompileResults
+	Application::compileSet (const std::vector< ShaderSource > & sources) noexcept
+	{
+		auto & shaderManager = this->graphicsRenderer().shaderManager();
+
+		CompileResults results;
+
+		std::unordered_set< size_t > compiledHashes;
+		std::vector< uint32_t > binaryCode;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for ( const auto & source : sources )
+		{
+			/* NOTE: A shader shared by several programs is compiled once, like the shader module cache does. */
+			if ( !compiledHashes.emplace(source.hash).second )
+			{
+				continue;
+			}
+
+			binaryCode.clear();
+
+			if ( !shaderManager.compile(source.name, source.type, source.sourceCode, binaryCode) )
+			{
+				results.failures++;
+
+				continue;
+			}
+
+			results.shaders++;
+			results.binaryBytes += binaryCode.size() * sizeof(uint32_t);
+		}
+
+		results.durationNS = static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+
+		return results;
+	}
+
+	void
+	Application::runBenchmark () noexcept
+	{
+		uint64_t syntheticChecksum = 0;
+		uint64_t sceneChecksum = 0;
+
+		std::vector< ShaderSource > syntheticSources;
+		std::vector< ShaderSource > sceneSources;
+
+		const auto syntheticResults = measureGeneration(generateSyntheticSet, m_iterations, syntheticChecksum, &syntheticSources);
+
+		const auto sceneResults = measureGeneration([this] (Results & results, std::vector< ShaderSource > * sources) {
+			this->generateSceneSet(results, sources);
+		}, m_iterations, sceneChecksum, &sceneSources);
+
+		std::ostringstream report;
+		report << "[" "\n";
+		writeGenerationReport("synthetic", m_iterations, syntheticResults, syntheticChecksum, report);
+		report << "," "\n";
+		writeGenerationReport("scene", m_iterations, sceneResults, sceneChecksum, report);
+
+		uint64_t compileFailures = 0;
+
+		/* NOTE: The compilation is measured after the generations, never inside them. */
+		if ( this->graphicsRenderer().device() != nullptr && this->graphicsRenderer().shaderManager().usable() )
+		{
+			const auto syntheticCompile = this->compileSet(syntheticSources);
+			const auto sceneCompile = this->compileSet(sceneSources);
+
+			compileFailures = syntheticCompile.failures + sceneCompile.failures;
+
+			report << "," "\n";
+			writeCompileReport("synthetic", syntheticCompile, report);
+			report << "," "\n";
+			writeCompileReport("scene", sceneCompile, report);
+		}
+
+		report << "\n" "]" "\n";
+
+		if ( !writeOutput(report.str(), m_outputFilepath) )
+		{
+			this->stop(EXIT_FAILURE);
+
+			return;
+		}
+
+		this->stop(syntheticResults.failures + sceneResults.failures + compileFailures > 0 ? EXIT_FAILURE : EXIT_SUCCESS);
+	}
+}
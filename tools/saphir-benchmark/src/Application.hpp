@@ -0,0 +1,106 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/* Local inclusions for inheritances. */
+#include "Core.hpp"
+
+/* Local inclusions for usages. */
+#include "Scenes/Scene.hpp"
+#include "Report.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief The benchmark application. Boots the engine without window and audio, then measures the
+	 * GLSL generation of two program sets and writes the JSON report.
+	 *
+	 * - "synthetic" : every variant of MaterialVariantGenerator and the gizmo programs, no engine object involved.
+	 * - "scene" : the programs of real renderable instances of a scene, built with the generators used by
+	 *   the renderer. SceneRendering for every render pass type (LightGenerator for the light passes, with
+	 *   and without shadow maps and color projection) and ShadowCasting.
+	 *
+	 * @note The source code generation is measured first, see Saphir::Generator::Abstract::generateShadersCode().
+	 * The SPIR-V compilation of the generated sources is measured apart, once per unique shader, when a device is available.
+	 * @extends EmEn::Core The benchmark is an engine application.
+	 */
+	class Application final : public EmEn::Core
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"SaphirBenchmark"};
+
+			/**
+			 * @brief Constructs the benchmark application.
+			 * @param argc The argument count.
+			 * @param argv The argument values.
+			 */
+			Application (int argc, char * * argv) noexcept
+				: Core{argc, argv, ClassId, {1, 0, 0}, "EmeraudeEngine", "localhost"}
+			{
+
+			}
+
+		private:
+
+			/** @copydoc EmEn::Core::onCoreStarted() */
+			bool onCoreStarted (const EmEn::Arguments & arguments, EmEn::Settings & settings) noexcept override;
+
+			/** @copydoc EmEn::Core::onCoreProcessLogics() */
+			void onCoreProcessLogics (size_t engineCycle) noexcept override;
+
+			/**
+			 * @brief Creates the scene and its renderable instances.
+			 * @return bool
+			 */
+			bool buildScene () noexcept;
+
+			/**
+			 * @brief Releases the renderable instances and deletes the scene.
+			 * @return void
+			 */
+			void releaseScene () noexcept;
+
+			/**
+			 * @brief Returns whether every renderable of the scene is loaded.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool isSceneReady () const noexcept;
+
+			/**
+			 * @brief Generates the scene program set once.
+			 * @param results A reference to the results.
+			 * @param sources A pointer to a list receiving the generated sources. Can be null.
+			 * @return void
+			 */
+			void generateSceneSet (Results & results, std::vector< ShaderSource > * sources) noexcept;
+
+			/**
+			 * @brief Compiles each unique source of a set to SPIR-V once and measures it.
+			 * @note No shader cache is involved, see Saphir::ShaderManager::compile().
+			 * @param sources A reference to the sources of one pass of the set.
+			 * @return CompileResults
+			 */
+			[[nodiscard]]
+			CompileResults compileSet (const std::vector< ShaderSource > & sources) noexcept;
+
+			/**
+			 * @brief Runs every set, writes the report and stops the engine.
+			 * @return void
+			 */
+			void runBenchmark () noexcept;
+
+			std::shared_ptr< EmEn::Scenes::Scene > m_scene;
+			std::vector< std::shared_ptr< EmEn::Graphics::RenderableInstance::Abstract > > m_renderableInstances;
+			std::string m_outputFilepath;
+			uint32_t m_iterations{20};
+			uint32_t m_waitedCycles{0};
+			bool m_isFinished{false};
+	};
+}
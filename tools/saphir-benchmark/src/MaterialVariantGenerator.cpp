@@ -0,0 +1,309 @@
+#include "MaterialVariantGenerator.hpp"
+
+/* STL inclusions. */
+#include <string>
+
+/* Local inclusions. */
+#include "Graphics/Geometry/Helpers.hpp"
+#include "Saphir/Code.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn;
+	using namespace EmEn::Graphics;
+	using namespace EmEn::Saphir;
+	using namespace EmEn::Saphir::Keys;
+
+	/** @brief Material uniform block component names. */
+	static constexpr auto AlbedoColor{"albedoColor"};
+	static constexpr auto Roughness{"roughness"};
+	static constexpr auto AlphaThreshold{"alphaThreshold"};
+	static constexpr auto LightDirection{"lightDirection"};
+
+	/**
+	 * @brief Returns the geometry flags needed by a combination of features.
+	 * @param features The combination of features.
+	 * @return uint32_t
+	 */
+	static
+	uint32_t
+	geometryFlags (uint32_t features) noexcept
+	{
+		uint32_t flags = Geometry::None;
+
+		if ( (features & MaterialVariantGenerator::Lighting) != 0 )
+		{
+			flags |= (features & MaterialVariantGenerator::NormalTexture) != 0 ? Geometry::EnableTangentSpace : Geometry::EnableNormal;
+		}
+
+		if ( (features & (MaterialVariantGenerator::AlbedoTexture | MaterialVariantGenerator::NormalTexture | MaterialVariantGenerator::RoughnessTexture)) != 0 )
+		{
+			flags |= Geometry::EnablePrimaryTextureCoordinates;
+		}
+
+		if ( (features & MaterialVariantGenerator::VertexColor) != 0 )
+		{
+			flags |= Geometry::EnableVertexColor;
+		}
+
+		return flags;
+	}
+
+	MaterialVariantGenerator::MaterialVariantGenerator (uint32_t features) noexcept
+		: Abstract{"MaterialVariant" + std::to_string(features), nullptr, Topology::TriangleList, geometryFlags(features)},
+		m_features{features}
+	{
+
+	}
+
+	ProgramKey
+	MaterialVariantGenerator::computeProgramCacheKey () const noexcept
+	{
+		ProgramKeyBuilder key{ClassId};
+
+		this->addGeometryToKey(key);
+
+		key.add(m_features);
+
+		return key.key();
+	}
+
+	void
+	MaterialVariantGenerator::prepareUniformSets (SetIndexes & setIndexes) noexcept
+	{
+		setIndexes.enableSet(SetType::PerModelLayer);
+	}
+
+	bool
+	MaterialVariantGenerator::onGenerateShadersCode (Program & program) noexcept
+	{
+		if ( !this->generateVertexShader(program) )
+		{
+			return false;
+		}
+
+		return this->generateFragmentShader(program);
+	}
+
+	bool
+	MaterialVariantGenerator::onCreateDataLayouts (Renderer & /*renderer*/, const SetIndexes & /*setIndexes*/, Base::StaticVector< std::shared_ptr< Vulkan::DescriptorSetLayout >, 6 > & /*descriptorSetLayouts*/, Base::StaticVector< VkPushConstantRange, 4 > & /*pushConstantRanges*/) noexcept
+	{
+		/* NOTE: Never called, the benchmark stops after the code generation. */
+		return true;
+	}
+
+	bool
+	MaterialVariantGenerator::onGraphicsPipelineConfiguration (const Program & /*program*/, Vulkan::GraphicsPipeline & /*graphicsPipeline*/) noexcept
+	{
+		/* NOTE: Never called, the benchmark stops after the code generation. */
+		return true;
+	}
+
+	bool
+	MaterialVariantGenerator::generateVertexShader (Program & program) noexcept
+	{
+		auto * vertexShader = program.initVertexShader(this->name() + "VertexShader", false, false, false);
+		vertexShader->setExtensionBehavior("GL_ARB_separate_shader_objects", "enable");
+
+		Declaration::PushConstantBlock pushConstantBlock{PushConstant::Type::Matrices, PushConstant::Matrices};
+		pushConstantBlock.addMember(Declaration::VariableType::Matrix4, PushConstant::Component::ModelViewProjectionMatrix);
+		pushConstantBlock.addMember(Declaration::VariableType::Matrix4, PushConstant::Component::ModelMatrix);
+
+		if ( !vertexShader->declare(pushConstantBlock) )
+		{
+			return false;
+		}
+
+		if ( !vertexShader->declare(Declaration::InputAttribute{VertexAttributeType::Position}) )
+		{
+			return false;
+		}
+
+		Code{*vertexShader, Location::Output} << "gl_Position = " << MatrixPC(PushConstant::Component::ModelViewProjectionMatrix) << " * vec4(" << Attribute::Position << ", 1.0);";
+
+		if ( this->isTextured() )
+		{
+			if ( !vertexShader->declare(Declaration::InputAttribute{VertexAttributeType::Primary2DTextureCoordinates}) )
+			{
+				return false;
+			}
+
+			if ( !vertexShader->declare(Declaration::StageOutput{this->getNextShaderVariableLocation(), GLSL::FloatVector2, ShaderVariable::Primary2DTextureCoordinates, GLSL::Smooth}) )
+			{
+				return false;
+			}
+
+			Code{*vertexShader, Location::Output} << ShaderVariable::Primary2DTextureCoordinates << " = " << Attribute::Primary2DTextureCoordinates << ';';
+		}
+
+		if ( this->has(VertexColor) )
+		{
+			if ( !vertexShader->declare(Declaration::InputAttribute{VertexAttributeType::VertexColor}) )
+			{
+				return false;
+			}
+
+			if ( !vertexShader->declare(Declaration::StageOutput{this->getNextShaderVariableLocation(), GLSL::FloatVector4, ShaderVariable::PrimaryVertexColor, GLSL::Smooth}) )
+			{
+				return false;
+			}
+
+			Code{*vertexShader, Location::Output} << ShaderVariable::PrimaryVertexColor << " = " << Attribute::Color << ';';
+		}
+
+		if ( this->has(Lighting) )
+		{
+			if ( !vertexShader->declare(Declaration::InputAttribute{VertexAttributeType::Normal}) )
+			{
+				return false;
+			}
+
+			if ( !vertexShader->declare(Declaration::StageOutput{this->getNextShaderVariableLocation(), GLSL::FloatVector3, ShaderVariable::NormalWorldSpace, GLSL::Smooth}) )
+			{
+				return false;
+			}
+
+			Code{*vertexShader, Location::Output} <<
+				"const mat3 normalMatrix = mat3(" << MatrixPC(PushConstant::Component::ModelMatrix) << ");" << Line::End <<
+				ShaderVariable::NormalWorldSpace << " = normalize(normalMatrix * " << Attribute::Normal << ");";
+
+			if ( this->has(NormalTexture) )
+			{
+				if ( !vertexShader->declare(Declaration::InputAttribute{VertexAttributeType::Tangent}) )
+				{
+					return false;
+				}
+
+				if ( !vertexShader->declare(Declaration::StageOutput{this->getNextShaderVariableLocation(), GLSL::FloatVector3, ShaderVariable::TangentWorldSpace, GLSL::Smooth}) )
+				{
+					return false;
+				}
+
+				Code{*vertexShader, Location::Output} << ShaderVariable::TangentWorldSpace << " = normalize(normalMatrix * " << Attribute::Tangent << ");";
+			}
+		}
+
+		return vertexShader->generateSourceCode(*this);
+	}
+
+	bool
+	MaterialVariantGenerator::generateFragmentShader (Program & program) noexcept
+	{
+		auto * fragmentShader = program.initFragmentShader(this->name() + "FragmentShader");
+		fragmentShader->setExtensionBehavior("GL_ARB_separate_shader_objects", "enable");
+
+		if ( !fragmentShader->connectFromPreviousShader(*program.vertexShader()) )
+		{
+			return false;
+		}
+
+		const auto materialSet = program.setIndex(SetType::PerModelLayer);
+		uint32_t binding = 0;
+
+		Declaration::UniformBlock uniformBlock{materialSet, binding++, Declaration::MemoryLayout::Std140, UniformBlock::Type::PBRMaterial, UniformBlock::Material};
+		uniformBlock.addMember(Declaration::VariableType::FloatVector4, AlbedoColor);
+		uniformBlock.addMember(Declaration::VariableType::FloatVector4, LightDirection);
+		uniformBlock.addMember(Declaration::VariableType::Float, Roughness);
+		uniformBlock.addMember(Declaration::VariableType::Float, AlphaThreshold);
+
+		if ( !fragmentShader->declare(uniformBlock) )
+		{
+			return false;
+		}
+
+		if ( !fragmentShader->declareDefaultOutputFragment() )
+		{
+			return false;
+		}
+
+		Code{*fragmentShader, Location::Top} << "vec4 albedo = " << MaterialUB(AlbedoColor) << ';';
+
+		if ( this->has(AlbedoTexture) )
+		{
+			if ( !fragmentShader->declare(Declaration::Sampler{materialSet, binding++, GLSL::Sampler2D, Uniform::AlbedoSampler}) )
+			{
+				return false;
+			}
+
+			Code{*fragmentShader} << "albedo *= texture(" << Uniform::AlbedoSampler << ", " << ShaderVariable::Primary2DTextureCoordinates << ");";
+		}
+
+		if ( this->has(VertexColor) )
+		{
+			Code{*fragmentShader} << "albedo *= " << ShaderVariable::PrimaryVertexColor << ';';
+		}
+
+		if ( this->has(AlphaTest) )
+		{
+			Code{*fragmentShader} <<
+				"if ( albedo.a < " << MaterialUB(AlphaThreshold) << " )" << Line::End <<
+				'{' << Line::End <<
+				'\t' << GLSL::Discard << ';' << Line::End <<
+				'}';
+		}
+
+		if ( this->has(Lighting) )
+		{
+			Code{*fragmentShader} << "vec3 normal = normalize(" << ShaderVariable::NormalWorldSpace << ");";
+
+			if ( this->has(NormalTexture) )
+			{
+				if ( !fragmentShader->declare(Declaration::Sampler{materialSet, binding++, GLSL::Sampler2D, Uniform::NormalSampler}) )
+				{
+					return false;
+				}
+
+				Code{*fragmentShader} <<
+					"const vec3 tangent = normalize(" << ShaderVariable::TangentWorldSpace << " - dot(" << ShaderVariable::TangentWorldSpace << ", normal) * normal);" << Line::End <<
+					"const mat3 TBN = mat3(tangent, cross(normal, tangent), normal);" << Line::End <<
+					"normal = normalize(TBN * (texture(" << Uniform::NormalSampler << ", " << ShaderVariable::Primary2DTextureCoordinates << ").xyz * 2.0 - 1.0));";
+			}
+
+			Code{*fragmentShader} << "float roughness = " << MaterialUB(Roughness) << ';';
+
+			if ( this->has(RoughnessTexture) )
+			{
+				if ( !fragmentShader->declare(Declaration::Sampler{materialSet, binding++, GLSL::Sampler2D, Uniform::RoughnessSampler}) )
+				{
+					return false;
+				}
+
+				Code{*fragmentShader} << "roughness *= texture(" << Uniform::RoughnessSampler << ", " << ShaderVariable::Primary2DTextureCoordinates << ").g;";
+			}
+
+			Code{*fragmentShader} <<
+				"const vec3 lightDirection = normalize(-" << MaterialUB(LightDirection) << ".xyz);" << Line::End <<
+				"const float diffuse = max(dot(normal, lightDirection), 0.0);" << Line::End <<
+				"const float shininess = mix(256.0, 2.0, clamp(roughness, 0.0, 1.0));" << Line::End <<
+				"const float specular = pow(max(dot(reflect(-lightDirection, normal), vec3(0.0, 0.0, 1.0)), 0.0), shininess);" << Line::End <<
+				"albedo.rgb = albedo.rgb * (" << 0.08F << " + diffuse) + vec3(specular * (1.0 - roughness));";
+		}
+		else if ( this->has(NormalTexture) || this->has(RoughnessTexture) )
+		{
+			/* NOTE: Without lighting these textures only tint the output, the variant still declares and samples them. */
+			if ( this->has(NormalTexture) )
+			{
+				if ( !fragmentShader->declare(Declaration::Sampler{materialSet, binding++, GLSL::Sampler2D, Uniform::NormalSampler}) )
+				{
+					return false;
+				}
+
+				Code{*fragmentShader} << "albedo.rgb *= texture(" << Uniform::NormalSampler << ", " << ShaderVariable::Primary2DTextureCoordinates << ").z;";
+			}
+
+			if ( this->has(RoughnessTexture) )
+			{
+				if ( !fragmentShader->declare(Declaration::Sampler{materialSet, binding++, GLSL::Sampler2D, Uniform::RoughnessSampler}) )
+				{
+					return false;
+				}
+
+				Code{*fragmentShader} << "albedo.rgb *= 1.0 - texture(" << Uniform::RoughnessSampler << ", " << ShaderVariable::Primary2DTextureCoordinates << ").g * " << 0.5F << ';';
+			}
+		}
+
+		Code{*fragmentShader, Location::Output} << ShaderVariable::OutputFragment << " = albedo;";
+
+		return fragmentShader->generateSourceCode(*this);
+	}
+}
@@ -0,0 +1,109 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstdint>
+
+/* Local inclusions for inheritances. */
+#include "Saphir/Generator/Abstract.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief A program generator for a synthetic material, one program per combination of features.
+	 *
+	 * The generator declares its own uniform block, samplers and stage variables and writes its
+	 * code with Saphir::Code, like the scene generators do. It needs no render target, no material
+	 * resource and no device, so the whole set can be generated from a command line tool.
+	 *
+	 * @note Only the source code generation runs, see Saphir::Generator::Abstract::generateShadersCode().
+	 */
+	class MaterialVariantGenerator final : public EmEn::Saphir::Generator::Abstract
+	{
+		public:
+
+			/** @brief Class identifier. */
+			static constexpr auto ClassId{"MaterialVariantGenerator"};
+
+			/** @brief The material features, combined into a variant. */
+			enum Feature : uint32_t
+			{
+				AlbedoTexture = 1U << 0,
+				NormalTexture = 1U << 1,
+				RoughnessTexture = 1U << 2,
+				VertexColor = 1U << 3,
+				Lighting = 1U << 4,
+				AlphaTest = 1U << 5
+			};
+
+			/** @brief The number of variants, every combination of features. */
+			static constexpr uint32_t VariantCount{1U << 6};
+
+			/**
+			 * @brief Constructs a material variant generator.
+			 * @param features The combination of features.
+			 */
+			explicit MaterialVariantGenerator (uint32_t features) noexcept;
+
+			/** @copydoc EmEn::Saphir::Generator::Abstract::computeProgramCacheKey() */
+			[[nodiscard]]
+			EmEn::Saphir::ProgramKey computeProgramCacheKey () const noexcept override;
+
+		private:
+
+			/** @copydoc EmEn::Saphir::Generator::Abstract::prepareUniformSets() */
+			void prepareUniformSets (EmEn::Saphir::SetIndexes & setIndexes) noexcept override;
+
+			/** @copydoc EmEn::Saphir::Generator::Abstract::onGenerateShadersCode() */
+			[[nodiscard]]
+			bool onGenerateShadersCode (EmEn::Saphir::Program & program) noexcept override;
+
+			/** @copydoc EmEn::Saphir::Generator::Abstract::onCreateDataLayouts() */
+			[[nodiscard]]
+			bool onCreateDataLayouts (EmEn::Graphics::Renderer & renderer, const EmEn::Saphir::SetIndexes & setIndexes, EmEn::Base::StaticVector< std::shared_ptr< EmEn::Vulkan::DescriptorSetLayout >, 6 > & descriptorSetLayouts, EmEn::Base::StaticVector< VkPushConstantRange, 4 > & pushConstantRanges) noexcept override;
+
+			/** @copydoc EmEn::Saphir::Generator::Abstract::onGraphicsPipelineConfiguration() */
+			[[nodiscard]]
+			bool onGraphicsPipelineConfiguration (const EmEn::Saphir::Program & program, EmEn::Vulkan::GraphicsPipeline & graphicsPipeline) noexcept override;
+
+			/**
+			 * @brief Generates the vertex shader.
+			 * @param program A reference to the program.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool generateVertexShader (EmEn::Saphir::Program & program) noexcept;
+
+			/**
+			 * @brief Generates the fragment shader.
+			 * @param program A reference to the program.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool generateFragmentShader (EmEn::Saphir::Program & program) noexcept;
+
+			/**
+			 * @brief Returns whether a feature is part of the variant.
+			 * @param feature The feature.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			has (Feature feature) const noexcept
+			{
+				return (m_features & feature) != 0;
+			}
+
+			/**
+			 * @brief Returns whether the variant samples a texture.
+			 * @return bool
+			 */
+			[[nodiscard]]
+			bool
+			isTextured () const noexcept
+			{
+				return (m_features & (AlbedoTexture | NormalTexture | RoughnessTexture)) != 0;
+			}
+
+			uint32_t m_features;
+	};
+}
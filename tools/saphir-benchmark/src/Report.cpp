@@ -0,0 +1,172 @@
+#include "Report.hpp"
+
+/* STL inclusions. */
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+/* Local inclusions. */
+#include "Graphics/Geometry/Helpers.hpp"
+#include "Saphir/Generator/GizmoRendering.hpp"
+#include "MaterialVariantGenerator.hpp"
+
+namespace Benchmark
+{
+	using namespace EmEn;
+
+	void
+	generate (Saphir::Generator::Abstract & generator, Results & results, std::vector< ShaderSource > * sources) noexcept
+	{
+		if ( !generator.generateShadersCode() )
+		{
+			results.failures++;
+
+			return;
+		}
+
+		results.programs++;
+
+		for ( const auto * shader : generator.shaderProgram()->getShaderList() )
+		{
+			results.shaders++;
+			results.sourceBytes += shader->sourceCode().size();
+
+			/* NOTE: Order independent, the same set of programs gives the same checksum. */
+			results.checksum ^= shader->hash();
+
+			if ( sources != nullptr )
+			{
+				sources->emplace_back(ShaderSource{shader->name(), shader->sourceCode(), shader->hash(), shader->type()});
+			}
+		}
+	}
+
+	void
+	generateSyntheticSet (Results & results, std::vector< ShaderSource > * sources) noexcept
+	{
+		for ( uint32_t features = 0; features < MaterialVariantGenerator::VariantCount; ++features )
+		{
+			MaterialVariantGenerator generator{features};
+
+			generate(generator, results, sources);
+		}
+
+		for ( const auto topology : {Graphics::Topology::TriangleList, Graphics::Topology::LineLine, Graphics::Topology::PointList} )
+		{
+			Saphir::Generator::GizmoRendering generator{nullptr, topology, Graphics::Geometry::EnableVertexColor};
+
+			generate(generator, results, sources);
+		}
+	}
+
+	Results
+	measureGeneration (const SetGenerator & generateSet, uint32_t iterations, uint64_t & checksum, std::vector< ShaderSource > * sources) noexcept
+	{
+		Results warmUp;
+
+		generateSet(warmUp, sources);
+
+		checksum = warmUp.checksum;
+
+		Results results;
+		results.failures = warmUp.failures;
+
+		const auto start = std::chrono::steady_clock::now();
+
+		for ( uint32_t iteration = 0; iteration < iterations; ++iteration )
+		{
+			generateSet(results, nullptr);
+		}
+
+		results.durationNS = static_cast< uint64_t >(std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count());
+
+		return results;
+	}
+
+	void
+	writeGenerationReport (const char * name, uint32_t iterations, const Results & results, uint64_t checksum, std::ostream & output) noexcept
+	{
+		const auto totalSeconds = static_cast< double >(results.durationNS) / 1000000000.0;
+
+		std::ostringstream hexChecksum;
+		hexChecksum << std::hex << checksum;
+
+		output <<
+			"\t{" "\n"
+			"\t\t\"set\": \"" << name << "\"," "\n"
+			"\t\t\"stage\": \"generation\"," "\n"
+			"\t\t\"iterations\": " << iterations << "," "\n"
+			"\t\t\"programs\": " << results.programs << "," "\n"
+			"\t\t\"shaders\": " << results.shaders << "," "\n"
+			"\t\t\"failures\": " << results.failures << "," "\n"
+			"\t\t\"sourceBytes\": " << results.sourceBytes << "," "\n"
+			"\t\t\"totalMS\": " << static_cast< double >(results.durationNS) / 1000000.0 << "," "\n"
+			"\t\t\"programsPerSecond\": " << (totalSeconds > 0.0 ? static_cast< double >(results.programs) / totalSeconds : 0.0) << "," "\n"
+			"\t\t\"checksum\": \"" << hexChecksum.str() << "\"" "\n"
+			"\t}";
+	}
+
+	void
+	writeCompileReport (const char * name, const CompileResults & results, std::ostream & output) noexcept
+	{
+		const auto totalSeconds = static_cast< double >(results.durationNS) / 1000000000.0;
+
+		output <<
+			"\t{" "\n"
+			"\t\t\"set\": \"" << name << "\"," "\n"
+			"\t\t\"stage\": \"compilation\"," "\n"
+			"\t\t\"shaders\": " << results.shaders << "," "\n"
+			"\t\t\"failures\": " << results.failures << "," "\n"
+			"\t\t\"binaryBytes\": " << results.binaryBytes << "," "\n"
+			"\t\t\"totalMS\": " << static_cast< double >(results.durationNS) / 1000000.0 << "," "\n"
+			"\t\t\"shadersPerSecond\": " << (totalSeconds > 0.0 ? static_cast< double >(results.shaders) / totalSeconds : 0.0) << "\n"
+			"\t}";
+	}
+
+	bool
+	writeOutput (const std::string & report, const std::string & outputFilepath) noexcept
+	{
+		if ( outputFilepath.empty() )
+		{
+			std::cout << report;
+
+			return true;
+		}
+
+		std::ofstream file{outputFilepath, std::ios::trunc};
+
+		if ( !file.is_open() )
+		{
+			std::cerr << "Unable to write '" << outputFilepath << "' !" "\n";
+
+			return false;
+		}
+
+		file << report;
+
+		return true;
+	}
+
+	bool
+	writeDeviceLessReport (const Arguments & arguments) noexcept
+	{
+		const auto iterations = static_cast< uint32_t >(std::stoul(arguments.get("--iterations").value_or("20")));
+
+		uint64_t checksum = 0;
+
+		const auto results = measureGeneration(generateSyntheticSet, iterations, checksum, nullptr);
+
+		std::ostringstream report;
+		report << "[" "\n";
+		writeGenerationReport("synthetic", iterations, results, checksum, report);
+		report << "\n" "]" "\n";
+
+		if ( !writeOutput(report.str(), arguments.get("--output").value_or("")) )
+		{
+			return false;
+		}
+
+		return results.failures == 0;
+	}
+}
@@ -0,0 +1,124 @@
+#pragma once
+
+/* STL inclusions. */
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/* Local inclusions for usages. */
+#include "Arguments.hpp"
+#include "Saphir/Generator/Abstract.hpp"
+#include "Saphir/Types.hpp"
+
+namespace Benchmark
+{
+	/**
+	 * @brief Accumulated results of the generations.
+	 */
+	struct Results
+	{
+		uint64_t programs{0};
+		uint64_t shaders{0};
+		uint64_t sourceBytes{0};
+		uint64_t failures{0};
+		uint64_t checksum{0};
+		uint64_t durationNS{0};
+	};
+
+	/**
+	 * @brief Accumulated results of the SPIR-V compilations.
+	 */
+	struct CompileResults
+	{
+		uint64_t shaders{0};
+		uint64_t binaryBytes{0};
+		uint64_t failures{0};
+		uint64_t durationNS{0};
+	};
+
+	/**
+	 * @brief A generated shader source, kept to be compiled after the generation is measured.
+	 */
+	struct ShaderSource
+	{
+		std::string name;
+		std::string sourceCode;
+		size_t hash{0};
+		EmEn::Saphir::ShaderType type{EmEn::Saphir::ShaderType::Undefined};
+	};
+
+	/** @brief A function generating a program set once, collecting the sources when the list is not null. */
+	using SetGenerator = std::function< void (Results & results, std::vector< ShaderSource > * sources) >;
+
+	/**
+	 * @brief Generates the code of a program and accumulates the results.
+	 * @param generator A reference to a program generator.
+	 * @param results A reference to the results.
+	 * @param sources A pointer to a list receiving the generated sources. Can be null.
+	 * @return void
+	 */
+	void generate (EmEn::Saphir::Generator::Abstract & generator, Results & results, std::vector< ShaderSource > * sources) noexcept;
+
+	/**
+	 * @brief Generates the synthetic program set once: every material variant and the gizmo programs.
+	 * @note Only Saphir generators and code buffers are involved, no engine service nor device.
+	 * @param results A reference to the results.
+	 * @param sources A pointer to a list receiving the generated sources. Can be null.
+	 * @return void
+	 */
+	void generateSyntheticSet (Results & results, std::vector< ShaderSource > * sources) noexcept;
+
+	/**
+	 * @brief Measures the generation of a program set.
+	 * @note A first pass warms the allocator and the code buffer pools, it is not measured.
+	 * It gives the checksum of the set and the sources, the measured passes repeat the same set.
+	 * @param generateSet A reference to the set generator.
+	 * @param iterations The number of measured passes.
+	 * @param checksum A reference to the checksum of one pass.
+	 * @param sources A pointer to a list receiving the sources of one pass. Can be null.
+	 * @return Results
+	 */
+	[[nodiscard]]
+	Results measureGeneration (const SetGenerator & generateSet, uint32_t iterations, uint64_t & checksum, std::vector< ShaderSource > * sources) noexcept;
+
+	/**
+	 * @brief Writes the JSON report of a program set generation.
+	 * @param name The set name.
+	 * @param iterations The number of measured iterations.
+	 * @param results A reference to the measured results.
+	 * @param checksum The checksum of one pass.
+	 * @param output A reference to the output stream.
+	 * @return void
+	 */
+	void writeGenerationReport (const char * name, uint32_t iterations, const Results & results, uint64_t checksum, std::ostream & output) noexcept;
+
+	/**
+	 * @brief Writes the JSON report of a program set compilation.
+	 * @param name The set name.
+	 * @param results A reference to the measured results.
+	 * @param output A reference to the output stream.
+	 * @return void
+	 */
+	void writeCompileReport (const char * name, const CompileResults & results, std::ostream & output) noexcept;
+
+	/**
+	 * @brief Writes a report to a file, or to the standard output when the path is empty.
+	 * @param report A reference to the report.
+	 * @param outputFilepath A reference to the output path.
+	 * @return bool
+	 */
+	[[nodiscard]]
+	bool writeOutput (const std::string & report, const std::string & outputFilepath) noexcept;
+
+	/**
+	 * @brief Measures the synthetic set without starting the engine and writes the JSON report.
+	 * @note Reads --iterations and --output. Nothing is compiled, no device is needed.
+	 * @param arguments A reference to the command line arguments.
+	 * @return bool
+	 */
+	[[nodiscard]]
+	bool writeDeviceLessReport (const EmEn::Arguments & arguments) noexcept;
+}
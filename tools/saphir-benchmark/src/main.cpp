@@ -0,0 +1,62 @@
+/* STL inclusions. */
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+/* Local inclusions. */
+#include "Application.hpp"
+#include "Report.hpp"
+
+int
+main (int argc, char * * argv)
+{
+	std::vector< char * > engineArguments{argv, argv + argc};
+
+	bool deviceLess = false;
+
+	for ( int index = 1; index < argc; ++index )
+	{
+		if ( std::strcmp(argv[index], "--help") == 0 || std::strcmp(argv[index], "-h") == 0 )
+		{
+			std::cout <<
+				"Usage : SaphirBenchmark [--iterations={count}] [--output={filepath}] [--no-device]" "\n"
+				"Generates the GLSL code of the synthetic program set (material variants and gizmos) and of the scene program set" "\n"
+				"(scene rendering for every render pass type, light passes with and without shadow maps, and shadow casting)," "\n"
+				"then compiles each unique generated shader to SPIR-V once. Generation and compilation are reported apart." "\n"
+				"Iterations default to 20. The engine boots without window and audio, a Vulkan device is still required." "\n"
+				"With --no-device, the engine is not started: only the synthetic set generation is measured (headless CI)." "\n";
+
+			return EXIT_SUCCESS;
+		}
+
+		if ( std::strcmp(argv[index], "--no-device") == 0 )
+		{
+			deviceLess = true;
+		}
+	}
+
+	if ( deviceLess )
+	{
+		EmEn::Arguments arguments{argc, argv, false};
+
+		if ( !arguments.initialize() )
+		{
+			return EXIT_FAILURE;
+		}
+
+		return Benchmark::writeDeviceLessReport(arguments) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	/* NOTE: The scene programs are generated from real renderable instances, the engine is started without window nor audio. */
+	static char windowLess[] = "--window-less";
+	static char disableAudio[] = "--disable-audio";
+
+	engineArguments.emplace_back(windowLess);
+	engineArguments.emplace_back(disableAudio);
+	engineArguments.emplace_back(nullptr);
+
+	Benchmark::Application application{static_cast< int >(engineArguments.size() - 1), engineArguments.data()};
+
+	return application.run();
+}
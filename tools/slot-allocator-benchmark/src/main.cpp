@@ -0,0 +1,287 @@
+/* STL inclusions. */
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* Local inclusions. */
+#include "Arguments.hpp"
+#include "Graphics/SlotAllocator.hpp"
+
+using namespace EmEn;
+
+/**
+ * @brief The seat table SharedUniformBuffer used before the bitmap: a linear scan under a mutex.
+ */
+class LinearSeats final
+{
+	public:
+
+		explicit
+		LinearSeats (uint32_t capacity) noexcept
+			: m_seats(capacity, nullptr)
+		{
+
+		}
+
+		std::optional< uint32_t >
+		allocate (const void * element) noexcept
+		{
+			const std::lock_guard< std::mutex > lock{m_access};
+
+			for ( uint32_t index = 0; index < m_seats.size(); ++index )
+			{
+				if ( m_seats[index] == nullptr )
+				{
+					m_seats[index] = element;
+
+					return index;
+				}
+			}
+
+			return std::nullopt;
+		}
+
+		void
+		release (const void * element) noexcept
+		{
+			const std::lock_guard< std::mutex > lock{m_access};
+
+			const auto seatIt = std::ranges::find(m_seats, element);
+
+			if ( seatIt != m_seats.end() )
+			{
+				*seatIt = nullptr;
+			}
+		}
+
+	private:
+
+		std::vector< const void * > m_seats;
+		std::mutex m_access;
+};
+
+/**
+ * @brief The churn of one worker: the live elements and the random victims.
+ */
+struct Churn
+{
+	std::vector< uint32_t > live;
+	std::vector< uint32_t > victims;
+};
+
+/**
+ * @brief Prepares the churn of a worker.
+ * @param liveCount The number of live elements of the worker.
+ * @param operations The number of release/allocate pairs.
+ * @param seed The random seed.
+ * @return Churn
+ */
+Churn
+prepareChurn (uint32_t liveCount, uint32_t operations, uint32_t seed) noexcept
+{
+	Churn churn;
+	churn.live.reserve(liveCount);
+	churn.victims.reserve(operations);
+
+	std::mt19937 generator{seed};
+	std::uniform_int_distribution< uint32_t > distribution{0, liveCount - 1};
+
+	for ( uint32_t operation = 0; operation < operations; ++operation )
+	{
+		churn.victims.emplace_back(distribution(generator));
+	}
+
+	return churn;
+}
+
+/**
+ * @brief Measures a churn run and returns the elapsed nanoseconds.
+ * @param threadCount The number of worker threads.
+ * @param function A reference to the worker function, receiving the worker index.
+ * @return int64_t
+ */
+template< typename function_t >
+int64_t
+measure (uint32_t threadCount, const function_t & function) noexcept
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	if ( threadCount <= 1 )
+	{
+		function(0U);
+	}
+	else
+	{
+		std::vector< std::thread > workers;
+		workers.reserve(threadCount);
+
+		for ( uint32_t worker = 0; worker < threadCount; ++worker )
+		{
+			workers.emplace_back(function, worker);
+		}
+
+		for ( auto & thread : workers )
+		{
+			thread.join();
+		}
+	}
+
+	return std::chrono::duration_cast< std::chrono::nanoseconds >(std::chrono::steady_clock::now() - start).count();
+}
+
+int
+main (int argc, char * * argv)
+{
+	Arguments arguments{argc, argv, false};
+	arguments.initialize();
+
+	if ( arguments.get("--help", "-h") )
+	{
+		std::cout <<
+			"Usage : SlotAllocatorBenchmark [--slots={count}] [--operations={count}] [--threads={count}] [--output={filepath}]" "\n"
+			"Fills 90% of the slots, then releases and allocates random elements, slots default to 100000," "\n"
+			"operations to 100000 per thread and threads to 4." "\n"
+			"The linear scan baseline runs on one thread, for 10000 operations at most." "\n";
+
+		return EXIT_SUCCESS;
+	}
+
+	const auto slots = static_cast< uint32_t >(std::stoul(arguments.get("--slots").value_or("100000")));
+	const auto operations = static_cast< uint32_t >(std::stoul(arguments.get("--operations").value_or("100000")));
+	const auto threadCount = std::max(static_cast< uint32_t >(std::stoul(arguments.get("--threads").value_or("4"))), 1U);
+
+	const auto liveCount = std::max(slots / 10 * 9 / threadCount, 1U);
+	uint64_t failures = 0;
+
+	/* NOTE: The element identity only matters to the linear baseline, which releases by pointer. */
+	const auto elementOf = [] (uint32_t worker, uint32_t index) {
+		return reinterpret_cast< const void * >((static_cast< uintptr_t >(worker) << 32U) | (static_cast< uintptr_t >(index) + 1));
+	};
+
+	/* 1. Baseline, one thread. NOTE: Capped, each pair scans the whole table. */
+	const auto linearOperations = std::min(operations, 10000U);
+
+	LinearSeats linearSeats{slots};
+	auto linearChurn = prepareChurn(liveCount * threadCount, linearOperations, 1);
+
+	for ( uint32_t index = 0; index < liveCount * threadCount; ++index )
+	{
+		linearChurn.live.emplace_back(index);
+
+		failures += linearSeats.allocate(elementOf(0, index)) ? 0 : 1;
+	}
+
+	const auto linearNS = measure(1, [&] (uint32_t) {
+		uint32_t nextElement = liveCount * threadCount;
+
+		for ( const auto victim : linearChurn.victims )
+		{
+			linearSeats.release(elementOf(0, linearChurn.live[victim]));
+
+			linearChurn.live[victim] = nextElement;
+
+			failures += linearSeats.allocate(elementOf(0, nextElement++)) ? 0 : 1;
+		}
+	});
+
+	/* 2. Bitmap, one thread then every thread. */
+	const auto bitmapRun = [&] (uint32_t workerCount) {
+		Graphics::SlotAllocator allocator{slots};
+		std::vector< Churn > churns;
+
+		for ( uint32_t worker = 0; worker < workerCount; ++worker )
+		{
+			auto & churn = churns.emplace_back(prepareChurn(liveCount, operations, worker + 1));
+
+			for ( uint32_t index = 0; index < liveCount; ++index )
+			{
+				churn.live.emplace_back(allocator.allocate().value_or(0));
+			}
+		}
+
+		std::vector< uint64_t > workerFailures(workerCount, 0);
+
+		const auto totalNS = measure(workerCount, [&] (uint32_t worker) {
+			auto & churn = churns[worker];
+
+			for ( const auto victim : churn.victims )
+			{
+				allocator.release(churn.live[victim]);
+
+				if ( const auto slot = allocator.allocate() )
+				{
+					churn.live[victim] = *slot;
+				}
+				else
+				{
+					workerFailures[worker]++;
+				}
+			}
+		});
+
+		for ( const auto count : workerFailures )
+		{
+			failures += count;
+		}
+
+		return totalNS;
+	};
+
+	const auto bitmapNS = bitmapRun(1);
+	const auto bitmapThreadedNS = bitmapRun(threadCount);
+
+	const auto toMS = [] (int64_t nanoseconds) {
+		return static_cast< double >(nanoseconds) / 1000000.0;
+	};
+
+	const auto perSecond = [] (uint64_t count, int64_t nanoseconds) {
+		return nanoseconds > 0 ? static_cast< double >(count) * 1000000000.0 / static_cast< double >(nanoseconds) : 0.0;
+	};
+
+	std::ostringstream report;
+	report <<
+		"{" "\n"
+		"\t\"slots\": " << slots << "," "\n"
+		"\t\"liveElements\": " << liveCount * threadCount << "," "\n"
+		"\t\"operations\": " << operations << "," "\n"
+		"\t\"threads\": " << threadCount << "," "\n"
+		"\t\"failures\": " << failures << "," "\n"
+		"\t\"linearScanOperations\": " << linearOperations << "," "\n"
+		"\t\"linearScanMS\": " << toMS(linearNS) << "," "\n"
+		"\t\"linearScanPairsPerSecond\": " << perSecond(linearOperations, linearNS) << "," "\n"
+		"\t\"bitmapMS\": " << toMS(bitmapNS) << "," "\n"
+		"\t\"bitmapPairsPerSecond\": " << perSecond(operations, bitmapNS) << "," "\n"
+		"\t\"bitmapThreadedMS\": " << toMS(bitmapThreadedNS) << "," "\n"
+		"\t\"bitmapThreadedPairsPerSecond\": " << perSecond(static_cast< uint64_t >(operations) * threadCount, bitmapThreadedNS) << "\n"
+		"}" "\n";
+
+	if ( const auto outputFilepath = arguments.get("--output") )
+	{
+		std::ofstream file{*outputFilepath, std::ios::trunc};
+
+		if ( !file.is_open() )
+		{
+			std::cerr << "Unable to write '" << *outputFilepath << "' !" "\n";
+
+			return EXIT_FAILURE;
+		}
+
+		file << report.str();
+	}
+	else
+	{
+		std::cout << report.str();
+	}
+
+	return failures > 0 ? EXIT_FAILURE : EXIT_SUCCESS;
+}